@@ -43,6 +43,7 @@ class NodeBindingExtension : public iox::runtime::Node
     void destroy()
     {
         m_data->m_toBeDestroyed.store(true, std::memory_order_relaxed);
+        m_data->m_discoveryNotifier.notify();
     }
 };
 
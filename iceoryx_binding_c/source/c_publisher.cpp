@@ -111,6 +111,7 @@ void iox_pub_deinit(iox_pub_t const self)
     iox::cxx::Expects(self != nullptr);
 
     self->m_portData->m_toBeDestroyed.store(true, std::memory_order_relaxed);
+    self->m_portData->m_discoveryNotifier.notify();
     delete self;
 }
 
@@ -80,7 +80,9 @@ class iox_server_test : public Test
 
     void connectClient()
     {
-        sutPort->m_chunkSenderData.m_queues.emplace_back(&clientResponseQueueData);
+        using ChunkDistributor_t = iox::popo::ChunkDistributor<iox::popo::ServerChunkDistributorData_t>;
+        ChunkDistributor_t chunkDistributor(&sutPort->m_chunkSenderData);
+        EXPECT_FALSE(chunkDistributor.tryAddQueue(&clientResponseQueueData).has_error());
     }
 
     void prepareServerInit(const ServerOptions& options = ServerOptions())
@@ -16,44 +16,83 @@
 // SPDX-License-Identifier: Apache-2.0
 #include "base.hpp"
 
+#include <vector>
 
-void IcePerfBase::preLatencyPerfTestLeader(const uint32_t payloadSizeInBytes) noexcept
+void IcePerfBase::releaseFollower() noexcept
 {
-    sendPerfTopic(payloadSizeInBytes, RunFlag::RUN);
+    sendPerfTopic(sizeof(PerfTopic), RunFlag::STOP, PerfTopic::NO_REPLY);
 }
 
-void IcePerfBase::postLatencyPerfTestLeader() noexcept
+LatencyStatistics IcePerfBase::latencyPerfTestLeader(const uint32_t payloadSizeInBytes,
+                                                     const uint64_t numRoundTrips,
+                                                     const uint32_t numberOfFollowers) noexcept
 {
-    // Wait for the last response
-    receivePerfTopic();
-}
+    std::vector<uint64_t> roundTripsInNanoseconds;
+    roundTripsInNanoseconds.reserve(numRoundTrips);
 
-void IcePerfBase::releaseFollower() noexcept
-{
-    sendPerfTopic(sizeof(PerfTopic), RunFlag::STOP);
+    // with a fan-out every follower would hold an echo of the full payload, which quickly drains the mempool of the
+    // large payloads; the leader therefore waits for small acknowledgements instead
+    const uint32_t replyPayloadSize =
+        (numberOfFollowers > 1U) ? static_cast<uint32_t>(sizeof(PerfTopic)) : payloadSizeInBytes;
+
+    // run the performance test
+    for (auto i = 0U; i < numRoundTrips; ++i)
+    {
+        auto start = std::chrono::steady_clock::now();
+
+        sendPerfTopic(payloadSizeInBytes, RunFlag::RUN, replyPayloadSize);
+        for (auto follower = 0U; follower < numberOfFollowers; ++follower)
+        {
+            receivePerfTopic();
+        }
+
+        auto finish = std::chrono::steady_clock::now();
+        auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(finish - start);
+        roundTripsInNanoseconds.push_back(static_cast<uint64_t>(duration.count()));
+    }
+
+    return LatencyStatistics::fromRoundTrips(roundTripsInNanoseconds);
 }
 
-iox::units::Duration IcePerfBase::latencyPerfTestLeader(const uint64_t numRoundTrips) noexcept
+ThroughputStatistics IcePerfBase::throughputPerfTestLeader(const uint32_t payloadSizeInBytes,
+                                                           const uint64_t numberOfSamples,
+                                                           const uint32_t burstSize,
+                                                           const uint32_t numberOfFollowers) noexcept
 {
     auto start = std::chrono::steady_clock::now();
 
     // run the performance test
-    for (auto i = 0U; i < numRoundTrips; ++i)
+    uint64_t sentSamples{0U};
+    while (sentSamples < numberOfSamples)
     {
-        auto perfTopic = receivePerfTopic();
-        sendPerfTopic(perfTopic.payloadSize, RunFlag::RUN);
+        const uint64_t remainingSamples = numberOfSamples - sentSamples;
+        const uint64_t samplesInBurst = (remainingSamples < burstSize) ? remainingSamples : burstSize;
+        for (uint64_t i = 1U; i < samplesInBurst; ++i)
+        {
+            sendPerfTopic(payloadSizeInBytes, RunFlag::RUN, PerfTopic::NO_REPLY);
+        }
+
+        // the acknowledgement of the last sample of a burst is kept as small as possible to not distort the rate
+        sendPerfTopic(payloadSizeInBytes, RunFlag::RUN, sizeof(PerfTopic));
+        for (auto follower = 0U; follower < numberOfFollowers; ++follower)
+        {
+            receivePerfTopic();
+        }
+
+        sentSamples += samplesInBurst;
     }
 
     auto finish = std::chrono::steady_clock::now();
 
-    constexpr uint64_t TRANSMISSIONS_PER_ROUNDTRIP{2U};
-    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(finish - start);
-    auto latencyInNanoSeconds =
-        (static_cast<uint64_t>(duration.count()) / (numRoundTrips * TRANSMISSIONS_PER_ROUNDTRIP));
-    return iox::units::Duration::fromNanoseconds(latencyInNanoSeconds);
+    auto duration = std::chrono::duration_cast<std::chrono::duration<double>>(finish - start);
+    ThroughputStatistics statistics;
+    statistics.samplesPerSecond = static_cast<double>(numberOfSamples) / duration.count();
+    statistics.megabytesPerSecond =
+        statistics.samplesPerSecond * static_cast<double>(payloadSizeInBytes) / static_cast<double>(ONE_MEGABYTE);
+    return statistics;
 }
 
-void IcePerfBase::latencyPerfTestFollower() noexcept
+void IcePerfBase::perfTestFollower() noexcept
 {
     while (true)
     {
@@ -65,6 +104,9 @@ void IcePerfBase::latencyPerfTestFollower() noexcept
             break;
         }
 
-        sendPerfTopic(perfTopic.payloadSize, RunFlag::RUN);
+        if (perfTopic.replyPayloadSize != PerfTopic::NO_REPLY)
+        {
+            sendPerfTopic(perfTopic.replyPayloadSize, RunFlag::RUN, PerfTopic::NO_REPLY);
+        }
     }
 }
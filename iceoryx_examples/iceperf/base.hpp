@@ -18,6 +18,7 @@
 #define IOX_EXAMPLES_ICEPERF_BASE_HPP
 
 #include "example_common.hpp"
+#include "measurement_result.hpp"
 #include "topic_data.hpp"
 
 #include "iox/duration.hpp"
@@ -29,21 +30,42 @@ class IcePerfBase
 {
   public:
     static constexpr uint32_t ONE_KILOBYTE = 1024U;
+    static constexpr uint32_t ONE_MEGABYTE = 1024U * 1024U;
 
     virtual ~IcePerfBase() = default;
 
-    virtual void initLeader() noexcept = 0;
+    /// @brief Sets up the communication and waits until all followers are connected
+    /// @param[in] numberOfFollowers which are connected to the leader; only the iceoryx technologies support more
+    /// than one follower
+    virtual void initLeader(const uint32_t numberOfFollowers) noexcept = 0;
     virtual void initFollower() noexcept = 0;
     virtual void shutdown() noexcept = 0;
 
-    void preLatencyPerfTestLeader(const uint32_t payloadSizeInBytes) noexcept;
-    void postLatencyPerfTestLeader() noexcept;
     void releaseFollower() noexcept;
-    iox::units::Duration latencyPerfTestLeader(const uint64_t numRoundTrips) noexcept;
-    void latencyPerfTestFollower() noexcept;
+
+    /// @brief Sends numRoundTrips samples one after another and waits for the reply of every follower before the
+    /// next sample is sent; a single follower echoes the payload, with several followers each one replies with a
+    /// PerfTopic only
+    /// @return the distribution of the one-way latencies, i.e. the half of each round trip
+    LatencyStatistics latencyPerfTestLeader(const uint32_t payloadSizeInBytes,
+                                            const uint64_t numRoundTrips,
+                                            const uint32_t numberOfFollowers) noexcept;
+
+    /// @brief Sends numberOfSamples samples in bursts of burstSize samples; only the last sample of a burst is
+    /// acknowledged by the followers
+    /// @return the rate of the samples and bytes which were transmitted to each follower
+    ThroughputStatistics throughputPerfTestLeader(const uint32_t payloadSizeInBytes,
+                                                  const uint64_t numberOfSamples,
+                                                  const uint32_t burstSize,
+                                                  const uint32_t numberOfFollowers) noexcept;
+
+    /// @brief Receives the samples of the leader and replies when requested until the leader releases the follower
+    void perfTestFollower() noexcept;
 
   private:
-    virtual void sendPerfTopic(const uint32_t payloadSizeInBytes, const RunFlag runFlag) noexcept = 0;
+    virtual void sendPerfTopic(const uint32_t payloadSizeInBytes,
+                               const RunFlag runFlag,
+                               const uint32_t replyPayloadSizeInBytes) noexcept = 0;
     virtual PerfTopic receivePerfTopic() noexcept = 0;
 };
 
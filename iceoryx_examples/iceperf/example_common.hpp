@@ -39,4 +39,43 @@ enum class RunFlag
     RUN
 };
 
+enum class OutputFormat
+{
+    TABLE,
+    CSV,
+    JSON
+};
+
+inline const char* asStringLiteral(const Benchmark benchmark) noexcept
+{
+    switch (benchmark)
+    {
+    case Benchmark::ALL:
+        return "all";
+    case Benchmark::LATENCY:
+        return "latency";
+    case Benchmark::THROUGHPUT:
+        return "throughput";
+    }
+    return "unknown";
+}
+
+inline const char* asStringLiteral(const Technology technology) noexcept
+{
+    switch (technology)
+    {
+    case Technology::ALL:
+        return "all";
+    case Technology::ICEORYX_CPP_API:
+        return "iceoryx-cpp-api";
+    case Technology::ICEORYX_C_API:
+        return "iceoryx-c-api";
+    case Technology::POSIX_MESSAGE_QUEUE:
+        return "posix-message-queue";
+    case Technology::UNIX_DOMAIN_SOCKET:
+        return "unix-domain-sockets";
+    }
+    return "unknown";
+}
+
 #endif
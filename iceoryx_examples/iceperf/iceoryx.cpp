@@ -18,22 +18,53 @@
 #include "iceoryx.hpp"
 
 #include <chrono>
+#include <cstdlib>
 #include <thread>
 
+namespace
+{
+iox::popo::PublisherOptions publisherOptions() noexcept
+{
+    iox::popo::PublisherOptions options;
+    options.historyCapacity = 1U;
+    options.subscriberTooSlowPolicy = iox::popo::ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER;
+    return options;
+}
+
+iox::popo::SubscriberOptions subscriberOptions() noexcept
+{
+    iox::popo::SubscriberOptions options;
+    options.queueCapacity = Iceoryx::QUEUE_CAPACITY;
+    options.historyRequest = 1U;
+    options.queueFullPolicy = iox::popo::QueueFullPolicy::BLOCK_PRODUCER;
+    return options;
+}
+} // namespace
+
 Iceoryx::Iceoryx(const iox::capro::IdString_t& publisherName, const iox::capro::IdString_t& subscriberName) noexcept
-    : m_publisher({"IcePerf", publisherName, "C++-API"}, iox::popo::PublisherOptions{1U})
-    , m_subscriber({"IcePerf", subscriberName, "C++-API"}, iox::popo::SubscriberOptions{1U, 1U})
+    : m_publisher({"IcePerf", publisherName, "C++-API"}, publisherOptions())
+    , m_subscriber({"IcePerf", subscriberName, "C++-API"}, subscriberOptions())
 {
 }
 
-void Iceoryx::initLeader() noexcept
+void Iceoryx::initLeader(const uint32_t numberOfFollowers) noexcept
 {
     init();
+
+    // every follower registers when its subscriber is connected to the leader
+    std::cout << "Waiting for: " << numberOfFollowers << " follower(s)" << std::flush;
+    for (auto follower = 0U; follower < numberOfFollowers; ++follower)
+    {
+        receivePerfTopic();
+    }
+    std::cout << " [ success ]" << std::endl;
 }
 
 void Iceoryx::initFollower() noexcept
 {
     init();
+
+    sendPerfTopic(sizeof(PerfTopic), RunFlag::RUN, PerfTopic::NO_REPLY);
 }
 
 void Iceoryx::init() noexcept
@@ -57,7 +88,7 @@ void Iceoryx::shutdown() noexcept
     m_subscriber.unsubscribe();
 
     std::cout << "Waiting for: unsubscribe " << std::flush;
-    while (!m_publisher.hasSubscribers())
+    while (m_publisher.hasSubscribers())
     {
         std::this_thread::sleep_for(std::chrono::milliseconds(1));
     }
@@ -67,16 +98,27 @@ void Iceoryx::shutdown() noexcept
     std::cout << " [ finished ]" << std::endl;
 }
 
-void Iceoryx::sendPerfTopic(const uint32_t payloadSizeInBytes, const RunFlag runFlag) noexcept
+void Iceoryx::sendPerfTopic(const uint32_t payloadSizeInBytes,
+                            const RunFlag runFlag,
+                            const uint32_t replyPayloadSizeInBytes) noexcept
 {
-    m_publisher.loan(payloadSizeInBytes).and_then([&](auto& userPayload) {
-        auto sendSample = static_cast<PerfTopic*>(userPayload);
-        sendSample->payloadSize = payloadSizeInBytes;
-        sendSample->runFlag = runFlag;
-        sendSample->subPackets = 1;
-
-        m_publisher.publish(userPayload);
-    });
+    m_publisher.loan(payloadSizeInBytes)
+        .and_then([&](auto& userPayload) {
+            auto sendSample = static_cast<PerfTopic*>(userPayload);
+            sendSample->payloadSize = payloadSizeInBytes;
+            sendSample->runFlag = runFlag;
+            sendSample->replyPayloadSize = replyPayloadSizeInBytes;
+            sendSample->subPackets = 1;
+
+            m_publisher.publish(userPayload);
+        })
+        .or_else([&](auto& error) {
+            // the counterpart would wait forever for the sample
+            std::cout << std::endl
+                      << "loan error for " << payloadSizeInBytes << " bytes, " << iox::popo::asStringLiteral(error)
+                      << std::endl;
+            std::exit(EXIT_FAILURE);
+        });
 }
 
 PerfTopic Iceoryx::receivePerfTopic() noexcept
@@ -25,14 +25,20 @@
 class Iceoryx : public IcePerfBase
 {
   public:
+    /// @brief The queue decouples the bursts of the throughput benchmark; the publisher blocks when it is full. It is
+    /// small enough to not run out of chunks of the mempools of iceperf-roudi for the largest payload sizes
+    static constexpr uint64_t QUEUE_CAPACITY{4U};
+
     Iceoryx(const iox::capro::IdString_t& publisherName, const iox::capro::IdString_t& subscriberName) noexcept;
-    void initLeader() noexcept override;
+    void initLeader(const uint32_t numberOfFollowers) noexcept override;
     void initFollower() noexcept override;
     void shutdown() noexcept override;
 
   private:
     void init() noexcept;
-    void sendPerfTopic(const uint32_t payloadSizeInBytes, const RunFlag runFlag) noexcept override;
+    void sendPerfTopic(const uint32_t payloadSizeInBytes,
+                       const RunFlag runFlag,
+                       const uint32_t replyPayloadSizeInBytes) noexcept override;
     PerfTopic receivePerfTopic() noexcept override;
 
     iox::popo::UntypedPublisher m_publisher;
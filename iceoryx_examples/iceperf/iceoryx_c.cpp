@@ -17,6 +17,7 @@
 #include "iceoryx_c.hpp"
 
 #include <chrono>
+#include <cstdlib>
 #include <thread>
 
 IceoryxC::IceoryxC(const iox::capro::IdString_t& publisherName, const iox::capro::IdString_t& subscriberName) noexcept
@@ -24,12 +25,14 @@ IceoryxC::IceoryxC(const iox::capro::IdString_t& publisherName, const iox::capro
     iox_pub_options_t publisherOptions;
     iox_pub_options_init(&publisherOptions);
     publisherOptions.historyCapacity = 1U;
+    publisherOptions.subscriberTooSlowPolicy = ConsumerTooSlowPolicy_WAIT_FOR_CONSUMER;
     m_publisher = iox_pub_init(&m_publisherStorage, "IcePerf", publisherName.c_str(), "C-API", &publisherOptions);
 
     iox_sub_options_t subscriberOptions;
     iox_sub_options_init(&subscriberOptions);
-    subscriberOptions.queueCapacity = 1U;
+    subscriberOptions.queueCapacity = QUEUE_CAPACITY;
     subscriberOptions.historyRequest = 1U;
+    subscriberOptions.queueFullPolicy = QueueFullPolicy_BLOCK_PRODUCER;
     m_subscriber = iox_sub_init(&m_subscriberStorage, "IcePerf", subscriberName.c_str(), "C-API", &subscriberOptions);
 }
 
@@ -39,14 +42,24 @@ IceoryxC::~IceoryxC()
     iox_sub_deinit(m_subscriber);
 }
 
-void IceoryxC::initLeader() noexcept
+void IceoryxC::initLeader(const uint32_t numberOfFollowers) noexcept
 {
     init();
+
+    // every follower registers when its subscriber is connected to the leader
+    std::cout << "Waiting for: " << numberOfFollowers << " follower(s)" << std::flush;
+    for (auto follower = 0U; follower < numberOfFollowers; ++follower)
+    {
+        receivePerfTopic();
+    }
+    std::cout << " [ success ]" << std::endl;
 }
 
 void IceoryxC::initFollower() noexcept
 {
     init();
+
+    sendPerfTopic(sizeof(PerfTopic), RunFlag::RUN, PerfTopic::NO_REPLY);
 }
 
 void IceoryxC::init() noexcept
@@ -73,7 +86,7 @@ void IceoryxC::shutdown() noexcept
     iox_sub_unsubscribe(m_subscriber);
 
     std::cout << "Waiting for: unsubscribe " << std::flush;
-    while (!iox_pub_has_subscribers(m_publisher))
+    while (iox_pub_has_subscribers(m_publisher))
     {
         std::this_thread::sleep_for(std::chrono::milliseconds(1));
     }
@@ -83,7 +96,9 @@ void IceoryxC::shutdown() noexcept
     std::cout << " [ finished ]" << std::endl;
 }
 
-void IceoryxC::sendPerfTopic(const uint32_t payloadSizeInBytes, const RunFlag runFlag) noexcept
+void IceoryxC::sendPerfTopic(const uint32_t payloadSizeInBytes,
+                             const RunFlag runFlag,
+                             const uint32_t replyPayloadSizeInBytes) noexcept
 {
     void* userPayload = nullptr;
     if (iox_pub_loan_chunk(m_publisher, &userPayload, payloadSizeInBytes) == AllocationResult_SUCCESS)
@@ -91,9 +106,16 @@ void IceoryxC::sendPerfTopic(const uint32_t payloadSizeInBytes, const RunFlag ru
         auto sendSample = static_cast<PerfTopic*>(userPayload);
         sendSample->payloadSize = payloadSizeInBytes;
         sendSample->runFlag = runFlag;
+        sendSample->replyPayloadSize = replyPayloadSizeInBytes;
         sendSample->subPackets = 1;
         iox_pub_publish_chunk(m_publisher, userPayload);
     }
+    else
+    {
+        // the counterpart would wait forever for the sample
+        std::cout << std::endl << "loan error for " << payloadSizeInBytes << " bytes" << std::endl;
+        std::exit(EXIT_FAILURE);
+    }
 }
 
 PerfTopic IceoryxC::receivePerfTopic() noexcept
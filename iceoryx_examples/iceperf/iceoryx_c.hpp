@@ -27,15 +27,20 @@ extern "C" {
 class IceoryxC : public IcePerfBase
 {
   public:
+    /// @brief Same queue configuration as for the C++ API to keep the results comparable
+    static constexpr uint64_t QUEUE_CAPACITY{4U};
+
     IceoryxC(const iox::capro::IdString_t& publisherName, const iox::capro::IdString_t& subscriberName) noexcept;
     ~IceoryxC();
-    void initLeader() noexcept override;
+    void initLeader(const uint32_t numberOfFollowers) noexcept override;
     void initFollower() noexcept override;
     void shutdown() noexcept override;
 
   private:
     void init() noexcept;
-    void sendPerfTopic(const uint32_t payloadSizeInBytes, const RunFlag runFlag) noexcept override;
+    void sendPerfTopic(const uint32_t payloadSizeInBytes,
+                       const RunFlag runFlag,
+                       const uint32_t replyPayloadSizeInBytes) noexcept override;
     PerfTopic receivePerfTopic() noexcept override;
 
     iox_pub_storage_t m_publisherStorage;
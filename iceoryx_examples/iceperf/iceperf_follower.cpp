@@ -24,6 +24,7 @@
 #include "uds.hpp"
 
 #include <iostream>
+#include <string>
 
 //! [use constants instead of magic values]
 constexpr const char APP_NAME[]{"iceperf-bench-follower"};
@@ -31,12 +32,17 @@ constexpr const char PUBLISHER[]{"Follower"};
 constexpr const char SUBSCRIBER[]{"Leader"};
 //! [use constants instead of magic values]
 
+IcePerfFollower::IcePerfFollower(const uint32_t followerId) noexcept
+    : m_followerId(followerId)
+{
+}
+
 //! [do the measurement for a single technology]
 void IcePerfFollower::doMeasurement(IcePerfBase& ipcTechnology) noexcept
 {
     ipcTechnology.initFollower();
 
-    ipcTechnology.latencyPerfTestFollower();
+    ipcTechnology.perfTestFollower();
 
     ipcTechnology.shutdown();
 }
@@ -73,7 +79,12 @@ PerfSettings IcePerfFollower::getSettings(iox::popo::Subscriber<PerfSettings>& s
 //! [run all technologies]
 int IcePerfFollower::run() noexcept
 {
-    iox::runtime::PoshRuntime::initRuntime(APP_NAME);
+    std::string runtimeName{APP_NAME};
+    if (m_followerId > 0U)
+    {
+        runtimeName += "-" + std::to_string(m_followerId);
+    }
+    iox::runtime::PoshRuntime::initRuntime(iox::RuntimeName_t(iox::TruncateToCapacity, runtimeName.c_str()));
 
     //! [get settings from leader]
     iox::capro::ServiceDescription serviceDescription{"IcePerf", "Settings", "Generic"};
@@ -85,12 +96,18 @@ int IcePerfFollower::run() noexcept
     //! [get settings from leader]
 
     //! [create an run technologies]
+    // the leader skips the technologies without fan-out support when there is more than one follower
+    const bool isFanOut = m_settings.numberOfFollowers > 1U;
+
     if (m_settings.technology == Technology::ALL || m_settings.technology == Technology::POSIX_MESSAGE_QUEUE)
     {
 #ifndef __APPLE__
-        std::cout << std::endl << "******   MESSAGE QUEUE    ********" << std::endl;
-        MQ mq(PUBLISHER, SUBSCRIBER);
-        doMeasurement(mq);
+        if (!isFanOut)
+        {
+            std::cout << std::endl << "******   MESSAGE QUEUE    ********" << std::endl;
+            MQ mq(PUBLISHER, SUBSCRIBER);
+            doMeasurement(mq);
+        }
 #else
         if (m_settings.technology == Technology::POSIX_MESSAGE_QUEUE)
         {
@@ -99,7 +116,8 @@ int IcePerfFollower::run() noexcept
 #endif
     }
 
-    if (m_settings.technology == Technology::ALL || m_settings.technology == Technology::UNIX_DOMAIN_SOCKET)
+    if (!isFanOut
+        && (m_settings.technology == Technology::ALL || m_settings.technology == Technology::UNIX_DOMAIN_SOCKET))
     {
         std::cout << std::endl << "****** UNIX DOMAIN SOCKET ********" << std::endl;
         UDS uds(PUBLISHER, SUBSCRIBER);
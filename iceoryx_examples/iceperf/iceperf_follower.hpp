@@ -26,7 +26,9 @@
 class IcePerfFollower
 {
   public:
-    IcePerfFollower() noexcept = default;
+    /// @brief Creates a follower
+    /// @param[in] followerId distinguishes the runtime names when several followers are started for a fan-out
+    explicit IcePerfFollower(const uint32_t followerId) noexcept;
 
     int run() noexcept;
 
@@ -35,6 +37,7 @@ class IcePerfFollower
     void doMeasurement(IcePerfBase& ipcTechnology) noexcept;
 
   private:
+    const uint32_t m_followerId{0U};
     PerfSettings m_settings;
 };
 
@@ -26,6 +26,7 @@
 #include "topic_data.hpp"
 #include "uds.hpp"
 
+#include <fstream>
 #include <iomanip>
 #include <iostream>
 #include <vector>
@@ -36,8 +37,9 @@ constexpr const char PUBLISHER[]{"Leader"};
 constexpr const char SUBSCRIBER[]{"Follower"};
 //! [use constants instead of magic values]
 
-IcePerfLeader::IcePerfLeader(const PerfSettings settings) noexcept
+IcePerfLeader::IcePerfLeader(const PerfSettings settings, const LeaderSettings& leaderSettings) noexcept
     : m_settings(settings)
+    , m_leaderSettings(leaderSettings)
 {
     //! [cleanup outdated resources]
 #ifndef __APPLE__
@@ -48,56 +50,146 @@ IcePerfLeader::IcePerfLeader(const PerfSettings settings) noexcept
 }
 
 //! [do the measurement for a single technology]
-void IcePerfLeader::doMeasurement(IcePerfBase& ipcTechnology) noexcept
+void IcePerfLeader::doMeasurement(IcePerfBase& ipcTechnology, const Technology technology) noexcept
 {
-    ipcTechnology.initLeader();
+    ipcTechnology.initLeader(m_settings.numberOfFollowers);
 
-    std::vector<std::tuple<uint32_t, iox::units::Duration>> latencyMeasurements;
-    const std::vector<uint32_t> payloadSizesInKB{1, 2, 4, 8, 16, 32, 64, 128, 256, 512, 1024, 2048, 4096};
-    std::cout << "Measurement for:";
-    const char* separator = " ";
-    for (const auto payloadSizeInKB : payloadSizesInKB)
+    MeasurementResult result;
+    result.technology = technology;
+    result.numberOfSamples = m_settings.numberOfSamples;
+    result.numberOfFollowers = m_settings.numberOfFollowers;
+    result.burstSize = m_settings.burstSize;
+
+    std::vector<MeasurementResult> results;
+    if (m_settings.benchmark == Benchmark::ALL || m_settings.benchmark == Benchmark::LATENCY)
     {
-        std::cout << separator << payloadSizeInKB << " kB" << std::flush;
-        separator = ", ";
-        auto payloadSizeInBytes = payloadSizeInKB * IcePerfBase::ONE_KILOBYTE;
+        result.benchmark = Benchmark::LATENCY;
+        std::cout << "Latency measurement for:";
+        const char* separator = " ";
+        for (const auto payloadSizeInKB : m_leaderSettings.payloadSizesInKB)
+        {
+            std::cout << separator << payloadSizeInKB << " kB" << std::flush;
+            separator = ", ";
+            result.payloadSizeInBytes = payloadSizeInKB * IcePerfBase::ONE_KILOBYTE;
 
-        ipcTechnology.preLatencyPerfTestLeader(payloadSizeInBytes);
+            result.latency = ipcTechnology.latencyPerfTestLeader(
+                result.payloadSizeInBytes, m_settings.numberOfSamples, m_settings.numberOfFollowers);
 
-        auto latency = ipcTechnology.latencyPerfTestLeader(m_settings.numberOfSamples);
+            results.push_back(result);
+        }
+        std::cout << std::endl;
+    }
 
-        latencyMeasurements.push_back(std::make_tuple(payloadSizeInKB, latency));
+    if (m_settings.benchmark == Benchmark::ALL || m_settings.benchmark == Benchmark::THROUGHPUT)
+    {
+        result.benchmark = Benchmark::THROUGHPUT;
+        result.latency = LatencyStatistics();
+        std::cout << "Throughput measurement for:";
+        const char* separator = " ";
+        for (const auto payloadSizeInKB : m_leaderSettings.payloadSizesInKB)
+        {
+            std::cout << separator << payloadSizeInKB << " kB" << std::flush;
+            separator = ", ";
+            result.payloadSizeInBytes = payloadSizeInKB * IcePerfBase::ONE_KILOBYTE;
 
-        ipcTechnology.postLatencyPerfTestLeader();
+            result.throughput = ipcTechnology.throughputPerfTestLeader(result.payloadSizeInBytes,
+                                                                       m_settings.numberOfSamples,
+                                                                       m_settings.burstSize,
+                                                                       m_settings.numberOfFollowers);
+
+            results.push_back(result);
+        }
+        std::cout << std::endl;
     }
-    std::cout << std::endl;
 
     ipcTechnology.releaseFollower();
 
     ipcTechnology.shutdown();
 
+    if (m_leaderSettings.outputFormat == OutputFormat::TABLE)
+    {
+        printTable(results);
+    }
+    m_results.insert(m_results.end(), results.begin(), results.end());
+}
+//! [do the measurement for a single technology]
+
+void IcePerfLeader::printTable(const std::vector<MeasurementResult>& results) const noexcept
+{
+    constexpr double NANOSECONDS_PER_MICROSECOND{1000.0};
+    auto toMicroseconds = [&](const iox::units::Duration duration) {
+        return static_cast<double>(duration.toNanoseconds()) / NANOSECONDS_PER_MICROSECOND;
+    };
+
     std::cout << std::endl;
     std::cout << "#### Measurement Result ####" << std::endl;
-    std::cout << m_settings.numberOfSamples << " round trips for each payload." << std::endl;
-    std::cout << std::endl;
-    std::cout << "| Payload Size [kB] | Average Latency [µs] |" << std::endl;
-    std::cout << "|------------------:|---------------------:|" << std::endl;
-    for (const auto& latencyMeasuement : latencyMeasurements)
+    std::cout << std::fixed << std::setprecision(2);
+
+    if (m_settings.benchmark == Benchmark::ALL || m_settings.benchmark == Benchmark::LATENCY)
     {
-        auto payloadSizeInKB = std::get<0>(latencyMeasuement);
-        auto latencyInMicroseconds = static_cast<double>(std::get<1>(latencyMeasuement).toNanoseconds()) / 1000.0;
-        std::cout << "| " << std::setw(17) << payloadSizeInKB << " | " << std::setw(20) << std::setprecision(2)
-                  << latencyInMicroseconds << " |" << std::endl;
+        std::cout << m_settings.numberOfSamples << " round trips for each payload with "
+                  << m_settings.numberOfFollowers << " follower(s)." << std::endl;
+        std::cout << std::endl;
+        std::cout << "| Payload Size [kB] | Average Latency [µs] | Min [µs] | p50 [µs] | p90 [µs] | p99 [µs] "
+                     "| p99.9 [µs] | Max [µs] |"
+                  << std::endl;
+        std::cout << "|------------------:|---------------------:|---------:|---------:|---------:|---------:"
+                     "|-----------:|---------:|"
+                  << std::endl;
+        for (const auto& result : results)
+        {
+            if (result.benchmark != Benchmark::LATENCY)
+            {
+                continue;
+            }
+            const auto& latency = result.latency;
+            std::cout << "| " << std::setw(17) << result.payloadSizeInBytes / IcePerfBase::ONE_KILOBYTE << " | "
+                      << std::setw(20) << toMicroseconds(latency.average) << " | " << std::setw(8)
+                      << toMicroseconds(latency.min) << " | " << std::setw(8) << toMicroseconds(latency.p50) << " | "
+                      << std::setw(8) << toMicroseconds(latency.p90) << " | " << std::setw(8)
+                      << toMicroseconds(latency.p99) << " | " << std::setw(10) << toMicroseconds(latency.p99_9)
+                      << " | " << std::setw(8) << toMicroseconds(latency.max) << " |" << std::endl;
+        }
+        std::cout << std::endl;
+    }
+
+    if (m_settings.benchmark == Benchmark::ALL || m_settings.benchmark == Benchmark::THROUGHPUT)
+    {
+        std::cout << m_settings.numberOfSamples << " samples in bursts of " << m_settings.burstSize
+                  << " for each payload with " << m_settings.numberOfFollowers << " follower(s)." << std::endl;
+        std::cout << std::endl;
+        std::cout << "| Payload Size [kB] | Samples per Second | Throughput [MB/s] |" << std::endl;
+        std::cout << "|------------------:|-------------------:|------------------:|" << std::endl;
+        for (const auto& result : results)
+        {
+            if (result.benchmark != Benchmark::THROUGHPUT)
+            {
+                continue;
+            }
+            std::cout << "| " << std::setw(17) << result.payloadSizeInBytes / IcePerfBase::ONE_KILOBYTE << " | "
+                      << std::setw(18) << result.throughput.samplesPerSecond << " | " << std::setw(17)
+                      << result.throughput.megabytesPerSecond << " |" << std::endl;
+        }
+        std::cout << std::endl;
     }
 
-    std::cout << std::endl;
     std::cout << "Finished!" << std::endl;
 }
-//! [do the measurement for a single technology]
 
 //! [run all technologies]
 int IcePerfLeader::run() noexcept
 {
+    std::ofstream resultFile;
+    if (!m_leaderSettings.resultFile.empty())
+    {
+        resultFile.open(m_leaderSettings.resultFile);
+        if (!resultFile.is_open())
+        {
+            std::cerr << "Could not open the result file '" << m_leaderSettings.resultFile << "'!" << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+
     iox::runtime::PoshRuntime::initRuntime(APP_NAME);
 
     //! [send setting to follower application]
@@ -113,12 +205,22 @@ int IcePerfLeader::run() noexcept
     //! [send setting to follower application]
 
     //! [create an run technologies]
+    // the message queue and the unix domain socket connect exactly two endpoints and do not support a fan-out
+    const bool isFanOut = m_settings.numberOfFollowers > 1U;
+
     if (m_settings.technology == Technology::ALL || m_settings.technology == Technology::POSIX_MESSAGE_QUEUE)
     {
 #ifndef __APPLE__
-        std::cout << std::endl << "******   MESSAGE QUEUE    ********" << std::endl;
-        MQ mq(PUBLISHER, SUBSCRIBER);
-        doMeasurement(mq);
+        if (isFanOut)
+        {
+            std::cout << "The message queue supports only one follower and will be skipped!" << std::endl;
+        }
+        else
+        {
+            std::cout << std::endl << "******   MESSAGE QUEUE    ********" << std::endl;
+            MQ mq(PUBLISHER, SUBSCRIBER);
+            doMeasurement(mq, Technology::POSIX_MESSAGE_QUEUE);
+        }
 #else
         if (m_settings.technology == Technology::POSIX_MESSAGE_QUEUE)
         {
@@ -129,26 +231,48 @@ int IcePerfLeader::run() noexcept
 
     if (m_settings.technology == Technology::ALL || m_settings.technology == Technology::UNIX_DOMAIN_SOCKET)
     {
-        std::cout << std::endl << "****** UNIX DOMAIN SOCKET ********" << std::endl;
-        UDS uds(PUBLISHER, SUBSCRIBER);
-        doMeasurement(uds);
+        if (isFanOut)
+        {
+            std::cout << "The unix domain socket supports only one follower and will be skipped!" << std::endl;
+        }
+        else
+        {
+            std::cout << std::endl << "****** UNIX DOMAIN SOCKET ********" << std::endl;
+            UDS uds(PUBLISHER, SUBSCRIBER);
+            doMeasurement(uds, Technology::UNIX_DOMAIN_SOCKET);
+        }
     }
 
     if (m_settings.technology == Technology::ALL || m_settings.technology == Technology::ICEORYX_CPP_API)
     {
         std::cout << std::endl << "******      ICEORYX       ********" << std::endl;
         Iceoryx iceoryx(PUBLISHER, SUBSCRIBER);
-        doMeasurement(iceoryx);
+        doMeasurement(iceoryx, Technology::ICEORYX_CPP_API);
     }
 
     if (m_settings.technology == Technology::ALL || m_settings.technology == Technology::ICEORYX_C_API)
     {
         std::cout << std::endl << "******   ICEORYX C API    ********" << std::endl;
         IceoryxC iceoryxc(PUBLISHER, SUBSCRIBER);
-        doMeasurement(iceoryxc);
+        doMeasurement(iceoryxc, Technology::ICEORYX_C_API);
     }
     //! [create an run technologies]
 
+    //! [write the results]
+    std::ostream& resultStream = resultFile.is_open() ? resultFile : std::cout;
+    switch (m_leaderSettings.outputFormat)
+    {
+    case OutputFormat::TABLE:
+        break;
+    case OutputFormat::CSV:
+        writeCsv(resultStream, m_results);
+        break;
+    case OutputFormat::JSON:
+        writeJson(resultStream, m_results);
+        break;
+    }
+    //! [write the results]
+
     return EXIT_SUCCESS;
 }
 //! [run all technologies]
@@ -19,21 +19,37 @@
 
 #include "base.hpp"
 #include "example_common.hpp"
+#include "measurement_result.hpp"
 
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 
+#include <string>
+#include <vector>
+
+/// @brief The settings of the leader which are not shared with the followers
+struct LeaderSettings
+{
+    std::vector<uint32_t> payloadSizesInKB{1, 2, 4, 8, 16, 32, 64, 128, 256, 512, 1024, 2048, 4096};
+    OutputFormat outputFormat{OutputFormat::TABLE};
+    /// @brief the CSV or JSON results are written to this file instead of stdout when it is not empty
+    std::string resultFile;
+};
+
 class IcePerfLeader
 {
   public:
-    IcePerfLeader(const PerfSettings settings) noexcept;
+    IcePerfLeader(const PerfSettings settings, const LeaderSettings& leaderSettings) noexcept;
 
     int run() noexcept;
 
   private:
-    void doMeasurement(IcePerfBase& ipcTechnology) noexcept;
+    void doMeasurement(IcePerfBase& ipcTechnology, const Technology technology) noexcept;
+    void printTable(const std::vector<MeasurementResult>& results) const noexcept;
 
   private:
     const PerfSettings m_settings;
+    const LeaderSettings m_leaderSettings;
+    std::vector<MeasurementResult> m_results;
 };
 
 #endif // IOX_EXAMPLES_ICEPERF_LEADER_HPP
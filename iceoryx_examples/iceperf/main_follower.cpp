@@ -23,11 +23,15 @@
 
 int main(int argc, char* argv[])
 {
-    constexpr option longOptions[] = {
-        {"help", no_argument, nullptr, 'h'}, {"moo", required_argument, nullptr, 'm'}, {nullptr, 0, nullptr, 0}};
+    uint32_t followerId{0U};
+
+    constexpr option longOptions[] = {{"help", no_argument, nullptr, 'h'},
+                                      {"id", required_argument, nullptr, 'i'},
+                                      {"moo", required_argument, nullptr, 'm'},
+                                      {nullptr, 0, nullptr, 0}};
 
     // colon after shortOption means it requires an argument, two colons mean optional argument
-    constexpr const char* shortOptions = "hm:";
+    constexpr const char* shortOptions = "hi:m:";
     int32_t index{0};
     int32_t opt{-1};
     while ((opt = getopt_long(argc, argv, shortOptions, longOptions, &index), opt != -1))
@@ -38,11 +42,21 @@ int main(int argc, char* argv[])
             std::cout << "Usage: " << argv[0] << " [options]" << std::endl;
             std::cout << "Options:" << std::endl;
             std::cout << "-h, --help                        Display help" << std::endl;
+            std::cout << "-i, --id <ID>                     Set a unique id for each follower of a fan-out benchmark"
+                      << std::endl;
+            std::cout << "                                  default = '0'" << std::endl;
             std::cout << "-m, --moo <intensity>             Prints 'Moo!' with the specified intensity" << std::endl;
             std::cout << "                                  range = '0' to '100'" << std::endl;
             std::cout << "                                  default = '0'" << std::endl;
 
             return EXIT_SUCCESS;
+        case 'i':
+            if (!iox::cxx::convert::fromString(optarg, followerId))
+            {
+                std::cerr << "Could not parse 'id' paramater!" << std::endl;
+                return EXIT_FAILURE;
+            }
+            break;
         case 'm':
         {
             constexpr decltype(EXIT_SUCCESS) MOO{EXIT_SUCCESS};
@@ -73,6 +87,6 @@ int main(int argc, char* argv[])
         }
     }
 
-    IcePerfFollower app;
+    IcePerfFollower app(followerId);
     return app.run();
 }
@@ -24,19 +24,53 @@
 
 #include <cstring>
 #include <iostream>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+/// @brief parses a comma separated list of payload sizes in kB
+bool parsePayloadSizes(const char* list, std::vector<uint32_t>& payloadSizesInKB)
+{
+    constexpr uint32_t MAX_PAYLOAD_SIZE_IN_KB{std::numeric_limits<uint32_t>::max() / IcePerfBase::ONE_KILOBYTE};
+
+    payloadSizesInKB.clear();
+    std::stringstream stream{list};
+    std::string entry;
+    while (std::getline(stream, entry, ','))
+    {
+        uint32_t payloadSizeInKB{0U};
+        if (!iox::cxx::convert::fromString(entry.c_str(), payloadSizeInKB) || payloadSizeInKB == 0U
+            || payloadSizeInKB > MAX_PAYLOAD_SIZE_IN_KB)
+        {
+            return false;
+        }
+        payloadSizesInKB.push_back(payloadSizeInKB);
+    }
+    return !payloadSizesInKB.empty();
+}
+} // namespace
 
 int main(int argc, char* argv[])
 {
     PerfSettings settings;
+    LeaderSettings leaderSettings;
 
     constexpr option longOptions[] = {{"help", no_argument, nullptr, 'h'},
                                       {"benchmark", required_argument, nullptr, 'b'},
                                       {"technology", required_argument, nullptr, 't'},
-                                      {"number-of-samples", required_argument, nullptr, 't'},
+                                      {"number-of-samples", required_argument, nullptr, 'n'},
+                                      {"payload-sizes", required_argument, nullptr, 'p'},
+                                      {"burst-size", required_argument, nullptr, 's'},
+                                      {"number-of-followers", required_argument, nullptr, 'f'},
+                                      {"output-format", required_argument, nullptr, 'o'},
+                                      {"result-file", required_argument, nullptr, 'r'},
                                       {nullptr, 0, nullptr, 0}};
 
     // colon after shortOption means it requires an argument, two colons mean optional argument
-    constexpr const char* shortOptions = "hb:t:n:";
+    constexpr const char* shortOptions = "hb:t:n:p:s:f:o:r:";
     int32_t index{0};
     int32_t opt{-1};
     while ((opt = getopt_long(argc, argv, shortOptions, longOptions, &index), opt != -1))
@@ -60,6 +94,29 @@ int main(int argc, char* argv[])
             std::cout << "-n, --number-of-samples <N>       Set the number of samples sent in a benchmark round"
                       << std::endl;
             std::cout << "                                  default = '10000'" << std::endl;
+            std::cout << "-p, --payload-sizes <LIST>        Comma separated list of the payload sizes in kB"
+                      << std::endl;
+            std::cout << "                                  default = '1,2,4,8,16,32,64,128,256,512,1024,2048,4096'"
+                      << std::endl;
+            std::cout << "-s, --burst-size <N>              Set the number of samples which are sent back-to-back in"
+                      << std::endl;
+            std::cout << "                                  the throughput benchmark before waiting for an"
+                      << std::endl;
+            std::cout << "                                  acknowledgement of the followers" << std::endl;
+            std::cout << "                                  default = '1'" << std::endl;
+            std::cout << "-f, --number-of-followers <N>     Set the number of followers which receive each sample;"
+                      << std::endl;
+            std::cout << "                                  a fan-out to more than one follower is only supported"
+                      << std::endl;
+            std::cout << "                                  by iceoryx, start each follower with its own '--id'"
+                      << std::endl;
+            std::cout << "                                  default = '1'" << std::endl;
+            std::cout << "-o, --output-format <FORMAT>      Selects the format of the results" << std::endl;
+            std::cout << "                                  <FORMAT> {table, csv, json}" << std::endl;
+            std::cout << "                                  default = 'table'" << std::endl;
+            std::cout << "-r, --result-file <PATH>          Writes the 'csv' or 'json' results to a file instead of"
+                      << std::endl;
+            std::cout << "                                  stdout" << std::endl;
 
             return EXIT_SUCCESS;
         case 'b':
@@ -77,7 +134,7 @@ int main(int argc, char* argv[])
             }
             else
             {
-                std::cerr << "Options for 'benchmark' are 'all', 'latency' and 'off'!" << std::endl;
+                std::cerr << "Options for 'benchmark' are 'all', 'latency' and 'throughput'!" << std::endl;
                 return EXIT_FAILURE;
             }
             break;
@@ -111,17 +168,66 @@ int main(int argc, char* argv[])
             }
             break;
         case 'n':
-            if (!iox::cxx::convert::fromString(optarg, settings.numberOfSamples))
+            if (!iox::cxx::convert::fromString(optarg, settings.numberOfSamples) || settings.numberOfSamples == 0U)
             {
                 std::cerr << "Could not parse 'number-of-samples' paramater!" << std::endl;
                 return EXIT_FAILURE;
             }
             break;
+        case 'p':
+            if (!parsePayloadSizes(optarg, leaderSettings.payloadSizesInKB))
+            {
+                std::cerr << "Could not parse 'payload-sizes' paramater!" << std::endl;
+                return EXIT_FAILURE;
+            }
+            break;
+        case 's':
+            if (!iox::cxx::convert::fromString(optarg, settings.burstSize) || settings.burstSize == 0U)
+            {
+                std::cerr << "Could not parse 'burst-size' paramater!" << std::endl;
+                return EXIT_FAILURE;
+            }
+            break;
+        case 'f':
+            if (!iox::cxx::convert::fromString(optarg, settings.numberOfFollowers) || settings.numberOfFollowers == 0U)
+            {
+                std::cerr << "Could not parse 'number-of-followers' paramater!" << std::endl;
+                return EXIT_FAILURE;
+            }
+            break;
+        case 'o':
+            if (strcmp(optarg, "table") == 0)
+            {
+                leaderSettings.outputFormat = OutputFormat::TABLE;
+            }
+            else if (strcmp(optarg, "csv") == 0)
+            {
+                leaderSettings.outputFormat = OutputFormat::CSV;
+            }
+            else if (strcmp(optarg, "json") == 0)
+            {
+                leaderSettings.outputFormat = OutputFormat::JSON;
+            }
+            else
+            {
+                std::cerr << "Options for 'output-format' are 'table', 'csv' and 'json'!" << std::endl;
+                return EXIT_FAILURE;
+            }
+            break;
+        case 'r':
+            leaderSettings.resultFile = optarg;
+            break;
         default:
             return EXIT_FAILURE;
         };
     }
 
-    IcePerfLeader app(settings);
+    if (!leaderSettings.resultFile.empty() && leaderSettings.outputFormat == OutputFormat::TABLE)
+    {
+        std::cerr << "The 'result-file' requires the 'output-format' 'csv' or 'json'!" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    IcePerfLeader app(settings, leaderSettings);
     return app.run();
 }
@@ -0,0 +1,151 @@
+// Copyright (c) 2026 by agent <agent@local>. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "measurement_result.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+
+namespace
+{
+constexpr uint64_t TRANSMISSIONS_PER_ROUNDTRIP{2U};
+constexpr int32_t RATE_PRECISION{3};
+
+iox::units::Duration toOneWayLatency(const uint64_t roundTripInNanoseconds) noexcept
+{
+    return iox::units::Duration::fromNanoseconds(roundTripInNanoseconds / TRANSMISSIONS_PER_ROUNDTRIP);
+}
+
+/// @brief nearest-rank percentile of the sorted round trips, converted to the one-way latency
+iox::units::Duration percentile(const std::vector<uint64_t>& sortedRoundTrips, const double percent) noexcept
+{
+    const auto numberOfRoundTrips = sortedRoundTrips.size();
+    auto rank = static_cast<uint64_t>(std::ceil(percent / 100.0 * static_cast<double>(numberOfRoundTrips)));
+    rank = std::max<uint64_t>(rank, 1U);
+    rank = std::min<uint64_t>(rank, numberOfRoundTrips);
+    return toOneWayLatency(sortedRoundTrips[rank - 1U]);
+}
+} // namespace
+
+LatencyStatistics LatencyStatistics::fromRoundTrips(std::vector<uint64_t>& roundTripsInNanoseconds) noexcept
+{
+    LatencyStatistics statistics;
+    if (roundTripsInNanoseconds.empty())
+    {
+        return statistics;
+    }
+
+    std::sort(roundTripsInNanoseconds.begin(), roundTripsInNanoseconds.end());
+
+    uint64_t sum{0U};
+    for (const auto roundTrip : roundTripsInNanoseconds)
+    {
+        sum += roundTrip;
+    }
+    const auto numberOfRoundTrips = roundTripsInNanoseconds.size();
+
+    statistics.min = toOneWayLatency(roundTripsInNanoseconds.front());
+    statistics.average = toOneWayLatency(sum / numberOfRoundTrips);
+    statistics.p50 = percentile(roundTripsInNanoseconds, 50.0);
+    statistics.p90 = percentile(roundTripsInNanoseconds, 90.0);
+    statistics.p99 = percentile(roundTripsInNanoseconds, 99.0);
+    statistics.p99_9 = percentile(roundTripsInNanoseconds, 99.9);
+    statistics.max = toOneWayLatency(roundTripsInNanoseconds.back());
+
+    return statistics;
+}
+
+void writeCsv(std::ostream& stream, const std::vector<MeasurementResult>& results) noexcept
+{
+    const auto flags = stream.flags();
+    const auto precision = stream.precision();
+    stream << std::fixed << std::setprecision(RATE_PRECISION);
+
+    stream << "technology,benchmark,payload_size_bytes,number_of_samples,number_of_followers,burst_size,"
+              "latency_min_ns,latency_average_ns,latency_p50_ns,latency_p90_ns,latency_p99_ns,latency_p99_9_ns,"
+              "latency_max_ns,throughput_samples_per_second,throughput_megabytes_per_second"
+           << std::endl;
+
+    for (const auto& result : results)
+    {
+        stream << asStringLiteral(result.technology) << "," << asStringLiteral(result.benchmark) << ","
+               << result.payloadSizeInBytes << "," << result.numberOfSamples << "," << result.numberOfFollowers << ","
+               << result.burstSize << ",";
+        if (result.benchmark == Benchmark::LATENCY)
+        {
+            const auto& latency = result.latency;
+            stream << latency.min.toNanoseconds() << "," << latency.average.toNanoseconds() << ","
+                   << latency.p50.toNanoseconds() << "," << latency.p90.toNanoseconds() << ","
+                   << latency.p99.toNanoseconds() << "," << latency.p99_9.toNanoseconds() << ","
+                   << latency.max.toNanoseconds() << ",,";
+        }
+        else
+        {
+            stream << ",,,,,,," << result.throughput.samplesPerSecond << ","
+                   << result.throughput.megabytesPerSecond;
+        }
+        stream << std::endl;
+    }
+
+    stream.flags(flags);
+    stream.precision(precision);
+}
+
+void writeJson(std::ostream& stream, const std::vector<MeasurementResult>& results) noexcept
+{
+    const auto flags = stream.flags();
+    const auto precision = stream.precision();
+    stream << std::fixed << std::setprecision(RATE_PRECISION);
+
+    stream << "[";
+    const char* separator = "";
+    for (const auto& result : results)
+    {
+        stream << separator << std::endl;
+        separator = ",";
+        stream << "  {" << std::endl;
+        stream << "    \"technology\": \"" << asStringLiteral(result.technology) << "\"," << std::endl;
+        stream << "    \"benchmark\": \"" << asStringLiteral(result.benchmark) << "\"," << std::endl;
+        stream << "    \"payloadSizeInBytes\": " << result.payloadSizeInBytes << "," << std::endl;
+        stream << "    \"numberOfSamples\": " << result.numberOfSamples << "," << std::endl;
+        stream << "    \"numberOfFollowers\": " << result.numberOfFollowers << "," << std::endl;
+        stream << "    \"burstSize\": " << result.burstSize << "," << std::endl;
+        if (result.benchmark == Benchmark::LATENCY)
+        {
+            const auto& latency = result.latency;
+            stream << "    \"latencyInNanoseconds\": {";
+            stream << "\"min\": " << latency.min.toNanoseconds();
+            stream << ", \"average\": " << latency.average.toNanoseconds();
+            stream << ", \"p50\": " << latency.p50.toNanoseconds();
+            stream << ", \"p90\": " << latency.p90.toNanoseconds();
+            stream << ", \"p99\": " << latency.p99.toNanoseconds();
+            stream << ", \"p99.9\": " << latency.p99_9.toNanoseconds();
+            stream << ", \"max\": " << latency.max.toNanoseconds() << "}" << std::endl;
+        }
+        else
+        {
+            stream << "    \"throughput\": {";
+            stream << "\"samplesPerSecond\": " << result.throughput.samplesPerSecond;
+            stream << ", \"megabytesPerSecond\": " << result.throughput.megabytesPerSecond << "}" << std::endl;
+        }
+        stream << "  }";
+    }
+    stream << std::endl << "]" << std::endl;
+
+    stream.flags(flags);
+    stream.precision(precision);
+}
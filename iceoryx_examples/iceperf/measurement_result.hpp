@@ -0,0 +1,72 @@
+// Copyright (c) 2026 by agent <agent@local>. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_EXAMPLES_ICEPERF_MEASUREMENT_RESULT_HPP
+#define IOX_EXAMPLES_ICEPERF_MEASUREMENT_RESULT_HPP
+
+#include "example_common.hpp"
+
+#include "iox/duration.hpp"
+
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+/// @brief The distribution of the one-way latencies of a latency measurement
+struct LatencyStatistics
+{
+    /// @brief Calculates the statistics from the measured round trip times; the one-way latency of a round trip is
+    /// half of its duration
+    /// @param[in] roundTripsInNanoseconds the duration of each round trip, will be sorted
+    static LatencyStatistics fromRoundTrips(std::vector<uint64_t>& roundTripsInNanoseconds) noexcept;
+
+    iox::units::Duration min{iox::units::Duration::zero()};
+    iox::units::Duration average{iox::units::Duration::zero()};
+    iox::units::Duration p50{iox::units::Duration::zero()};
+    iox::units::Duration p90{iox::units::Duration::zero()};
+    iox::units::Duration p99{iox::units::Duration::zero()};
+    iox::units::Duration p99_9{iox::units::Duration::zero()};
+    iox::units::Duration max{iox::units::Duration::zero()};
+};
+
+/// @brief The rate of a one-way throughput measurement
+struct ThroughputStatistics
+{
+    double samplesPerSecond{0.0};
+    double megabytesPerSecond{0.0};
+};
+
+/// @brief The result of a single benchmark for one technology and payload size
+struct MeasurementResult
+{
+    Technology technology{Technology::ALL};
+    Benchmark benchmark{Benchmark::LATENCY};
+    uint32_t payloadSizeInBytes{0U};
+    uint64_t numberOfSamples{0U};
+    uint32_t numberOfFollowers{1U};
+    uint32_t burstSize{1U};
+    LatencyStatistics latency;
+    ThroughputStatistics throughput;
+};
+
+/// @brief Writes the results as comma separated values with a header line; the columns which do not apply to a
+/// benchmark are left empty
+void writeCsv(std::ostream& stream, const std::vector<MeasurementResult>& results) noexcept;
+
+/// @brief Writes the results as a JSON array with one object per result
+void writeJson(std::ostream& stream, const std::vector<MeasurementResult>& results) noexcept;
+
+#endif // IOX_EXAMPLES_ICEPERF_MEASUREMENT_RESULT_HPP
@@ -19,6 +19,7 @@
 #include "iceoryx_dust/cxx/std_string_support.hpp"
 #include "iceoryx_dust/posix_wrapper/message_queue.hpp"
 #include "iceoryx_hoofs/posix_wrapper/posix_call.hpp"
+#include "iceoryx_platform/attributes.hpp"
 #include "iceoryx_platform/fcntl.hpp"
 #include "iceoryx_platform/platform_correction.hpp"
 
@@ -55,7 +56,7 @@ void MQ::cleanupOutdatedResources(const std::string& publisherName, const std::s
         });
 }
 
-void MQ::initLeader() noexcept
+void MQ::initLeader(const uint32_t numberOfFollowers IOX_MAYBE_UNUSED) noexcept
 {
     open(m_subscriberMqName, iox::posix::IpcChannelSide::SERVER);
 
@@ -74,7 +75,7 @@ void MQ::initFollower() noexcept
 
     open(m_publisherMqName, iox::posix::IpcChannelSide::CLIENT);
 
-    sendPerfTopic(sizeof(PerfTopic), RunFlag::RUN);
+    sendPerfTopic(sizeof(PerfTopic), RunFlag::RUN, PerfTopic::NO_REPLY);
 }
 
 void MQ::initMqAttributes() noexcept
@@ -120,7 +121,9 @@ void MQ::shutdown() noexcept
         });
 }
 
-void MQ::sendPerfTopic(const uint32_t payloadSizeInBytes, const RunFlag runFlag) noexcept
+void MQ::sendPerfTopic(const uint32_t payloadSizeInBytes,
+                       const RunFlag runFlag,
+                       const uint32_t replyPayloadSizeInBytes) noexcept
 {
     char* buffer = new char[payloadSizeInBytes];
     auto sample = reinterpret_cast<PerfTopic*>(&buffer[0]);
@@ -128,6 +131,7 @@ void MQ::sendPerfTopic(const uint32_t payloadSizeInBytes, const RunFlag runFlag)
     // Specify the payload size for the measurement
     sample->payloadSize = payloadSizeInBytes;
     sample->runFlag = runFlag;
+    sample->replyPayloadSize = replyPayloadSizeInBytes;
     if (payloadSizeInBytes <= MAX_MESSAGE_SIZE)
     {
         sample->subPackets = 1;
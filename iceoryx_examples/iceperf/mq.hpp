@@ -41,7 +41,7 @@ class MQ : public IcePerfBase
     /// @attention only leader is allowed to call this
     static void cleanupOutdatedResources(const std::string& publisherName, const std::string& subscriberName) noexcept;
 
-    void initLeader() noexcept override;
+    void initLeader(const uint32_t numberOfFollowers) noexcept override;
     void initFollower() noexcept override;
     void shutdown() noexcept override;
 
@@ -51,7 +51,9 @@ class MQ : public IcePerfBase
     void open(const std::string& name, const iox::posix::IpcChannelSide channelSide) noexcept;
     void send(const char* buffer, uint32_t length) noexcept;
     void receive(char* buffer) noexcept;
-    void sendPerfTopic(const uint32_t payloadSizeInBytes, const RunFlag runFlag) noexcept override;
+    void sendPerfTopic(const uint32_t payloadSizeInBytes,
+                       const RunFlag runFlag,
+                       const uint32_t replyPayloadSizeInBytes) noexcept override;
     PerfTopic receivePerfTopic() noexcept override;
 
     const std::string m_publisherMqName;
@@ -27,12 +27,17 @@ struct PerfSettings
     Benchmark benchmark{Benchmark::ALL};
     Technology technology{Technology::ALL};
     uint64_t numberOfSamples{10000U};
+    uint32_t numberOfFollowers{1U};
+    uint32_t burstSize{1U};
 };
 
 struct PerfTopic
 {
+    static constexpr uint32_t NO_REPLY{0U};
+
     uint32_t payloadSize{0};
     uint32_t subPackets{0};
+    uint32_t replyPayloadSize{NO_REPLY};
     RunFlag runFlag{RunFlag::RUN};
 };
 //! [topic data definitions]
@@ -19,6 +19,7 @@
 #include "iceoryx_dust/cxx/std_string_support.hpp"
 #include "iceoryx_hoofs/cxx/requires.hpp"
 #include "iceoryx_hoofs/posix_wrapper/posix_call.hpp"
+#include "iceoryx_platform/attributes.hpp"
 #include "iox/size.hpp"
 
 #include <chrono>
@@ -70,7 +71,7 @@ void UDS::cleanupOutdatedResources(const std::string& publisherName, const std::
         });
 }
 
-void UDS::initLeader() noexcept
+void UDS::initLeader(const uint32_t numberOfFollowers IOX_MAYBE_UNUSED) noexcept
 {
     init();
 
@@ -87,7 +88,7 @@ void UDS::initFollower() noexcept
     std::cout << "registering with the leader" << std::endl;
     waitForLeader();
 
-    sendPerfTopic(sizeof(PerfTopic), RunFlag::RUN);
+    sendPerfTopic(sizeof(PerfTopic), RunFlag::RUN, PerfTopic::NO_REPLY);
 }
 
 void UDS::init() noexcept
@@ -217,7 +218,9 @@ void UDS::shutdown() noexcept
     }
 }
 
-void UDS::sendPerfTopic(const uint32_t payloadSizeInBytes, const RunFlag runFlag) noexcept
+void UDS::sendPerfTopic(const uint32_t payloadSizeInBytes,
+                        const RunFlag runFlag,
+                        const uint32_t replyPayloadSizeInBytes) noexcept
 {
     char* buffer = new char[payloadSizeInBytes];
     auto sample = reinterpret_cast<PerfTopic*>(&buffer[0]);
@@ -225,6 +228,7 @@ void UDS::sendPerfTopic(const uint32_t payloadSizeInBytes, const RunFlag runFlag
     // Specify the payload size for the measurement
     sample->payloadSize = payloadSizeInBytes;
     sample->runFlag = runFlag;
+    sample->replyPayloadSize = replyPayloadSizeInBytes;
     if (payloadSizeInBytes <= MAX_MESSAGE_SIZE)
     {
         sample->subPackets = 1;
@@ -47,7 +47,7 @@ class UDS : public IcePerfBase
     /// @attention only leader is allowed to call this
     static void cleanupOutdatedResources(const std::string& publisherName, const std::string& subscriberName) noexcept;
 
-    void initLeader() noexcept override;
+    void initLeader(const uint32_t numberOfFollowers) noexcept override;
     void initFollower() noexcept override;
     void shutdown() noexcept override;
 
@@ -58,7 +58,9 @@ class UDS : public IcePerfBase
     void receive(char* buffer) noexcept;
     void waitForLeader() noexcept;
     void waitForFollower() noexcept;
-    void sendPerfTopic(const uint32_t payloadSizeInBytes, const RunFlag runFlag) noexcept override;
+    void sendPerfTopic(const uint32_t payloadSizeInBytes,
+                       const RunFlag runFlag,
+                       const uint32_t replyPayloadSizeInBytes) noexcept override;
     PerfTopic receivePerfTopic() noexcept override;
 
     static void initSocketAddress(sockaddr_un& sockAddr, const std::string& socketName);
@@ -92,6 +92,20 @@ class LoFFLi
     /// @return true if index is valid or not yet pushed, false otherwise
     bool push(const Index_t index) noexcept;
 
+    /// Pop up to maxNumberOfIndices values from the free-list by detaching a chain of indices with a single CAS
+    /// @param [out] indices memory for at least maxNumberOfIndices elements to use
+    /// @param [in] maxNumberOfIndices is the maximum number of indices to pop
+    /// @return the number of valid indices which were written to the beginning of 'indices'; 0 if the free-list is
+    /// empty
+    uint32_t popN(Index_t* const indices, const uint32_t maxNumberOfIndices) noexcept;
+
+    /// Push previously poped elements by splicing them as a chain into the free-list with a single CAS
+    /// @param [in] indices to previously poped elements
+    /// @param [in] numberOfIndices is the number of elements in 'indices'
+    /// @return true if all indices are valid and not yet pushed, false otherwise; in the latter case none of the
+    /// indices is pushed
+    bool pushN(const Index_t* const indices, const uint32_t numberOfIndices) noexcept;
+
     /// Calculates the required memory size for a free-list
     /// @param [in] capacity is the number of elements of the free-list
     /// @return the required memory size for a free-list with the requested capacity
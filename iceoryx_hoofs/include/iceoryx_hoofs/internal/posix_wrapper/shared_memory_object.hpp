@@ -118,6 +118,19 @@ class SharedMemoryObjectBuilder
     /// @brief Defines the access permissions of the shared memory
     IOX_BUILDER_PARAMETER(access_rights, permissions, perms::none)
 
+    /// @brief If set, the shared memory is created as file in this directory instead of with shm_open, e.g. in the
+    ///        mount point of a hugetlbfs to back it with huge pages. See SharedMemoryBuilder::directory
+    IOX_BUILDER_PARAMETER(optional<Path>, directory, nullopt)
+
+    /// @brief If set, the newly created shared memory is bound to this NUMA node before it is touched for the first
+    ///        time. A failed binding is reported as warning since the memory is still usable.
+    IOX_BUILDER_PARAMETER(optional<uint32_t>, numaNode, nullopt)
+
+    /// @brief If not zero, the newly created shared memory is prefaulted by writing a single byte of each page with
+    ///        the given size instead of zeroing it completely with memset. The memory provided by the operating system
+    ///        is already zeroed, the write only ensures that the pages are available.
+    IOX_BUILDER_PARAMETER(uint64_t, prefaultPageSize, 0U)
+
   public:
     expected<SharedMemoryObject, SharedMemoryObjectError> create() noexcept;
 };
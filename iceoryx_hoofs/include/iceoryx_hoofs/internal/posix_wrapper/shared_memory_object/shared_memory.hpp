@@ -23,6 +23,7 @@
 #include "iox/file_management_interface.hpp"
 #include "iox/filesystem.hpp"
 #include "iox/optional.hpp"
+#include "iox/path.hpp"
 #include "iox/string.hpp"
 
 #include <cstdint>
@@ -53,7 +54,8 @@ enum class SharedMemoryError
 };
 
 /// @brief Creates a bare metal shared memory object with the posix functions
-///        shm_open, shm_unlink etc.
+///        shm_open, shm_unlink etc. or alternatively as a file in a given directory,
+///        e.g. the mount point of a hugetlbfs to back the shared memory with huge pages.
 ///        It must be used in combination with MemoryMap (or manual mmap calls)
 ///        to gain access to the created/opened shared memory
 class SharedMemory : public FileManagementInterface<SharedMemory>
@@ -85,10 +87,20 @@ class SharedMemory : public FileManagementInterface<SharedMemory>
     ///         SharedMemoryError when the underlying shm_unlink call failed.
     static expected<bool, SharedMemoryError> unlinkIfExist(const Name_t& name) noexcept;
 
+    /// @brief removes shared memory with a given name which was created in the given directory from the system
+    /// @param[in] name name of the shared memory
+    /// @param[in] directory the shared memory was created in
+    /// @return true if the shared memory was removed, false if the shared memory did not exist and
+    ///         SharedMemoryError when the underlying unlink call failed.
+    static expected<bool, SharedMemoryError> unlinkIfExist(const Name_t& name, const Path& directory) noexcept;
+
     friend class SharedMemoryBuilder;
 
   private:
-    SharedMemory(const Name_t& name, const int handle, const bool hasOwnership) noexcept;
+    SharedMemory(const Name_t& name,
+                 const optional<Path>& directory,
+                 const int handle,
+                 const bool hasOwnership) noexcept;
 
     bool unlink() noexcept;
     bool close() noexcept;
@@ -101,6 +113,7 @@ class SharedMemory : public FileManagementInterface<SharedMemory>
     int32_t get_file_handle() const noexcept;
 
     Name_t m_name;
+    optional<Path> m_directory;
     int m_handle{INVALID_HANDLE};
     bool m_hasOwnership{false};
 };
@@ -125,6 +138,11 @@ class SharedMemoryBuilder
     /// @brief Defines the size of the shared memory
     IOX_BUILDER_PARAMETER(uint64_t, size, 0U)
 
+    /// @brief If set, the shared memory is created as file with the given name in this directory instead of with
+    ///        shm_open. With the mount point of a hugetlbfs the shared memory is backed by huge pages, the size
+    ///        must then be a multiple of the huge page size.
+    IOX_BUILDER_PARAMETER(optional<Path>, directory, nullopt)
+
   public:
     /// @brief creates a valid SharedMemory object. If the construction failed the expected
     ///        contains an enum value describing the error.
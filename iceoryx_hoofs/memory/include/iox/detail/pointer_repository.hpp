@@ -21,6 +21,8 @@
 #include "iox/optional.hpp"
 #include "iox/vector.hpp"
 
+#include <cstdint>
+
 namespace iox
 {
 constexpr uint64_t MAX_POINTER_REPO_CAPACITY{10000U};
@@ -40,6 +42,17 @@ class PointerRepository final
         ptr_t endPtr{nullptr};
     };
 
+    /// @brief entry of the address range index which is sorted by the base pointer
+    struct IndexEntry
+    {
+        ptr_t basePtr{nullptr};
+        ptr_t endPtr{nullptr};
+        /// @brief the largest end pointer of this and all preceding entries; this bounds the search for segments
+        /// which contain a pointer when segments overlap
+        ptr_t maxEndPtr{nullptr};
+        id_t id{0U};
+    };
+
     static constexpr id_t MIN_ID{1U};
     static constexpr id_t MAX_ID{CAPACITY - 1U};
 
@@ -90,9 +103,11 @@ class PointerRepository final
     /// @return the base pointer associated with the id
     ptr_t getBasePtr(const id_t id) const noexcept;
 
-    /// @brief returns the id for a given pointer ptr
+    /// @brief returns the id for a given pointer ptr; if the pointer is contained in multiple segments, the smallest
+    /// id is returned
     /// @param[in] ptr is the pointer whose corresponding id is searched for
     /// @return the id the pointer was registered to
+    /// @note the lookup is a binary search over the registered segments which are sorted by their start address
     id_t searchId(const ptr_t ptr) const noexcept;
 
   private:
@@ -103,9 +118,15 @@ class PointerRepository final
     /// and each needs to initialize it via register calls above
 
     iox::vector<Info, CAPACITY> m_info;
-    uint64_t m_maxRegistered{0U};
+    /// @brief the registered segments sorted by their base pointer, used by searchId; it is only modified on
+    /// registration and unregistration, which are rare compared to the lookup
+    iox::vector<IndexEntry, CAPACITY> m_index;
 
     bool addPointerIfIdIsFree(const id_t id, const ptr_t ptr, const uint64_t size) noexcept;
+    void addToIndex(const id_t id, const ptr_t basePtr, const ptr_t endPtr) noexcept;
+    void removeFromIndex(const id_t id) noexcept;
+    void updateMaxEndPtrOfIndex(const uint64_t startPosition) noexcept;
+    uint64_t numberOfIndexEntriesStartingAtOrBefore(const ptr_t ptr) const noexcept;
 };
 } // namespace iox
 
@@ -20,6 +20,8 @@
 
 #include "iox/detail/pointer_repository.hpp"
 
+#include <algorithm>
+
 namespace iox
 {
 template <typename id_t, typename ptr_t, uint64_t CAPACITY>
@@ -63,8 +65,8 @@ inline bool PointerRepository<id_t, ptr_t, CAPACITY>::unregisterPtr(const id_t i
         if (m_info[id].basePtr != nullptr)
         {
             m_info[id].basePtr = nullptr;
+            removeFromIndex(id);
 
-            /// @note do not search for next lower registered index but we could do it here
             return true;
         }
     }
@@ -79,7 +81,7 @@ inline void PointerRepository<id_t, ptr_t, CAPACITY>::unregisterAll() noexcept
     {
         info.basePtr = nullptr;
     }
-    m_maxRegistered = 0U;
+    m_index.clear();
 }
 
 template <typename id_t, typename ptr_t, uint64_t CAPACITY>
@@ -100,19 +102,29 @@ inline ptr_t PointerRepository<id_t, ptr_t, CAPACITY>::getBasePtr(const id_t id)
 template <typename id_t, typename ptr_t, uint64_t CAPACITY>
 inline id_t PointerRepository<id_t, ptr_t, CAPACITY>::searchId(const ptr_t ptr) const noexcept
 {
-    for (id_t id{1U}; id <= m_maxRegistered; ++id)
+    // all entries before this position start at or before ptr
+    auto position = m_index.begin() + numberOfIndexEntriesStartingAtOrBefore(ptr);
+
+    id_t id{RAW_POINTER_BEHAVIOUR_ID};
+    while (position != m_index.begin())
     {
-        // return first id where the ptr is in the corresponding interval
-        // AXIVION Next Construct AutosarC++19_03-M5.14.1 : False positive. vector::operator[](index) has no side-effect when index is less than vector size which is guaranteed by PointerRepository design
-        if ((ptr >= m_info[id].basePtr) && (ptr <= m_info[id].endPtr))
+        --position;
+        if (position->maxEndPtr < ptr)
         {
-            return id;
+            // neither this nor any preceding segment reaches up to ptr
+            break;
+        }
+        // without overlapping segments the first match is the only one, otherwise the smallest id is returned
+        if ((ptr <= position->endPtr) && ((id == RAW_POINTER_BEHAVIOUR_ID) || (position->id < id)))
+        {
+            id = position->id;
         }
     }
     /// @note treat the pointer as a regular pointer if not found
     /// by setting id to RAW_POINTER_BEHAVIOUR_ID
-    return RAW_POINTER_BEHAVIOUR_ID;
+    return id;
 }
+
 template <typename id_t, typename ptr_t, uint64_t CAPACITY>
 inline bool PointerRepository<id_t, ptr_t, CAPACITY>::addPointerIfIdIsFree(const id_t id,
                                                                            const ptr_t ptr,
@@ -127,15 +139,65 @@ inline bool PointerRepository<id_t, ptr_t, CAPACITY>::addPointerIfIdIsFree(const
         // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
         m_info[id].endPtr = reinterpret_cast<ptr_t>(reinterpret_cast<uintptr_t>(ptr) + (size - 1U));
 
-        if (id > m_maxRegistered)
+        if (id >= MIN_ID)
         {
-            m_maxRegistered = id;
+            // a segment registered with a nullptr is still considered to be free and can be registered again
+            removeFromIndex(id);
+            addToIndex(id, ptr, m_info[id].endPtr);
         }
         return true;
     }
     return false;
 }
 
+template <typename id_t, typename ptr_t, uint64_t CAPACITY>
+inline void
+PointerRepository<id_t, ptr_t, CAPACITY>::addToIndex(const id_t id, const ptr_t basePtr, const ptr_t endPtr) noexcept
+{
+    // segments with the same base pointer are kept in the order of their registration
+    const auto insertPosition = numberOfIndexEntriesStartingAtOrBefore(basePtr);
+
+    IndexEntry entry;
+    entry.basePtr = basePtr;
+    entry.endPtr = endPtr;
+    entry.id = id;
+    m_index.emplace(insertPosition, entry);
+    updateMaxEndPtrOfIndex(insertPosition);
+}
+
+template <typename id_t, typename ptr_t, uint64_t CAPACITY>
+inline uint64_t
+PointerRepository<id_t, ptr_t, CAPACITY>::numberOfIndexEntriesStartingAtOrBefore(const ptr_t ptr) const noexcept
+{
+    auto position = std::upper_bound(
+        m_index.begin(), m_index.end(), ptr, [](const ptr_t p, const IndexEntry& entry) { return p < entry.basePtr; });
+    return static_cast<uint64_t>(position - m_index.begin());
+}
+
+template <typename id_t, typename ptr_t, uint64_t CAPACITY>
+inline void PointerRepository<id_t, ptr_t, CAPACITY>::removeFromIndex(const id_t id) noexcept
+{
+    auto position =
+        std::find_if(m_index.begin(), m_index.end(), [id](const IndexEntry& entry) { return entry.id == id; });
+    if (position != m_index.end())
+    {
+        const auto erasePosition = static_cast<uint64_t>(position - m_index.begin());
+        m_index.erase(position);
+        updateMaxEndPtrOfIndex(erasePosition);
+    }
+}
+
+template <typename id_t, typename ptr_t, uint64_t CAPACITY>
+inline void PointerRepository<id_t, ptr_t, CAPACITY>::updateMaxEndPtrOfIndex(const uint64_t startPosition) noexcept
+{
+    for (uint64_t i = startPosition; i < m_index.size(); ++i)
+    {
+        const auto& entry = m_index[i];
+        m_index[i].maxEndPtr =
+            ((i == 0U) || (m_index[i - 1U].maxEndPtr < entry.endPtr)) ? entry.endPtr : m_index[i - 1U].maxEndPtr;
+    }
+}
+
 } // namespace iox
 
 #endif // IOX_HOOFS_MEMORY_POINTER_REPOSITORY_INL
@@ -220,6 +220,32 @@ constexpr bool isPowerOfTwo(const T n) noexcept
     // AXIVION Next Construct AutosarC++19_03-M0.1.2, AutosarC++19_03-M0.1.9, FaultDetection-DeadBranches : False positive! 'n' can be zero.
     return (n > 0) && ((n & (n - 1U)) == 0U);
 }
+
+/// @brief Counts the trailing zero bits of a 64 bit value, i.e. the index of the least significant set bit
+/// @param[in] value to inspect
+/// @return the number of trailing zero bits or 64 if value is zero
+constexpr uint64_t countTrailingZeros(const uint64_t value) noexcept
+{
+    constexpr uint64_t NUMBER_OF_BITS{64U};
+    // a de Bruijn sequence contains every 6 bit pattern exactly once; multiplied with the isolated least significant
+    // bit, the upper 6 bits are unique for each bit index and are mapped to the index by the table
+    constexpr uint64_t DE_BRUIJN_SEQUENCE{0x03F79D71B4CB0A89U};
+    constexpr uint64_t DE_BRUIJN_SHIFT{58U};
+    // NOLINTJUSTIFICATION lookup table which must be usable in a C++14 constexpr function
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays, hicpp-avoid-c-arrays)
+    constexpr uint8_t BIT_INDEX[NUMBER_OF_BITS]{
+        0U,  1U,  48U, 2U,  57U, 49U, 28U, 3U,  61U, 58U, 50U, 42U, 38U, 29U, 17U, 4U,  62U, 55U, 59U, 36U, 53U, 51U,
+        43U, 22U, 45U, 39U, 33U, 30U, 24U, 18U, 12U, 5U,  63U, 47U, 56U, 27U, 60U, 41U, 37U, 16U, 54U, 35U, 52U, 21U,
+        44U, 32U, 23U, 11U, 46U, 26U, 40U, 15U, 34U, 20U, 31U, 10U, 25U, 14U, 19U, 9U,  13U, 8U,  7U,  6U};
+
+    if (value == 0U)
+    {
+        return NUMBER_OF_BITS;
+    }
+    const uint64_t leastSignificantBit{value & (~value + 1U)};
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index) the shifted value is always less than 64
+    return BIT_INDEX[(leastSignificantBit * DE_BRUIJN_SEQUENCE) >> DE_BRUIJN_SHIFT];
+}
 } // namespace iox
 
 #include "iox/detail/algorithm.inl"
@@ -107,5 +107,102 @@ bool LoFFLi::push(const Index_t index) noexcept
     return true;
 }
 
+uint32_t LoFFLi::popN(Index_t* const indices, const uint32_t maxNumberOfIndices) noexcept
+{
+    if (indices == nullptr || maxNumberOfIndices == 0U || !m_nextFreeIndex)
+    {
+        return 0U;
+    }
+
+    Node oldHead = m_head.load(std::memory_order_acquire);
+    Node newHead = oldHead;
+    uint32_t numberOfIndices{0U};
+
+    do
+    {
+        // the chain is only stable as long as the head is unchanged; if another thread modified the free-list while
+        // the chain is traversed, the CAS fails due to the aba counter and the traversal is repeated
+        numberOfIndices = 0U;
+        Index_t nextFreeIndex = oldHead.indexToNextFreeIndex;
+        while (numberOfIndices < maxNumberOfIndices && nextFreeIndex < m_size)
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) limited by maxNumberOfIndices
+            indices[numberOfIndices] = nextFreeIndex;
+            ++numberOfIndices;
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) upper limit of index set by m_size
+            nextFreeIndex = m_nextFreeIndex.get()[nextFreeIndex];
+        }
+
+        if (numberOfIndices == 0U)
+        {
+            return 0U;
+        }
+
+        newHead.indexToNextFreeIndex = nextFreeIndex;
+        newHead.abaCounter = oldHead.abaCounter + 1;
+    } while (!m_head.compare_exchange_weak(oldHead, newHead, std::memory_order_acq_rel, std::memory_order_acquire));
+
+    for (uint32_t i = 0U; i < numberOfIndices; ++i)
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) indices are limited by m_size
+        m_nextFreeIndex.get()[indices[i]] = m_invalidIndex;
+    }
+
+    /// we need to synchronize m_nextFreeIndex with push so that we can perform a validation
+    /// check right before push to avoid double free's
+    std::atomic_thread_fence(std::memory_order_release);
+
+    return numberOfIndices;
+}
+
+bool LoFFLi::pushN(const Index_t* const indices, const uint32_t numberOfIndices) noexcept
+{
+    if (indices == nullptr || numberOfIndices == 0U)
+    {
+        return numberOfIndices == 0U;
+    }
+
+    /// we synchronize with m_nextFreeIndex in pop to perform the validity check
+    std::atomic_thread_fence(std::memory_order_release);
+
+    /// the indices are validated and linked to a chain in one pass; since a linked index is not marked as acquired
+    /// anymore, an index which occurs twice in 'indices' is detected like a double free
+    const Index_t lastIndex = indices[numberOfIndices - 1U];
+    for (uint32_t i = 0U; i < numberOfIndices; ++i)
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) limited by numberOfIndices
+        const Index_t index = indices[i];
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) index is limited by capacity
+        if (index >= m_size || !m_nextFreeIndex || m_nextFreeIndex.get()[index] != m_invalidIndex)
+        {
+            for (uint32_t j = 0U; j < i; ++j)
+            {
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) validated in the previous pass
+                m_nextFreeIndex.get()[indices[j]] = m_invalidIndex;
+            }
+            return false;
+        }
+
+        if (i + 1U < numberOfIndices)
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) index is limited by capacity
+            m_nextFreeIndex.get()[index] = indices[i + 1U];
+        }
+    }
+
+    Node oldHead = m_head.load(std::memory_order_acquire);
+    Node newHead = oldHead;
+
+    do
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) index is limited by capacity
+        m_nextFreeIndex.get()[lastIndex] = oldHead.indexToNextFreeIndex;
+        newHead.indexToNextFreeIndex = indices[0];
+        newHead.abaCounter += 1;
+    } while (!m_head.compare_exchange_weak(oldHead, newHead, std::memory_order_acq_rel, std::memory_order_acquire));
+
+    return true;
+}
+
 } // namespace concurrent
 } // namespace iox
@@ -16,9 +16,11 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object.hpp"
+#include "iceoryx_hoofs/posix_wrapper/posix_call.hpp"
 #include "iceoryx_hoofs/posix_wrapper/signal_handler.hpp"
 #include "iceoryx_hoofs/posix_wrapper/types.hpp"
 #include "iceoryx_platform/fcntl.hpp"
+#include "iceoryx_platform/mman.hpp"
 #include "iceoryx_platform/unistd.hpp"
 #include "iox/attributes.hpp"
 #include "iox/logging.hpp"
@@ -84,6 +86,7 @@ expected<SharedMemoryObject, SharedMemoryObjectError> SharedMemoryObjectBuilder:
                             .openMode(m_openMode)
                             .size(m_memorySizeInBytes)
                             .filePermissions(m_permissions)
+                            .directory(m_directory)
                             .create();
 
     if (!sharedMemory)
@@ -131,6 +134,18 @@ expected<SharedMemoryObject, SharedMemoryObjectError> SharedMemoryObjectBuilder:
     {
         IOX_LOG(DEBUG) << "Trying to reserve " << m_memorySizeInBytes << " bytes in the shared memory [" << m_name
                        << "]";
+        if (m_numaNode)
+        {
+            // the memory policy has to be set before the pages are touched for the first time
+            posixCall(iox_mbind)(memoryMap->getBaseAddress(), realSize, *m_numaNode)
+                .failureReturnValue(-1)
+                .evaluate()
+                .or_else([this](auto& r) {
+                    IOX_LOG(WARN) << "Unable to bind the shared memory [" << m_name << "] to the NUMA node "
+                                  << *m_numaNode << " : " << r.getHumanReadableErrnum();
+                });
+        }
+
         if (platform::IOX_SHM_WRITE_ZEROS_ON_CREATION)
         {
             // this lock is required for the case that multiple threads are creating multiple
@@ -161,7 +176,19 @@ expected<SharedMemoryObject, SharedMemoryObjectError> SharedMemoryObjectBuilder:
                 (m_baseAddressHint) ? *m_baseAddressHint : nullptr,
                 m_permissions.value()));
 
-            memset(memoryMap->getBaseAddress(), 0, m_memorySizeInBytes);
+            if (m_prefaultPageSize > 0U)
+            {
+                auto* memory = static_cast<volatile uint8_t*>(memoryMap->getBaseAddress());
+                for (uint64_t offset = 0U; offset < m_memorySizeInBytes; offset += m_prefaultPageSize)
+                {
+                    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) offset is within the mapping
+                    memory[offset] = 0U;
+                }
+            }
+            else
+            {
+                memset(memoryMap->getBaseAddress(), 0, m_memorySizeInBytes);
+            }
         }
         IOX_LOG(DEBUG) << "Acquired " << m_memorySizeInBytes << " bytes successfully in the shared memory [" << m_name
                        << "]";
@@ -39,6 +39,37 @@ string<SharedMemory::Name_t::capacity() + 1> addLeadingSlash(const SharedMemory:
     return nameWithLeadingSlash;
 }
 
+optional<Path> filePathInDirectory(const Path& directory, const SharedMemory::Name_t& name) noexcept
+{
+    const auto nameWithLeadingSlash = addLeadingSlash(name);
+    if (directory.size() + nameWithLeadingSlash.size() > Path::capacity())
+    {
+        return nullopt;
+    }
+
+    string<Path::capacity()> filePath{directory.as_string()};
+    filePath.append(TruncateToCapacity, nameWithLeadingSlash);
+    optional<Path> result;
+    Path::create(filePath).and_then([&](auto& path) { result.emplace(path); });
+    return result;
+}
+
+int openSharedMemory(const optional<Path>& filePath, const char* nameWithLeadingSlash, int oflag, mode_t mode)
+{
+    return (filePath) ? iox_open(filePath->as_string().c_str(), oflag, mode)
+                      : iox_shm_open(nameWithLeadingSlash, oflag, mode);
+}
+
+int unlinkSharedMemory(const optional<Path>& filePath, const char* nameWithLeadingSlash)
+{
+    return (filePath) ? iox_unlink(filePath->as_string().c_str()) : iox_shm_unlink(nameWithLeadingSlash);
+}
+
+int closeSharedMemory(const optional<Path>& directory, int handle)
+{
+    return (directory) ? iox_close(handle) : iox_shm_close(handle);
+}
+
 expected<SharedMemory, SharedMemoryError> SharedMemoryBuilder::create() noexcept
 {
     auto printError = [this] {
@@ -46,7 +77,7 @@ expected<SharedMemory, SharedMemoryError> SharedMemoryBuilder::create() noexcept
                        << ", access mode = " << asStringLiteral(m_accessMode)
                        << ", open mode = " << asStringLiteral(m_openMode)
                        << ", mode = " << iox::log::oct(m_filePermissions.value()) << ", sizeInBytes = " << m_size
-                       << " ]";
+                       << ", directory = " << ((m_directory) ? m_directory->as_string().c_str() : "(shm_open)") << " ]";
     };
 
 
@@ -65,6 +96,17 @@ expected<SharedMemory, SharedMemoryError> SharedMemoryBuilder::create() noexcept
     }
 
     auto nameWithLeadingSlash = addLeadingSlash(m_name);
+    optional<Path> filePath;
+    if (m_directory)
+    {
+        filePath = filePathInDirectory(*m_directory, m_name);
+        if (!filePath)
+        {
+            IOX_LOG(ERROR) << "The shared memory name \"" << m_name << "\" does not fit into the directory \""
+                           << m_directory->as_string() << "\"";
+            return error<SharedMemoryError>(SharedMemoryError::INVALID_FILE_NAME);
+        }
+    }
 
     bool hasOwnership = (m_openMode == OpenMode::EXCLUSIVE_CREATE || m_openMode == OpenMode::PURGE_AND_CREATE
                          || m_openMode == OpenMode::OPEN_OR_CREATE);
@@ -84,14 +126,15 @@ expected<SharedMemory, SharedMemoryError> SharedMemoryBuilder::create() noexcept
 
         if (m_openMode == OpenMode::PURGE_AND_CREATE)
         {
-            IOX_DISCARD_RESULT(posixCall(iox_shm_unlink)(nameWithLeadingSlash.c_str())
+            IOX_DISCARD_RESULT(posixCall(unlinkSharedMemory)(filePath, nameWithLeadingSlash.c_str())
                                    .failureReturnValue(SharedMemory::INVALID_HANDLE)
                                    .ignoreErrnos(ENOENT)
                                    .evaluate());
         }
 
         auto result =
-            posixCall(iox_shm_open)(
+            posixCall(openSharedMemory)(
+                filePath,
                 nameWithLeadingSlash.c_str(),
                 convertToOflags(m_accessMode,
                                 (m_openMode == OpenMode::OPEN_OR_CREATE) ? OpenMode::EXCLUSIVE_CREATE : m_openMode),
@@ -106,9 +149,10 @@ expected<SharedMemory, SharedMemoryError> SharedMemoryBuilder::create() noexcept
             if (m_openMode == OpenMode::OPEN_OR_CREATE && result.get_error().errnum == EEXIST)
             {
                 hasOwnership = false;
-                result = posixCall(iox_shm_open)(nameWithLeadingSlash.c_str(),
-                                                 convertToOflags(m_accessMode, OpenMode::OPEN_EXISTING),
-                                                 m_filePermissions.value())
+                result = posixCall(openSharedMemory)(filePath,
+                                                     nameWithLeadingSlash.c_str(),
+                                                     convertToOflags(m_accessMode, OpenMode::OPEN_EXISTING),
+                                                     m_filePermissions.value())
                              .failureReturnValue(SharedMemory::INVALID_HANDLE)
                              .evaluate();
             }
@@ -132,7 +176,7 @@ expected<SharedMemory, SharedMemoryError> SharedMemoryBuilder::create() noexcept
         {
             printError();
 
-            posixCall(iox_shm_close)(sharedMemoryFileHandle)
+            posixCall(closeSharedMemory)(m_directory, sharedMemoryFileHandle)
                 .failureReturnValue(SharedMemory::INVALID_HANDLE)
                 .evaluate()
                 .or_else([&](auto& r) {
@@ -140,7 +184,7 @@ expected<SharedMemory, SharedMemoryError> SharedMemoryBuilder::create() noexcept
                                    << " for SharedMemory \"" << m_name << "\"";
                 });
 
-            posixCall(iox_shm_unlink)(nameWithLeadingSlash.c_str())
+            posixCall(unlinkSharedMemory)(filePath, nameWithLeadingSlash.c_str())
                 .failureReturnValue(SharedMemory::INVALID_HANDLE)
                 .evaluate()
                 .or_else([&](auto&) {
@@ -152,11 +196,15 @@ expected<SharedMemory, SharedMemoryError> SharedMemoryBuilder::create() noexcept
         }
     }
 
-    return success<SharedMemory>(SharedMemory(m_name, sharedMemoryFileHandle, hasOwnership));
+    return success<SharedMemory>(SharedMemory(m_name, m_directory, sharedMemoryFileHandle, hasOwnership));
 }
 
-SharedMemory::SharedMemory(const Name_t& name, const int handle, const bool hasOwnership) noexcept
+SharedMemory::SharedMemory(const Name_t& name,
+                           const optional<Path>& directory,
+                           const int handle,
+                           const bool hasOwnership) noexcept
     : m_name{name}
+    , m_directory{directory}
     , m_handle{handle}
     , m_hasOwnership{hasOwnership}
 {
@@ -177,6 +225,7 @@ void SharedMemory::reset() noexcept
 {
     m_hasOwnership = false;
     m_name = Name_t();
+    m_directory.reset();
     m_handle = INVALID_HANDLE;
 }
 
@@ -192,6 +241,7 @@ SharedMemory& SharedMemory::operator=(SharedMemory&& rhs) noexcept
         destroy();
 
         m_name = rhs.m_name;
+        m_directory = rhs.m_directory;
         m_hasOwnership = rhs.m_hasOwnership;
         m_handle = rhs.m_handle;
 
@@ -232,11 +282,32 @@ expected<bool, SharedMemoryError> SharedMemory::unlinkIfExist(const Name_t& name
     return error<SharedMemoryError>(errnoToEnum(result.get_error().errnum));
 }
 
+expected<bool, SharedMemoryError> SharedMemory::unlinkIfExist(const Name_t& name, const Path& directory) noexcept
+{
+    auto filePath = filePathInDirectory(directory, name);
+    if (!filePath)
+    {
+        return error<SharedMemoryError>(SharedMemoryError::INVALID_FILE_NAME);
+    }
+
+    auto result = posixCall(iox_unlink)(filePath->as_string().c_str())
+                      .failureReturnValue(INVALID_HANDLE)
+                      .ignoreErrnos(ENOENT)
+                      .evaluate();
+
+    if (!result.has_error())
+    {
+        return success<bool>(result->errnum != ENOENT);
+    }
+
+    return error<SharedMemoryError>(errnoToEnum(result.get_error().errnum));
+}
+
 bool SharedMemory::unlink() noexcept
 {
     if (m_hasOwnership)
     {
-        auto unlinkResult = unlinkIfExist(m_name);
+        auto unlinkResult = (m_directory) ? unlinkIfExist(m_name, *m_directory) : unlinkIfExist(m_name);
         if (unlinkResult.has_error() || !unlinkResult.value())
         {
             IOX_LOG(ERROR) << "Unable to unlink SharedMemory (shm_unlink failed).";
@@ -253,11 +324,13 @@ bool SharedMemory::close() noexcept
 {
     if (m_handle != INVALID_HANDLE)
     {
-        auto call =
-            posixCall(iox_shm_close)(m_handle).failureReturnValue(INVALID_HANDLE).evaluate().or_else([](auto& r) {
-                IOX_LOG(ERROR) << "Unable to close SharedMemory filedescriptor (close failed) : "
-                               << r.getHumanReadableErrnum();
-            });
+        auto call = posixCall(closeSharedMemory)(m_directory, m_handle)
+                        .failureReturnValue(INVALID_HANDLE)
+                        .evaluate()
+                        .or_else([](auto& r) {
+                            IOX_LOG(ERROR) << "Unable to close SharedMemory filedescriptor (close failed) : "
+                                           << r.getHumanReadableErrnum();
+                        });
 
         m_handle = INVALID_HANDLE;
         return !call.has_error();
@@ -227,4 +227,99 @@ TYPED_TEST(LoFFLi_test, PushToUninitializedLoFFLi)
     decltype(this->m_loffli) loFFLi;
     EXPECT_THAT(loFFLi.push(0), Eq(false));
 }
+
+TYPED_TEST(LoFFLi_test, PopNReturnsAllIndices)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9f8d8a3b-9152-415b-a79c-791db608e42f");
+    std::vector<uint32_t> indices(Size);
+
+    EXPECT_THAT(this->m_loffli.popN(indices.data(), Size), Eq(Size));
+    EXPECT_THAT(indices, ElementsAre(0U, 1U, 2U, 3U));
+
+    uint32_t index{0};
+    EXPECT_THAT(this->m_loffli.pop(index), Eq(false));
+    EXPECT_THAT(this->m_loffli.popN(indices.data(), Size), Eq(0U));
+}
+
+TYPED_TEST(LoFFLi_test, PopNWithMoreIndicesThanAvailableReturnsOnlyAvailableIndices)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0c670452-628b-4e9e-a072-81fed80a1ccf");
+    constexpr uint32_t REQUESTED_INDICES{Size + 2U};
+    std::vector<uint32_t> indices(REQUESTED_INDICES);
+
+    EXPECT_THAT(this->m_loffli.popN(indices.data(), REQUESTED_INDICES), Eq(Size));
+}
+
+TYPED_TEST(LoFFLi_test, PopNWithFewerIndicesThanAvailableLeavesRemainingIndices)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "652996e2-0eb0-4fa5-92a1-ce0eb4e061b0");
+    std::vector<uint32_t> indices(2U);
+
+    EXPECT_THAT(this->m_loffli.popN(indices.data(), 2U), Eq(2U));
+    EXPECT_THAT(indices, ElementsAre(0U, 1U));
+
+    uint32_t index{0};
+    EXPECT_THAT(this->m_loffli.pop(index), Eq(true));
+    EXPECT_THAT(index, Eq(2U));
+}
+
+TYPED_TEST(LoFFLi_test, PopNFromUninitializedLoFFLi)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1e1d97b9-e457-4e9b-b34e-a9f0fd1aa700");
+    std::vector<uint32_t> indices(Size);
+
+    decltype(this->m_loffli) loFFLi;
+    EXPECT_THAT(loFFLi.popN(indices.data(), Size), Eq(0U));
+}
+
+TYPED_TEST(LoFFLi_test, PushNOfPoppedIndicesMakesThemAvailableAgain)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "63be9432-69eb-4310-b3e7-198862b03d3e");
+    std::vector<uint32_t> indices(Size);
+    ASSERT_THAT(this->m_loffli.popN(indices.data(), Size), Eq(Size));
+    std::reverse(indices.begin(), indices.end());
+
+    EXPECT_THAT(this->m_loffli.pushN(indices.data(), Size), Eq(true));
+
+    std::vector<uint32_t> poppedIndices(Size);
+    EXPECT_THAT(this->m_loffli.popN(poppedIndices.data(), Size), Eq(Size));
+    EXPECT_THAT(poppedIndices, Eq(indices));
+}
+
+TYPED_TEST(LoFFLi_test, PushNWithDuplicateIndexFailsAndPushesNothing)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1cdb57d4-9e84-4c4c-bba9-e978aa139bb7");
+    std::vector<uint32_t> indices(Size);
+    ASSERT_THAT(this->m_loffli.popN(indices.data(), Size), Eq(Size));
+
+    std::vector<uint32_t> indicesWithDuplicate{0U, 1U, 0U};
+    EXPECT_THAT(this->m_loffli.pushN(indicesWithDuplicate.data(), 3U), Eq(false));
+
+    uint32_t index{0};
+    EXPECT_THAT(this->m_loffli.pop(index), Eq(false));
+    EXPECT_THAT(this->m_loffli.pushN(indices.data(), Size), Eq(true));
+}
+
+TYPED_TEST(LoFFLi_test, PushNWithIndexWhichWasNotPoppedFailsAndPushesNothing)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f52baf98-45ee-4233-982f-bbf4b6ba5403");
+    std::vector<uint32_t> indices(2U);
+    ASSERT_THAT(this->m_loffli.popN(indices.data(), 2U), Eq(2U));
+
+    std::vector<uint32_t> indicesWithFreeIndex{0U, 1U, 2U};
+    EXPECT_THAT(this->m_loffli.pushN(indicesWithFreeIndex.data(), 3U), Eq(false));
+    std::vector<uint32_t> indicesWithOutOfBoundIndex{0U, Size};
+    EXPECT_THAT(this->m_loffli.pushN(indicesWithOutOfBoundIndex.data(), 2U), Eq(false));
+
+    EXPECT_THAT(this->m_loffli.pushN(indices.data(), 2U), Eq(true));
+}
+
+TYPED_TEST(LoFFLi_test, PushNToUninitializedLoFFLi)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "604095cf-c343-4fc9-b942-838f5484cdfc");
+    std::vector<uint32_t> indices{0U};
+
+    decltype(this->m_loffli) loFFLi;
+    EXPECT_THAT(loFFLi.pushN(indices.data(), 1U), Eq(false));
+}
 } // namespace
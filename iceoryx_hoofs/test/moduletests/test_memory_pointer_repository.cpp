@@ -0,0 +1,140 @@
+// Copyright (c) 2026 by agent <agent@local>. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iox/detail/pointer_repository.hpp"
+#include "test.hpp"
+
+#include <cstdint>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox;
+
+constexpr uint64_t REPOSITORY_CAPACITY{128U};
+constexpr uint64_t SEGMENT_SIZE{64U};
+constexpr uint64_t NUMBER_OF_SEGMENTS{REPOSITORY_CAPACITY - 1U};
+
+using Repository_t = PointerRepository<uint64_t, void*, REPOSITORY_CAPACITY>;
+
+class PointerRepository_test : public Test
+{
+  public:
+    void* segment(const uint64_t index, const uint64_t offset = 0U)
+    {
+        // NOLINTJUSTIFICATION Used only for test purposes
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+        return &memory[index * SEGMENT_SIZE + offset];
+    }
+
+    Repository_t sut;
+    // NOLINTJUSTIFICATION Used only for test purposes
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays, hicpp-avoid-c-arrays)
+    uint8_t memory[NUMBER_OF_SEGMENTS * SEGMENT_SIZE]{0U};
+};
+
+TEST_F(PointerRepository_test, SearchIdWithoutRegisteredSegmentsReturnsRawPointerId)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "581ecbd3-1c68-4e1b-b8f3-162877add4ba");
+    EXPECT_THAT(sut.searchId(segment(0U)), Eq(Repository_t::RAW_POINTER_BEHAVIOUR_ID));
+}
+
+TEST_F(PointerRepository_test, SearchIdFindsSegmentContainingThePointer)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d2c3a13f-1608-4125-8e96-b0c7d1e5d113");
+    // the segments are registered in a different order than they are located in memory
+    ASSERT_TRUE(sut.registerPtrWithId(3U, segment(0U), SEGMENT_SIZE));
+    ASSERT_TRUE(sut.registerPtrWithId(1U, segment(4U), SEGMENT_SIZE));
+    ASSERT_TRUE(sut.registerPtrWithId(2U, segment(2U), SEGMENT_SIZE));
+
+    EXPECT_THAT(sut.searchId(segment(0U)), Eq(3U));
+    EXPECT_THAT(sut.searchId(segment(0U, SEGMENT_SIZE - 1U)), Eq(3U));
+    EXPECT_THAT(sut.searchId(segment(1U)), Eq(Repository_t::RAW_POINTER_BEHAVIOUR_ID));
+    EXPECT_THAT(sut.searchId(segment(2U, SEGMENT_SIZE / 2U)), Eq(2U));
+    EXPECT_THAT(sut.searchId(segment(3U, SEGMENT_SIZE - 1U)), Eq(Repository_t::RAW_POINTER_BEHAVIOUR_ID));
+    EXPECT_THAT(sut.searchId(segment(4U, SEGMENT_SIZE - 1U)), Eq(1U));
+    EXPECT_THAT(sut.searchId(segment(5U)), Eq(Repository_t::RAW_POINTER_BEHAVIOUR_ID));
+}
+
+TEST_F(PointerRepository_test, SearchIdDoesNotFindUnregisteredSegment)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "100ab4d6-10ee-4ebc-b4ad-7fb0e8d49689");
+    ASSERT_TRUE(sut.registerPtrWithId(1U, segment(0U), SEGMENT_SIZE));
+    ASSERT_TRUE(sut.registerPtrWithId(2U, segment(1U), SEGMENT_SIZE));
+
+    ASSERT_TRUE(sut.unregisterPtr(1U));
+
+    EXPECT_THAT(sut.searchId(segment(0U, 1U)), Eq(Repository_t::RAW_POINTER_BEHAVIOUR_ID));
+    EXPECT_THAT(sut.searchId(segment(1U, 1U)), Eq(2U));
+}
+
+TEST_F(PointerRepository_test, SearchIdFindsSegmentWhichIsRegisteredAgainAtAnotherLocation)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ef28dbcc-09f9-4165-a733-54cfd242e163");
+    ASSERT_TRUE(sut.registerPtrWithId(1U, segment(0U), SEGMENT_SIZE));
+    ASSERT_TRUE(sut.unregisterPtr(1U));
+    ASSERT_TRUE(sut.registerPtrWithId(1U, segment(3U), SEGMENT_SIZE));
+
+    EXPECT_THAT(sut.searchId(segment(0U)), Eq(Repository_t::RAW_POINTER_BEHAVIOUR_ID));
+    EXPECT_THAT(sut.searchId(segment(3U)), Eq(1U));
+}
+
+TEST_F(PointerRepository_test, SearchIdReturnsSmallestIdOfOverlappingSegments)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5dfb68a1-ace4-43c4-84b3-ba8cbe389978");
+    ASSERT_TRUE(sut.registerPtrWithId(5U, segment(0U), 4U * SEGMENT_SIZE));
+    ASSERT_TRUE(sut.registerPtrWithId(2U, segment(1U), SEGMENT_SIZE));
+    ASSERT_TRUE(sut.registerPtrWithId(7U, segment(2U), SEGMENT_SIZE));
+
+    EXPECT_THAT(sut.searchId(segment(0U)), Eq(5U));
+    EXPECT_THAT(sut.searchId(segment(1U)), Eq(2U));
+    EXPECT_THAT(sut.searchId(segment(2U)), Eq(5U));
+    EXPECT_THAT(sut.searchId(segment(3U, SEGMENT_SIZE - 1U)), Eq(5U));
+    EXPECT_THAT(sut.searchId(segment(4U)), Eq(Repository_t::RAW_POINTER_BEHAVIOUR_ID));
+}
+
+TEST_F(PointerRepository_test, SearchIdFindsAllSegmentsWhenRepositoryIsFull)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "77c8e7f3-65c6-4f1f-911c-5e6023051456");
+    for (uint64_t i = 0U; i < NUMBER_OF_SEGMENTS; ++i)
+    {
+        auto id = sut.registerPtr(segment(NUMBER_OF_SEGMENTS - 1U - i), SEGMENT_SIZE);
+        ASSERT_TRUE(id.has_value());
+        EXPECT_THAT(id.value(), Eq(i + 1U));
+    }
+    EXPECT_FALSE(sut.registerPtr(segment(0U), SEGMENT_SIZE).has_value());
+
+    for (uint64_t i = 0U; i < NUMBER_OF_SEGMENTS; ++i)
+    {
+        EXPECT_THAT(sut.searchId(segment(i, SEGMENT_SIZE / 2U)), Eq(NUMBER_OF_SEGMENTS - i));
+    }
+}
+
+TEST_F(PointerRepository_test, SearchIdAfterUnregisterAllReturnsRawPointerId)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "84431ee6-d237-4171-9af9-f54f945d458f");
+    ASSERT_TRUE(sut.registerPtrWithId(1U, segment(0U), SEGMENT_SIZE));
+    ASSERT_TRUE(sut.registerPtrWithId(2U, segment(1U), SEGMENT_SIZE));
+
+    sut.unregisterAll();
+
+    EXPECT_THAT(sut.searchId(segment(0U)), Eq(Repository_t::RAW_POINTER_BEHAVIOUR_ID));
+    EXPECT_THAT(sut.searchId(segment(1U)), Eq(Repository_t::RAW_POINTER_BEHAVIOUR_ID));
+    EXPECT_TRUE(sut.registerPtrWithId(1U, segment(1U), SEGMENT_SIZE));
+    EXPECT_THAT(sut.searchId(segment(1U)), Eq(1U));
+}
+
+} // namespace
@@ -265,4 +265,81 @@ TEST_F(SharedMemory_Test, OpenFailsWhenCreatingShmInReadOnlyMode)
 }
 
 
+#if !defined(_WIN32)
+TEST_F(SharedMemory_Test, CreateInDirectoryCreatesAndRemovesFileInDirectory)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "70c4ea65-16a2-4807-9f45-c182f99fabe7");
+    const auto directory = Path::create(platform::IOX_TEMP_DIR).expect("valid directory");
+    const std::string filePath = std::string(platform::IOX_TEMP_DIR) + "/" + SUT_SHM_NAME;
+    IOX_DISCARD_RESULT(SharedMemory::unlinkIfExist(SUT_SHM_NAME, directory));
+
+    {
+        auto sut = iox::posix::SharedMemoryBuilder()
+                       .name(SUT_SHM_NAME)
+                       .accessMode(iox::posix::AccessMode::READ_WRITE)
+                       .openMode(OpenMode::EXCLUSIVE_CREATE)
+                       .filePermissions(perms::owner_all)
+                       .size(128)
+                       .directory(directory)
+                       .create();
+        ASSERT_FALSE(sut.has_error());
+        EXPECT_TRUE(sut->hasOwnership());
+        EXPECT_THAT(iox_access(filePath.c_str(), F_OK), Eq(0));
+    }
+
+    EXPECT_THAT(iox_access(filePath.c_str(), F_OK), Ne(0));
+}
+
+TEST_F(SharedMemory_Test, OpenInDirectoryOpensSharedMemoryCreatedInDirectory)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9683d4d8-f021-40d9-88d7-451da21151de");
+    const auto directory = Path::create(platform::IOX_TEMP_DIR).expect("valid directory");
+    auto creator = iox::posix::SharedMemoryBuilder()
+                       .name(SUT_SHM_NAME)
+                       .accessMode(iox::posix::AccessMode::READ_WRITE)
+                       .openMode(OpenMode::PURGE_AND_CREATE)
+                       .filePermissions(perms::owner_all)
+                       .size(128)
+                       .directory(directory)
+                       .create();
+    ASSERT_FALSE(creator.has_error());
+
+    auto sut = iox::posix::SharedMemoryBuilder()
+                   .name(SUT_SHM_NAME)
+                   .accessMode(iox::posix::AccessMode::READ_WRITE)
+                   .openMode(OpenMode::OPEN_EXISTING)
+                   .directory(directory)
+                   .create();
+    ASSERT_FALSE(sut.has_error());
+    EXPECT_FALSE(sut->hasOwnership());
+
+    // the shared memory in the directory is not visible via shm_open
+    EXPECT_TRUE(createSut(SUT_SHM_NAME, OpenMode::OPEN_EXISTING).has_error());
+}
+
+TEST_F(SharedMemory_Test, UnlinkExistingSharedMemoryInDirectoryWorks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f04196db-f9ef-44e8-821b-78aff45b651c");
+    const auto directory = Path::create(platform::IOX_TEMP_DIR).expect("valid directory");
+    auto sut = iox::posix::SharedMemoryBuilder()
+                   .name(SUT_SHM_NAME)
+                   .accessMode(iox::posix::AccessMode::READ_WRITE)
+                   .openMode(OpenMode::PURGE_AND_CREATE)
+                   .filePermissions(perms::owner_all)
+                   .size(128)
+                   .directory(directory)
+                   .create();
+    ASSERT_FALSE(sut.has_error());
+
+    auto result = SharedMemory::unlinkIfExist(SUT_SHM_NAME, directory);
+    ASSERT_FALSE(result.has_error());
+    EXPECT_TRUE(*result);
+
+    result = SharedMemory::unlinkIfExist(SUT_SHM_NAME, directory);
+    ASSERT_FALSE(result.has_error());
+    EXPECT_FALSE(*result);
+}
+#endif
+
+
 } // namespace
@@ -162,6 +162,83 @@ TEST_F(SharedMemoryObject_Test, OpenSutMapsAllMemoryIntoProcess)
     }
 }
 
+TEST_F(SharedMemoryObject_Test, PrefaultedSharedMemoryIsZeroed)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "cd203abc-7ef6-4268-b011-e9bf45d3027d");
+    constexpr uint64_t PAGE_SIZE{4096U};
+    constexpr uint64_t MEMORY_SIZE{4U * PAGE_SIZE};
+    auto sut = iox::posix::SharedMemoryObjectBuilder()
+                   .name("shmPrefault")
+                   .memorySizeInBytes(MEMORY_SIZE)
+                   .accessMode(iox::posix::AccessMode::READ_WRITE)
+                   .openMode(iox::posix::OpenMode::PURGE_AND_CREATE)
+                   .permissions(perms::owner_all)
+                   .prefaultPageSize(PAGE_SIZE)
+                   .create()
+                   .expect("failed to create sut");
+
+    auto* data = static_cast<uint8_t*>(sut.getBaseAddress());
+    for (uint64_t i = 0U; i < MEMORY_SIZE; ++i)
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        ASSERT_THAT(data[i], Eq(0U));
+    }
+}
+
+#if !defined(_WIN32)
+TEST_F(SharedMemoryObject_Test, SharedMemoryInDirectoryCanBeOpenedByASecondObject)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5db36d4d-ebac-42e2-8228-5dbe420a0996");
+    constexpr uint64_t MEMORY_SIZE{128U};
+    constexpr uint8_t MAGIC_VALUE{73U};
+    const auto directory = Path::create(platform::IOX_TEMP_DIR).expect("valid directory");
+    auto creator = iox::posix::SharedMemoryObjectBuilder()
+                       .name("shmInDirectory")
+                       .memorySizeInBytes(MEMORY_SIZE)
+                       .accessMode(iox::posix::AccessMode::READ_WRITE)
+                       .openMode(iox::posix::OpenMode::PURGE_AND_CREATE)
+                       .permissions(perms::owner_all)
+                       .directory(directory)
+                       .create()
+                       .expect("failed to create shared memory");
+    static_cast<uint8_t*>(creator.getBaseAddress())[MEMORY_SIZE - 1U] = MAGIC_VALUE;
+
+    auto sut = iox::posix::SharedMemoryObjectBuilder()
+                   .name("shmInDirectory")
+                   .memorySizeInBytes(MEMORY_SIZE)
+                   .accessMode(iox::posix::AccessMode::READ_WRITE)
+                   .openMode(iox::posix::OpenMode::OPEN_EXISTING)
+                   .directory(directory)
+                   .create()
+                   .expect("failed to open shared memory");
+
+    EXPECT_THAT(static_cast<uint8_t*>(sut.getBaseAddress())[MEMORY_SIZE - 1U], Eq(MAGIC_VALUE));
+}
+#endif
+
+#if defined(__linux__)
+TEST_F(SharedMemoryObject_Test, SharedMemoryBoundToNumaNodeZeroIsUsable)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8c6941d3-e167-4ac1-be85-6758aa034177");
+    constexpr uint64_t MEMORY_SIZE{8192U};
+    auto sut = iox::posix::SharedMemoryObjectBuilder()
+                   .name("shmNumaNode")
+                   .memorySizeInBytes(MEMORY_SIZE)
+                   .accessMode(iox::posix::AccessMode::READ_WRITE)
+                   .openMode(iox::posix::OpenMode::PURGE_AND_CREATE)
+                   .permissions(perms::owner_all)
+                   .numaNode(0U)
+                   .create()
+                   .expect("failed to create sut");
+
+    auto* data = static_cast<uint8_t*>(sut.getBaseAddress());
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    data[MEMORY_SIZE - 1U] = 1U;
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    EXPECT_THAT(data[MEMORY_SIZE - 1U], Eq(1U));
+}
+#endif
+
 #if !defined(_WIN32) && !defined(__APPLE__)
 TEST_F(SharedMemoryObject_Test, AcquiringOwnerWorks)
 {
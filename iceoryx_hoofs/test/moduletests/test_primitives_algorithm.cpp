@@ -226,4 +226,28 @@ TYPED_TEST(algorithm_test_isPowerOfTwo, MaxValueForTypeIsNotPowerOfTwo)
     ::testing::Test::RecordProperty("TEST_ID", "2abdb27d-58de-4e3d-b8fb-8e5f1f3e6327");
     EXPECT_FALSE(isPowerOfTwo(static_cast<typename TestFixture::CurrentType>(TestFixture::MAX)));
 }
+
+TEST_F(algorithm_test, CountTrailingZerosOfZeroIsNumberOfBits)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0cbd3a8e-7f77-4e9e-a3b5-3f0d6f31a9a1");
+    EXPECT_THAT(countTrailingZeros(0U), Eq(64U));
+}
+
+TEST_F(algorithm_test, CountTrailingZerosReturnsIndexOfEverySingleSetBit)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5a47a7d6-3f51-4d49-a4a4-43e0e57e0a84");
+    for (uint64_t i = 0U; i < 64U; ++i)
+    {
+        EXPECT_THAT(countTrailingZeros(1ULL << i), Eq(i));
+    }
+}
+
+TEST_F(algorithm_test, CountTrailingZerosReturnsIndexOfLeastSignificantSetBit)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e1a5f0c2-9a6a-4f3c-8a4b-0a3e8b6a8d21");
+    EXPECT_THAT(countTrailingZeros(std::numeric_limits<uint64_t>::max()), Eq(0U));
+    EXPECT_THAT(countTrailingZeros(0xF0U), Eq(4U));
+    EXPECT_THAT(countTrailingZeros(0x8000000000000100ULL), Eq(8U));
+    static_assert(countTrailingZeros(42U) == 1U, "countTrailingZeros must be usable at compile time");
+}
 } // namespace
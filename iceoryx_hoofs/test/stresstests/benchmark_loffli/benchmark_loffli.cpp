@@ -0,0 +1,106 @@
+// Copyright (c) 2026 by agent <agent@local>. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/internal/concurrent/loffli.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+using iox::concurrent::LoFFLi;
+
+constexpr uint64_t NUMBER_OF_ITERATIONS_PER_THREAD{100000U};
+constexpr uint32_t MAX_NUMBER_OF_THREADS{16U};
+constexpr uint32_t BATCH_SIZE{16U};
+constexpr uint32_t CAPACITY{MAX_NUMBER_OF_THREADS * BATCH_SIZE * 2U};
+
+enum class Mode
+{
+    SINGLE,
+    BATCHED
+};
+
+/// @brief every thread pops BATCH_SIZE indices and pushes them back, either with pop/push or with popN/pushN
+/// @return the number of indices which were popped and pushed per microsecond
+double measureThroughput(const Mode mode, const uint32_t numberOfThreads)
+{
+    std::vector<LoFFLi::Index_t> memory(LoFFLi::requiredIndexMemorySize(CAPACITY) / sizeof(LoFFLi::Index_t));
+    LoFFLi sut;
+    sut.init(memory.data(), CAPACITY);
+
+    std::atomic_bool start{false};
+    std::vector<std::thread> threads;
+    for (uint32_t t = 0U; t < numberOfThreads; ++t)
+    {
+        threads.emplace_back([&] {
+            std::vector<LoFFLi::Index_t> indices(BATCH_SIZE);
+            while (!start.load(std::memory_order_acquire))
+            {
+                std::this_thread::yield();
+            }
+            for (uint64_t i = 0U; i < NUMBER_OF_ITERATIONS_PER_THREAD; ++i)
+            {
+                if (mode == Mode::SINGLE)
+                {
+                    for (auto& index : indices)
+                    {
+                        sut.pop(index);
+                    }
+                    for (auto index : indices)
+                    {
+                        sut.push(index);
+                    }
+                }
+                else
+                {
+                    const auto numberOfIndices = sut.popN(indices.data(), BATCH_SIZE);
+                    sut.pushN(indices.data(), numberOfIndices);
+                }
+            }
+        });
+    }
+
+    const auto begin = std::chrono::steady_clock::now();
+    start.store(true, std::memory_order_release);
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    const auto end = std::chrono::steady_clock::now();
+
+    const auto numberOfIndices = static_cast<double>(numberOfThreads) * NUMBER_OF_ITERATIONS_PER_THREAD * BATCH_SIZE;
+    return numberOfIndices
+           / static_cast<double>(std::chrono::duration_cast<std::chrono::microseconds>(end - begin).count());
+}
+
+int main()
+{
+    for (uint32_t numberOfThreads = 1U; numberOfThreads <= MAX_NUMBER_OF_THREADS; numberOfThreads *= 2U)
+    {
+        const auto single = measureThroughput(Mode::SINGLE, numberOfThreads);
+        const auto batched = measureThroughput(Mode::BATCHED, numberOfThreads);
+
+        // Not using iceoryx logger due to width requirements
+        std::cout << "threads: " << std::setw(3) << numberOfThreads << " | pop/push: " << std::setw(8) << std::fixed
+                  << std::setprecision(1) << single << " indices/us | popN/pushN(" << BATCH_SIZE
+                  << "): " << std::setw(8) << batched << " indices/us" << std::endl;
+    }
+
+    return 0;
+}
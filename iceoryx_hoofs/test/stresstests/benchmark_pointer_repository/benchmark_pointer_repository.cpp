@@ -0,0 +1,114 @@
+// Copyright (c) 2026 by agent <agent@local>. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iox/detail/pointer_repository.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+using Repository_t = iox::PointerRepository<uint64_t, void*>;
+
+constexpr uint64_t NUMBER_OF_LOOKUPS{10000000U};
+constexpr uint64_t SEGMENT_SIZE{4096U};
+constexpr uint64_t NUMBER_OF_SEGMENTS[]{1U, 16U, 100U};
+
+/// @brief the linear scan over all registered segments which was used by PointerRepository::searchId before the
+/// address range index was introduced
+class LinearScan
+{
+  public:
+    void registerPtr(void* const ptr, const uint64_t size)
+    {
+        m_segments.push_back({static_cast<uint8_t*>(ptr), static_cast<uint8_t*>(ptr) + (size - 1U)});
+    }
+
+    uint64_t searchId(void* const ptr) const
+    {
+        for (uint64_t id = 1U; id <= m_segments.size(); ++id)
+        {
+            if ((ptr >= m_segments[id - 1U].basePtr) && (ptr <= m_segments[id - 1U].endPtr))
+            {
+                return id;
+            }
+        }
+        return Repository_t::RAW_POINTER_BEHAVIOUR_ID;
+    }
+
+  private:
+    struct Info
+    {
+        void* basePtr;
+        void* endPtr;
+    };
+    std::vector<Info> m_segments;
+};
+
+/// @return the mean duration of a single lookup in nanoseconds
+template <typename Lookup>
+double measureLookup(const Lookup& lookup, const std::vector<void*>& pointers)
+{
+    uint64_t checksum{0U};
+    const auto begin = std::chrono::steady_clock::now();
+    for (uint64_t i = 0U; i < NUMBER_OF_LOOKUPS; ++i)
+    {
+        checksum += lookup(pointers[i % pointers.size()]);
+    }
+    const auto end = std::chrono::steady_clock::now();
+
+    // the checksum prevents the compiler from removing the lookups
+    if (checksum == 0U)
+    {
+        std::cout << "no segment was found" << std::endl;
+    }
+    return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count())
+           / static_cast<double>(NUMBER_OF_LOOKUPS);
+}
+
+int main()
+{
+    for (const auto numberOfSegments : NUMBER_OF_SEGMENTS)
+    {
+        std::vector<uint8_t> memory(numberOfSegments * SEGMENT_SIZE);
+        auto repository = std::make_unique<Repository_t>();
+        LinearScan linearScan;
+        for (uint64_t i = 0U; i < numberOfSegments; ++i)
+        {
+            repository->registerPtr(&memory[i * SEGMENT_SIZE], SEGMENT_SIZE);
+            linearScan.registerPtr(&memory[i * SEGMENT_SIZE], SEGMENT_SIZE);
+        }
+
+        // the pointers are spread over all segments, i.e. the linear scan visits half of the segments on average
+        std::vector<void*> pointers;
+        for (uint64_t i = 0U; i < 1024U; ++i)
+        {
+            pointers.push_back(&memory[(i * 7919U * 64U) % memory.size()]);
+        }
+
+        const auto scan = measureLookup([&](void* ptr) { return linearScan.searchId(ptr); }, pointers);
+        const auto index = measureLookup([&](void* ptr) { return repository->searchId(ptr); }, pointers);
+
+        // Not using iceoryx logger due to width requirements
+        std::cout << "segments: " << std::setw(4) << numberOfSegments << " | linear scan: " << std::setw(7)
+                  << std::fixed << std::setprecision(2) << scan << " ns | address range index: " << std::setw(7)
+                  << index << " ns" << std::endl;
+    }
+
+    return 0;
+}
@@ -16,6 +16,10 @@
 
 #include "iceoryx_platform/mman.hpp"
 
+#include <cerrno>
+#include <cstdint>
+#include <linux/mempolicy.h>
+#include <sys/syscall.h>
 #include <unistd.h>
 
 // NOLINTNEXTLINE(readability-identifier-naming)
@@ -34,3 +38,22 @@ int iox_shm_close(int fd)
 {
     return close(fd);
 }
+
+int iox_mbind(void* addr, size_t length, unsigned int numaNode)
+{
+    // mbind is provided by libnuma only, the syscall is used directly to avoid the dependency
+    constexpr unsigned int BITS_PER_MASK_ELEMENT{sizeof(unsigned long) * 8U};
+    constexpr unsigned int NUMBER_OF_MASK_ELEMENTS{16U};
+    if (numaNode >= BITS_PER_MASK_ELEMENT * NUMBER_OF_MASK_ELEMENTS)
+    {
+        errno = EINVAL;
+        return -1;
+    }
+
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays) required by the syscall
+    unsigned long nodeMask[NUMBER_OF_MASK_ELEMENTS] = {};
+    nodeMask[numaNode / BITS_PER_MASK_ELEMENT] = 1UL << (numaNode % BITS_PER_MASK_ELEMENT);
+    // the kernel evaluates one bit less than given by maxnode
+    const unsigned long maxNode{BITS_PER_MASK_ELEMENT * NUMBER_OF_MASK_ELEMENTS + 1U};
+    return static_cast<int>(syscall(SYS_mbind, addr, length, MPOL_BIND, &nodeMask[0], maxNode, 0U));
+}
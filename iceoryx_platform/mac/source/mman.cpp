@@ -43,3 +43,9 @@ int iox_shm_close(int fd)
 {
     return close(fd);
 }
+
+int iox_mbind(void*, size_t, unsigned int)
+{
+    errno = ENOSYS;
+    return -1;
+}
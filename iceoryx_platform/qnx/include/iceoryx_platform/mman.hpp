@@ -23,4 +23,9 @@ int iox_shm_open(const char* name, int oflag, mode_t mode);
 int iox_shm_unlink(const char* name);
 int iox_shm_close(int fd);
 
+/// @brief binds the memory of the given range strictly to the given NUMA node; has to be called before the pages are
+/// touched for the first time
+/// @return 0 on success, -1 and errno set on failure; ENOSYS on platforms without NUMA support
+int iox_mbind(void* addr, size_t length, unsigned int numaNode);
+
 #endif // IOX_HOOFS_QNX_PLATFORM_MMAN_HPP
@@ -16,6 +16,7 @@
 
 #include "iceoryx_platform/mman.hpp"
 
+#include <errno.h>
 #include <unistd.h>
 
 int iox_shm_open(const char* name, int oflag, mode_t mode)
@@ -32,3 +33,9 @@ int iox_shm_close(int fd)
 {
     return close(fd);
 }
+
+int iox_mbind(void*, size_t, unsigned int)
+{
+    errno = ENOSYS;
+    return -1;
+}
@@ -16,6 +16,7 @@
 
 #include "iceoryx_platform/mman.hpp"
 
+#include <errno.h>
 #include <unistd.h>
 
 // NOLINTNEXTLINE(readability-identifier-naming)
@@ -34,3 +35,9 @@ int iox_shm_close(int fd)
 {
     return close(fd);
 }
+
+int iox_mbind(void*, size_t, unsigned int)
+{
+    errno = ENOSYS;
+    return -1;
+}
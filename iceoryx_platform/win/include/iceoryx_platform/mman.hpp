@@ -48,6 +48,11 @@ int iox_shm_unlink(const char* name);
 
 int iox_shm_close(int fd);
 
+/// @brief binds the memory of the given range strictly to the given NUMA node; has to be called before the pages are
+/// touched for the first time
+/// @return 0 on success, -1 and errno set on failure; ENOSYS on platforms without NUMA support
+int iox_mbind(void* addr, size_t length, unsigned int numaNode);
+
 void internal_iox_shm_set_size(int fd, off_t length);
 
 off_t internal_iox_shm_get_size(int fd);
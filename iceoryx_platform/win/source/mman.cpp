@@ -19,6 +19,7 @@
 #include "iceoryx_platform/platform_settings.hpp"
 #include "iceoryx_platform/win32_errorHandling.hpp"
 
+#include <cerrno>
 #include <iostream>
 #include <map>
 #include <mutex>
@@ -255,3 +256,9 @@ off_t internal_iox_shm_get_size(int fd)
     fclose(shm_state);
     return shm_size;
 }
+
+int iox_mbind(void*, size_t, unsigned int)
+{
+    errno = ENOSYS;
+    return -1;
+}
@@ -115,6 +115,10 @@ configure_option(
     NAME IOX_MAX_RESPONSES_PROCESSED_SIMULTANEOUSLY
     DEFAULT_VALUE 16
 )
+configure_option(
+    NAME IOX_MAX_REQUESTS_PROCESSED_SIMULTANEOUSLY
+    DEFAULT_VALUE 4
+)
 configure_option(
     NAME IOX_MAX_RESPONSE_QUEUE_CAPACITY
     DEFAULT_VALUE 16
@@ -129,6 +133,7 @@ configure_option(
 )
 
 # note: don't change IOX_INTERNAL_MAX_NUMBER_OF_NOTIFIERS value because it could break the C-Binding
+#       the condition variable itself supports up to 4096 notifiers
 #configure_option(
 #    NAME IOX_MAX_NUMBER_OF_NOTIFIERS
 #    DEFAULT_VALUE 256
@@ -181,6 +181,18 @@ class ServiceDescription
 /// @return                                 Bool if comparison match or not
 bool serviceMatch(const ServiceDescription& first, const ServiceDescription& second) noexcept;
 
+/// @brief Computes the FNV-1a hash of an id string
+/// @param[in] id string to hash
+/// @return the hash, which does not depend on the process and can therefore also be stored in shared memory
+uint64_t hashIdString(const IdString_t& id) noexcept;
+
+/// @brief Hash function for hash-indexed containers of ServiceDescriptions. Only the service, instance and event
+/// string are hashed, therefore equal ServiceDescriptions (see ServiceDescription::operator==) have the same hash.
+struct ServiceDescriptionHash
+{
+    uint64_t operator()(const ServiceDescription& service) const noexcept;
+};
+
 /// @brief Convenience stream operator to easily use the 'ServiceDescription' with std::ostream
 /// @param[in] stream output stream to write the message to
 /// @param[in] service ServiceDescription that shall be converted
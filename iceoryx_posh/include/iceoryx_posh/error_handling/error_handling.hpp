@@ -78,6 +78,9 @@ namespace iox
     error(POPO__BASE_SERVER_OVERRIDING_WITH_EVENT_SINCE_HAS_REQUEST_OR_REQUEST_RECEIVED_ALREADY_ATTACHED) \
     error(POPO__BASE_SERVER_OVERRIDING_WITH_STATE_SINCE_HAS_REQUEST_OR_REQUEST_RECEIVED_ALREADY_ATTACHED) \
     error(POPO__CHUNK_QUEUE_POPPER_CHUNK_WITH_INCOMPATIBLE_CHUNK_HEADER_VERSION) \
+    error(POPO__CHUNK_QUEUE_POPPER_SEMAPHORE_CORRUPTED_IN_POST) \
+    error(POPO__CHUNK_QUEUE_PUSHER_SEMAPHORE_CORRUPTED_IN_TIMED_WAIT) \
+    error(POPO__CHUNK_QUEUE_DATA_FAILED_TO_CREATE_SEMAPHORE) \
     error(POPO__CHUNK_DISTRIBUTOR_OVERFLOW_OF_QUEUE_CONTAINER) \
     error(POPO__CHUNK_DISTRIBUTOR_CLEANUP_DEADLOCK_BECAUSE_BAD_APPLICATION_TERMINATION) \
     error(POPO__CHUNK_SENDER_INVALID_CHUNK_TO_FREE_FROM_USER) \
@@ -94,6 +97,8 @@ namespace iox
     error(POPO__SERVER_PORT_INVALID_RESPONSE_TO_FREE_FROM_USER) \
     error(POPO__SERVER_PORT_INVALID_RESPONSE_TO_SEND_FROM_USER) \
     error(POPO__SERVER_PORT_NO_CLIENT_RESPONSE_QUEUE_TO_CONNECT) \
+    error(POPO__SERVER_WORKER_POOL_FAILED_TO_CREATE_WORKER_SEMAPHORE) \
+    error(POPO__SERVER_WORKER_POOL_WORKER_SEMAPHORE_CORRUPTED) \
     error(POPO__CONDITION_VARIABLE_DATA_FAILED_TO_CREATE_SEMAPHORE) \
     error(POPO__CONDITION_LISTENER_SEMAPHORE_CORRUPTED_IN_WAS_TRIGGERED) \
     error(POPO__CONDITION_LISTENER_SEMAPHORE_CORRUPTED_IN_WAIT) \
@@ -102,6 +107,8 @@ namespace iox
     error(POPO__CONDITION_LISTENER_SEMAPHORE_CORRUPTED_IN_DESTROY) \
     error(POPO__CONDITION_NOTIFIER_INDEX_TOO_LARGE) \
     error(POPO__CONDITION_NOTIFIER_SEMAPHORE_CORRUPT_IN_NOTIFY) \
+    error(POPO__LISTENER_FAILED_TO_CREATE_WORKER_SEMAPHORE) \
+    error(POPO__LISTENER_WORKER_SEMAPHORE_CORRUPTED) \
     error(POPO__NOTIFICATION_INFO_TYPE_INCONSISTENCY_IN_GET_ORIGIN) \
     error(POPO__TYPED_UNIQUE_ID_ROUDI_HAS_ALREADY_DEFINED_CUSTOM_UNIQUE_ID) \
     error(POPO__TYPED_UNIQUE_ID_OVERFLOW) \
@@ -127,6 +134,7 @@ namespace iox
     error(PORT_POOL__INTERFACELIST_OVERFLOW) \
     error(PORT_POOL__NODELIST_OVERFLOW) \
     error(PORT_POOL__CONDITION_VARIABLE_LIST_OVERFLOW) \
+    error(PORT_POOL__HEARTBEAT_LIST_OVERFLOW) \
     error(PORT_MANAGER__PORT_POOL_UNAVAILABLE) \
     error(PORT_MANAGER__INTROSPECTION_MEMORY_MANAGER_UNAVAILABLE) \
     error(PORT_MANAGER__HANDLE_PUBLISHER_PORTS_INVALID_CAPRO_MESSAGE) \
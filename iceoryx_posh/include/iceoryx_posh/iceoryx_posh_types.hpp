@@ -62,17 +62,20 @@ constexpr uint32_t MAX_SUBSCRIBERS_PER_PUBLISHER = build::IOX_MAX_SUBSCRIBERS_PE
 constexpr uint32_t MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY =
     build::IOX_MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY;
 constexpr uint64_t MAX_PUBLISHER_HISTORY = build::IOX_MAX_PUBLISHER_HISTORY;
+constexpr uint32_t MAX_RECYCLED_CHUNKS_PER_PUBLISHER{8U};
 // Subscriber
 constexpr uint32_t MAX_SUBSCRIBERS = build::IOX_MAX_SUBSCRIBERS;
 constexpr uint32_t MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY =
     build::IOX_MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY;
 constexpr uint32_t MAX_SUBSCRIBER_QUEUE_CAPACITY = MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY;
+/// @note The latency histograms are shared by all subscribers which request one with the SubscriberOptions
+constexpr uint32_t MAX_LATENCY_HISTOGRAMS{16U};
 // Introspection is using the following publisherPorts, which reduced the number of ports available for the user
 // 1x publisherPort mempool introspection
 // 1x publisherPort process introspection
 // 3x publisherPort port introspection
 constexpr uint32_t PUBLISHERS_RESERVED_FOR_INTROSPECTION = 5;
-constexpr uint32_t PUBLISHERS_RESERVED_FOR_SERVICE_REGISTRY = 1;
+constexpr uint32_t PUBLISHERS_RESERVED_FOR_SERVICE_REGISTRY = 2;
 constexpr uint32_t NUMBER_OF_INTERNAL_PUBLISHERS =
     PUBLISHERS_RESERVED_FOR_INTROSPECTION + PUBLISHERS_RESERVED_FOR_SERVICE_REGISTRY;
 /// With MAX_SUBSCRIBER_QUEUE_CAPACITY = MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY we couple the maximum number of
@@ -93,7 +96,8 @@ constexpr uint32_t MAX_RESPONSE_QUEUE_CAPACITY = build::IOX_MAX_RESPONSE_QUEUE_C
 // Server
 constexpr uint32_t MAX_SERVERS = build::IOX_MAX_PUBLISHERS;
 constexpr uint32_t MAX_CLIENTS_PER_SERVER = build::IOX_MAX_CLIENTS_PER_SERVER;
-constexpr uint32_t MAX_REQUESTS_PROCESSED_SIMULTANEOUSLY = 4U;
+/// @note The requests processed simultaneously are shared by all worker threads of a ServerWorkerPool
+constexpr uint32_t MAX_REQUESTS_PROCESSED_SIMULTANEOUSLY = build::IOX_MAX_REQUESTS_PROCESSED_SIMULTANEOUSLY;
 constexpr uint32_t MAX_RESPONSES_ALLOCATED_SIMULTANEOUSLY = MAX_REQUESTS_PROCESSED_SIMULTANEOUSLY;
 constexpr uint32_t MAX_REQUEST_QUEUE_CAPACITY = build::IOX_MAX_REQUEST_QUEUE_CAPACITY;
 // Waitset
@@ -108,6 +112,7 @@ constexpr uint32_t MAX_NUMBER_OF_NOTIFIERS = build::IOX_MAX_NUMBER_OF_NOTIFIERS;
 /// the variable above must be increased
 constexpr uint32_t MAX_NUMBER_OF_ATTACHMENTS_PER_WAITSET = MAX_NUMBER_OF_NOTIFIERS;
 constexpr uint32_t MAX_NUMBER_OF_EVENTS_PER_LISTENER = MAX_NUMBER_OF_NOTIFIERS;
+constexpr uint32_t MAX_NUMBER_OF_WORKER_THREADS_PER_LISTENER = 16U;
 //--------- Communication Resources End---------------------
 
 // Memory
@@ -138,6 +143,7 @@ constexpr uint32_t MAX_FINDSERVICE_RESULT_SIZE = SERVICE_REGISTRY_CAPACITY;
 constexpr const char SERVICE_DISCOVERY_SERVICE_NAME[] = "ServiceDiscovery";
 constexpr const char SERVICE_DISCOVERY_INSTANCE_NAME[] = "RouDi_ID";
 constexpr const char SERVICE_DISCOVERY_EVENT_NAME[] = "ServiceRegistry";
+constexpr const char SERVICE_DISCOVERY_CHANGE_LOG_EVENT_NAME[] = "ServiceRegistryChangeLog";
 
 // Nodes
 constexpr uint32_t MAX_NODE_NUMBER = build::IOX_MAX_NODE_NUMBER;
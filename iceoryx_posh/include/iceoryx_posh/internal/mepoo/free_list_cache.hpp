@@ -0,0 +1,116 @@
+// Copyright (c) 2026 by agent <agent@local>. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_MEPOO_FREE_LIST_CACHE_HPP
+#define IOX_POSH_MEPOO_FREE_LIST_CACHE_HPP
+
+#include "iceoryx_hoofs/internal/concurrent/loffli.hpp"
+#include "iox/not_null.hpp"
+#include "iox/relative_pointer.hpp"
+
+#include <atomic>
+#include <cstdint>
+
+namespace iox
+{
+namespace mepoo
+{
+/// @brief Cache of free indices in front of a LoFFLi which reduces the contention on the LoFFLi head when many threads
+/// acquire and release chunks of the same mempool concurrently. The cache consists of a fixed number of slots which
+/// reside in shared memory next to the LoFFLi. Each slot holds a magazine of free indices and is exclusively used by
+/// the thread which successfully claimed it with a try-lock. Threads are spread over the slots, i.e. with not more
+/// threads than slots each thread usually works with its own magazine and the LoFFLi is only accessed in batches to
+/// refill or drain a magazine. If a slot is claimed by another thread, the LoFFLi is used directly.
+/// @note A slot is only claimed for the duration of a single pop or push and the claim is tagged with the process id.
+/// When a process terminates abnormally while it holds a claim, the slot is blocked until RouDi releases it with
+/// 'releaseSlotsOfProcess'. The magazine is kept consistent at any point in time, at worst the indices of a single
+/// batch are lost when the process is killed in the middle of a transfer between the LoFFLi and the magazine.
+/// @note Indices which reside in a magazine are not checked for a double free. This is only done by the LoFFLi when the
+/// magazines are drained.
+class FreeListCache
+{
+  public:
+    using Index_t = concurrent::LoFFLi::Index_t;
+
+    static constexpr uint32_t NUMBER_OF_SLOTS{16U};
+
+    FreeListCache() noexcept = default;
+
+    FreeListCache(const FreeListCache&) = delete;
+    FreeListCache(FreeListCache&&) = delete;
+    FreeListCache& operator=(const FreeListCache&) = delete;
+    FreeListCache& operator=(FreeListCache&&) = delete;
+
+    /// @brief Initializes the cache
+    /// @param [in] magazineMemory pointer to a memory with the size calculated by requiredMagazineMemorySize()
+    /// @param [in] magazineCapacity is the number of indices each slot can hold; must be the same used at
+    /// requiredMagazineMemorySize()
+    void init(not_null<Index_t*> magazineMemory, const uint32_t magazineCapacity) noexcept;
+
+    /// @brief Pops an index from the magazine of the slot of the calling thread. An empty magazine is refilled with
+    /// half of its capacity from the LoFFLi. If the LoFFLi is exhausted, the magazines of the other slots are searched.
+    /// @param [in] freeList is the LoFFLi the cached indices belong to
+    /// @param [out] index for an element to use
+    /// @return true if index is valid, false otherwise
+    bool pop(concurrent::LoFFLi& freeList, Index_t& index) noexcept;
+
+    /// @brief Pushes an index to the magazine of the slot of the calling thread. A full magazine is drained by half of
+    /// its capacity to the LoFFLi before.
+    /// @param [in] freeList is the LoFFLi the cached indices belong to
+    /// @param [in] index to previously popped element
+    /// @return false if the LoFFLi detected an invalid index or a double free while draining the magazine, true
+    /// otherwise
+    bool push(concurrent::LoFFLi& freeList, const Index_t index) noexcept;
+
+    /// @brief Releases all slots which are claimed by the given process; must only be called for a process which is
+    /// not running anymore
+    /// @param [in] pid is the process id of the terminated process
+    void releaseSlotsOfProcess(const uint32_t pid) noexcept;
+
+    /// @brief Returns the number of indices which are currently held in the magazines
+    uint32_t getNumberOfCachedIndices() const noexcept;
+
+    /// @brief Calculates the required memory size for the magazines
+    /// @param [in] magazineCapacity is the number of indices each slot can hold
+    /// @return the required memory size for the magazines of all slots
+    static constexpr uint64_t requiredMagazineMemorySize(const uint64_t magazineCapacity) noexcept
+    {
+        return NUMBER_OF_SLOTS * magazineCapacity * sizeof(Index_t);
+    }
+
+  private:
+    struct Slot
+    {
+        std::atomic<uint32_t> m_owner{NO_OWNER};
+        std::atomic<uint32_t> m_numberOfIndices{0U};
+    };
+
+    static constexpr uint32_t NO_OWNER{0U};
+
+    bool tryClaim(Slot& slot) noexcept;
+    void release(Slot& slot) noexcept;
+    Index_t* magazineOf(const uint32_t slotIndex) noexcept;
+    uint32_t slotIndexOfCurrentThread() const noexcept;
+    bool popFromOtherSlots(const uint32_t ownSlotIndex, Index_t& index) noexcept;
+
+    uint32_t m_magazineCapacity{0U};
+    Slot m_slots[NUMBER_OF_SLOTS];
+    RelativePointer<Index_t> m_magazines;
+};
+
+} // namespace mepoo
+} // namespace iox
+
+#endif // IOX_POSH_MEPOO_FREE_LIST_CACHE_HPP
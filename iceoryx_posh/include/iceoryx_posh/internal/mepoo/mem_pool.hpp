@@ -18,6 +18,7 @@
 #define IOX_POSH_MEPOO_MEM_POOL_HPP
 
 #include "iceoryx_hoofs/internal/concurrent/loffli.hpp"
+#include "iceoryx_posh/internal/mepoo/free_list_cache.hpp"
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
 #include "iox/algorithm.hpp"
 #include "iox/bump_allocator.hpp"
@@ -36,12 +37,14 @@ struct MemPoolInfo
     MemPoolInfo(const uint32_t usedChunks,
                 const uint32_t minFreeChunks,
                 const uint32_t numChunks,
-                const uint32_t chunkSize) noexcept;
+                const uint32_t chunkSize,
+                const uint32_t spilledChunks = 0U) noexcept;
 
     uint32_t m_usedChunks{0};
     uint32_t m_minFreeChunks{0};
     uint32_t m_numChunks{0};
     uint32_t m_chunkSize{0};
+    uint32_t m_spilledChunks{0};
 };
 
 class MemPool
@@ -50,10 +53,18 @@ class MemPool
     using freeList_t = concurrent::LoFFLi;
     static constexpr uint64_t CHUNK_MEMORY_ALIGNMENT = 8U; // default alignment for 64 bit
 
+    /// @brief Creates a mempool with the chunks and the management data obtained from the provided allocators
+    /// @param[in] chunkSize is the size of each chunk
+    /// @param[in] numberOfChunks is the number of chunks of the mempool
+    /// @param[in] managementAllocator is the allocator for the free-list and the chunk cache
+    /// @param[in] chunkMemoryAllocator is the allocator for the chunks
+    /// @param[in] chunkCacheCapacity is the number of free chunks each slot of the chunk cache can hold; 0 disables the
+    /// chunk cache
     MemPool(const greater_or_equal<uint32_t, CHUNK_MEMORY_ALIGNMENT> chunkSize,
             const greater_or_equal<uint32_t, 1> numberOfChunks,
             iox::BumpAllocator& managementAllocator,
-            iox::BumpAllocator& chunkMemoryAllocator) noexcept;
+            iox::BumpAllocator& chunkMemoryAllocator,
+            const uint32_t chunkCacheCapacity = 0U) noexcept;
 
     MemPool(const MemPool&) = delete;
     MemPool(MemPool&&) = delete;
@@ -65,10 +76,26 @@ class MemPool
     uint32_t getChunkCount() const noexcept;
     uint32_t getUsedChunks() const noexcept;
     uint32_t getMinFree() const noexcept;
+    uint32_t getSpilledChunks() const noexcept;
     MemPoolInfo getInfo() const noexcept;
 
+    /// @brief Records that a chunk request could not be served by this mempool since it was out of chunks and that a
+    /// larger mempool was used instead
+    void countSpilledChunk() noexcept;
+
     void freeChunk(const void* chunk) noexcept;
 
+    /// @brief Releases the slots of the chunk cache which are still claimed by a terminated process
+    /// @param[in] pid is the process id of the terminated process
+    void releaseChunkCacheSlotsOfProcess(const uint32_t pid) noexcept;
+
+    /// @brief Calculates the required memory size for the free-list and the chunk cache of a mempool
+    /// @param[in] numberOfChunks is the number of chunks of the mempool
+    /// @param[in] chunkCacheCapacity is the number of free chunks each slot of the chunk cache can hold
+    /// @return the required management memory size
+    static uint64_t requiredManagementMemorySize(const uint64_t numberOfChunks,
+                                                 const uint32_t chunkCacheCapacity) noexcept;
+
   private:
     void adjustMinFree() noexcept;
     bool isMultipleOfAlignment(const uint32_t value) const noexcept;
@@ -82,8 +109,10 @@ class MemPool
 
     std::atomic<uint32_t> m_usedChunks{0U};
     std::atomic<uint32_t> m_minFree{0U};
+    std::atomic<uint32_t> m_spilledChunks{0U};
 
     freeList_t m_freeIndices;
+    FreeListCache m_freeIndicesCache;
 };
 
 } // namespace mepoo
@@ -21,10 +21,12 @@
 #include "iceoryx_posh/internal/mepoo/mem_pool.hpp"
 #include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
 #include "iceoryx_posh/mepoo/chunk_settings.hpp"
+#include "iceoryx_posh/mepoo/mepoo_config.hpp"
 #include "iox/algorithm.hpp"
 #include "iox/bump_allocator.hpp"
 #include "iox/expected.hpp"
 #include "iox/memory.hpp"
+#include "iox/optional.hpp"
 #include "iox/vector.hpp"
 
 #include <cstdint>
@@ -42,8 +44,6 @@ class LogStream;
 }
 namespace mepoo
 {
-struct MePooConfig;
-
 class MemoryManager
 {
     using MaxChunkPayloadSize_t = range<uint32_t, 1, std::numeric_limits<uint32_t>::max() - sizeof(ChunkHeader)>;
@@ -67,7 +67,8 @@ class MemoryManager
                                 BumpAllocator& managementAllocator,
                                 BumpAllocator& chunkMemoryAllocator) noexcept;
 
-    /// @brief Obtains a chunk from the mempools
+    /// @brief Obtains a chunk from the mempools; if the best fitting mempool is out of chunks, the configured
+    /// MemPoolAllocationPolicy decides whether a larger mempool is used
     /// @param[in] chunkSettings for the requested chunk
     /// @return a SharedChunk if successful, otherwise a MemoryManager::Error
     expected<SharedChunk, Error> getChunk(const ChunkSettings& chunkSettings) noexcept;
@@ -76,12 +77,20 @@ class MemoryManager
 
     MemPoolInfo getMemPoolInfo(const uint32_t index) const noexcept;
 
+    /// @brief Releases the chunk cache slots of all mempools which are still claimed by a terminated process
+    /// @param[in] pid is the process id of the terminated process
+    void releaseChunkCacheSlotsOfProcess(const uint32_t pid) noexcept;
+
     static uint64_t requiredChunkMemorySize(const MePooConfig& mePooConfig) noexcept;
     static uint64_t requiredManagementMemorySize(const MePooConfig& mePooConfig) noexcept;
     static uint64_t requiredFullMemorySize(const MePooConfig& mePooConfig) noexcept;
 
   private:
+    /// @brief the chunk size range [2^n, 2^(n+1)) is the size class n; a chunk size is always a uint32_t
+    static constexpr uint32_t NUMBER_OF_SIZE_CLASSES{32U};
+
     static uint32_t sizeWithChunkHeaderStruct(const MaxChunkPayloadSize_t size) noexcept;
+    static uint32_t sizeClassOf(const uint32_t chunkSize) noexcept;
 
     void printMemPoolVector(log::LogStream& log) const noexcept;
     void addMemPool(BumpAllocator& managementAllocator,
@@ -89,13 +98,21 @@ class MemoryManager
                     const greater_or_equal<uint32_t, MemPool::CHUNK_MEMORY_ALIGNMENT> chunkPayloadSize,
                     const greater_or_equal<uint32_t, 1> numberOfChunks) noexcept;
     void generateChunkManagementPool(BumpAllocator& managementAllocator) noexcept;
+    void generateSizeClassLookup() noexcept;
+    optional<uint32_t> findFittingMemPoolIndex(const uint32_t requiredChunkSize) const noexcept;
+    void* getChunkFromFittingMemPools(const uint32_t fittingMemPoolIndex, MemPool*& memPoolPointer) noexcept;
 
   private:
     bool m_denyAddMemPool{false};
     uint32_t m_totalNumberOfChunks{0};
+    MemPoolAllocationPolicy m_allocationPolicy{MemPoolAllocationPolicy::STRICT_BEST_FIT};
+    uint32_t m_chunkCacheCapacity{0U};
 
     vector<MemPool, MAX_NUMBER_OF_MEMPOOLS> m_memPoolVector;
     vector<MemPool, 1> m_chunkManagementPool;
+    /// @brief contains for every size class the index of the first mempool with a chunk size of at least 2^n;
+    /// since the mempools are ordered by increasing chunk size, the search for a fitting mempool starts there
+    vector<uint32_t, NUMBER_OF_SIZE_CLASSES> m_sizeClassLookup;
 };
 
 /// @brief Converts the MemoryManager::Error to a string literal
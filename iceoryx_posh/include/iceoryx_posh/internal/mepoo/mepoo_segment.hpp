@@ -21,10 +21,12 @@
 #include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object.hpp"
 #include "iceoryx_hoofs/posix_wrapper/posix_access_rights.hpp"
 #include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
+#include "iceoryx_posh/mepoo/huge_page_config.hpp"
 #include "iceoryx_posh/mepoo/memory_info.hpp"
 #include "iceoryx_posh/mepoo/mepoo_config.hpp"
 #include "iox/bump_allocator.hpp"
 #include "iox/filesystem.hpp"
+#include "iox/optional.hpp"
 
 namespace iox
 {
@@ -38,7 +40,9 @@ class MePooSegment
                  BumpAllocator& managementAllocator,
                  const posix::PosixGroup& readerGroup,
                  const posix::PosixGroup& writerGroup,
-                 const iox::mepoo::MemoryInfo& memoryInfo = iox::mepoo::MemoryInfo()) noexcept;
+                 const iox::mepoo::MemoryInfo& memoryInfo = iox::mepoo::MemoryInfo(),
+                 const optional<HugePageConfig>& hugePageConfig = nullopt,
+                 const optional<uint32_t>& numaNode = nullopt) noexcept;
 
     posix::PosixGroup getWriterGroup() const noexcept;
     posix::PosixGroup getReaderGroup() const noexcept;
@@ -47,9 +51,15 @@ class MePooSegment
 
     uint64_t getSegmentId() const noexcept;
 
+    /// @brief Returns the directory in which the shared memory was created as file when the segment is backed by huge
+    /// pages; the applications must open the segment in the same directory
+    optional<Path> getSharedMemoryDirectory() const noexcept;
+
   protected:
     SharedMemoryObjectType createSharedMemoryObject(const MePooConfig& mempoolConfig,
-                                                    const posix::PosixGroup& writerGroup) noexcept;
+                                                    const posix::PosixGroup& writerGroup,
+                                                    const optional<HugePageConfig>& hugePageConfig,
+                                                    const optional<uint32_t>& numaNode) noexcept;
 
   protected:
     SharedMemoryObjectType m_sharedMemoryObject;
@@ -58,6 +68,7 @@ class MePooSegment
     posix::PosixGroup m_writerGroup;
     uint64_t m_segmentId;
     iox::mepoo::MemoryInfo m_memoryInfo;
+    optional<HugePageConfig> m_hugePageConfig;
 
     static constexpr access_rights SEGMENT_PERMISSIONS =
         perms::owner_read | perms::owner_write | perms::group_read | perms::group_write;
@@ -23,6 +23,7 @@
 #include "iceoryx_posh/mepoo/mepoo_config.hpp"
 #include "iox/bump_allocator.hpp"
 #include "iox/logging.hpp"
+#include "iox/memory.hpp"
 #include "iox/relative_pointer.hpp"
 
 namespace iox
@@ -38,11 +39,14 @@ inline MePooSegment<SharedMemoryObjectType, MemoryManagerType>::MePooSegment(
     BumpAllocator& managementAllocator,
     const posix::PosixGroup& readerGroup,
     const posix::PosixGroup& writerGroup,
-    const iox::mepoo::MemoryInfo& memoryInfo) noexcept
-    : m_sharedMemoryObject(std::move(createSharedMemoryObject(mempoolConfig, writerGroup)))
+    const iox::mepoo::MemoryInfo& memoryInfo,
+    const optional<HugePageConfig>& hugePageConfig,
+    const optional<uint32_t>& numaNode) noexcept
+    : m_sharedMemoryObject(std::move(createSharedMemoryObject(mempoolConfig, writerGroup, hugePageConfig, numaNode)))
     , m_readerGroup(readerGroup)
     , m_writerGroup(writerGroup)
     , m_memoryInfo(memoryInfo)
+    , m_hugePageConfig(hugePageConfig)
 {
     using namespace posix;
     AccessController accessController;
@@ -57,7 +61,16 @@ inline MePooSegment<SharedMemoryObjectType, MemoryManagerType>::MePooSegment(
 
     if (!accessController.writePermissionsToFile(m_sharedMemoryObject.getFileHandle()))
     {
-        errorHandler(PoshError::MEPOO__SEGMENT_COULD_NOT_APPLY_POSIX_RIGHTS_TO_SHARED_MEMORY);
+        if (m_hugePageConfig.has_value())
+        {
+            // hugetlbfs does not support access control lists, the access is restricted by the file permissions
+            IOX_LOG(WARN) << "Unable to apply the access control list to the huge page segment of the writer group '"
+                          << writerGroup.getName() << "', only the owner and the group of the file have access";
+        }
+        else
+        {
+            errorHandler(PoshError::MEPOO__SEGMENT_COULD_NOT_APPLY_POSIX_RIGHTS_TO_SHARED_MEMORY);
+        }
     }
 
     BumpAllocator allocator(m_sharedMemoryObject.getBaseAddress(),
@@ -67,15 +80,32 @@ inline MePooSegment<SharedMemoryObjectType, MemoryManagerType>::MePooSegment(
 
 template <typename SharedMemoryObjectType, typename MemoryManagerType>
 inline SharedMemoryObjectType MePooSegment<SharedMemoryObjectType, MemoryManagerType>::createSharedMemoryObject(
-    const MePooConfig& mempoolConfig, const posix::PosixGroup& writerGroup) noexcept
+    const MePooConfig& mempoolConfig,
+    const posix::PosixGroup& writerGroup,
+    const optional<HugePageConfig>& hugePageConfig,
+    const optional<uint32_t>& numaNode) noexcept
 {
+    auto memorySize = MemoryManager::requiredChunkMemorySize(mempoolConfig);
+    optional<Path> directory;
+    uint64_t prefaultPageSize{0U};
+    if (hugePageConfig.has_value())
+    {
+        // hugetlbfs only accepts multiples of the huge page size for truncate and mmap
+        memorySize = align(memorySize, hugePageConfig->m_pageSize);
+        directory.emplace(hugePageConfig->m_mountPoint);
+        prefaultPageSize = hugePageConfig->m_pageSize;
+    }
+
     return std::move(
         typename SharedMemoryObjectType::Builder()
             .name(writerGroup.getName())
-            .memorySizeInBytes(MemoryManager::requiredChunkMemorySize(mempoolConfig))
+            .memorySizeInBytes(memorySize)
             .accessMode(posix::AccessMode::READ_WRITE)
             .openMode(posix::OpenMode::PURGE_AND_CREATE)
             .permissions(SEGMENT_PERMISSIONS)
+            .directory(directory)
+            .numaNode(numaNode)
+            .prefaultPageSize(prefaultPageSize)
             .create()
             .and_then([this](auto& sharedMemoryObject) {
                 auto maybeSegmentId = iox::UntypedRelativePointer::registerPtr(
@@ -127,6 +157,16 @@ inline uint64_t MePooSegment<SharedMemoryObjectType, MemoryManagerType>::getSegm
     return m_segmentId;
 }
 
+template <typename SharedMemoryObjectType, typename MemoryManagerType>
+inline optional<Path> MePooSegment<SharedMemoryObjectType, MemoryManagerType>::getSharedMemoryDirectory() const noexcept
+{
+    if (m_hugePageConfig.has_value())
+    {
+        return m_hugePageConfig->m_mountPoint;
+    }
+    return nullopt;
+}
+
 template <typename SharedMemoryObjectType, typename MemoryManagerType>
 inline void MePooSegment<SharedMemoryObjectType, MemoryManagerType>::setSegmentId(const uint64_t segmentId) noexcept
 {
@@ -59,13 +59,15 @@ class SegmentManager
                        uint64_t size,
                        bool isWritable,
                        uint64_t segmentId,
-                       const iox::mepoo::MemoryInfo& memoryInfo = iox::mepoo::MemoryInfo()) noexcept
+                       const iox::mepoo::MemoryInfo& memoryInfo = iox::mepoo::MemoryInfo(),
+                       const optional<Path>& sharedMemoryDirectory = nullopt) noexcept
             : m_sharedMemoryName(sharedMemoryName)
             , m_startAddress(startAddress)
             , m_size(size)
             , m_isWritable(isWritable)
             , m_segmentId(segmentId)
             , m_memoryInfo(memoryInfo)
+            , m_sharedMemoryDirectory(sharedMemoryDirectory)
 
         {
         }
@@ -76,6 +78,7 @@ class SegmentManager
         bool m_isWritable{false};
         uint64_t m_segmentId{0};
         iox::mepoo::MemoryInfo m_memoryInfo; // we can specify additional info about a segments memory here
+        optional<Path> m_sharedMemoryDirectory; // set when the segment is a file in a hugetlbfs mount point
     };
 
     struct SegmentUserInformation
@@ -89,6 +92,10 @@ class SegmentManager
     SegmentMappingContainer getSegmentMappings(const posix::PosixUser& user) noexcept;
     SegmentUserInformation getSegmentInformationWithWriteAccessForUser(const posix::PosixUser& user) noexcept;
 
+    /// @brief Releases the chunk cache slots of all segments which are still claimed by a terminated process
+    /// @param[in] pid is the process id of the terminated process
+    void releaseChunkCacheSlotsOfProcess(const uint32_t pid) noexcept;
+
     static uint64_t requiredManagementMemorySize(const SegmentConfig& config) noexcept;
     static uint64_t requiredChunkMemorySize(const SegmentConfig& config) noexcept;
     static uint64_t requiredFullMemorySize(const SegmentConfig& config) noexcept;
@@ -42,8 +42,13 @@ inline void SegmentManager<SegmentType>::createSegment(const SegmentConfig::Segm
 {
     auto readerGroup = iox::posix::PosixGroup(segmentEntry.m_readerGroup);
     auto writerGroup = iox::posix::PosixGroup(segmentEntry.m_writerGroup);
-    m_segmentContainer.emplace_back(
-        segmentEntry.m_mempoolConfig, *m_managementAllocator, readerGroup, writerGroup, segmentEntry.m_memoryInfo);
+    m_segmentContainer.emplace_back(segmentEntry.m_mempoolConfig,
+                                    *m_managementAllocator,
+                                    readerGroup,
+                                    writerGroup,
+                                    segmentEntry.m_memoryInfo,
+                                    segmentEntry.m_hugePageConfig,
+                                    segmentEntry.m_numaNode);
 }
 
 template <typename SegmentType>
@@ -72,7 +77,9 @@ SegmentManager<SegmentType>::getSegmentMappings(const posix::PosixUser& user) no
                         segment.getSharedMemoryObject().getBaseAddress(),
                         segment.getSharedMemoryObject().get_size().expect("failed to get SHM size"),
                         true,
-                        segment.getSegmentId());
+                        segment.getSegmentId(),
+                        iox::mepoo::MemoryInfo(),
+                        segment.getSharedMemoryDirectory());
                     foundInWriterGroup = true;
                 }
                 else
@@ -99,7 +106,9 @@ SegmentManager<SegmentType>::getSegmentMappings(const posix::PosixUser& user) no
                     segment.getSharedMemoryObject().getBaseAddress(),
                     segment.getSharedMemoryObject().get_size().expect("Failed to get SHM size."),
                     false,
-                    segment.getSegmentId());
+                    segment.getSegmentId(),
+                    iox::mepoo::MemoryInfo(),
+                    segment.getSharedMemoryDirectory());
             }
         }
     }
@@ -132,6 +141,15 @@ SegmentManager<SegmentType>::getSegmentInformationWithWriteAccessForUser(const p
     return segmentInfo;
 }
 
+template <typename SegmentType>
+inline void SegmentManager<SegmentType>::releaseChunkCacheSlotsOfProcess(const uint32_t pid) noexcept
+{
+    for (auto& segment : m_segmentContainer)
+    {
+        segment.getMemoryManager().releaseChunkCacheSlotsOfProcess(pid);
+    }
+}
+
 template <typename SegmentType>
 uint64_t SegmentManager<SegmentType>::requiredManagementMemorySize(const SegmentConfig& config) noexcept
 {
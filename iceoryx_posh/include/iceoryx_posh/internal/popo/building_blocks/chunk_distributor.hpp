@@ -21,10 +21,15 @@
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_distributor_data.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_pusher.hpp"
 #include "iox/detail/adaptive_wait.hpp"
+#include "iox/deadline_timer.hpp"
 #include "iox/detail/unique_id.hpp"
+#include "iox/duration.hpp"
 #include "iox/not_null.hpp"
 
+#include <algorithm>
+#include <functional>
 #include <thread>
+#include <utility>
 
 namespace iox
 {
@@ -48,12 +53,19 @@ enum class ChunkDistributorError
 /// This ChunkDistributor can be used with different LockingPolicies for different scenarios
 /// When different threads operate on it (e.g. application sends chunks and RouDi adds and removes queues),
 /// a locking policy must be used that ensures consistent data in the ChunkDistributorData.
+/// The stored queues are double buffered, i.e. deliverToAllStoredQueues does not take the lock to access them and
+/// a chunk is sent without contending with RouDi adding or removing queues. The lock is only taken when the chunk is
+/// added to the history.
+/// With batched consumer notifications, the chunk is pushed to all queues first and the consumers are notified
+/// afterwards. Queues attached to the same condition variable, e.g. the subscribers of one WaitSet, then cause only a
+/// single wake up per delivery.
 /// @todo iox-#1713 There are currently some challenges:
-/// For the stored queues and the history, containers are used which are not thread safe. Therefore we use an
+/// For the history a container is used which is not thread safe. Therefore we use an
 /// inter-process mutex. But this can lead to deadlocks if a user process gets terminated while one of its
-/// threads is in the ChunkDistributor and holds a lock. An easier setup would be if changing the queues
-/// by a middleware thread and sending chunks by the user process would not interleave. I.e. there is no concurrent
-/// access to the containers. Then a memory synchronization would be sufficient.
+/// threads is in the ChunkDistributor and holds a lock. The lock-free readers of the queues of a terminated user
+/// process are only reclaimed after QUEUE_READERS_TIMEOUT when RouDi modifies the queues. An easier setup
+/// would be if changing the queues by a middleware thread and sending chunks by the user process would not
+/// interleave. I.e. there is no concurrent access to the containers. Then a memory synchronization would be sufficient.
 /// The cleanup() call is the biggest challenge. This is used to free chunks that are still held by a not properly
 /// terminated user application. Even if access from middleware and user threads do not overlap, the history
 /// container to cleanup could be in an inconsistent state as the application was hard terminated while changing it.
@@ -67,6 +79,14 @@ class ChunkDistributor
     using ChunkQueueData_t = typename ChunkDistributorDataType::ChunkQueueData_t;
     using ChunkQueuePusher_t = typename ChunkDistributorDataType::ChunkQueuePusher_t;
 
+    /// @brief With the WAIT_FOR_CONSUMER policy, a delivery to a full queue sleeps until the consumer freed space in
+    /// the queue but at most for this duration before the queues are checked again
+    static constexpr units::Duration BLOCKED_QUEUE_WAIT_TIMEOUT{units::Duration::fromMilliseconds(1U)};
+
+    /// @brief A modification of the queues waits at most this duration for the readers of the previously active queue
+    /// container; readers which are still announced afterwards belong to a terminated process and are reclaimed
+    static constexpr units::Duration QUEUE_READERS_TIMEOUT{units::Duration::fromSeconds(1U)};
+
     explicit ChunkDistributor(not_null<MemberType_t* const> chunkDistrubutorDataPtr) noexcept;
 
     ChunkDistributor(const ChunkDistributor& other) = delete;
@@ -102,6 +122,14 @@ class ChunkDistributor
     /// @return the number of queues the chunk was delivered to
     uint64_t deliverToAllStoredQueues(mepoo::SharedChunk chunk) noexcept;
 
+    /// @brief Deliver the provided shared chunks in the given order to all the stored chunk queues. The consumer of
+    /// each queue is notified once for all chunks and the history is updated under a single lock; apart from that,
+    /// the behavior is the same as calling deliverToAllStoredQueues for each chunk
+    /// @param[in] chunks is a pointer to the first of the SharedChunks to be delivered
+    /// @param[in] numberOfChunks is the number of SharedChunks to be delivered
+    /// @return the number of queues all the chunks were delivered to
+    uint64_t deliverToAllStoredQueues(const mepoo::SharedChunk* const chunks, const uint64_t numberOfChunks) noexcept;
+
     /// @brief Deliver the provided shared chunk to the chunk queue with the provided ID. The chunk will NOT be added
     /// to the chunk history
     /// @param[in] uniqueQueueId is an unique ID which identifies the queue to which this chunk shall be delivered
@@ -144,6 +172,37 @@ class ChunkDistributor
     bool pushToQueue(not_null<ChunkQueueData_t* const> queue, mepoo::SharedChunk chunk) noexcept;
 
   private:
+    using QueueContainer_t = typename ChunkDistributorDataType::QueueContainer_t;
+
+    /// @brief Announces a lock-free reader of the active queue container
+    /// @return the generation of the queue container which can be accessed until leaveQueueReaderSection is called
+    uint64_t enterQueueReaderSection() const noexcept;
+    void leaveQueueReaderSection(const uint64_t generation) const noexcept;
+    const QueueContainer_t& getQueuesOfGeneration(const uint64_t generation) const noexcept;
+
+    /// @brief Must only be called with the lock held
+    const QueueContainer_t& getActiveQueues() const noexcept;
+
+    /// @brief Copies the active queue container into the inactive one; must only be called with the lock held
+    /// @return the inactive queue container which can be modified
+    QueueContainer_t& prepareQueueModification() noexcept;
+
+    /// @brief Activates the previously prepared queue container and waits until the readers of the previously active
+    /// container are gone but at most for QUEUE_READERS_TIMEOUT; must only be called with the lock held
+    void activateModifiedQueues() noexcept;
+
+    /// @brief Waits until the consumer of a blocked queue freed space; must be called without the lock, otherwise a
+    /// slow consumer would also block RouDi and all other users of the chunk distributor
+    /// @return false if the queue was removed in the meantime and was therefore not waited for
+    bool waitForSpaceInStoredQueue(ChunkQueueData_t* const queue) const noexcept;
+
+    /// @brief Notifies the consumers of the queues after the chunk was pushed without notification; every condition
+    /// variable is woken up only once even if several queues are attached to it
+    static void notifyConsumers(const QueueContainer_t& queues) noexcept;
+
+    static bool containsQueue(const QueueContainer_t& queues, const ChunkQueueData_t* const queue) noexcept;
+    static void eraseQueuesWhichAreNotStoredIn(QueueContainer_t& queues, const QueueContainer_t& storedQueues) noexcept;
+
     MemberType_t* m_chunkDistrubutorDataPtr{nullptr};
 };
 
@@ -23,6 +23,11 @@ namespace iox
 {
 namespace popo
 {
+template <typename ChunkDistributorDataType>
+constexpr units::Duration ChunkDistributor<ChunkDistributorDataType>::BLOCKED_QUEUE_WAIT_TIMEOUT;
+template <typename ChunkDistributorDataType>
+constexpr units::Duration ChunkDistributor<ChunkDistributorDataType>::QUEUE_READERS_TIMEOUT;
+
 template <typename ChunkDistributorDataType>
 inline ChunkDistributor<ChunkDistributorDataType>::ChunkDistributor(
     not_null<MemberType_t* const> chunkDistrubutorDataPtr) noexcept
@@ -51,19 +56,21 @@ ChunkDistributor<ChunkDistributorDataType>::tryAddQueue(not_null<ChunkQueueData_
 {
     typename MemberType_t::LockGuard_t lock(*getMembers());
 
+    const auto& storedQueues = getActiveQueues();
     const auto alreadyKnownReceiver =
-        std::find_if(getMembers()->m_queues.begin(),
-                     getMembers()->m_queues.end(),
-                     [&](const RelativePointer<ChunkQueueData_t> queue) { return queue.get() == queueToAdd; });
+        std::find_if(storedQueues.begin(), storedQueues.end(), [&](const RelativePointer<ChunkQueueData_t> queue) {
+            return queue.get() == queueToAdd;
+        });
 
     // check if the queue is not already in the list
-    if (alreadyKnownReceiver == getMembers()->m_queues.end())
+    if (alreadyKnownReceiver == storedQueues.end())
     {
-        if (getMembers()->m_queues.size() < getMembers()->m_queues.capacity())
+        if (storedQueues.size() < storedQueues.capacity())
         {
+            auto& modifiedQueues = prepareQueueModification();
             // AXIVION Next Construct AutosarC++19_03-A0.1.2, AutosarC++19_03-M0-3-2 : we checked the capacity, so
             // pushing will be fine
-            getMembers()->m_queues.push_back(RelativePointer<ChunkQueueData_t>(queueToAdd));
+            modifiedQueues.push_back(RelativePointer<ChunkQueueData_t>(queueToAdd));
 
             const auto currChunkHistorySize = getMembers()->m_history.size();
 
@@ -74,7 +81,8 @@ ChunkDistributor<ChunkDistributorDataType>::tryAddQueue(not_null<ChunkQueueData_
             }
 
             // if the current history is large enough we send the requested number of chunks, else we send the
-            // total history
+            // total history; this is done before the queue is visible for deliverToAllStoredQueues in order to keep
+            // the chunks in order
             const auto startIndex =
                 (requestedHistory <= currChunkHistorySize) ? currChunkHistorySize - requestedHistory : 0u;
             for (auto i = startIndex; i < currChunkHistorySize; ++i)
@@ -82,6 +90,8 @@ ChunkDistributor<ChunkDistributorDataType>::tryAddQueue(not_null<ChunkQueueData_
                 pushToQueue(queueToAdd, getMembers()->m_history[i].cloneToSharedChunk());
             }
 
+            activateModifiedQueues();
+
             return success<void>();
         }
         else
@@ -103,20 +113,19 @@ ChunkDistributor<ChunkDistributorDataType>::tryRemoveQueue(not_null<ChunkQueueDa
 {
     typename MemberType_t::LockGuard_t lock(*getMembers());
 
-    const auto iter = std::find(getMembers()->m_queues.begin(),
-                                getMembers()->m_queues.end(),
-                                static_cast<ChunkQueueData_t* const>(queueToRemove));
-    if (iter != getMembers()->m_queues.end())
-    {
-        // AXIVION Next Construct AutosarC++19_03-A0.1.2 : we don't use iter any longer so return value can be ignored
-        getMembers()->m_queues.erase(iter);
-
-        return success<void>();
-    }
-    else
+    if (!containsQueue(getActiveQueues(), queueToRemove))
     {
         return error<ChunkDistributorError>(ChunkDistributorError::QUEUE_NOT_IN_CONTAINER);
     }
+
+    auto& modifiedQueues = prepareQueueModification();
+    const auto iter = std::find(
+        modifiedQueues.begin(), modifiedQueues.end(), static_cast<ChunkQueueData_t* const>(queueToRemove));
+    // AXIVION Next Construct AutosarC++19_03-A0.1.2 : we don't use iter any longer so return value can be ignored
+    modifiedQueues.erase(iter);
+    activateModifiedQueues();
+
+    return success<void>();
 }
 
 template <typename ChunkDistributorDataType>
@@ -124,97 +133,238 @@ inline void ChunkDistributor<ChunkDistributorDataType>::removeAllQueues() noexce
 {
     typename MemberType_t::LockGuard_t lock(*getMembers());
 
-    getMembers()->m_queues.clear();
+    if (getActiveQueues().empty())
+    {
+        return;
+    }
+
+    prepareQueueModification().clear();
+    activateModifiedQueues();
 }
 
 template <typename ChunkDistributorDataType>
 inline bool ChunkDistributor<ChunkDistributorDataType>::hasStoredQueues() const noexcept
 {
-    typename MemberType_t::LockGuard_t lock(*getMembers());
+    const auto generation = enterQueueReaderSection();
+    const bool hasQueues{!getQueuesOfGeneration(generation).empty()};
+    leaveQueueReaderSection(generation);
 
-    return !getMembers()->m_queues.empty();
+    return hasQueues;
 }
 
 template <typename ChunkDistributorDataType>
 inline uint64_t ChunkDistributor<ChunkDistributorDataType>::deliverToAllStoredQueues(mepoo::SharedChunk chunk) noexcept
 {
-    uint64_t numberOfQueuesTheChunkWasDeliveredTo{0U};
-    typename ChunkDistributorDataType::QueueContainer_t remainingQueues;
-    {
-        typename MemberType_t::LockGuard_t lock(*getMembers());
+    return deliverToAllStoredQueues(&chunk, 1U);
+}
 
-        bool willWaitForConsumer = getMembers()->m_consumerTooSlowPolicy == ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER;
-        // send to all the queues
-        for (auto& queue : getMembers()->m_queues)
+template <typename ChunkDistributorDataType>
+inline uint64_t
+ChunkDistributor<ChunkDistributorDataType>::deliverToAllStoredQueues(const mepoo::SharedChunk* const chunks,
+                                                                     const uint64_t numberOfChunks) noexcept
+{
+    uint64_t numberOfQueuesTheChunksWereDeliveredTo{0U};
+    // the blocked queues together with the index of the first chunk which was not yet delivered to them
+    QueueContainer_t remainingQueues;
+    vector<uint64_t, MemberType_t::ChunkDistributorDataProperties_t::MAX_QUEUES> remainingChunkIndices;
+    // the served queues are only tracked when there is a history, see the delivery to concurrently added queues below
+    QueueContainer_t servedQueues;
+    const bool hasHistory{getMembers()->m_historyCapacity > 0U};
+    const bool willWaitForConsumer =
+        getMembers()->m_consumerTooSlowPolicy == ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER;
+
+    // pushes the chunks starting with 'nextChunkIndex' to the queue and notifies the consumer once; returns false if
+    // the queue is blocked, 'nextChunkIndex' is then the first chunk which was not delivered
+    auto serveQueue = [&](const RelativePointer<ChunkQueueData_t>& queue,
+                          uint64_t& nextChunkIndex,
+                          const bool notifyConsumer) -> bool {
+        ChunkQueuePusher_t pusher(queue.get());
+        const uint64_t firstChunkIndex{nextChunkIndex};
+        bool isBlocked{false};
+        for (; nextChunkIndex < numberOfChunks; ++nextChunkIndex)
         {
-            bool isBlockingQueue = (willWaitForConsumer && queue->m_queueFullPolicy == QueueFullPolicy::BLOCK_PRODUCER);
-
-            if (pushToQueue(queue.get(), chunk))
-            {
-                ++numberOfQueuesTheChunkWasDeliveredTo;
-            }
-            else
+            if (!pusher.pushWithoutNotification(chunks[nextChunkIndex]))
             {
-                if (isBlockingQueue)
-                {
-                    remainingQueues.emplace_back(queue);
-                }
-                else
+                if (willWaitForConsumer && queue->m_queueFullPolicy == QueueFullPolicy::BLOCK_PRODUCER)
                 {
-                    ++numberOfQueuesTheChunkWasDeliveredTo;
-                    ChunkQueuePusher_t(queue.get()).lostAChunk();
+                    isBlocked = true;
+                    break;
                 }
+                pusher.lostAChunk();
+                getMembers()->m_lostChunks.fetch_add(1U, std::memory_order_relaxed);
             }
         }
+
+        if (notifyConsumer && nextChunkIndex > firstChunkIndex)
+        {
+            pusher.notifyConsumer();
+        }
+
+        if (isBlocked)
+        {
+            return false;
+        }
+
+        ++numberOfQueuesTheChunksWereDeliveredTo;
+        if (hasHistory)
+        {
+            // AXIVION Next Construct AutosarC++19_03-A0.1.2 : the queues are a subset of the stored queues which
+            // cannot exceed the capacity
+            servedQueues.emplace_back(queue);
+        }
+        return true;
+    };
+
+    auto eraseRemainingQueue = [&](const uint64_t index) {
+        remainingQueues.erase(remainingQueues.begin() + index);
+        remainingChunkIndices.erase(remainingChunkIndices.begin() + index);
+    };
+
+    // send to all the queues without taking the lock; RouDi can add and remove queues concurrently
+    const bool batchNotifications{getMembers()->m_batchConsumerNotifications};
+    const auto deliveryGeneration = enterQueueReaderSection();
+    const auto& deliveryQueues = getQueuesOfGeneration(deliveryGeneration);
+    for (auto& queue : deliveryQueues)
+    {
+        uint64_t nextChunkIndex{0U};
+        if (!serveQueue(queue, nextChunkIndex, !batchNotifications))
+        {
+            remainingQueues.emplace_back(queue);
+            remainingChunkIndices.emplace_back(nextChunkIndex);
+        }
     }
+    if (batchNotifications)
+    {
+        notifyConsumers(deliveryQueues);
+    }
+    leaveQueueReaderSection(deliveryGeneration);
 
-    // busy waiting until every queue is served
-    iox::detail::adaptive_wait adaptiveWait;
+    // waiting until every queue is served; the consumers wake up the publisher when they freed space in their queue
     while (!remainingQueues.empty())
     {
-        adaptiveWait.wait();
+        // it is possible that since the last iteration some subscriber have already unsubscribed and their queues
+        // are not allowed to be accessed anymore; only the queues which are still stored are served
+        const auto generation = enterQueueReaderSection();
+        const auto& storedQueues = getQueuesOfGeneration(generation);
+        for (uint64_t i = remainingQueues.size(); i > 0U; --i)
         {
-            // create intersection of current queues and remainingQueues
-            // reason: it is possible that since the last iteration some subscriber have already unsubscribed
-            //          and without this intersection we would deliver to dead queues
-            typename MemberType_t::LockGuard_t lock(*getMembers());
-            typename ChunkDistributorDataType::QueueContainer_t queueIntersection(remainingQueues.size());
-            auto greaterThan = [](RelativePointer<ChunkQueueData_t>& a, RelativePointer<ChunkQueueData_t>& b) -> bool {
-                return reinterpret_cast<uint64_t>(a.get()) > reinterpret_cast<uint64_t>(b.get());
-            };
-            std::sort(getMembers()->m_queues.begin(), getMembers()->m_queues.end(), greaterThan);
-            std::sort(remainingQueues.begin(), remainingQueues.end(), greaterThan);
-
-            auto iter = std::set_intersection(getMembers()->m_queues.begin(),
-                                              getMembers()->m_queues.end(),
-                                              remainingQueues.begin(),
-                                              remainingQueues.end(),
-                                              queueIntersection.begin(),
-                                              greaterThan);
-            queueIntersection.resize(static_cast<uint64_t>(iter - queueIntersection.begin()));
-            remainingQueues = queueIntersection;
-
-            // deliver to remaining queues
-            for (uint64_t i = remainingQueues.size() - 1U; !remainingQueues.empty(); --i)
+            if (!containsQueue(storedQueues, remainingQueues[i - 1U].get()))
             {
-                if (pushToQueue(remainingQueues[i].get(), chunk))
+                eraseRemainingQueue(i - 1U);
+            }
+        }
+        if (!remainingQueues.empty())
+        {
+            // the reader section keeps the queue alive while waiting; the timeout bounds the time RouDi has to wait
+            // when it modifies the queues in the meantime
+            ChunkQueuePusher_t(remainingQueues.front().get()).waitForSpace(BLOCKED_QUEUE_WAIT_TIMEOUT);
+        }
+        for (uint64_t i = remainingQueues.size(); i > 0U; --i)
+        {
+            if (serveQueue(remainingQueues[i - 1U], remainingChunkIndices[i - 1U], true))
+            {
+                eraseRemainingQueue(i - 1U);
+            }
+        }
+        leaveQueueReaderSection(generation);
+    }
+
+    if (hasHistory)
+    {
+        // a queue which was added during the delivery got the history without these chunks; the chunks are delivered
+        // to it under the lock before they become part of the history, therefore they are received either way exactly
+        // once
+        bool hasBlockingQueue{false};
+        ChunkQueueData_t* blockedQueue{nullptr};
+        uint64_t blockedQueueChunkIndex{0U};
+        do
+        {
+            hasBlockingQueue = false;
+
+            {
+                typename MemberType_t::LockGuard_t lock(*getMembers());
+                if (getMembers()->m_queuesGeneration.load(std::memory_order_relaxed) != deliveryGeneration)
                 {
-                    remainingQueues.erase(remainingQueues.begin() + i);
-                    ++numberOfQueuesTheChunkWasDeliveredTo;
+                    const auto& storedQueues = getActiveQueues();
+                    eraseQueuesWhichAreNotStoredIn(servedQueues, storedQueues);
+                    for (auto& queue : storedQueues)
+                    {
+                        if (containsQueue(servedQueues, queue.get()))
+                        {
+                            continue;
+                        }
+
+                        // a blocked queue continues with the first chunk which was not yet delivered to it
+                        uint64_t nextChunkIndex{(queue.get() == blockedQueue) ? blockedQueueChunkIndex : 0U};
+                        if (!serveQueue(queue, nextChunkIndex, true))
+                        {
+                            hasBlockingQueue = true;
+                            blockedQueue = queue.get();
+                            blockedQueueChunkIndex = nextChunkIndex;
+                            break;
+                        }
+                    }
                 }
 
-                // don't move this up since the for loop counts downwards and the algorithm would break
-                if (i == 0U)
+                if (!hasBlockingQueue)
                 {
-                    break;
+                    for (uint64_t i = 0U; i < numberOfChunks; ++i)
+                    {
+                        addToHistoryWithoutDelivery(chunks[i]);
+                    }
                 }
             }
+
+            // a queue which was removed while waiting starts with the first chunk when it is added again
+            if (hasBlockingQueue && !waitForSpaceInStoredQueue(blockedQueue))
+            {
+                blockedQueue = nullptr;
+            }
+        } while (hasBlockingQueue);
+    }
+
+    return numberOfQueuesTheChunksWereDeliveredTo;
+}
+
+template <typename ChunkDistributorDataType>
+inline void ChunkDistributor<ChunkDistributorDataType>::notifyConsumers(const QueueContainer_t& queues) noexcept
+{
+    // first all notifications are activated, afterwards the condition variables are woken up; a consumer which wakes
+    // up therefore sees the notifications of all its queues at once
+    using Notification_t = std::pair<const ConditionVariableData*, uint64_t>;
+    vector<Notification_t, MemberType_t::ChunkDistributorDataProperties_t::MAX_QUEUES> notifications;
+    for (uint64_t i = 0U; i < queues.size(); ++i)
+    {
+        const auto* conditionVariableData = ChunkQueuePusher_t(queues[i].get()).activateNotification();
+        if (conditionVariableData != nullptr)
+        {
+            notifications.emplace_back(conditionVariableData, i);
         }
     }
 
-    addToHistoryWithoutDelivery(chunk);
+    // the notifications are grouped by condition variable; std::sort is not used since it triggers array-bounds
+    // warnings for a MAX_QUEUES below its insertion sort threshold, e.g. for the single queue of a client
+    const auto isLess = [](const Notification_t& lhs, const Notification_t& rhs) {
+        return std::less<const ConditionVariableData*>()(lhs.first, rhs.first);
+    };
+    for (auto next = notifications.begin(); next != notifications.end(); ++next)
+    {
+        std::rotate(std::upper_bound(notifications.begin(), next, *next, isLess), next, next + 1);
+    }
 
-    return numberOfQueuesTheChunkWasDeliveredTo;
+    auto notification = notifications.begin();
+    while (notification != notifications.end())
+    {
+        // a queue could have been detached from the condition variable in the meantime; in this case the next queue
+        // which is attached to the same condition variable does the wake up
+        const auto* conditionVariableData = notification->first;
+        bool isWokenUp{false};
+        for (; notification != notifications.end() && notification->first == conditionVariableData; ++notification)
+        {
+            isWokenUp = isWokenUp
+                        || ChunkQueuePusher_t(queues[notification->second].get()).wakeUpConsumer(conditionVariableData);
+        }
+    }
 }
 
 template <typename ChunkDistributorDataType>
@@ -233,33 +383,46 @@ ChunkDistributor<ChunkDistributorDataType>::deliverToQueue(const UniqueId unique
     bool retry{false};
     do
     {
-        typename MemberType_t::LockGuard_t lock(*getMembers());
+        ChunkQueueData_t* blockedQueue{nullptr};
+        {
+            typename MemberType_t::LockGuard_t lock(*getMembers());
 
-        auto queueIndex = getQueueIndex(uniqueQueueId, lastKnownQueueIndex);
+            auto queueIndex = getQueueIndex(uniqueQueueId, lastKnownQueueIndex);
 
-        if (!queueIndex.has_value())
-        {
-            return error<ChunkDistributorError>(ChunkDistributorError::QUEUE_NOT_IN_CONTAINER);
-        }
+            if (!queueIndex.has_value())
+            {
+                return error<ChunkDistributorError>(ChunkDistributorError::QUEUE_NOT_IN_CONTAINER);
+            }
 
-        auto& queue = getMembers()->m_queues[queueIndex.value()];
+            auto& queue = getActiveQueues()[queueIndex.value()];
 
-        bool willWaitForConsumer = getMembers()->m_consumerTooSlowPolicy == ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER;
+            bool willWaitForConsumer =
+                getMembers()->m_consumerTooSlowPolicy == ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER;
 
-        bool isBlockingQueue = (willWaitForConsumer && queue->m_queueFullPolicy == QueueFullPolicy::BLOCK_PRODUCER);
+            bool isBlockingQueue =
+                (willWaitForConsumer && queue->m_queueFullPolicy == QueueFullPolicy::BLOCK_PRODUCER);
 
-        retry = false;
-        if (!pushToQueue(queue.get(), chunk))
-        {
-            if (isBlockingQueue)
+            retry = false;
+            if (!pushToQueue(queue.get(), chunk))
             {
-                retry = true;
-            }
-            else
-            {
-                ChunkQueuePusher_t(queue.get()).lostAChunk();
+                if (isBlockingQueue)
+                {
+                    retry = true;
+                    blockedQueue = queue.get();
+                }
+                else
+                {
+                    ChunkQueuePusher_t(queue.get()).lostAChunk();
+                    getMembers()->m_lostChunks.fetch_add(1U, std::memory_order_relaxed);
+                }
             }
         }
+
+        if (retry)
+        {
+            // a removed queue is not waited for; the retry reports it as not in the container
+            IOX_DISCARD_RESULT(waitForSpaceInStoredQueue(blockedQueue));
+        }
     } while (retry);
 
     return success<>();
@@ -272,7 +435,7 @@ ChunkDistributor<ChunkDistributorDataType>::getQueueIndex(const UniqueId uniqueQ
 {
     typename MemberType_t::LockGuard_t lock(*getMembers());
 
-    auto& queues = getMembers()->m_queues;
+    auto& queues = getActiveQueues();
 
     if (queues.size() > lastKnownQueueIndex && queues[lastKnownQueueIndex]->m_uniqueId == uniqueQueueId)
     {
@@ -357,6 +520,126 @@ inline void ChunkDistributor<ChunkDistributorDataType>::cleanup() noexcept
     }
 }
 
+template <typename ChunkDistributorDataType>
+inline uint64_t ChunkDistributor<ChunkDistributorDataType>::enterQueueReaderSection() const noexcept
+{
+    uint64_t generation{getMembers()->m_queuesGeneration.load(std::memory_order_seq_cst)};
+    while (true)
+    {
+        auto& readers = getMembers()->m_queueReaders[generation % MemberType_t::NUMBER_OF_QUEUE_CONTAINERS];
+        readers.fetch_add(1U, std::memory_order_seq_cst);
+        // the container might have been deactivated and could be modified before the increment became visible to
+        // the modifying thread, therefore the generation is checked again
+        const auto currentGeneration = getMembers()->m_queuesGeneration.load(std::memory_order_seq_cst);
+        if (currentGeneration == generation)
+        {
+            return generation;
+        }
+        readers.fetch_sub(1U, std::memory_order_release);
+        generation = currentGeneration;
+    }
+}
+
+template <typename ChunkDistributorDataType>
+inline void
+ChunkDistributor<ChunkDistributorDataType>::leaveQueueReaderSection(const uint64_t generation) const noexcept
+{
+    getMembers()->m_queueReaders[generation % MemberType_t::NUMBER_OF_QUEUE_CONTAINERS].fetch_sub(
+        1U, std::memory_order_release);
+}
+
+template <typename ChunkDistributorDataType>
+inline const typename ChunkDistributorDataType::QueueContainer_t&
+ChunkDistributor<ChunkDistributorDataType>::getQueuesOfGeneration(const uint64_t generation) const noexcept
+{
+    return getMembers()->m_queues[generation % MemberType_t::NUMBER_OF_QUEUE_CONTAINERS];
+}
+
+template <typename ChunkDistributorDataType>
+inline const typename ChunkDistributorDataType::QueueContainer_t&
+ChunkDistributor<ChunkDistributorDataType>::getActiveQueues() const noexcept
+{
+    // the generation is only modified under the lock which is held by the caller
+    return getQueuesOfGeneration(getMembers()->m_queuesGeneration.load(std::memory_order_relaxed));
+}
+
+template <typename ChunkDistributorDataType>
+inline typename ChunkDistributorDataType::QueueContainer_t&
+ChunkDistributor<ChunkDistributorDataType>::prepareQueueModification() noexcept
+{
+    const auto generation = getMembers()->m_queuesGeneration.load(std::memory_order_relaxed);
+    auto& inactiveQueues = getMembers()->m_queues[(generation + 1U) % MemberType_t::NUMBER_OF_QUEUE_CONTAINERS];
+    // there are no readers of the inactive container since the last modification waited for them
+    inactiveQueues = getQueuesOfGeneration(generation);
+    return inactiveQueues;
+}
+
+template <typename ChunkDistributorDataType>
+inline void ChunkDistributor<ChunkDistributorDataType>::activateModifiedQueues() noexcept
+{
+    const auto generation = getMembers()->m_queuesGeneration.load(std::memory_order_relaxed);
+    getMembers()->m_queuesGeneration.store(generation + 1U, std::memory_order_seq_cst);
+
+    // wait until the readers of the previously active container are gone; afterwards the removed queues are not
+    // accessed anymore and the container can be reused for the next modification
+    auto& readers = getMembers()->m_queueReaders[generation % MemberType_t::NUMBER_OF_QUEUE_CONTAINERS];
+    iox::detail::adaptive_wait adaptiveWait;
+    deadline_timer readersTimer(QUEUE_READERS_TIMEOUT);
+    while (readers.load(std::memory_order_seq_cst) != 0U)
+    {
+        if (readersTimer.hasExpired())
+        {
+            // a reader section is at most as long as BLOCKED_QUEUE_WAIT_TIMEOUT, therefore the remaining readers
+            // were terminated while delivering a chunk and will never leave their section
+            IOX_LOG(WARN) << "Reclaiming " << readers.load(std::memory_order_relaxed)
+                          << " queue reader section(s) which were not left within " << QUEUE_READERS_TIMEOUT
+                          << "! The delivering process was probably terminated.";
+            readers.store(0U, std::memory_order_seq_cst);
+            break;
+        }
+        adaptiveWait.wait();
+    }
+}
+
+template <typename ChunkDistributorDataType>
+inline bool
+ChunkDistributor<ChunkDistributorDataType>::waitForSpaceInStoredQueue(ChunkQueueData_t* const queue) const noexcept
+{
+    // the reader section keeps the queue alive while waiting; the timeout bounds the time RouDi has to wait when it
+    // modifies the queues in the meantime
+    const auto generation = enterQueueReaderSection();
+    const bool isQueueStored{containsQueue(getQueuesOfGeneration(generation), queue)};
+    if (isQueueStored)
+    {
+        ChunkQueuePusher_t(queue).waitForSpace(BLOCKED_QUEUE_WAIT_TIMEOUT);
+    }
+    leaveQueueReaderSection(generation);
+    return isQueueStored;
+}
+
+template <typename ChunkDistributorDataType>
+inline bool ChunkDistributor<ChunkDistributorDataType>::containsQueue(const QueueContainer_t& queues,
+                                                                       const ChunkQueueData_t* const queue) noexcept
+{
+    return std::find_if(queues.begin(), queues.end(), [&](const RelativePointer<ChunkQueueData_t>& storedQueue) {
+               return storedQueue.get() == queue;
+           })
+           != queues.end();
+}
+
+template <typename ChunkDistributorDataType>
+inline void ChunkDistributor<ChunkDistributorDataType>::eraseQueuesWhichAreNotStoredIn(
+    QueueContainer_t& queues, const QueueContainer_t& storedQueues) noexcept
+{
+    for (uint64_t i = queues.size(); i > 0U; --i)
+    {
+        if (!containsQueue(storedQueues, queues[i - 1U].get()))
+        {
+            queues.erase(queues.begin() + (i - 1U));
+        }
+    }
+}
+
 } // namespace popo
 } // namespace iox
 
@@ -27,6 +27,7 @@
 #include "iox/relative_pointer.hpp"
 #include "iox/vector.hpp"
 
+#include <atomic>
 #include <cstdint>
 #include <mutex>
 
@@ -43,12 +44,30 @@ struct ChunkDistributorData : public LockingPolicy
     using ChunkQueueData_t = typename ChunkQueuePusherType::MemberType_t;
     using ChunkDistributorDataProperties_t = ChunkDistributorDataProperties;
 
-    ChunkDistributorData(const ConsumerTooSlowPolicy policy, const uint64_t historyCapacity = 0u) noexcept;
+    ChunkDistributorData(const ConsumerTooSlowPolicy policy,
+                         const uint64_t historyCapacity = 0u,
+                         const bool batchConsumerNotifications = false) noexcept;
 
     const uint64_t m_historyCapacity;
+    /// @brief If true, the consumers are notified in a separate pass after the chunk was pushed to all queues and
+    /// every condition variable is woken up only once per delivery, even if several queues are attached to it
+    const bool m_batchConsumerNotifications;
 
     using QueueContainer_t = vector<RelativePointer<ChunkQueueData_t>, ChunkDistributorDataProperties_t::MAX_QUEUES>;
-    QueueContainer_t m_queues;
+    static constexpr uint64_t NUMBER_OF_QUEUE_CONTAINERS{2U};
+
+    /// @brief The queues are double buffered in order to deliver chunks without taking the lock. A modification is
+    /// done under the lock on the inactive container which is then activated by incrementing m_queuesGeneration. The
+    /// active container is the one with the index 'm_queuesGeneration % NUMBER_OF_QUEUE_CONTAINERS'. A lock-free
+    /// reader announces itself in m_queueReaders of the container it is accessing and the modifying thread waits until
+    /// the previously active container has no readers anymore, i.e. a removed queue is not accessed anymore once the
+    /// modification returned.
+    /// NOLINTJUSTIFICATION the container is selected by the generation and accessed only via index
+    /// NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays)
+    QueueContainer_t m_queues[NUMBER_OF_QUEUE_CONTAINERS];
+    std::atomic<uint64_t> m_queuesGeneration{0U};
+    /// NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays)
+    mutable std::atomic<uint64_t> m_queueReaders[NUMBER_OF_QUEUE_CONTAINERS]{{0U}, {0U}};
 
     /// @todo iox-#1710 If we would make the ChunkDistributor lock-free, can we than extend the UsedChunkList to
     /// be like a ring buffer and use this for the history? This would be needed to be able to safely cleanup.
@@ -58,6 +77,9 @@ struct ChunkDistributorData : public LockingPolicy
         vector<mepoo::ShmSafeUnmanagedChunk, ChunkDistributorDataProperties_t::MAX_HISTORY_CAPACITY>;
     HistoryContainer_t m_history;
     const ConsumerTooSlowPolicy m_consumerTooSlowPolicy;
+
+    /// @brief number of deliveries which were dropped since the queue was full; read by the port introspection
+    std::atomic<uint64_t> m_lostChunks{0U};
 };
 
 } // namespace popo
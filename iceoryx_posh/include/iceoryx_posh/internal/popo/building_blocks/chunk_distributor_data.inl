@@ -33,11 +33,16 @@ constexpr T min(const T left, const T right) noexcept
 }
 } // namespace internal
 
+template <typename ChunkDistributorDataProperties, typename LockingPolicy, typename ChunkQueuePusherType>
+constexpr uint64_t ChunkDistributorData<ChunkDistributorDataProperties, LockingPolicy, ChunkQueuePusherType>::
+    NUMBER_OF_QUEUE_CONTAINERS;
+
 template <typename ChunkDistributorDataProperties, typename LockingPolicy, typename ChunkQueuePusherType>
 inline ChunkDistributorData<ChunkDistributorDataProperties, LockingPolicy, ChunkQueuePusherType>::ChunkDistributorData(
-    const ConsumerTooSlowPolicy policy, const uint64_t historyCapacity) noexcept
+    const ConsumerTooSlowPolicy policy, const uint64_t historyCapacity, const bool batchConsumerNotifications) noexcept
     : LockingPolicy()
     , m_historyCapacity(internal::min(historyCapacity, ChunkDistributorDataProperties_t::MAX_HISTORY_CAPACITY))
+    , m_batchConsumerNotifications(batchConsumerNotifications)
     , m_consumerTooSlowPolicy(policy)
 {
     if (m_historyCapacity != historyCapacity)
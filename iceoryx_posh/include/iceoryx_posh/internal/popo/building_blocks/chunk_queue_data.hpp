@@ -25,6 +25,7 @@
 #include "iox/detail/unique_id.hpp"
 #include "iox/relative_pointer.hpp"
 
+#include <atomic>
 #include <mutex>
 
 namespace iox
@@ -45,10 +46,20 @@ struct ChunkQueueData : public LockingPolicy
     static constexpr uint64_t MAX_CAPACITY = ChunkQueueDataProperties_t::MAX_QUEUE_CAPACITY;
     cxx::VariantQueue<mepoo::ShmSafeUnmanagedChunk, MAX_CAPACITY> m_queue;
     std::atomic_bool m_queueHasLostChunks{false};
+    /// @brief number of chunks which were dropped since the queue was full; read by the port introspection
+    std::atomic<uint64_t> m_lostChunks{0U};
 
     RelativePointer<ConditionVariableData> m_conditionVariableDataPtr;
     optional<uint64_t> m_conditionVariableNotificationIndex;
     const QueueFullPolicy m_queueFullPolicy;
+
+    /// @brief Only created for the BLOCK_PRODUCER policy. Producers which wait for space in the full queue sleep on the
+    /// semaphore and are woken up by the consumer when the queue was drained to the low watermark
+    optional<posix::UnnamedSemaphore> m_producerSemaphore;
+    std::atomic<uint32_t> m_numberOfWaitingProducers{0U};
+    /// @brief Set by the consumer when it woke up the waiting producers and reset by a producer which starts to wait;
+    /// this way the pops below the low watermark post the semaphore only once per wait
+    std::atomic<bool> m_hasWokenUpProducers{false};
 };
 
 } // namespace popo
@@ -17,6 +17,8 @@
 #ifndef IOX_POSH_POPO_BUILDING_BLOCKS_CHUNK_QUEUE_DATA_INL
 #define IOX_POSH_POPO_BUILDING_BLOCKS_CHUNK_QUEUE_DATA_INL
 
+#include "iceoryx_posh/error_handling/error_handling.hpp"
+
 namespace iox
 {
 namespace popo
@@ -27,6 +29,16 @@ inline ChunkQueueData<ChunkQueueProperties, LockingPolicy>::ChunkQueueData(
     : m_queue(queueType)
     , m_queueFullPolicy(policy)
 {
+    if (m_queueFullPolicy == QueueFullPolicy::BLOCK_PRODUCER)
+    {
+        posix::UnnamedSemaphoreBuilder()
+            .initialValue(0U)
+            .isInterProcessCapable(true)
+            .create(m_producerSemaphore)
+            .or_else([](auto) {
+                errorHandler(PoshError::POPO__CHUNK_QUEUE_DATA_FAILED_TO_CREATE_SEMAPHORE, ErrorLevel::FATAL);
+            });
+    }
 }
 
 } // namespace popo
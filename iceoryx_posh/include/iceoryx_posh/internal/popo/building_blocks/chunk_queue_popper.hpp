@@ -32,6 +32,9 @@ namespace popo
 /// infrastructure to exchange memory chunks between different data producers and consumers that could be located in
 /// different processes. A ChunkQueuePopper is used to build elements of higher abstraction layers that also do memory
 /// managemet and provide an API towards the real user
+/// @note tryPop, hasLostChunks, empty, size and clear can be called concurrently by multiple consumers if the queue is
+/// one of the MultiProducerSingleConsumer types of the VariantQueue since their underlying lock-free queue supports
+/// multiple consumers.
 template <typename ChunkQueueDataType>
 class ChunkQueuePopper
 {
@@ -46,7 +49,8 @@ class ChunkQueuePopper
     ChunkQueuePopper& operator=(ChunkQueuePopper&& rhs) noexcept = default;
     virtual ~ChunkQueuePopper() noexcept = default;
 
-    /// @brief pop a chunk from the chunk queue
+    /// @brief pop a chunk from the chunk queue; producers waiting for space in a queue with the BLOCK_PRODUCER policy
+    /// are woken up when the queue is drained to the low watermark of half its capacity
     /// @return optional for a shared chunk that is set if the queue is not empty
     optional<mepoo::SharedChunk> tryPop() noexcept;
 
@@ -97,6 +101,8 @@ class ChunkQueuePopper
     MemberType_t* getMembers() noexcept;
 
   private:
+    void wakeUpWaitingProducers() noexcept;
+
     MemberType_t* m_chunkQueueDataPtr;
 };
 
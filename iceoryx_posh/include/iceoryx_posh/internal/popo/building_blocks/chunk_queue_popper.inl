@@ -52,6 +52,8 @@ inline optional<mepoo::SharedChunk> ChunkQueuePopper<ChunkQueueDataType>::tryPop
     // check if queue had an element that was poped and return if so
     if (retVal.has_value())
     {
+        wakeUpWaitingProducers();
+
         auto chunk = retVal.value().releaseToSharedChunk();
 
         auto receivedChunkHeaderVersion = chunk.getChunkHeader()->chunkHeaderVersion();
@@ -71,15 +73,49 @@ inline optional<mepoo::SharedChunk> ChunkQueuePopper<ChunkQueueDataType>::tryPop
     }
 }
 
+template <typename ChunkQueueDataType>
+inline void ChunkQueuePopper<ChunkQueueDataType>::wakeUpWaitingProducers() noexcept
+{
+    if (!getMembers()->m_producerSemaphore.has_value())
+    {
+        return;
+    }
+
+    // pairs with the announcement of a waiting producer in ChunkQueuePusher::waitForSpace
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    const auto numberOfWaitingProducers = getMembers()->m_numberOfWaitingProducers.load(std::memory_order_relaxed);
+    // the producers are only woken up when the queue is at or below the low watermark, this way they can push a burst
+    // of chunks instead of being woken up for every single free slot
+    if (numberOfWaitingProducers == 0U || getMembers()->m_queue.size() > getMembers()->m_queue.capacity() / 2U)
+    {
+        return;
+    }
+
+    // every further pop below the low watermark would post again although the producers are already woken up
+    if (getMembers()->m_hasWokenUpProducers.exchange(true, std::memory_order_seq_cst))
+    {
+        return;
+    }
+
+    for (uint32_t i = 0U; i < numberOfWaitingProducers; ++i)
+    {
+        if (getMembers()->m_producerSemaphore->post().has_error())
+        {
+            errorHandler(PoshError::POPO__CHUNK_QUEUE_POPPER_SEMAPHORE_CORRUPTED_IN_POST, ErrorLevel::FATAL);
+            return;
+        }
+    }
+}
+
 template <typename ChunkQueueDataType>
 inline bool ChunkQueuePopper<ChunkQueueDataType>::hasLostChunks() noexcept
 {
-    if (getMembers()->m_queueHasLostChunks.load(std::memory_order_relaxed))
+    // the exchange ensures that a loss is reported only once when multiple consumers share the queue
+    if (!getMembers()->m_queueHasLostChunks.load(std::memory_order_relaxed))
     {
-        getMembers()->m_queueHasLostChunks.store(false, std::memory_order_relaxed);
-        return true;
+        return false;
     }
-    return false;
+    return getMembers()->m_queueHasLostChunks.exchange(false, std::memory_order_relaxed);
 }
 
 template <typename ChunkQueueDataType>
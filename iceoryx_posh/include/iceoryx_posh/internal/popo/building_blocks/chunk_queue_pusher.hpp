@@ -20,6 +20,7 @@
 #include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_data.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/condition_notifier.hpp"
+#include "iox/duration.hpp"
 #include "iox/expected.hpp"
 #include "iox/not_null.hpp"
 
@@ -50,9 +51,35 @@ class ChunkQueuePusher
     /// @return false if a queue overflow occurred, otherwise true
     bool push(mepoo::SharedChunk chunk) noexcept;
 
+    /// @brief push a new chunk to the chunk queue without notifying the consumer; the consumer has to be notified
+    /// afterwards with notifyConsumer or with activateNotification and wakeUpConsumer
+    /// @param[in] shared chunk object
+    /// @return false if a queue overflow occurred, otherwise true
+    bool pushWithoutNotification(mepoo::SharedChunk chunk) noexcept;
+
+    /// @brief Notifies the consumer if a condition variable is attached, e.g. after several chunks were pushed with
+    /// pushWithoutNotification
+    void notifyConsumer() noexcept;
+
+    /// @brief Marks the notification of the consumer as active without waking it up
+    /// @return the condition variable the consumer is waiting on or nullptr if no condition variable is attached
+    const ConditionVariableData* activateNotification() noexcept;
+
+    /// @brief Wakes up the consumer if the queue is still attached to the provided condition variable. Several queues
+    /// attached to the same condition variable need only one wake up after their notifications were activated
+    /// @param[in] conditionVariableData which was returned by activateNotification
+    /// @return true if the condition variable was woken up, false if the queue is not attached to it anymore
+    bool wakeUpConsumer(const ConditionVariableData* const conditionVariableData) noexcept;
+
     /// @brief tell the queue that it lost a chunk (e.g. because push failed and there will be no retry)
     void lostAChunk() noexcept;
 
+    /// @brief Blocks until the consumer drained the full queue to the low watermark or the timeout expired. Returns
+    /// immediately if the queue is not full or if the queue does not block producers
+    /// @param[in] timeout is the maximum time to wait; a blocked producer has to retry the push after the timeout
+    /// since a consumer which stops popping above the low watermark does not wake it up
+    void waitForSpace(const units::Duration& timeout) noexcept;
+
   protected:
     const MemberType_t* getMembers() const noexcept;
     MemberType_t* getMembers() noexcept;
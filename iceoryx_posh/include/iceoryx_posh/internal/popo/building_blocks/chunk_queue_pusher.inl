@@ -44,6 +44,27 @@ ChunkQueuePusher<ChunkQueueDataType>::getMembers() noexcept
 
 template <typename ChunkQueueDataType>
 inline bool ChunkQueuePusher<ChunkQueueDataType>::push(mepoo::SharedChunk chunk) noexcept
+{
+    const bool hasNoQueueOverflow = pushWithoutNotification(chunk);
+    notifyConsumer();
+
+    return hasNoQueueOverflow;
+}
+
+template <typename ChunkQueueDataType>
+inline void ChunkQueuePusher<ChunkQueueDataType>::notifyConsumer() noexcept
+{
+    typename MemberType_t::LockGuard_t lock(*getMembers());
+    if (getMembers()->m_conditionVariableDataPtr)
+    {
+        ConditionNotifier(*getMembers()->m_conditionVariableDataPtr.get(),
+                          *getMembers()->m_conditionVariableNotificationIndex)
+            .notify();
+    }
+}
+
+template <typename ChunkQueueDataType>
+inline bool ChunkQueuePusher<ChunkQueueDataType>::pushWithoutNotification(mepoo::SharedChunk chunk) noexcept
 {
     auto pushRet = getMembers()->m_queue.push(chunk);
     bool hasQueueOverflow = false;
@@ -56,23 +77,71 @@ inline bool ChunkQueuePusher<ChunkQueueDataType>::push(mepoo::SharedChunk chunk)
         hasQueueOverflow = true;
     }
 
+    return !hasQueueOverflow;
+}
+
+template <typename ChunkQueueDataType>
+inline const ConditionVariableData* ChunkQueuePusher<ChunkQueueDataType>::activateNotification() noexcept
+{
+    typename MemberType_t::LockGuard_t lock(*getMembers());
+    if (!getMembers()->m_conditionVariableDataPtr)
     {
-        typename MemberType_t::LockGuard_t lock(*getMembers());
-        if (getMembers()->m_conditionVariableDataPtr)
-        {
-            ConditionNotifier(*getMembers()->m_conditionVariableDataPtr.get(),
-                              *getMembers()->m_conditionVariableNotificationIndex)
-                .notify();
-        }
+        return nullptr;
     }
 
-    return !hasQueueOverflow;
+    ConditionNotifier(*getMembers()->m_conditionVariableDataPtr.get(),
+                      *getMembers()->m_conditionVariableNotificationIndex)
+        .notifyWithoutWakeUp();
+    return getMembers()->m_conditionVariableDataPtr.get();
+}
+
+template <typename ChunkQueueDataType>
+inline bool
+ChunkQueuePusher<ChunkQueueDataType>::wakeUpConsumer(const ConditionVariableData* const conditionVariableData) noexcept
+{
+    // the condition variable is only accessed while the queue is attached to it, this ensures that it still exists
+    typename MemberType_t::LockGuard_t lock(*getMembers());
+    if (!getMembers()->m_conditionVariableDataPtr
+        || getMembers()->m_conditionVariableDataPtr.get() != conditionVariableData)
+    {
+        return false;
+    }
+
+    ConditionNotifier(*getMembers()->m_conditionVariableDataPtr.get(),
+                      *getMembers()->m_conditionVariableNotificationIndex)
+        .wakeUp();
+    return true;
 }
 
 template <typename ChunkQueueDataType>
 inline void ChunkQueuePusher<ChunkQueueDataType>::lostAChunk() noexcept
 {
     getMembers()->m_queueHasLostChunks.store(true, std::memory_order_relaxed);
+    // several producers can push to the same queue
+    getMembers()->m_lostChunks.fetch_add(1U, std::memory_order_relaxed);
+}
+
+template <typename ChunkQueueDataType>
+inline void ChunkQueuePusher<ChunkQueueDataType>::waitForSpace(const units::Duration& timeout) noexcept
+{
+    auto& producerSemaphore = getMembers()->m_producerSemaphore;
+    if (!producerSemaphore.has_value())
+    {
+        return;
+    }
+
+    // the producer has to announce itself before the queue is checked; either the consumer sees the waiting producer
+    // after its pop or the producer sees the popped chunk and does not wait
+    getMembers()->m_numberOfWaitingProducers.fetch_add(1U, std::memory_order_seq_cst);
+    getMembers()->m_hasWokenUpProducers.store(false, std::memory_order_seq_cst);
+    if (getMembers()->m_queue.size() >= getMembers()->m_queue.capacity())
+    {
+        if (producerSemaphore->timedWait(timeout).has_error())
+        {
+            errorHandler(PoshError::POPO__CHUNK_QUEUE_PUSHER_SEMAPHORE_CORRUPTED_IN_TIMED_WAIT, ErrorLevel::FATAL);
+        }
+    }
+    getMembers()->m_numberOfWaitingProducers.fetch_sub(1U, std::memory_order_relaxed);
 }
 
 } // namespace popo
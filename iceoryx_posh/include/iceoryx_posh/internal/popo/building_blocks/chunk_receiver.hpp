@@ -23,6 +23,8 @@
 #include "iox/expected.hpp"
 #include "iox/not_null.hpp"
 
+#include <mutex>
+
 namespace iox
 {
 namespace popo
@@ -78,6 +80,15 @@ class ChunkReceiver : public ChunkQueuePopper<typename ChunkReceiverDataType::Ch
     /// or if there are no new chunks in the underlying queue
     expected<const mepoo::ChunkHeader*, ChunkReceiveResult> tryGet() noexcept;
 
+    /// @brief Tries to get the next received chunk like tryGet but only the bookkeeping of the chunks held by the user
+    /// is done while holding the provided lock. The chunk itself is popped without the lock, therefore multiple
+    /// consumers can get chunks concurrently if the underlying queue supports multiple consumers
+    /// @param[in] chunksInUseLock lock which serializes the access to the chunks held by the user
+    /// @return New chunk header, ChunkReceiveResult on error
+    /// or if there are no new chunks in the underlying queue
+    template <typename Lockable>
+    expected<const mepoo::ChunkHeader*, ChunkReceiveResult> tryGet(Lockable& chunksInUseLock) noexcept;
+
     /// @brief Release a chunk that was obtained with get
     /// @param[in] chunkHeader, pointer to the ChunkHeader to release
     void release(const mepoo::ChunkHeader* const chunkHeader) noexcept;
@@ -90,6 +101,15 @@ class ChunkReceiver : public ChunkQueuePopper<typename ChunkReceiverDataType::Ch
   private:
     const MemberType_t* getMembers() const noexcept;
     MemberType_t* getMembers() noexcept;
+
+    /// @brief Stores the chunk in the list of chunks held by the user
+    /// @param[in] sharedChunk which was popped from the queue
+    /// @return the ChunkHeader of the chunk, TOO_MANY_CHUNKS_HELD_IN_PARALLEL if the list is full
+    expected<const mepoo::ChunkHeader*, ChunkReceiveResult> hold(mepoo::SharedChunk sharedChunk) noexcept;
+
+    /// @brief Records the time since the chunk was sent if the latency histogram is enabled
+    /// @param[in] chunkHeader of the chunk that is handed to the user
+    void recordLatency(const mepoo::ChunkHeader& chunkHeader) noexcept;
 };
 
 } // namespace popo
@@ -76,24 +76,63 @@ inline expected<const mepoo::ChunkHeader*, ChunkReceiveResult> ChunkReceiver<Chu
 
     if (popRet.has_value())
     {
-        auto sharedChunk = *popRet;
-
-        // if the application holds too many chunks, don't provide more
-        if (getMembers()->m_chunksInUse.insert(sharedChunk))
-        {
-            return success<const mepoo::ChunkHeader*>(
-                const_cast<const mepoo::ChunkHeader*>(sharedChunk.getChunkHeader()));
-        }
-        else
-        {
-            // release the chunk
-            sharedChunk = nullptr;
-            return error<ChunkReceiveResult>(ChunkReceiveResult::TOO_MANY_CHUNKS_HELD_IN_PARALLEL);
-        }
+        return hold(*popRet);
     }
     return error<ChunkReceiveResult>(ChunkReceiveResult::NO_CHUNK_AVAILABLE);
 }
 
+template <typename ChunkReceiverDataType>
+template <typename Lockable>
+inline expected<const mepoo::ChunkHeader*, ChunkReceiveResult>
+ChunkReceiver<ChunkReceiverDataType>::tryGet(Lockable& chunksInUseLock) noexcept
+{
+    auto popRet = this->tryPop();
+
+    if (popRet.has_value())
+    {
+        std::lock_guard<Lockable> lock(chunksInUseLock);
+        return hold(*popRet);
+    }
+    return error<ChunkReceiveResult>(ChunkReceiveResult::NO_CHUNK_AVAILABLE);
+}
+
+template <typename ChunkReceiverDataType>
+inline expected<const mepoo::ChunkHeader*, ChunkReceiveResult>
+ChunkReceiver<ChunkReceiverDataType>::hold(mepoo::SharedChunk sharedChunk) noexcept
+{
+    // if the application holds too many chunks, don't provide more
+    if (getMembers()->m_chunksInUse.insert(sharedChunk))
+    {
+        // only one consumer at a time writes the counter, a read-modify-write is not required
+        auto& receivedChunks = getMembers()->m_receivedChunks;
+        receivedChunks.store(receivedChunks.load(std::memory_order_relaxed) + 1U, std::memory_order_relaxed);
+        recordLatency(*sharedChunk.getChunkHeader());
+        return success<const mepoo::ChunkHeader*>(const_cast<const mepoo::ChunkHeader*>(sharedChunk.getChunkHeader()));
+    }
+
+    // the chunk is released when the SharedChunk goes out of scope
+    return error<ChunkReceiveResult>(ChunkReceiveResult::TOO_MANY_CHUNKS_HELD_IN_PARALLEL);
+}
+
+template <typename ChunkReceiverDataType>
+inline void ChunkReceiver<ChunkReceiverDataType>::recordLatency(const mepoo::ChunkHeader& chunkHeader) noexcept
+{
+    auto* latencyHistogram = getMembers()->m_latencyHistogram.get();
+    const auto sendTimestamp = chunkHeader.sendTimestamp();
+    // chunks which were not sent by a ChunkSender, e.g. by a gateway, have no send timestamp
+    if (latencyHistogram == nullptr || sendTimestamp == 0U)
+    {
+        return;
+    }
+
+    const auto now = static_cast<uint64_t>(
+        std::chrono::duration_cast<mepoo::DurationNs_t>(mepoo::BaseClock_t::now().time_since_epoch()).count());
+    if (now >= sendTimestamp)
+    {
+        latencyHistogram->record(now - sendTimestamp);
+    }
+}
+
 template <typename ChunkReceiverDataType>
 inline void ChunkReceiver<ChunkReceiverDataType>::release(const mepoo::ChunkHeader* const chunkHeader) noexcept
 {
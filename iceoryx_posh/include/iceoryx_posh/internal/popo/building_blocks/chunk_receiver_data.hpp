@@ -20,8 +20,12 @@
 #include "iceoryx_hoofs/cxx/variant_queue.hpp"
 #include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/latency_histogram.hpp"
 #include "iceoryx_posh/internal/popo/used_chunk_list.hpp"
 #include "iceoryx_posh/mepoo/memory_info.hpp"
+#include "iox/relative_pointer.hpp"
+
+#include <atomic>
 
 namespace iox
 {
@@ -32,7 +36,8 @@ struct ChunkReceiverData : public ChunkQueueDataType
 {
     explicit ChunkReceiverData(const cxx::VariantQueueTypes queueType,
                                const QueueFullPolicy queueFullPolicy,
-                               const mepoo::MemoryInfo& memoryInfo = mepoo::MemoryInfo()) noexcept;
+                               const mepoo::MemoryInfo& memoryInfo = mepoo::MemoryInfo(),
+                               LatencyHistogram* const latencyHistogram = nullptr) noexcept;
 
     using ChunkQueueData_t = ChunkQueueDataType;
 
@@ -43,6 +48,15 @@ struct ChunkReceiverData : public ChunkQueueDataType
     /// has to return one to not brake the contract. This is aligned with AUTOSAR Adaptive ara::com
     static constexpr uint32_t MAX_CHUNKS_IN_USE = MaxChunksHeldSimultaneously + 1U;
     UsedChunkList<MAX_CHUNKS_IN_USE> m_chunksInUse;
+
+    /// @brief number of chunks which were handed to the user; only written by the consumer, read by the port
+    /// introspection
+    std::atomic<uint64_t> m_receivedChunks{0U};
+
+    /// @brief end-to-end latency of the received chunks; only set when it was requested with the subscriber options,
+    /// only written by the consumer, read by the port introspection. The histogram is owned by the creator of the
+    /// ChunkReceiverData, e.g. the PortPool, in order to not enlarge every subscriber port by its size
+    RelativePointer<LatencyHistogram> m_latencyHistogram;
 };
 
 } // namespace popo
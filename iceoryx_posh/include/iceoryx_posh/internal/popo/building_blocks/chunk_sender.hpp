@@ -28,6 +28,7 @@
 #include "iox/into.hpp"
 #include "iox/not_null.hpp"
 #include "iox/optional.hpp"
+#include "iox/vector.hpp"
 
 namespace iox
 {
@@ -72,6 +73,8 @@ inline log::LogStream& operator<<(log::LogStream& stream, AllocationError value)
 /// For getting chunks of memory the MemoryManger is used. Together with the ChunkReceiver, they are the next
 /// abstraction layer on top of ChunkDistributor and ChunkQueuePopper. The ChunkSender holds the ownership of the
 /// SharedChunks and does a bookkeeping which chunks are currently passed to the user side.
+/// Besides the last sent chunk, up to 'm_recycledChunkCapacity' previously sent chunks are kept in a ring and reused
+/// by tryAllocate once all subscribers released them, instead of getting a new chunk from the MemoryManager.
 template <typename ChunkSenderDataType>
 class ChunkSender : public ChunkDistributor<typename ChunkSenderDataType::ChunkDistributorData_t>
 {
@@ -114,6 +117,15 @@ class ChunkSender : public ChunkDistributor<typename ChunkSenderDataType::ChunkD
     /// @return the number of receiver the chunk was send to
     uint64_t send(mepoo::ChunkHeader* const chunkHeader) noexcept;
 
+    /// @brief Send allocated chunks in the given order to all connected ChunkQueuePopper. Compared to calling send
+    /// for each chunk, every ChunkQueuePopper is notified only once and the history is updated in one go
+    /// @param[in] chunkHeaders, pointer to the first of the ChunkHeaders to send; the ownership of the pointers is
+    /// transferred to this method
+    /// @param[in] numberOfChunks, the number of ChunkHeaders to send
+    /// @return the minimum number of receiver any of the chunks was send to, i.e. a receiver which subscribes or
+    /// unsubscribes while the batch is sent is only counted if it received all the chunks
+    uint64_t sendBatch(mepoo::ChunkHeader* const* const chunkHeaders, const uint64_t numberOfChunks) noexcept;
+
     /// @brief Send an allocated chunk to a specific ChunkQueuePopper
     /// @param[in] chunkHeader, pointer to the ChunkHeader to send; the ownership of the pointer is transferred to this
     /// method
@@ -145,6 +157,21 @@ class ChunkSender : public ChunkDistributor<typename ChunkSenderDataType::ChunkD
     /// @return true if there was a matching chunk with this header, false if not
     bool getChunkReadyForSend(const mepoo::ChunkHeader* const chunkHeader, mepoo::SharedChunk& chunk) noexcept;
 
+    /// @brief Stores the sent chunk as last chunk and moves the previous last chunk to the recycled chunks
+    /// @param[in] chunk that was sent
+    void storeLastChunk(const mepoo::SharedChunk& chunk) noexcept;
+
+    /// @brief Updates the statistics of the sent chunks which are read by the port introspection
+    /// @param[in] chunkHeader of the chunk that is sent
+    /// @param[in] now is the send timestamp of the chunk
+    void updateSendStatistics(const mepoo::ChunkHeader& chunkHeader, const uint64_t now) noexcept;
+
+    /// @brief Searches the last chunk and the recycled chunks for the smallest chunk which has no other owner and
+    /// fits the required chunk size
+    /// @param[in] requiredChunkSize is the minimal size of the chunk
+    /// @return pointer to the unmanaged chunk which can be reused, nullptr if there is none
+    mepoo::ShmSafeUnmanagedChunk* findReusableChunk(const uint32_t requiredChunkSize) noexcept;
+
     const MemberType_t* getMembers() const noexcept;
     MemberType_t* getMembers() noexcept;
 };
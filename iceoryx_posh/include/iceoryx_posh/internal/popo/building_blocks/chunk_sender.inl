@@ -101,7 +101,7 @@ ChunkSender<ChunkSenderDataType>::tryAllocate(const UniquePortId originId,
                                               const uint32_t userHeaderSize,
                                               const uint32_t userHeaderAlignment) noexcept
 {
-    // use the chunk stored in m_lastChunkUnmanaged if:
+    // reuse the last chunk or a recycled chunk if:
     //   - there is a valid chunk
     //   - there is no other owner
     //   - the new user-payload still fits in it
@@ -115,20 +115,34 @@ ChunkSender<ChunkSenderDataType>::tryAllocate(const UniquePortId originId,
     const auto& chunkSettings = chunkSettingsResult.value();
     const uint32_t requiredChunkSize = chunkSettings.requiredChunkSize();
 
-    auto& lastChunkUnmanaged = getMembers()->m_lastChunkUnmanaged;
-    mepoo::ChunkHeader* lastChunkChunkHeader =
-        lastChunkUnmanaged.isNotLogicalNullptrAndHasNoOtherOwners() ? lastChunkUnmanaged.getChunkHeader() : nullptr;
+    auto* reusableChunk = findReusableChunk(requiredChunkSize);
+    // the counters are only written by the publisher, a read-modify-write is not required; without a recycle capacity
+    // the feature is disabled and there is nothing to count
+    const bool isRecyclingEnabled{getMembers()->m_recycledChunkCapacity > 0U};
+    auto& recycledChunkHits = getMembers()->m_recycledChunkHits;
+    auto& recycledChunkMisses = getMembers()->m_recycledChunkMisses;
 
-    if (lastChunkChunkHeader && (lastChunkChunkHeader->chunkSize() >= requiredChunkSize))
+    if (reusableChunk != nullptr)
     {
-        auto sharedChunk = lastChunkUnmanaged.cloneToSharedChunk();
+        if (isRecyclingEnabled)
+        {
+            recycledChunkHits.store(recycledChunkHits.load(std::memory_order_relaxed) + 1U, std::memory_order_relaxed);
+        }
+
+        mepoo::ChunkHeader* reusableChunkHeader = reusableChunk->getChunkHeader();
+        auto sharedChunk = reusableChunk->cloneToSharedChunk();
         if (getMembers()->m_chunksInUse.insert(sharedChunk))
         {
-            auto chunkSize = lastChunkChunkHeader->chunkSize();
-            lastChunkChunkHeader->~ChunkHeader();
-            new (lastChunkChunkHeader) mepoo::ChunkHeader(chunkSize, chunkSettings);
-            lastChunkChunkHeader->setOriginId(originId);
-            return success<mepoo::ChunkHeader*>(lastChunkChunkHeader);
+            if (reusableChunk != &getMembers()->m_lastChunkUnmanaged)
+            {
+                // the chunk is owned by m_chunksInUse now and is recycled again after it was sent
+                reusableChunk->releaseToSharedChunk();
+            }
+            auto chunkSize = reusableChunkHeader->chunkSize();
+            reusableChunkHeader->~ChunkHeader();
+            new (reusableChunkHeader) mepoo::ChunkHeader(chunkSize, chunkSettings);
+            reusableChunkHeader->setOriginId(originId);
+            return success<mepoo::ChunkHeader*>(reusableChunkHeader);
         }
         else
         {
@@ -137,6 +151,12 @@ ChunkSender<ChunkSenderDataType>::tryAllocate(const UniquePortId originId,
     }
     else
     {
+        if (isRecyclingEnabled)
+        {
+            recycledChunkMisses.store(recycledChunkMisses.load(std::memory_order_relaxed) + 1U,
+                                      std::memory_order_relaxed);
+        }
+
         // BEGIN of critical section, chunk will be lost if the process terminates in this section
         // get a new chunk
         auto getChunkResult = getMembers()->m_memoryMgr->getChunk(chunkSettings);
@@ -188,14 +208,58 @@ inline uint64_t ChunkSender<ChunkSenderDataType>::send(mepoo::ChunkHeader* const
     {
         numberOfReceiverTheChunkWasDelivered = this->deliverToAllStoredQueues(chunk);
 
-        getMembers()->m_lastChunkUnmanaged.releaseToSharedChunk();
-        getMembers()->m_lastChunkUnmanaged = chunk;
+        storeLastChunk(chunk);
     }
     // END of critical section
 
     return numberOfReceiverTheChunkWasDelivered;
 }
 
+template <typename ChunkSenderDataType>
+inline uint64_t ChunkSender<ChunkSenderDataType>::sendBatch(mepoo::ChunkHeader* const* const chunkHeaders,
+                                                            const uint64_t numberOfChunks) noexcept
+{
+    // the receivers can change between the parts of a batch, only the ones which received every part are counted
+    uint64_t numberOfReceiverTheChunksWereDelivered{0};
+    bool hasDeliveredAPart{false};
+    // there cannot be more valid chunks than chunks in use, an invalid chunk header is reported by
+    // getChunkReadyForSend; larger batches are nevertheless sent in parts
+    vector<mepoo::SharedChunk, MemberType_t::MAX_CHUNKS_ALLOCATED_SIMULTANEOUSLY> chunks;
+    uint64_t index{0U};
+    while (index < numberOfChunks)
+    {
+        // BEGIN of critical section, chunks will be lost if the process terminates in this section
+        for (; index < numberOfChunks && chunks.size() < chunks.capacity(); ++index)
+        {
+            mepoo::SharedChunk chunk(nullptr);
+            if (getChunkReadyForSend(chunkHeaders[index], chunk))
+            {
+                chunks.emplace_back(chunk);
+            }
+        }
+
+        if (!chunks.empty())
+        {
+            const auto numberOfReceiverThePartWasDelivered =
+                this->deliverToAllStoredQueues(chunks.begin(), chunks.size());
+            numberOfReceiverTheChunksWereDelivered =
+                hasDeliveredAPart
+                    ? std::min(numberOfReceiverTheChunksWereDelivered, numberOfReceiverThePartWasDelivered)
+                    : numberOfReceiverThePartWasDelivered;
+            hasDeliveredAPart = true;
+
+            for (const auto& chunk : chunks)
+            {
+                storeLastChunk(chunk);
+            }
+            chunks.clear();
+        }
+        // END of critical section
+    }
+
+    return numberOfReceiverTheChunksWereDelivered;
+}
+
 template <typename ChunkSenderDataType>
 inline bool ChunkSender<ChunkSenderDataType>::sendToQueue(mepoo::ChunkHeader* const chunkHeader,
                                                           const UniqueId uniqueQueueId,
@@ -207,8 +271,7 @@ inline bool ChunkSender<ChunkSenderDataType>::sendToQueue(mepoo::ChunkHeader* co
     {
         auto deliveryResult = this->deliverToQueue(uniqueQueueId, lastKnownQueueIndex, chunk);
 
-        getMembers()->m_lastChunkUnmanaged.releaseToSharedChunk();
-        getMembers()->m_lastChunkUnmanaged = chunk;
+        storeLastChunk(chunk);
 
         return !deliveryResult.has_error();
     }
@@ -226,8 +289,7 @@ inline void ChunkSender<ChunkSenderDataType>::pushToHistory(mepoo::ChunkHeader*
     {
         this->addToHistoryWithoutDelivery(chunk);
 
-        getMembers()->m_lastChunkUnmanaged.releaseToSharedChunk();
-        getMembers()->m_lastChunkUnmanaged = chunk;
+        storeLastChunk(chunk);
     }
     // END of critical section
 }
@@ -251,6 +313,10 @@ inline void ChunkSender<ChunkSenderDataType>::releaseAll() noexcept
     getMembers()->m_chunksInUse.cleanup();
     this->cleanup();
     getMembers()->m_lastChunkUnmanaged.releaseToSharedChunk();
+    for (uint32_t i = 0U; i < getMembers()->m_recycledChunkCapacity; ++i)
+    {
+        getMembers()->m_recycledChunks[i].releaseToSharedChunk();
+    }
 }
 
 template <typename ChunkSenderDataType>
@@ -259,7 +325,12 @@ inline bool ChunkSender<ChunkSenderDataType>::getChunkReadyForSend(const mepoo::
 {
     if (getMembers()->m_chunksInUse.remove(chunkHeader, chunk))
     {
-        chunk.getChunkHeader()->setSequenceNumber(getMembers()->m_sequenceNumber++);
+        const auto now = static_cast<uint64_t>(
+            std::chrono::duration_cast<mepoo::DurationNs_t>(mepoo::BaseClock_t::now().time_since_epoch()).count());
+        auto* header = chunk.getChunkHeader();
+        header->setSequenceNumber(getMembers()->m_sequenceNumber++);
+        header->setSendTimestamp(now);
+        updateSendStatistics(*header, now);
         return true;
     }
     else
@@ -269,6 +340,91 @@ inline bool ChunkSender<ChunkSenderDataType>::getChunkReadyForSend(const mepoo::
     }
 }
 
+template <typename ChunkSenderDataType>
+inline void ChunkSender<ChunkSenderDataType>::updateSendStatistics(const mepoo::ChunkHeader& chunkHeader,
+                                                                   const uint64_t now) noexcept
+{
+    // the statistics are only written by the publisher, a read-modify-write is not required
+    auto* members = getMembers();
+    const auto sentChunks = members->m_sentChunks.load(std::memory_order_relaxed);
+
+    if (sentChunks == 0U)
+    {
+        members->m_firstSendTimestamp.store(now, std::memory_order_relaxed);
+    }
+    else
+    {
+        const auto lastSendTimestamp = members->m_lastSendTimestamp.load(std::memory_order_relaxed);
+        members->m_lastSendIntervalInNanoseconds.store(now - lastSendTimestamp, std::memory_order_relaxed);
+    }
+    members->m_lastSendTimestamp.store(now, std::memory_order_relaxed);
+    members->m_lastUserPayloadSize.store(chunkHeader.userPayloadSize(), std::memory_order_relaxed);
+    members->m_lastChunkSize.store(chunkHeader.chunkSize(), std::memory_order_relaxed);
+    members->m_sentUserPayloadBytes.store(members->m_sentUserPayloadBytes.load(std::memory_order_relaxed)
+                                              + chunkHeader.userPayloadSize(),
+                                          std::memory_order_relaxed);
+    members->m_sentChunks.store(sentChunks + 1U, std::memory_order_relaxed);
+}
+
+template <typename ChunkSenderDataType>
+inline void ChunkSender<ChunkSenderDataType>::storeLastChunk(const mepoo::SharedChunk& chunk) noexcept
+{
+    auto* members = getMembers();
+    auto previousChunk = members->m_lastChunkUnmanaged.releaseToSharedChunk();
+    members->m_lastChunkUnmanaged = chunk;
+
+    // the previous chunk is the same as the new one when the last chunk was reused by tryAllocate
+    if (members->m_recycledChunkCapacity == 0U || !previousChunk || previousChunk == chunk)
+    {
+        return;
+    }
+
+    // the last chunk might already be in the ring if it was reused while another chunk was sent
+    for (uint32_t i = 0U; i < members->m_recycledChunkCapacity; ++i)
+    {
+        if (members->m_recycledChunks[i].getChunkHeader() == previousChunk.getChunkHeader())
+        {
+            return;
+        }
+    }
+
+    // the oldest recycled chunk is overwritten and released by the d'tor of the returned SharedChunk
+    auto& recycledChunk = members->m_recycledChunks[members->m_nextRecycledChunkIndex];
+    recycledChunk.releaseToSharedChunk();
+    recycledChunk = previousChunk;
+    members->m_nextRecycledChunkIndex = (members->m_nextRecycledChunkIndex + 1U) % members->m_recycledChunkCapacity;
+}
+
+template <typename ChunkSenderDataType>
+inline mepoo::ShmSafeUnmanagedChunk*
+ChunkSender<ChunkSenderDataType>::findReusableChunk(const uint32_t requiredChunkSize) noexcept
+{
+    auto* members = getMembers();
+    mepoo::ShmSafeUnmanagedChunk* reusableChunk{nullptr};
+    uint32_t reusableChunkSize{0U};
+
+    auto considerChunk = [&](mepoo::ShmSafeUnmanagedChunk& chunk) {
+        if (!chunk.isNotLogicalNullptrAndHasNoOtherOwners())
+        {
+            return;
+        }
+        const uint32_t chunkSize = chunk.getChunkHeader()->chunkSize();
+        if (chunkSize >= requiredChunkSize && (reusableChunk == nullptr || chunkSize < reusableChunkSize))
+        {
+            reusableChunk = &chunk;
+            reusableChunkSize = chunkSize;
+        }
+    };
+
+    considerChunk(members->m_lastChunkUnmanaged);
+    for (uint32_t i = 0U; i < members->m_recycledChunkCapacity; ++i)
+    {
+        considerChunk(members->m_recycledChunks[i]);
+    }
+
+    return reusableChunk;
+}
+
 } // namespace popo
 } // namespace iox
 
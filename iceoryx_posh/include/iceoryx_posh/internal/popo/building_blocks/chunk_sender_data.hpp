@@ -26,6 +26,8 @@
 #include "iox/not_null.hpp"
 #include "iox/relative_pointer.hpp"
 
+#include <atomic>
+
 namespace iox
 {
 namespace popo
@@ -36,15 +38,42 @@ struct ChunkSenderData : public ChunkDistributorDataType
     explicit ChunkSenderData(not_null<mepoo::MemoryManager* const> memoryManager,
                              const ConsumerTooSlowPolicy consumerTooSlowPolicy,
                              const uint64_t historyCapacity = 0U,
-                             const mepoo::MemoryInfo& memoryInfo = mepoo::MemoryInfo()) noexcept;
+                             const mepoo::MemoryInfo& memoryInfo = mepoo::MemoryInfo(),
+                             const bool batchConsumerNotifications = false,
+                             const uint32_t recycledChunkCapacity = 0U) noexcept;
 
     using ChunkDistributorData_t = ChunkDistributorDataType;
 
+    static constexpr uint32_t MAX_CHUNKS_ALLOCATED_SIMULTANEOUSLY{MaxChunksAllocatedSimultaneously};
+    static constexpr uint32_t MAX_RECYCLED_CHUNKS{MAX_RECYCLED_CHUNKS_PER_PUBLISHER};
+
     const RelativePointer<mepoo::MemoryManager> m_memoryMgr;
     mepoo::MemoryInfo m_memoryInfo;
     UsedChunkList<MaxChunksAllocatedSimultaneously> m_chunksInUse;
     mepoo::SequenceNumber_t m_sequenceNumber{0U};
     mepoo::ShmSafeUnmanagedChunk m_lastChunkUnmanaged;
+
+    /// @brief ring of the chunks which were sent before m_lastChunkUnmanaged; a chunk is reused by the next allocation
+    /// once all subscribers released it
+    const uint32_t m_recycledChunkCapacity;
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays) fixed size ring in shared memory
+    mepoo::ShmSafeUnmanagedChunk m_recycledChunks[MAX_RECYCLED_CHUNKS];
+    uint32_t m_nextRecycledChunkIndex{0U};
+
+    /// @brief number of allocations served by a previously sent chunk and by the mempool; only written by the
+    /// publisher, read by the port introspection and not counted without a recycle capacity
+    std::atomic<uint64_t> m_recycledChunkHits{0U};
+    std::atomic<uint64_t> m_recycledChunkMisses{0U};
+
+    /// @brief statistics of the sent chunks; only written by the publisher, read by the port introspection. The
+    /// timestamps are the nanoseconds since the epoch of mepoo::BaseClock_t
+    std::atomic<uint64_t> m_sentChunks{0U};
+    std::atomic<uint64_t> m_sentUserPayloadBytes{0U};
+    std::atomic<uint32_t> m_lastUserPayloadSize{0U};
+    std::atomic<uint32_t> m_lastChunkSize{0U};
+    std::atomic<uint64_t> m_firstSendTimestamp{0U};
+    std::atomic<uint64_t> m_lastSendTimestamp{0U};
+    std::atomic<uint64_t> m_lastSendIntervalInNanoseconds{0U};
 };
 
 } // namespace popo
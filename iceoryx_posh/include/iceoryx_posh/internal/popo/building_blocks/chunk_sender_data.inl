@@ -21,16 +21,32 @@ namespace iox
 {
 namespace popo
 {
+template <uint32_t MaxChunksAllocatedSimultaneously, typename ChunkDistributorDataType>
+constexpr uint32_t
+    ChunkSenderData<MaxChunksAllocatedSimultaneously, ChunkDistributorDataType>::MAX_CHUNKS_ALLOCATED_SIMULTANEOUSLY;
+
+template <uint32_t MaxChunksAllocatedSimultaneously, typename ChunkDistributorDataType>
+constexpr uint32_t ChunkSenderData<MaxChunksAllocatedSimultaneously, ChunkDistributorDataType>::MAX_RECYCLED_CHUNKS;
+
 template <uint32_t MaxChunksAllocatedSimultaneously, typename ChunkDistributorDataType>
 inline ChunkSenderData<MaxChunksAllocatedSimultaneously, ChunkDistributorDataType>::ChunkSenderData(
     not_null<mepoo::MemoryManager* const> memoryManager,
     const ConsumerTooSlowPolicy consumerTooSlowPolicy,
     const uint64_t historyCapacity,
-    const mepoo::MemoryInfo& memoryInfo) noexcept
-    : ChunkDistributorDataType(consumerTooSlowPolicy, historyCapacity)
+    const mepoo::MemoryInfo& memoryInfo,
+    const bool batchConsumerNotifications,
+    const uint32_t recycledChunkCapacity) noexcept
+    : ChunkDistributorDataType(consumerTooSlowPolicy, historyCapacity, batchConsumerNotifications)
     , m_memoryMgr(memoryManager)
     , m_memoryInfo(memoryInfo)
+    , m_recycledChunkCapacity((recycledChunkCapacity < MAX_RECYCLED_CHUNKS) ? recycledChunkCapacity
+                                                                           : MAX_RECYCLED_CHUNKS)
 {
+    if (m_recycledChunkCapacity != recycledChunkCapacity)
+    {
+        IOX_LOG(WARN) << "Recycled chunk capacity too large, reducing from " << recycledChunkCapacity << " to "
+                      << m_recycledChunkCapacity;
+    }
 }
 
 } // namespace popo
@@ -69,7 +69,7 @@ class ConditionListener
     ConditionVariableData* getMembers() noexcept;
 
   private:
-    void resetUnchecked(const uint64_t index) noexcept;
+    void collectActiveNotifications(NotificationVector_t& activeNotifications) noexcept;
     void resetSemaphore() noexcept;
 
     NotificationVector_t waitImpl(const function_ref<bool()>& waitCall) noexcept;
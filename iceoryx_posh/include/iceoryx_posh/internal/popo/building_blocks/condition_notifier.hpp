@@ -40,6 +40,14 @@ class ConditionNotifier
     /// @brief If threads are waiting on the condition variable, this call unblocks one of the waiting threads
     void notify() noexcept;
 
+    /// @brief Marks the notification as active without unblocking a waiting thread; wakeUp must be called afterwards.
+    /// This allows to wake up a condition variable only once for several notifications
+    void notifyWithoutWakeUp() noexcept;
+
+    /// @brief If threads are waiting on the condition variable, this call unblocks one of the waiting threads which
+    /// collects all active notifications
+    void wakeUp() noexcept;
+
   protected:
     const ConditionVariableData* getMembers() const noexcept;
     ConditionVariableData* getMembers() noexcept;
@@ -19,16 +19,28 @@
 
 #include "iceoryx_hoofs/posix_wrapper/unnamed_semaphore.hpp"
 #include "iceoryx_posh/error_handling/error_handling.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/discovery_notifier.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 
 #include <atomic>
+#include <cstdint>
 
 namespace iox
 {
 namespace popo
 {
+/// @brief The active notifications are stored as bitmap of 64 bit words. An additional summary word marks the
+/// bitmap words which may contain active notifications, so that collecting the notifications only touches the words
+/// of the fired notifiers and the cost is proportional to the number of fired notifications and not to
+/// MAX_NUMBER_OF_NOTIFIERS.
 struct ConditionVariableData
 {
+    static constexpr uint64_t NOTIFICATIONS_PER_WORD{64U};
+    static constexpr uint64_t NUMBER_OF_NOTIFICATION_WORDS{(MAX_NUMBER_OF_NOTIFIERS + NOTIFICATIONS_PER_WORD - 1U)
+                                                           / NOTIFICATIONS_PER_WORD};
+    static_assert(NUMBER_OF_NOTIFICATION_WORDS <= NOTIFICATIONS_PER_WORD,
+                  "The summary word can only track 64 notification words, i.e. at most 4096 notifiers");
+
     ConditionVariableData() noexcept;
     explicit ConditionVariableData(const RuntimeName_t& runtimeName) noexcept;
 
@@ -38,11 +50,26 @@ struct ConditionVariableData
     ConditionVariableData& operator=(ConditionVariableData&& rhs) = delete;
     ~ConditionVariableData() noexcept = default;
 
+    /// @brief Marks the notification with the provided index as active
+    /// @param[in] index of the notification, must be less than MAX_NUMBER_OF_NOTIFIERS
+    void setNotificationActive(const uint64_t index) noexcept;
+
+    /// @brief Checks if the notification with the provided index is active
+    /// @param[in] index of the notification, must be less than MAX_NUMBER_OF_NOTIFIERS
+    /// @return true if the notification is active, otherwise false
+    bool isNotificationActive(const uint64_t index) const noexcept;
+
     optional<posix::UnnamedSemaphore> m_semaphore;
     RuntimeName_t m_runtimeName;
     std::atomic_bool m_toBeDestroyed{false};
-    std::atomic_bool m_activeNotifications[MAX_NUMBER_OF_NOTIFIERS];
+    std::atomic<uint64_t> m_activeNotificationWords[NUMBER_OF_NOTIFICATION_WORDS];
+    std::atomic<uint64_t> m_activeNotificationWordsSummary{0U};
     std::atomic_bool m_wasNotified{false};
+    /// @brief set by the ConditionListener while it is in wait or timedWait; the semaphore is only posted when a
+    /// listener is waiting, therefore notifications without a waiting listener do not access the semaphore
+    std::atomic_bool m_hasWaitingListener{false};
+    /// @brief wakes up the discovery of RouDi when the condition variable is destroyed
+    DiscoveryNotifier m_discoveryNotifier;
 };
 
 } // namespace popo
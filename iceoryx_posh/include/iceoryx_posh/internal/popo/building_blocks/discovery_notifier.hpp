@@ -0,0 +1,57 @@
+// Copyright (c) 2026 by agent <agent@local>. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_POPO_BUILDING_BLOCKS_DISCOVERY_NOTIFIER_HPP
+#define IOX_POSH_POPO_BUILDING_BLOCKS_DISCOVERY_NOTIFIER_HPP
+
+#include "iox/relative_pointer.hpp"
+
+#include <cstdint>
+#include <limits>
+
+namespace iox
+{
+namespace popo
+{
+class DiscoveryTrigger;
+
+/// @brief The DiscoveryNotifier is part of the data of a port, node or condition variable in the management segment.
+/// Whenever the owner requests a state change which has to be processed by the discovery of RouDi, it marks its entry
+/// as dirty in the DiscoveryTrigger and wakes up the discovery. A default constructed DiscoveryNotifier is not
+/// attached to a DiscoveryTrigger and notify does nothing.
+class DiscoveryNotifier
+{
+  public:
+    static constexpr uint64_t INVALID_ENTRY_INDEX = std::numeric_limits<uint64_t>::max();
+
+    DiscoveryNotifier() noexcept = default;
+
+    /// @brief Attaches the notifier to an entry of a DiscoveryTrigger
+    /// @param[in] discoveryTrigger which is notified
+    /// @param[in] entryIndex of the owner in the DiscoveryTrigger, see DiscoveryTrigger::toEntryIndex
+    DiscoveryNotifier(DiscoveryTrigger& discoveryTrigger, const uint64_t entryIndex) noexcept;
+
+    /// @brief Marks the entry as dirty and wakes up the discovery
+    void notify() noexcept;
+
+  private:
+    RelativePointer<DiscoveryTrigger> m_discoveryTrigger;
+    uint64_t m_entryIndex{INVALID_ENTRY_INDEX};
+};
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_BUILDING_BLOCKS_DISCOVERY_NOTIFIER_HPP
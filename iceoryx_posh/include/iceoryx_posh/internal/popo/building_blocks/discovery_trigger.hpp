@@ -0,0 +1,100 @@
+// Copyright (c) 2026 by agent <agent@local>. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_POPO_BUILDING_BLOCKS_DISCOVERY_TRIGGER_HPP
+#define IOX_POSH_POPO_BUILDING_BLOCKS_DISCOVERY_TRIGGER_HPP
+
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
+#include "iox/duration.hpp"
+#include "iox/function_ref.hpp"
+
+#include <atomic>
+#include <cstdint>
+
+namespace iox
+{
+namespace popo
+{
+/// @brief The kinds of entries of the port pool which are processed by the discovery of RouDi
+enum class DiscoveryEntryKind : uint8_t
+{
+    PUBLISHER_PORT,
+    SUBSCRIBER_PORT,
+    SERVER_PORT,
+    CLIENT_PORT,
+    INTERFACE_PORT,
+    NODE,
+    CONDITION_VARIABLE,
+};
+
+/// @brief The DiscoveryTrigger is located in the management segment and owned by RouDi. Ports, nodes and condition
+/// variables mark their entry as dirty with a DiscoveryNotifier when they request a state change and wake up the
+/// discovery of RouDi with a condition variable. The discovery therefore reacts immediately and only touches the
+/// entries with pending requests instead of iterating over the whole port pool in every cycle.
+/// @note The dirty entries are stored as bitmap of 64 bit words, like the active notifications of the
+/// ConditionVariableData. The summary words mark the bitmap words which may contain dirty entries.
+class DiscoveryTrigger
+{
+  public:
+    static constexpr uint64_t ENTRIES_PER_WORD{64U};
+    static constexpr uint64_t NUMBER_OF_ENTRIES{MAX_PUBLISHERS + MAX_SUBSCRIBERS + MAX_SERVERS + MAX_CLIENTS
+                                                + MAX_INTERFACE_NUMBER + MAX_NODE_NUMBER
+                                                + MAX_NUMBER_OF_CONDITION_VARIABLES};
+    static constexpr uint64_t NUMBER_OF_ENTRY_WORDS{(NUMBER_OF_ENTRIES + ENTRIES_PER_WORD - 1U) / ENTRIES_PER_WORD};
+    static constexpr uint64_t NUMBER_OF_SUMMARY_WORDS{(NUMBER_OF_ENTRY_WORDS + ENTRIES_PER_WORD - 1U)
+                                                      / ENTRIES_PER_WORD};
+
+    DiscoveryTrigger() noexcept;
+
+    DiscoveryTrigger(const DiscoveryTrigger&) = delete;
+    DiscoveryTrigger(DiscoveryTrigger&&) = delete;
+    DiscoveryTrigger& operator=(const DiscoveryTrigger&) = delete;
+    DiscoveryTrigger& operator=(DiscoveryTrigger&&) = delete;
+    ~DiscoveryTrigger() noexcept = default;
+
+    /// @brief Calculates the index of an entry of the port pool in the DiscoveryTrigger
+    /// @param[in] kind of the entry
+    /// @param[in] position of the entry in the port pool container of its kind
+    /// @return the entry index which is used by the DiscoveryNotifier
+    static uint64_t toEntryIndex(const DiscoveryEntryKind kind, const uint64_t position) noexcept;
+
+    /// @brief Marks the entry as dirty and wakes up the discovery
+    /// @param[in] entryIndex of the dirty entry, must be less than NUMBER_OF_ENTRIES
+    void notify(const uint64_t entryIndex) noexcept;
+
+    /// @brief Wakes up the discovery without marking an entry as dirty, e.g. to stop it
+    void wakeUp() noexcept;
+
+    /// @brief Blocks until the discovery is woken up or the timeout has passed. Returns immediately if it was woken
+    /// up since the last call.
+    /// @param[in] timeout the maximum duration to wait
+    void timedWait(const units::Duration& timeout) noexcept;
+
+    /// @brief Calls the callback for every entry which was marked as dirty since the last call and resets the marks.
+    /// The entries are visited in ascending order of their kind and position.
+    /// @param[in] callback which is called with the kind and the position of every dirty entry
+    void collectDirtyEntries(const function_ref<void(const DiscoveryEntryKind, const uint64_t)> callback) noexcept;
+
+  private:
+    ConditionVariableData m_conditionVariableData;
+    std::atomic<uint64_t> m_dirtyEntryWords[NUMBER_OF_ENTRY_WORDS];
+    std::atomic<uint64_t> m_dirtyEntryWordsSummary[NUMBER_OF_SUMMARY_WORDS];
+};
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_BUILDING_BLOCKS_DISCOVERY_TRIGGER_HPP
@@ -0,0 +1,73 @@
+// Copyright (c) 2026 by agent <agent@local>. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_BUILDING_BLOCKS_LATENCY_HISTOGRAM_HPP
+#define IOX_POSH_POPO_BUILDING_BLOCKS_LATENCY_HISTOGRAM_HPP
+
+#include <atomic>
+#include <cstdint>
+
+namespace iox
+{
+namespace popo
+{
+/// @brief A histogram with a fixed number of logarithmic buckets for latencies in nanoseconds. Each power of two is
+/// split into SUB_BUCKETS_PER_OCTAVE buckets, i.e. the relative error of a reported value is below 25%. The histogram
+/// lives in shared memory, is written by a single thread and can be read concurrently by e.g. the port introspection.
+class LatencyHistogram
+{
+  public:
+    static constexpr uint64_t SUB_BUCKETS_PER_OCTAVE{4U};
+    static constexpr uint64_t NUMBER_OF_OCTAVES{40U};
+    static constexpr uint64_t NUMBER_OF_BUCKETS{SUB_BUCKETS_PER_OCTAVE * NUMBER_OF_OCTAVES};
+
+    LatencyHistogram() noexcept = default;
+
+    LatencyHistogram(const LatencyHistogram&) = delete;
+    LatencyHistogram(LatencyHistogram&&) = delete;
+    LatencyHistogram& operator=(const LatencyHistogram&) = delete;
+    LatencyHistogram& operator=(LatencyHistogram&&) = delete;
+    ~LatencyHistogram() noexcept = default;
+
+    /// @brief Adds a sample to the histogram; must only be called by the single writer
+    /// @param[in] latencyInNanoseconds of the sample; larger values than the range of the last bucket are counted there
+    void record(const uint64_t latencyInNanoseconds) noexcept;
+
+    /// @brief Returns the number of recorded samples
+    uint64_t count() const noexcept;
+
+    /// @brief Estimates the value below which the given percentage of the samples lie
+    /// @param[in] percentile in the range [0, 100]
+    /// @return the upper bound of the bucket which contains the percentile or 0 if no sample was recorded
+    uint64_t valueAtPercentile(const double percentile) const noexcept;
+
+    /// @brief Returns the index of the bucket in which a value is counted
+    static uint64_t bucketIndex(const uint64_t value) noexcept;
+
+    /// @brief Returns the largest value which is counted in the bucket with the given index
+    static uint64_t bucketUpperBound(const uint64_t index) noexcept;
+
+  private:
+    // NOLINTJUSTIFICATION the histogram must be usable in shared memory with a fixed layout
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays)
+    std::atomic<uint64_t> m_buckets[NUMBER_OF_BUCKETS]{};
+    std::atomic<uint64_t> m_count{0U};
+};
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_BUILDING_BLOCKS_LATENCY_HISTOGRAM_HPP
@@ -102,9 +102,48 @@ inline ListenerImpl<Capacity>::ListenerImpl() noexcept
 
 template <uint64_t Capacity>
 inline ListenerImpl<Capacity>::ListenerImpl(ConditionVariableData& conditionVariable) noexcept
+    : ListenerImpl(conditionVariable, 0U)
+{
+}
+
+template <uint64_t Capacity>
+inline ListenerImpl<Capacity>::ListenerImpl(ConditionVariableData& conditionVariable,
+                                            const uint64_t numberOfWorkerThreads) noexcept
     : m_conditionVariableData(&conditionVariable)
     , m_conditionListener(conditionVariable)
 {
+    for (auto& pendingExecutions : m_pendingExecutions)
+    {
+        pendingExecutions.store(0U, std::memory_order_relaxed);
+    }
+
+    uint64_t workerThreadsToStart = numberOfWorkerThreads;
+    if (workerThreadsToStart > MAX_NUMBER_OF_WORKER_THREADS_PER_LISTENER)
+    {
+        IOX_LOG(WARN) << "The Listener supports at most " << MAX_NUMBER_OF_WORKER_THREADS_PER_LISTENER
+                      << " worker threads but " << numberOfWorkerThreads << " were requested. Limiting to "
+                      << MAX_NUMBER_OF_WORKER_THREADS_PER_LISTENER << " worker threads.";
+        workerThreadsToStart = MAX_NUMBER_OF_WORKER_THREADS_PER_LISTENER;
+    }
+
+    if (workerThreadsToStart > 0U)
+    {
+        posix::UnnamedSemaphoreBuilder()
+            .initialValue(0U)
+            .isInterProcessCapable(false)
+            .create(m_workerSemaphore)
+            .or_else([&](auto) {
+                errorHandler(PoshError::POPO__LISTENER_FAILED_TO_CREATE_WORKER_SEMAPHORE, ErrorLevel::FATAL);
+                workerThreadsToStart = 0U;
+            });
+    }
+
+    for (uint64_t i = 0U; i < workerThreadsToStart; ++i)
+    {
+        m_workerThreads.emplace_back(&ListenerImpl<Capacity>::workerLoop, this);
+        posix::setThreadName(m_workerThreads.back().native_handle(), "ListenerWorker");
+    }
+
     m_thread = std::thread(&ListenerImpl<Capacity>::threadLoop, this);
 }
 
@@ -115,7 +154,20 @@ inline ListenerImpl<Capacity>::~ListenerImpl() noexcept
     m_conditionListener.destroy();
 
     m_thread.join();
+
+    // every worker stops after its next wake up, therefore one post per worker stops all of them
+    for (uint64_t i = 0U; i < m_workerThreads.size(); ++i)
+    {
+        m_workerSemaphore->post().or_else(
+            [](auto) { errorHandler(PoshError::POPO__LISTENER_WORKER_SEMAPHORE_CORRUPTED, ErrorLevel::FATAL); });
+    }
+    for (auto& worker : m_workerThreads)
+    {
+        worker.join();
+    }
+
     m_conditionVariableData->m_toBeDestroyed.store(true, std::memory_order_relaxed);
+    m_conditionVariableData->m_discoveryNotifier.notify();
 }
 
 template <uint64_t Capacity>
@@ -155,6 +207,12 @@ inline uint64_t ListenerImpl<Capacity>::size() const noexcept
     return m_indexManager.indicesInUse();
 }
 
+template <uint64_t Capacity>
+inline uint64_t ListenerImpl<Capacity>::numberOfWorkerThreads() const noexcept
+{
+    return m_workerThreads.size();
+}
+
 template <uint64_t Capacity>
 inline void ListenerImpl<Capacity>::threadLoop() noexcept
 {
@@ -164,11 +222,67 @@ inline void ListenerImpl<Capacity>::threadLoop() noexcept
 
         for (auto& id : activateNotificationIds)
         {
-            m_events[id]->executeCallback();
+            if (m_workerThreads.empty())
+            {
+                m_events[id]->executeCallback();
+            }
+            else
+            {
+                scheduleExecution(id);
+            }
         }
     }
 }
 
+template <uint64_t Capacity>
+inline void ListenerImpl<Capacity>::workerLoop() noexcept
+{
+    while (true)
+    {
+        if (m_workerSemaphore->wait().has_error())
+        {
+            errorHandler(PoshError::POPO__LISTENER_WORKER_SEMAPHORE_CORRUPTED, ErrorLevel::FATAL);
+            return;
+        }
+
+        if (m_wasDtorCalled.load(std::memory_order_relaxed))
+        {
+            return;
+        }
+
+        m_scheduledEvents.pop().and_then([this](auto& eventId) { this->executeScheduledEvent(eventId); });
+    }
+}
+
+template <uint64_t Capacity>
+inline void ListenerImpl<Capacity>::scheduleExecution(const uint64_t eventId) noexcept
+{
+    // if the event is already scheduled or executed, the worker which owns it handles this notification as well
+    if (m_pendingExecutions[eventId].fetch_add(1U, std::memory_order_acq_rel) != 0U)
+    {
+        return;
+    }
+
+    // an event is contained at most once in the queue, therefore the queue cannot overflow
+    cxx::Expects(m_scheduledEvents.tryPush(static_cast<uint32_t>(eventId)));
+    m_workerSemaphore->post().or_else(
+        [](auto) { errorHandler(PoshError::POPO__LISTENER_WORKER_SEMAPHORE_CORRUPTED, ErrorLevel::FATAL); });
+}
+
+template <uint64_t Capacity>
+inline void ListenerImpl<Capacity>::executeScheduledEvent(const uint64_t eventId) noexcept
+{
+    // all notifications which arrived before the callback is started are handled by this callback call, the
+    // notifications which arrive while the callback is running lead to exactly one more call
+    uint64_t handledExecutions = m_pendingExecutions[eventId].load(std::memory_order_acquire);
+    while (handledExecutions != 0U)
+    {
+        m_events[eventId]->executeCallback();
+        handledExecutions =
+            m_pendingExecutions[eventId].fetch_sub(handledExecutions, std::memory_order_acq_rel) - handledExecutions;
+    }
+}
+
 template <uint64_t Capacity>
 inline void ListenerImpl<Capacity>::removeTrigger(const uint64_t index) noexcept
 {
@@ -20,6 +20,7 @@
 #include "iceoryx_posh/capro/service_description.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/capro/capro_message.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/discovery_notifier.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/unique_port_id.hpp"
 #include "iox/relative_pointer.hpp"
 
@@ -54,6 +55,8 @@ struct BasePortData
     NodeName_t m_nodeName;
     UniquePortId m_uniqueId;
     std::atomic_bool m_toBeDestroyed{false};
+    /// @brief wakes up the discovery of RouDi when the port requests a state change
+    DiscoveryNotifier m_discoveryNotifier;
 };
 
 } // namespace popo
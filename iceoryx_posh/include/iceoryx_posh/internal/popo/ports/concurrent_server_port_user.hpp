@@ -0,0 +1,69 @@
+// Copyright (c) 2026 by agent <agent@local>. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_POPO_PORTS_CONCURRENT_SERVER_PORT_USER_HPP
+#define IOX_POSH_POPO_PORTS_CONCURRENT_SERVER_PORT_USER_HPP
+
+#include "iceoryx_posh/internal/popo/ports/server_port_user.hpp"
+
+#include <mutex>
+
+namespace iox
+{
+namespace popo
+{
+/// @brief The ConcurrentServerPortUser is a ServerPortUser which can be used by multiple threads concurrently, e.g.
+/// by the worker threads of a ServerWorkerPool. The requests are popped from the request queue without a lock, only
+/// the bookkeeping of the requests and responses held by the user is serialized.
+/// @note The request queue of a server port is always one of the MultiProducerSingleConsumer queue types which
+/// support multiple consumers
+class ConcurrentServerPortUser : public ServerPortUser
+{
+  public:
+    explicit ConcurrentServerPortUser(MemberType_t& serverPortData) noexcept;
+
+    ConcurrentServerPortUser(const ConcurrentServerPortUser& other) = delete;
+    ConcurrentServerPortUser& operator=(const ConcurrentServerPortUser&) = delete;
+    ConcurrentServerPortUser(ConcurrentServerPortUser&& rhs) = delete;
+    ConcurrentServerPortUser& operator=(ConcurrentServerPortUser&& rhs) = delete;
+    ~ConcurrentServerPortUser() = default;
+
+    /// @copydoc ServerPortUser::getRequest
+    expected<const RequestHeader*, ServerRequestResult> getRequest() noexcept;
+
+    /// @copydoc ServerPortUser::releaseRequest
+    void releaseRequest(const RequestHeader* const requestHeader) noexcept;
+
+    /// @copydoc ServerPortUser::allocateResponse
+    expected<ResponseHeader*, AllocationError> allocateResponse(const RequestHeader* const requestHeader,
+                                                                const uint32_t userPayloadSize,
+                                                                const uint32_t userPayloadAlignment) noexcept;
+
+    /// @copydoc ServerPortUser::releaseResponse
+    void releaseResponse(const ResponseHeader* const responseHeader) noexcept;
+
+    /// @copydoc ServerPortUser::sendResponse
+    expected<ServerSendError> sendResponse(ResponseHeader* const responseHeader) noexcept;
+
+  private:
+    /// @brief serializes the access to the chunks held by the user; it is only used by the threads of the process
+    /// which owns the port user and recursive since sendResponse releases the response on failure
+    std::recursive_mutex m_chunksInUseLock;
+};
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_PORTS_CONCURRENT_SERVER_PORT_USER_HPP
@@ -69,6 +69,12 @@ class PublisherPortUser : public BasePort
     /// @param[in] chunkHeader, pointer to the ChunkHeader to send
     void sendChunk(mepoo::ChunkHeader* const chunkHeader) noexcept;
 
+    /// @brief Send allocated chunks in the given order to all connected subscriber ports; every subscriber port is
+    /// notified only once for all chunks
+    /// @param[in] chunkHeaders, pointer to the first of the ChunkHeaders to send
+    /// @param[in] numberOfChunks, the number of ChunkHeaders to send
+    void sendChunks(mepoo::ChunkHeader* const* const chunkHeaders, const uint64_t numberOfChunks) noexcept;
+
     /// @brief Returns the last sent chunk if there is one
     /// @return pointer to the ChunkHeader of the last sent Chunk if there is one, empty optional if not
     optional<const mepoo::ChunkHeader*> tryGetPreviousChunk() const noexcept;
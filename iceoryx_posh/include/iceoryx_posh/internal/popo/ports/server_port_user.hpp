@@ -172,7 +172,13 @@ class ServerPortUser : public BasePort
     /// @return true if a condition variable attached, otherwise false
     bool isConditionVariableSet() const noexcept;
 
-  private:
+  protected:
+    /// @brief Converts the result of the ChunkReceiver to the result of getRequest
+    /// @param[in] getChunkResult the result of the ChunkReceiver
+    /// @return the RequestHeader of the received chunk, ServerRequestResult on error
+    expected<const RequestHeader*, ServerRequestResult>
+    toRequestResult(const expected<const mepoo::ChunkHeader*, ChunkReceiveResult>& getChunkResult) const noexcept;
+
     const MemberType_t* getMembers() const noexcept;
     MemberType_t* getMembers() noexcept;
 
@@ -38,7 +38,8 @@ struct SubscriberPortData : public BasePortData
                        const RuntimeName_t& runtimeName,
                        cxx::VariantQueueTypes queueType,
                        const SubscriberOptions& subscriberOptions,
-                       const mepoo::MemoryInfo& memoryInfo = mepoo::MemoryInfo()) noexcept;
+                       const mepoo::MemoryInfo& memoryInfo = mepoo::MemoryInfo(),
+                       LatencyHistogram* const latencyHistogram = nullptr) noexcept;
 
     /// @todo iox-#1051 remove these aliases here and only depend on pub_sub_port_types.hpp
     ///       (move relevant types and constants there)
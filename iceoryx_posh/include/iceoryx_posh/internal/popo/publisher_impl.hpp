@@ -61,6 +61,14 @@ class PublisherImpl : public BasePublisherType, private PublisherInterface<T, H>
     ///
     void publish(Sample<T, H>&& sample) noexcept override;
 
+    ///
+    /// @brief publishBatch Publishes the given samples in the given order and then releases their loans. Every
+    /// subscriber is notified only once for all samples.
+    /// @param samples Pointer to the first of the samples to publish; the samples are empty afterwards.
+    /// @param numberOfSamples The number of samples to publish.
+    ///
+    void publishBatch(Sample<T, H>* const samples, const uint64_t numberOfSamples) noexcept;
+
     ///
     /// @brief publishCopyOf Copy the provided value into a loaned shared memory chunk and publish it.
     /// @param val Value to copy.
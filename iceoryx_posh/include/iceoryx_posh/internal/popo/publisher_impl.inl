@@ -92,6 +92,24 @@ inline void PublisherImpl<T, H, BasePublisherType>::publish(Sample<T, H>&& sampl
     port().sendChunk(chunkHeader);
 }
 
+template <typename T, typename H, typename BasePublisherType>
+inline void PublisherImpl<T, H, BasePublisherType>::publishBatch(Sample<T, H>* const samples,
+                                                                 const uint64_t numberOfSamples) noexcept
+{
+    // there cannot be more loaned samples than chunks a publisher can hold; larger batches are sent in parts
+    vector<mepoo::ChunkHeader*, MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY> chunkHeaders;
+    for (uint64_t i = 0U; i < numberOfSamples; ++i)
+    {
+        auto userPayload = samples[i].release(); // release the Samples ownership of the chunk before publishing
+        chunkHeaders.emplace_back(mepoo::ChunkHeader::fromUserPayload(userPayload));
+        if (chunkHeaders.size() == chunkHeaders.capacity() || i + 1U == numberOfSamples)
+        {
+            port().sendChunks(chunkHeaders.begin(), chunkHeaders.size());
+            chunkHeaders.clear();
+        }
+    }
+}
+
 template <typename T, typename H, typename BasePublisherType>
 inline Sample<T, H>
 PublisherImpl<T, H, BasePublisherType>::convertChunkHeaderToSample(mepoo::ChunkHeader* const header) noexcept
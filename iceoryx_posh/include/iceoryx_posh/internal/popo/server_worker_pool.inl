@@ -0,0 +1,255 @@
+// Copyright (c) 2026 by agent <agent@local>. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_POPO_SERVER_WORKER_POOL_INL
+#define IOX_POSH_POPO_SERVER_WORKER_POOL_INL
+
+#include "iceoryx_posh/popo/server_worker_pool.hpp"
+#include "iox/logging.hpp"
+
+namespace iox
+{
+namespace popo
+{
+template <typename Req, typename Res>
+inline ServerWorkerPool<Req, Res>::ServerWorkerPool(const capro::ServiceDescription& service,
+                                                    const RequestHandler_t& requestHandler,
+                                                    const ServerWorkerPoolOptions& options) noexcept
+    : m_requestHandler(requestHandler)
+    , m_server(service, options.serverOptions)
+{
+    // every worker needs at least one of the requests which can be processed simultaneously, otherwise a request
+    // which is taken from the queue would be dropped
+    uint64_t workerThreadsToStart = options.numberOfWorkerThreads;
+    if (workerThreadsToStart == 0U || workerThreadsToStart > MAX_REQUESTS_PROCESSED_SIMULTANEOUSLY)
+    {
+        workerThreadsToStart = (workerThreadsToStart == 0U) ? 1U : MAX_REQUESTS_PROCESSED_SIMULTANEOUSLY;
+        IOX_LOG(WARN) << "The ServerWorkerPool supports 1 to " << MAX_REQUESTS_PROCESSED_SIMULTANEOUSLY
+                      << " worker threads but " << options.numberOfWorkerThreads << " were requested. Using "
+                      << workerThreadsToStart << " worker threads.";
+    }
+
+    const uint64_t maxInFlightRequestsPerWorker = MAX_REQUESTS_PROCESSED_SIMULTANEOUSLY / workerThreadsToStart;
+    m_inFlightRequestsPerWorker = options.inFlightRequestsPerWorker;
+    if (m_inFlightRequestsPerWorker == 0U || m_inFlightRequestsPerWorker > maxInFlightRequestsPerWorker)
+    {
+        m_inFlightRequestsPerWorker = (m_inFlightRequestsPerWorker == 0U) ? 1U : maxInFlightRequestsPerWorker;
+        IOX_LOG(WARN) << "The ServerWorkerPool with " << workerThreadsToStart << " worker threads supports 1 to "
+                      << maxInFlightRequestsPerWorker << " in-flight requests per worker but "
+                      << options.inFlightRequestsPerWorker << " were requested. Using " << m_inFlightRequestsPerWorker
+                      << " in-flight requests per worker.";
+    }
+
+    posix::UnnamedSemaphoreBuilder()
+        .initialValue(0U)
+        .isInterProcessCapable(false)
+        .create(m_workerSemaphore)
+        .or_else([&](auto) {
+            errorHandler(PoshError::POPO__SERVER_WORKER_POOL_FAILED_TO_CREATE_WORKER_SEMAPHORE, ErrorLevel::FATAL);
+            workerThreadsToStart = 0U;
+        });
+
+    for (uint64_t i = 0U; i < workerThreadsToStart; ++i)
+    {
+        m_workerThreads.emplace_back(&ServerWorkerPool<Req, Res>::workerLoop, this);
+        posix::setThreadName(m_workerThreads.back().native_handle(), "ServerWorker");
+    }
+
+    if (m_workerThreads.empty())
+    {
+        return;
+    }
+
+    m_listener
+        .attachEvent(m_server,
+                     ServerEvent::REQUEST_RECEIVED,
+                     createNotificationCallback(ServerWorkerPool<Req, Res>::onRequestReceived, *this))
+        .or_else([](auto& error) {
+            IOX_LOG(ERROR) << "Unable to attach the server of the ServerWorkerPool to its listener! Error: "
+                           << static_cast<uint64_t>(error);
+        });
+
+    // requests which arrived before the server was attached to the listener did not wake up a worker
+    wakeUpIdleWorker();
+}
+
+template <typename Req, typename Res>
+inline ServerWorkerPool<Req, Res>::~ServerWorkerPool() noexcept
+{
+    m_listener.detachEvent(m_server, ServerEvent::REQUEST_RECEIVED);
+    m_keepRunning.store(false, std::memory_order_relaxed);
+
+    // every worker stops after its next wake up, therefore one post per worker stops all of them
+    for (uint64_t i = 0U; i < m_workerThreads.size(); ++i)
+    {
+        m_workerSemaphore->post().or_else([](auto) {
+            errorHandler(PoshError::POPO__SERVER_WORKER_POOL_WORKER_SEMAPHORE_CORRUPTED, ErrorLevel::FATAL);
+        });
+    }
+    for (auto& worker : m_workerThreads)
+    {
+        worker.join();
+    }
+}
+
+template <typename Req, typename Res>
+inline void ServerWorkerPool<Req, Res>::offer() noexcept
+{
+    m_server.offer();
+}
+
+template <typename Req, typename Res>
+inline void ServerWorkerPool<Req, Res>::stopOffer() noexcept
+{
+    m_server.stopOffer();
+}
+
+template <typename Req, typename Res>
+inline bool ServerWorkerPool<Req, Res>::isOffered() const noexcept
+{
+    return m_server.isOffered();
+}
+
+template <typename Req, typename Res>
+inline bool ServerWorkerPool<Req, Res>::hasClients() const noexcept
+{
+    return m_server.hasClients();
+}
+
+template <typename Req, typename Res>
+inline uint64_t ServerWorkerPool<Req, Res>::numberOfWorkerThreads() const noexcept
+{
+    return m_workerThreads.size();
+}
+
+template <typename Req, typename Res>
+inline uint64_t ServerWorkerPool<Req, Res>::inFlightRequestsPerWorker() const noexcept
+{
+    return m_inFlightRequestsPerWorker;
+}
+
+template <typename Req, typename Res>
+inline void ServerWorkerPool<Req, Res>::onRequestReceived(Server_t* const, ServerWorkerPool* const self)
+{
+    self->wakeUpIdleWorker();
+}
+
+template <typename Req, typename Res>
+inline void ServerWorkerPool<Req, Res>::workerLoop() noexcept
+{
+    while (m_keepRunning.load(std::memory_order_relaxed))
+    {
+        while (m_keepRunning.load(std::memory_order_relaxed) && processRequests())
+        {
+        }
+        waitForWakeUp();
+    }
+}
+
+template <typename Req, typename Res>
+inline bool ServerWorkerPool<Req, Res>::processRequests() noexcept
+{
+    vector<Request<const Req>, MAX_REQUESTS_PROCESSED_SIMULTANEOUSLY> requests;
+    while (requests.size() < m_inFlightRequestsPerWorker)
+    {
+        auto takeResult = m_server.take();
+        if (takeResult.has_error())
+        {
+            break;
+        }
+        requests.emplace_back(std::move(takeResult.value()));
+    }
+
+    if (requests.empty())
+    {
+        return false;
+    }
+
+    // the remaining requests are processed concurrently by the next idle worker
+    if (m_server.hasRequests())
+    {
+        wakeUpIdleWorker();
+    }
+
+    for (auto& request : requests)
+    {
+        m_server.loan(request)
+            .and_then([&](auto& response) {
+                m_requestHandler(*request, *response);
+                m_server.send(std::move(response)).or_else([](auto& error) {
+                    IOX_LOG(WARN) << "ServerWorkerPool could not send a response! Error: " << error;
+                });
+            })
+            .or_else([](auto& error) {
+                IOX_LOG(ERROR) << "ServerWorkerPool could not allocate a response! Error: " << error;
+            });
+    }
+
+    return true;
+}
+
+template <typename Req, typename Res>
+inline void ServerWorkerPool<Req, Res>::wakeUpIdleWorker() noexcept
+{
+    if (tryClaimIdleWorker())
+    {
+        m_workerSemaphore->post().or_else([](auto) {
+            errorHandler(PoshError::POPO__SERVER_WORKER_POOL_WORKER_SEMAPHORE_CORRUPTED, ErrorLevel::FATAL);
+        });
+    }
+}
+
+template <typename Req, typename Res>
+inline bool ServerWorkerPool<Req, Res>::tryClaimIdleWorker() noexcept
+{
+    // pairs with the announcement of an idle worker in waitForWakeUp
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    uint64_t numberOfIdleWorkers = m_numberOfIdleWorkers.load(std::memory_order_relaxed);
+    while (numberOfIdleWorkers > 0U)
+    {
+        if (m_numberOfIdleWorkers.compare_exchange_weak(
+                numberOfIdleWorkers, numberOfIdleWorkers - 1U, std::memory_order_relaxed, std::memory_order_relaxed))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+template <typename Req, typename Res>
+inline void ServerWorkerPool<Req, Res>::waitForWakeUp() noexcept
+{
+    // the worker has to announce itself before the queue is checked; either the waker sees the idle worker or the
+    // worker sees the request which arrived after the queue was drained
+    m_numberOfIdleWorkers.fetch_add(1U, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    // if the worker claims itself, no other worker was woken up for the request and it continues without waiting;
+    // otherwise a waker already claimed it and posted the semaphore
+    if (m_server.hasRequests() && tryClaimIdleWorker())
+    {
+        return;
+    }
+
+    if (m_workerSemaphore->wait().has_error())
+    {
+        errorHandler(PoshError::POPO__SERVER_WORKER_POOL_WORKER_SEMAPHORE_CORRUPTED, ErrorLevel::FATAL);
+    }
+}
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_SERVER_WORKER_POOL_INL
@@ -60,6 +60,14 @@ class UntypedPublisherImpl : public BasePublisherType
     ///
     void publish(void* const userPayload) noexcept;
 
+    ///
+    /// @brief Publish the provided memory chunks in the given order. Every subscriber is notified only once for all
+    /// chunks.
+    /// @param userPayloads Pointer to the first of the user-payload pointers of the allocated shared memory chunks.
+    /// @param numberOfUserPayloads The number of chunks to publish.
+    ///
+    void publishBatch(void* const* const userPayloads, const uint64_t numberOfUserPayloads) noexcept;
+
     ///
     /// @brief Releases the ownership of the chunk provided by the user-payload pointer.
     /// @param userPayload pointer to the user-payload of the chunk to be released
@@ -38,6 +38,23 @@ inline void UntypedPublisherImpl<BasePublisherType>::publish(void* const userPay
     port().sendChunk(chunkHeader);
 }
 
+template <typename BasePublisherType>
+inline void UntypedPublisherImpl<BasePublisherType>::publishBatch(void* const* const userPayloads,
+                                                                  const uint64_t numberOfUserPayloads) noexcept
+{
+    // there cannot be more loaned chunks than a publisher can hold; larger batches are sent in parts
+    vector<mepoo::ChunkHeader*, MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY> chunkHeaders;
+    for (uint64_t i = 0U; i < numberOfUserPayloads; ++i)
+    {
+        chunkHeaders.emplace_back(mepoo::ChunkHeader::fromUserPayload(userPayloads[i]));
+        if (chunkHeaders.size() == chunkHeaders.capacity() || i + 1U == numberOfUserPayloads)
+        {
+            port().sendChunks(chunkHeaders.begin(), chunkHeaders.size());
+            chunkHeaders.clear();
+        }
+    }
+}
+
 template <typename BasePublisherType>
 inline expected<void*, AllocationError>
 UntypedPublisherImpl<BasePublisherType>::loan(const uint32_t userPayloadSize,
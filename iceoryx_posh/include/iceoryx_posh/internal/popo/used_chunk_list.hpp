@@ -28,6 +28,22 @@ namespace iox
 {
 namespace popo
 {
+namespace internal
+{
+/// @brief Calculates the largest power of two which is less or equal to the provided value
+/// @param[in] value must be larger than 0
+/// @return the largest power of two not exceeding value
+constexpr uint32_t largestPowerOfTwoNotExceeding(const uint32_t value) noexcept
+{
+    uint32_t powerOfTwo{1U};
+    while (powerOfTwo <= value / 2U)
+    {
+        powerOfTwo *= 2U;
+    }
+    return powerOfTwo;
+}
+} // namespace internal
+
 /// @brief This class is used to keep track of the chunks currently in use by the application.
 ///        In case the application terminates while holding chunks, this list is used by RouDi to retain ownership of
 ///        the chunks and prevent a chunk leak.
@@ -38,6 +54,9 @@ namespace popo
 ///        accessed. Additionally, the type stored is this array must be less or equal to 64 bit in order to write it
 ///        within one clock cycle to prevent torn writes, which would corrupt the list and could potentially crash
 ///        RouDi.
+///        The used entries are chained into buckets selected by a hash of the chunk header address. This makes the
+///        removal of a chunk independent of the number of held chunks while RouDi still only needs the array for the
+///        cleanup.
 template <uint32_t Capacity>
 class UsedChunkList
 {
@@ -54,7 +73,7 @@ class UsedChunkList
     bool insert(mepoo::SharedChunk chunk) noexcept;
 
     /// @brief Removes a chunk from the list
-    /// @param[in] chunkHeader to look for a corresponding SharedChunk
+    /// @param[in] chunkHeader to look for a corresponding SharedChunk; only the bucket of the chunkHeader is searched
     /// @param[out] chunk which is removed
     /// @return true if successfully removed, otherwise false if e.g. the chunkHeader was not found in the list
     /// @note only from runtime context
@@ -68,15 +87,19 @@ class UsedChunkList
   private:
     void init() noexcept;
 
+    static uint32_t bucketIndex(const mepoo::ChunkHeader* chunkHeader) noexcept;
+
   private:
     static constexpr uint32_t INVALID_INDEX{Capacity};
+    /// @brief with as many buckets as entries the bucket chains contain only one or two entries on average
+    static constexpr uint32_t NUMBER_OF_BUCKETS{internal::largestPowerOfTwoNotExceeding(Capacity)};
 
     using DataElement_t = mepoo::ShmSafeUnmanagedChunk;
     static constexpr DataElement_t DATA_ELEMENT_LOGICAL_NULLPTR{};
 
   private:
     std::atomic_flag m_synchronizer = ATOMIC_FLAG_INIT;
-    uint32_t m_usedListHead{INVALID_INDEX};
+    uint32_t m_usedListHeads[NUMBER_OF_BUCKETS];
     uint32_t m_freeListHead{0u};
     uint32_t m_listIndices[Capacity];
     DataElement_t m_listData[Capacity];
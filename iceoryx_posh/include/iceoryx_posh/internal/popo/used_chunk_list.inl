@@ -25,6 +25,9 @@ namespace popo
 template <uint32_t Capacity>
 constexpr typename UsedChunkList<Capacity>::DataElement_t UsedChunkList<Capacity>::DATA_ELEMENT_LOGICAL_NULLPTR;
 
+template <uint32_t Capacity>
+constexpr uint32_t UsedChunkList<Capacity>::NUMBER_OF_BUCKETS;
+
 template <uint32_t Capacity>
 UsedChunkList<Capacity>::UsedChunkList() noexcept
 {
@@ -44,11 +47,12 @@ bool UsedChunkList<Capacity>::insert(mepoo::SharedChunk chunk) noexcept
         // get next free entry after freelistHead
         auto nextFree = m_listIndices[m_freeListHead];
 
-        // freeListHead is getting new usedListHead, next of this entry is updated to next in usedList
-        m_listIndices[m_freeListHead] = m_usedListHead;
-        m_usedListHead = m_freeListHead;
+        // freeListHead is getting the new head of the bucket, next of this entry is updated to next in the bucket
+        auto& bucketHead = m_usedListHeads[bucketIndex(chunk.getChunkHeader())];
+        m_listIndices[m_freeListHead] = bucketHead;
+        bucketHead = m_freeListHead;
 
-        m_listData[m_usedListHead] = DataElement_t(chunk);
+        m_listData[bucketHead] = DataElement_t(chunk);
 
         // set freeListHead to the next free entry
         m_freeListHead = nextFree;
@@ -67,9 +71,10 @@ template <uint32_t Capacity>
 bool UsedChunkList<Capacity>::remove(const mepoo::ChunkHeader* chunkHeader, mepoo::SharedChunk& chunk) noexcept
 {
     auto previous = INVALID_INDEX;
+    auto& bucketHead = m_usedListHeads[bucketIndex(chunkHeader)];
 
-    // go through usedList with stored chunks
-    for (auto current = m_usedListHead; current != INVALID_INDEX; current = m_listIndices[current])
+    // go through the bucket of the chunkHeader with stored chunks
+    for (auto current = bucketHead; current != INVALID_INDEX; current = m_listIndices[current])
     {
         if (!m_listData[current].isLogicalNullptr())
         {
@@ -78,10 +83,10 @@ bool UsedChunkList<Capacity>::remove(const mepoo::ChunkHeader* chunkHeader, mepo
             {
                 chunk = m_listData[current].releaseToSharedChunk();
 
-                // remove index from used list
-                if (current == m_usedListHead)
+                // remove index from the bucket
+                if (current == bucketHead)
                 {
-                    m_usedListHead = m_listIndices[current];
+                    bucketHead = m_listIndices[current];
                 }
                 else
                 {
@@ -119,6 +124,18 @@ void UsedChunkList<Capacity>::cleanup() noexcept
     init(); // just to save us from the future self
 }
 
+template <uint32_t Capacity>
+uint32_t UsedChunkList<Capacity>::bucketIndex(const mepoo::ChunkHeader* chunkHeader) noexcept
+{
+    // Fibonacci hashing; the upper half of the product depends on all relevant bits of the address
+    constexpr uint64_t FIBONACCI_HASH_MULTIPLIER{11400714819323198485ULL};
+    constexpr uint64_t UPPER_HALF_SHIFT{32U};
+    // NOLINTJUSTIFICATION the address is only used to calculate a hash
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    const uint64_t address{reinterpret_cast<uintptr_t>(chunkHeader)};
+    return static_cast<uint32_t>((address * FIBONACCI_HASH_MULTIPLIER) >> UPPER_HALF_SHIFT) & (NUMBER_OF_BUCKETS - 1U);
+}
+
 template <uint32_t Capacity>
 void UsedChunkList<Capacity>::init() noexcept
 {
@@ -138,7 +155,10 @@ void UsedChunkList<Capacity>::init() noexcept
     }
 
 
-    m_usedListHead = INVALID_INDEX;
+    for (auto& usedListHead : m_usedListHeads)
+    {
+        usedListHead = INVALID_INDEX;
+    }
     m_freeListHead = 0U;
 
     // clear data
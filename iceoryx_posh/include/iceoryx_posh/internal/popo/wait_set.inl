@@ -93,6 +93,7 @@ inline WaitSet<Capacity>::~WaitSet() noexcept
 {
     removeAllTriggers();
     m_conditionVariableDataPtr->m_toBeDestroyed.store(true, std::memory_order_relaxed);
+    m_conditionVariableDataPtr->m_discoveryNotifier.notify();
 }
 
 template <uint64_t Capacity>
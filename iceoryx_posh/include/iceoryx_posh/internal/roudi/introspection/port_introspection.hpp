@@ -78,10 +78,12 @@ class PortIntrospection
             capro::ServiceDescription service;
             NodeName_t node;
 
+            /// counters of the previous throughput sample to compute the rates
             using TimePointNs_t = mepoo::TimePointNs_t;
             using DurationNs_t = mepoo::DurationNs_t;
-            TimePointNs_t m_sequenceNumberTimestamp{DurationNs_t(0)};
-            mepoo::SequenceNumber_t m_sequenceNumber{0U};
+            TimePointNs_t m_lastThroughputTimestamp{DurationNs_t(0)};
+            uint64_t m_lastSentChunks{0U};
+            uint64_t m_lastSentBytes{0U};
 
             /// map from indices to object pointers
             std::map<int, ConnectionInfo*> connectionMap;
@@ -580,9 +580,71 @@ PortIntrospection<PublisherPort, SubscriberPort>::PortData::prepareTopic(PortInt
 
 template <typename PublisherPort, typename SubscriberPort>
 inline void PortIntrospection<PublisherPort, SubscriberPort>::PortData::prepareTopic(
-    PortThroughputIntrospectionTopic& topic IOX_MAYBE_UNUSED) noexcept
+    PortThroughputIntrospectionTopic& topic) noexcept
 {
-    /// @todo iox-#402 re-add port throughput
+    std::lock_guard<std::mutex> lock(m_mutex); // we need to lock the internal data structs
+
+    for (auto& pub : m_publisherMap)
+    {
+        for (auto& pair : pub.second)
+        {
+            auto publisherIndex = pair.second;
+            if (publisherIndex >= 0)
+            {
+                auto& publisherInfo = m_publisherContainer[publisherIndex];
+                auto& chunkSenderData = publisherInfo.portData->m_chunkSenderData;
+                PortThroughputData throughputData;
+                throughputData.m_publisherPortID = static_cast<uint64_t>(publisherInfo.portData->m_uniqueId);
+                throughputData.m_recycledChunkHits = chunkSenderData.m_recycledChunkHits.load(std::memory_order_relaxed);
+                throughputData.m_recycledChunkMisses =
+                    chunkSenderData.m_recycledChunkMisses.load(std::memory_order_relaxed);
+                throughputData.m_isField = chunkSenderData.m_historyCapacity > 0U;
+                throughputData.m_lostChunks = chunkSenderData.m_lostChunks.load(std::memory_order_relaxed);
+
+                // the counters are written independently by the publisher, i.e. they are not a consistent snapshot;
+                // this is sufficient for statistics
+                const auto sentChunks = chunkSenderData.m_sentChunks.load(std::memory_order_relaxed);
+                const auto sentBytes = chunkSenderData.m_sentUserPayloadBytes.load(std::memory_order_relaxed);
+                throughputData.m_sentChunks = sentChunks;
+                throughputData.m_sentBytes = sentBytes;
+                throughputData.m_sampleSize = chunkSenderData.m_lastUserPayloadSize.load(std::memory_order_relaxed);
+                throughputData.m_chunkSize = chunkSenderData.m_lastChunkSize.load(std::memory_order_relaxed);
+                throughputData.m_lastSendIntervalInNanoseconds =
+                    chunkSenderData.m_lastSendIntervalInNanoseconds.load(std::memory_order_relaxed);
+                const auto firstSend = chunkSenderData.m_firstSendTimestamp.load(std::memory_order_relaxed);
+                const auto lastSend = chunkSenderData.m_lastSendTimestamp.load(std::memory_order_relaxed);
+                if (sentChunks > 1U && lastSend > firstSend)
+                {
+                    throughputData.m_averageSendIntervalInNanoseconds = (lastSend - firstSend) / (sentChunks - 1U);
+                }
+
+                // the rates are computed from the difference to the previous throughput sample
+                const auto now = mepoo::BaseClock_t::now();
+                if (publisherInfo.m_lastThroughputTimestamp.time_since_epoch().count() != 0)
+                {
+                    const auto elapsedNs = std::chrono::duration_cast<mepoo::DurationNs_t>(
+                                               now - publisherInfo.m_lastThroughputTimestamp)
+                                               .count();
+                    if (elapsedNs > 0)
+                    {
+                        constexpr double NANOSECONDS_PER_SECOND{1e9};
+                        constexpr double SECONDS_PER_MINUTE{60.0};
+                        const double elapsedSeconds = static_cast<double>(elapsedNs) / NANOSECONDS_PER_SECOND;
+                        throughputData.m_chunksPerMinute =
+                            static_cast<double>(sentChunks - publisherInfo.m_lastSentChunks) * SECONDS_PER_MINUTE
+                            / elapsedSeconds;
+                        throughputData.m_bytesPerSecond =
+                            static_cast<double>(sentBytes - publisherInfo.m_lastSentBytes) / elapsedSeconds;
+                    }
+                }
+                publisherInfo.m_lastThroughputTimestamp = now;
+                publisherInfo.m_lastSentChunks = sentChunks;
+                publisherInfo.m_lastSentBytes = sentBytes;
+
+                topic.m_throughputList.emplace_back(throughputData);
+            }
+        }
+    }
 }
 
 template <typename PublisherPort, typename SubscriberPort>
@@ -608,6 +670,17 @@ inline void PortIntrospection<PublisherPort, SubscriberPort>::PortData::prepareT
                     // subscriberData.fifoCapacity = port .getDeliveryFiFoCapacity();
                     // subscriberData.fifoSize = port.getDeliveryFiFoSize();
                     subscriberData.propagationScope = port.getCaProServiceDescription().getScope();
+                    auto& chunkReceiverData = subscriberInfo.portData->m_chunkReceiverData;
+                    subscriberData.receivedChunks = chunkReceiverData.m_receivedChunks.load(std::memory_order_relaxed);
+                    subscriberData.lostChunks = chunkReceiverData.m_lostChunks.load(std::memory_order_relaxed);
+                    if (chunkReceiverData.m_latencyHistogram)
+                    {
+                        const auto& latencyHistogram = *chunkReceiverData.m_latencyHistogram;
+                        subscriberData.latencySamples = latencyHistogram.count();
+                        subscriberData.latencyP50InNanoseconds = latencyHistogram.valueAtPercentile(50.0);
+                        subscriberData.latencyP99InNanoseconds = latencyHistogram.valueAtPercentile(99.0);
+                        subscriberData.latencyP999InNanoseconds = latencyHistogram.valueAtPercentile(99.9);
+                    }
                 }
                 else
                 {
@@ -35,6 +35,7 @@
 #include "iceoryx_posh/internal/popo/ports/subscriber_port_user.hpp"
 #include "iceoryx_posh/internal/roudi/introspection/port_introspection.hpp"
 #include "iceoryx_posh/internal/roudi/service_registry.hpp"
+#include "iceoryx_posh/internal/roudi/service_registry_change_log.hpp"
 #include "iceoryx_posh/internal/runtime/ipc_message.hpp"
 #include "iceoryx_posh/internal/runtime/node_data.hpp"
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
@@ -63,8 +64,17 @@ class PortManager
     /// @todo iox-#518 Remove this later
     void stopPortIntrospection() noexcept;
 
+    /// @brief Processes the pending requests of all ports, nodes and condition variables which notified the
+    /// DiscoveryTrigger of the port pool since the last call
     void doDiscovery() noexcept;
 
+    /// @brief Blocks until a port, node or condition variable requests a discovery or the timeout has passed
+    /// @param[in] timeout the maximum duration to wait
+    void waitForDiscoveryRequest(const units::Duration& timeout) noexcept;
+
+    /// @brief Wakes up a blocking waitForDiscoveryRequest, e.g. to shut down the discovery
+    void wakeUpDiscovery() noexcept;
+
     expected<PublisherPortRouDiType::MemberType_t*, PortPoolError>
     acquirePublisherPortData(const capro::ServiceDescription& service,
                              const popo::PublisherOptions& publisherOptions,
@@ -121,6 +131,15 @@ class PortManager
     expected<popo::ConditionVariableData*, PortPoolError>
     acquireConditionVariableData(const RuntimeName_t& runtimeName) noexcept;
 
+    /// @brief Acquires the heartbeat which the runtime of a monitored process updates
+    /// @param [in] runtimeName of the process runtime which is monitored
+    /// @return on success a pointer to the heartbeat in the management segment; on error a PortPoolError
+    expected<runtime::Heartbeat*, PortPoolError> acquireHeartbeat(const RuntimeName_t& runtimeName) noexcept;
+
+    /// @brief Releases a heartbeat which was acquired with acquireHeartbeat
+    /// @param [in] heartbeat which is not used anymore
+    void releaseHeartbeat(const runtime::Heartbeat* const heartbeat) noexcept;
+
     /// @brief Used to unblock potential locks in the shutdown phase of a process
     /// @param [in] name of the process runtime which is about to shut down
     void unblockProcessShutdown(const RuntimeName_t& runtimeName) noexcept;
@@ -137,17 +156,17 @@ class PortManager
 
     void destroySubscriberPort(SubscriberPortType::MemberType_t* const subscriberPortData) noexcept;
 
-    void handlePublisherPorts() noexcept;
+    void handlePublisherPort(PublisherPortRouDiType::MemberType_t* const publisherPortData) noexcept;
 
     void doDiscoveryForPublisherPort(PublisherPortRouDiType& publisherPort) noexcept;
 
-    void handleSubscriberPorts() noexcept;
+    void handleSubscriberPort(SubscriberPortType::MemberType_t* const subscriberPortData) noexcept;
 
     void doDiscoveryForSubscriberPort(SubscriberPortType& subscriberPort) noexcept;
 
     void destroyClientPort(popo::ClientPortData* const clientPortData) noexcept;
 
-    void handleClientPorts() noexcept;
+    void handleClientPort(popo::ClientPortData* const clientPortData) noexcept;
 
     void doDiscoveryForClientPort(popo::ClientPortRouDi& clientPort) noexcept;
 
@@ -155,15 +174,21 @@ class PortManager
 
     void destroyServerPort(popo::ServerPortData* const clientPortData) noexcept;
 
-    void handleServerPorts() noexcept;
+    void handleServerPort(popo::ServerPortData* const serverPortData) noexcept;
 
     void doDiscoveryForServerPort(popo::ServerPortRouDi& serverPort) noexcept;
 
-    void handleInterfaces() noexcept;
+    /// @brief Destroys the interface port if requested
+    /// @param[in] interfacePortData of the interface port to handle
+    /// @return true if the interface port is new and still needs the initial offer forwarding, otherwise false
+    bool handleInterfacePort(popo::InterfacePortData* const interfacePortData) noexcept;
 
-    void handleNodes() noexcept;
+    void forwardInitialOffersToInterfaces(
+        const vector<popo::InterfacePortData*, MAX_INTERFACE_NUMBER>& interfacePortsForInitialForwarding) noexcept;
 
-    void handleConditionVariables() noexcept;
+    void handleNode(runtime::NodeData* const nodeData) noexcept;
+
+    void handleConditionVariable(popo::ConditionVariableData* const conditionVariableData) noexcept;
 
     bool isCompatiblePubSub(const PublisherPortRouDiType& publisher,
                             const SubscriberPortType& subscriber) const noexcept;
@@ -200,15 +225,24 @@ class PortManager
 
     void publishServiceRegistry() const noexcept;
 
+    void publishServiceRegistryChangeLog() const noexcept;
+
+    /// @brief Records the modification of the service registry in the change log and publishes it, every
+    /// ServiceRegistryChangeLog::SNAPSHOT_INTERVAL modifications also a snapshot of the whole registry is published
+    void publishServiceRegistryChange(const ServiceRegistryChangeLog::Operation operation,
+                                      const capro::ServiceDescription& service) noexcept;
+
     const ServiceRegistry& serviceRegistry() const noexcept;
 
   private:
     RouDiMemoryInterface* m_roudiMemoryInterface{nullptr};
     PortPool* m_portPool{nullptr};
     ServiceRegistry m_serviceRegistry;
+    ServiceRegistryChangeLog m_serviceRegistryChangeLog;
     PortIntrospectionType m_portIntrospection;
     vector<capro::ServiceDescription, NUMBER_OF_INTERNAL_PUBLISHERS> m_internalServices;
     optional<PublisherPortRouDiType::MemberType_t*> m_serviceRegistryPublisherPortData;
+    optional<PublisherPortRouDiType::MemberType_t*> m_serviceRegistryChangeLogPublisherPortData;
 
     // some ports for the service registry requires special handling
     // as we cannot send registry information if it was not created yet
@@ -28,18 +28,14 @@ inline optional<RuntimeName_t>
 PortManager::doesViolateCommunicationPolicy(const capro::ServiceDescription& service) noexcept
 {
     // check if the publisher is already in the list
-    for (auto publisherPortData : m_portPool->getPublisherPortDataList())
+    for (auto publisherPortData : m_portPool->getPublisherPortDataList(service))
     {
-        popo::PublisherPortRouDi publisherPort(publisherPortData);
-        if (service == publisherPort.getCaProServiceDescription())
+        if (publisherPortData->m_toBeDestroyed)
         {
-            if (publisherPortData->m_toBeDestroyed)
-            {
-                destroyPublisherPort(publisherPortData);
-                continue;
-            }
-            return make_optional<RuntimeName_t>(publisherPortData->m_runtimeName);
+            destroyPublisherPort(publisherPortData);
+            continue;
         }
+        return make_optional<RuntimeName_t>(publisherPortData->m_runtimeName);
     }
     return nullopt;
 }
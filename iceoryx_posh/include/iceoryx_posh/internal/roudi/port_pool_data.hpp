@@ -19,11 +19,13 @@
 
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/discovery_trigger.hpp"
 #include "iceoryx_posh/internal/popo/ports/client_port_data.hpp"
 #include "iceoryx_posh/internal/popo/ports/interface_port.hpp"
 #include "iceoryx_posh/internal/popo/ports/publisher_port_data.hpp"
 #include "iceoryx_posh/internal/popo/ports/server_port_data.hpp"
 #include "iceoryx_posh/internal/popo/ports/subscriber_port_data.hpp"
+#include "iceoryx_posh/internal/runtime/heartbeat.hpp"
 #include "iceoryx_posh/internal/runtime/node_data.hpp"
 #include "iox/optional.hpp"
 #include "iox/vector.hpp"
@@ -48,6 +50,16 @@ class FixedPositionContainer
 
     vector<T*, Capacity> content() noexcept;
 
+    /// @brief Returns the position of an element of the container
+    /// @param[in] element which is part of the container
+    /// @return the position of the element or Capacity if it is not part of the container
+    uint64_t indexOf(const T* const element) const noexcept;
+
+    /// @brief Returns the element at a position
+    /// @param[in] index of the position
+    /// @return pointer to the element or nullptr if the position is empty
+    T* get(const uint64_t index) noexcept;
+
   private:
     vector<optional<T>, Capacity> m_data;
 };
@@ -57,12 +69,16 @@ struct PortPoolData
     FixedPositionContainer<popo::InterfacePortData, MAX_INTERFACE_NUMBER> m_interfacePortMembers;
     FixedPositionContainer<runtime::NodeData, MAX_NODE_NUMBER> m_nodeMembers;
     FixedPositionContainer<popo::ConditionVariableData, MAX_NUMBER_OF_CONDITION_VARIABLES> m_conditionVariableMembers;
+    FixedPositionContainer<runtime::Heartbeat, MAX_PROCESS_NUMBER> m_heartbeatMembers;
 
     FixedPositionContainer<iox::popo::PublisherPortData, MAX_PUBLISHERS> m_publisherPortMembers;
     FixedPositionContainer<iox::popo::SubscriberPortData, MAX_SUBSCRIBERS> m_subscriberPortMembers;
+    FixedPositionContainer<popo::LatencyHistogram, MAX_LATENCY_HISTOGRAMS> m_latencyHistogramMembers;
 
     FixedPositionContainer<iox::popo::ServerPortData, MAX_SERVERS> m_serverPortMembers;
     FixedPositionContainer<iox::popo::ClientPortData, MAX_CLIENTS> m_clientPortMembers;
+
+    popo::DiscoveryTrigger m_discoveryTrigger;
 };
 
 } // namespace roudi
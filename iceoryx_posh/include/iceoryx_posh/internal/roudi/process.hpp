@@ -20,6 +20,7 @@
 #include "iceoryx_hoofs/posix_wrapper/posix_access_rights.hpp"
 #include "iceoryx_posh/internal/mepoo/segment_manager.hpp"
 #include "iceoryx_posh/internal/roudi/port_manager.hpp"
+#include "iceoryx_posh/internal/runtime/heartbeat.hpp"
 #include "iceoryx_posh/internal/runtime/ipc_interface_user.hpp"
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
 #include "iceoryx_posh/version/version_info.hpp"
@@ -38,14 +39,16 @@ class Process
     /// @param [in] name of the process; this is equal to the IPC channel name, which is used for communication
     /// @param [in] pid is the host system process id
     /// @param [in] user is user used in the operating system for this process
-    /// @param [in] isMonitored indicates if the process should be monitored for being alive
-    /// @param [in] dataSegmentId is an identifier for the shm data segment
+    /// @param [in] heartbeat in the management segment which is updated by the runtime of a monitored process;
+    /// nullptr if the process is not monitored for being alive
     /// @param [in] sessionId is an ID generated by RouDi to prevent sending outdated IPC channel transmission
+    /// @param [in] ipcProtocol is the protocol negotiated with the runtime for the responses to port requests
     Process(const RuntimeName_t& name,
             const uint32_t pid,
             const posix::PosixUser& user,
-            const bool isMonitored,
-            const uint64_t sessionId) noexcept;
+            runtime::Heartbeat* const heartbeat,
+            const uint64_t sessionId,
+            const runtime::IpcProtocol ipcProtocol) noexcept;
 
     Process(const Process& other) = delete;
     Process& operator=(const Process& other) = delete;
@@ -60,13 +63,18 @@ class Process
 
     void sendViaIpcChannel(const runtime::IpcMessage& data) noexcept;
 
+    void sendViaIpcChannel(const runtime::IpcBinaryMessage& data) noexcept;
+
+    /// @brief The protocol which was negotiated with the runtime of this process during the registration
+    runtime::IpcProtocol getIpcProtocol() const noexcept;
+
     /// @brief The session ID which is used to check outdated IPC channel transmissions for this process
     /// @return the session ID for this process
     uint64_t getSessionId() noexcept;
 
-    void setTimestamp(const mepoo::TimePointNs_t timestamp) noexcept;
-
-    mepoo::TimePointNs_t getTimestamp() noexcept;
+    /// @brief The heartbeat which is updated by the runtime of this process
+    /// @return pointer to the heartbeat, nullptr if the process is not monitored
+    runtime::Heartbeat* getHeartbeat() const noexcept;
 
     posix::PosixUser getUser() const noexcept;
 
@@ -75,10 +83,10 @@ class Process
   private:
     const uint32_t m_pid{0U};
     runtime::IpcInterfaceUser m_ipcChannel;
-    mepoo::TimePointNs_t m_timestamp;
+    runtime::Heartbeat* m_heartbeat{nullptr};
     posix::PosixUser m_user;
-    bool m_isMonitored{true};
     std::atomic<uint64_t> m_sessionId{0U};
+    runtime::IpcProtocol m_ipcProtocol{runtime::IpcProtocol::TEXT};
 };
 
 } // namespace roudi
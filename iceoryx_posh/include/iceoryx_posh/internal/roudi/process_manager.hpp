@@ -71,6 +71,7 @@ class ProcessManager : public ProcessManagerInterface
     /// @param [in] transmissionTimestamp is an ID for the application to check for the expected response
     /// @param [in] sessionId is an ID generated by RouDi to prevent sending outdated IPC channel transmission
     /// @param [in] versionInfo Version of iceoryx used
+    /// @param [in] ipcProtocol is the protocol negotiated with the process for the responses to port requests
     /// @return false if process was already registered, true otherwise
     bool registerProcess(const RuntimeName_t& name,
                          const uint32_t pid,
@@ -78,7 +79,8 @@ class ProcessManager : public ProcessManagerInterface
                          const bool isMonitored,
                          const int64_t transmissionTimestamp,
                          const uint64_t sessionId,
-                         const version::VersionInfo& versionInfo) noexcept;
+                         const version::VersionInfo& versionInfo,
+                         const runtime::IpcProtocol ipcProtocol) noexcept;
 
     /// @brief Unregisters a process at the ProcessManager
     /// @param [in] name of the process which wants to unregister
@@ -103,8 +105,6 @@ class ProcessManager : public ProcessManagerInterface
     /// @brief Tries to gracefully terminate all registered processes
     void requestShutdownOfAllProcesses() noexcept;
 
-    void updateLivelinessOfProcess(const RuntimeName_t& name) noexcept;
-
     void
     addInterfaceForProcess(const RuntimeName_t& name, capro::Interfaces interface, const NodeName_t& node) noexcept;
 
@@ -169,6 +169,7 @@ class ProcessManager : public ProcessManagerInterface
     /// @param [in] transmissionTimestamp is an ID for the application to check for the expected response
     /// @param [in] sessionId is an ID generated by RouDi to prevent sending outdated IPC channel transmission
     /// @param [in] versionInfo Version of iceoryx used
+    /// @param [in] ipcProtocol is the protocol negotiated with the process for the responses to port requests
     /// @return Returns if the process could be added successfully.
     bool addProcess(const RuntimeName_t& name,
                     const uint32_t pid,
@@ -176,7 +177,8 @@ class ProcessManager : public ProcessManagerInterface
                     const bool isMonitored,
                     const int64_t transmissionTimestamp,
                     const uint64_t sessionId,
-                    const version::VersionInfo& versionInfo) noexcept;
+                    const version::VersionInfo& versionInfo,
+                    const runtime::IpcProtocol ipcProtocol) noexcept;
 
     /// @brief Removes the process from the managed client process list, identified by its id.
     /// @param [in] name The process name which should be removed.
@@ -216,6 +218,17 @@ class ProcessManager : public ProcessManagerInterface
     /// @param [in] errnum errorcode of the killcommand
     /// @param [in] errorString errorstring of the killcommand
     /// @param [in] shutdownPolicy enum which tells what termination command was used (e.g. SIGTERM)
+    /// @brief Sends the acknowledge for a created port or condition variable in the protocol of the process
+    /// @param [in] process which requested the port
+    /// @param [in] ackType is the type of the acknowledge message
+    /// @param [in] data is the pointer to the created port or condition variable in the management segment
+    void sendAckToRuntime(Process& process, const runtime::IpcMessageType ackType, void* const data) noexcept;
+
+    /// @brief Sends an error response in the protocol of the process
+    /// @param [in] process which sent the request
+    /// @param [in] error which occurred while handling the request
+    void sendErrorToRuntime(Process& process, const runtime::IpcMessageErrorType error) noexcept;
+
     void evaluateKillError(const Process& process,
                            const int32_t& errnum,
                            const char* errorString,
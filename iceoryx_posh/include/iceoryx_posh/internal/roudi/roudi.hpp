@@ -57,12 +57,14 @@ class RouDi
             const bool killProcessesInDestructor = true,
             const RuntimeMessagesThreadStart RuntimeMessagesThreadStart = RuntimeMessagesThreadStart::IMMEDIATE,
             const version::CompatibilityCheckLevel compatibilityCheckLevel = version::CompatibilityCheckLevel::PATCH,
-            const units::Duration processKillDelay = roudi::PROCESS_DEFAULT_KILL_DELAY) noexcept
+            const units::Duration processKillDelay = roudi::PROCESS_DEFAULT_KILL_DELAY,
+            const runtime::IpcProtocol ipcProtocol = runtime::IpcProtocol::BINARY) noexcept
             : m_monitoringMode(monitoringMode)
             , m_killProcessesInDestructor(killProcessesInDestructor)
             , m_runtimesMessagesThreadStart(RuntimeMessagesThreadStart)
             , m_compatibilityCheckLevel(compatibilityCheckLevel)
             , m_processKillDelay(processKillDelay)
+            , m_ipcProtocol(ipcProtocol)
         {
         }
 
@@ -71,6 +73,9 @@ class RouDi
         const RuntimeMessagesThreadStart m_runtimesMessagesThreadStart;
         const version::CompatibilityCheckLevel m_compatibilityCheckLevel;
         const units::Duration m_processKillDelay;
+        /// @brief the protocol which is offered to the runtimes for the port requests; runtimes which do not support
+        /// the binary protocol in the same version always use IpcProtocol::TEXT
+        const runtime::IpcProtocol m_ipcProtocol;
     };
 
     RouDi& operator=(const RouDi& other) = delete;
@@ -95,6 +100,9 @@ class RouDi
     virtual void processMessage(const runtime::IpcMessage& message,
                                 const iox::runtime::IpcMessageType& cmd,
                                 const RuntimeName_t& runtimeName) noexcept;
+    /// @brief Handles a request from a runtime which negotiated the binary protocol
+    /// @param [in] message the decoded request; the runtime name is the first field
+    virtual void processBinaryMessage(runtime::IpcBinaryMessage& message) noexcept;
     virtual void cyclicUpdateHook() noexcept;
     void IpcMessageErrorHandler() noexcept;
 
@@ -110,12 +118,14 @@ class RouDi
     /// @param [in] transmissionTimestamp is an ID for the application to check for the expected response
     /// @param [in] sessionId is an ID generated by RouDi to prevent sending outdated IPC channel transmission
     /// @param [in] versionInfo Version of iceoryx used
+    /// @param [in] ipcProtocolVersion is the version of the binary protocol supported by the process, 0 if none
     void registerProcess(const RuntimeName_t& name,
                          const uint32_t pid,
                          const posix::PosixUser user,
                          const int64_t transmissionTimestamp,
                          const uint64_t sessionId,
-                         const version::VersionInfo& versionInfo) noexcept;
+                         const version::VersionInfo& versionInfo,
+                         const uint32_t ipcProtocolVersion) noexcept;
 
     /// @brief Creates a unique ID which can be used to check outdated IPC channel transmissions
     /// @return a unique, monotonic and consecutive increasing number
@@ -158,6 +168,7 @@ class RouDi
   private:
     roudi::MonitoringMode m_monitoringMode{roudi::MonitoringMode::ON};
     units::Duration m_processKillDelay;
+    runtime::IpcProtocol m_ipcProtocol{runtime::IpcProtocol::BINARY};
 };
 
 } // namespace roudi
@@ -32,6 +32,25 @@ namespace iox
 {
 namespace roudi
 {
+namespace detail
+{
+/// @brief Calculates the smallest power of two which is greater or equal to the provided value
+/// @param[in] value must not exceed the largest power of two of uint32_t
+/// @return the smallest power of two not below value
+constexpr uint32_t smallestPowerOfTwoNotBelow(const uint32_t value) noexcept
+{
+    uint32_t powerOfTwo{1U};
+    while (powerOfTwo < value)
+    {
+        powerOfTwo *= 2U;
+    }
+    return powerOfTwo;
+}
+} // namespace detail
+
+/// @brief Registry of the offered services of the publishers and servers. The entries are indexed by hash tables on the
+/// full ServiceDescription and on each of its strings, therefore exact lookups do not depend on the number of entries
+/// and searches with wildcards only visit the entries which have the same hash for one of the specified strings.
 class ServiceRegistry
 {
   public:
@@ -86,6 +105,7 @@ class ServiceRegistry
     /// @param[in] instance, string or wildcard (= iox::nullopt) to search for
     /// @param[in] event, string or wildcard (= iox::nullopt) to search for
     /// @param[in] callable, callable to apply to each matching entry
+    /// @note the matching entries are visited in the order of their slots, like with forEach
     void find(const optional<capro::IdString_t>& service,
               const optional<capro::IdString_t>& instance,
               const optional<capro::IdString_t>& event,
@@ -96,25 +116,79 @@ class ServiceRegistry
     /// @note Can be used to obtain all entries or count them
     void forEach(function_ref<void(const ServiceDescriptionEntry&)> callable) const noexcept;
 
+    /// @brief Returns the generation of the registry which is incremented by every modification
+    /// @return the number of modifications since the construction of the registry
+    /// @note Two registries with the same generation which have seen the same modifications are identical,
+    /// therefore a copy of the registry can be kept up to date with the ServiceRegistryChangeLog
+    uint64_t generation() const noexcept;
+
   private:
     using Entry_t = optional<ServiceDescriptionEntry>;
     using ServiceDescriptionContainer_t = vector<Entry_t, CAPACITY>;
 
     static constexpr uint32_t NO_INDEX = CAPACITY;
 
+    /// @brief The keys of the hash indices, the full ServiceDescription for exact lookups and each of its strings for
+    /// the searches with wildcards
+    enum class IndexKey : uint8_t
+    {
+        SERVICE_DESCRIPTION,
+        SERVICE,
+        INSTANCE,
+        EVENT,
+    };
+    static constexpr uint64_t NUMBER_OF_INDEX_KEYS{4U};
+
+    static constexpr uint32_t NUMBER_OF_BUCKETS{detail::smallestPowerOfTwoNotBelow(CAPACITY)};
+
+    static constexpr uint32_t BITS_PER_WORD{64U};
+    static constexpr uint32_t NUMBER_OF_SLOT_WORDS{(CAPACITY + BITS_PER_WORD - 1U) / BITS_PER_WORD};
+
+    /// @brief Head of the chain of the entries whose key hashes into the bucket
+    struct Bucket
+    {
+        uint32_t firstIndex{NO_INDEX};
+        uint32_t numberOfEntries{0U};
+    };
+
+    /// @brief Links of an entry to its neighbours in the chain of its bucket, the doubly linked chain allows to remove
+    /// an entry without searching it
+    struct ChainLink
+    {
+        uint32_t nextIndex{NO_INDEX};
+        uint32_t previousIndex{NO_INDEX};
+    };
+
     ServiceDescriptionContainer_t m_serviceDescriptions;
 
-    // store the last known free Index (if any is known)
-    // we could use a queue (or stack) here since they are not optimal
-    // for the filling pattern of a vector (prefer entries close to the front)
-    uint32_t m_freeIndex{NO_INDEX};
+    // the indices refer to the slots of m_serviceDescriptions instead of using pointers, therefore the registry
+    // stays relocatable and can be copied into a shared memory chunk
+    Bucket m_buckets[NUMBER_OF_INDEX_KEYS][NUMBER_OF_BUCKETS];
+    ChainLink m_chainLinks[NUMBER_OF_INDEX_KEYS][CAPACITY];
+
+    // a set bit marks a free slot below the size of m_serviceDescriptions, new entries are stored in the lowest free
+    // slot to prefer entries close to the front
+    uint64_t m_freeSlotWords[NUMBER_OF_SLOT_WORDS]{};
+
+    uint64_t m_generation{0U};
 
   private:
     uint32_t findIndex(const capro::ServiceDescription& serviceDescription) const noexcept;
 
-
     expected<Error> add(const capro::ServiceDescription& serviceDescription,
                         ReferenceCounter_t ServiceDescriptionEntry::*count);
+
+    uint32_t acquireFreeIndex() noexcept;
+
+    void removeEntry(const uint32_t index) noexcept;
+
+    static uint64_t hash(const IndexKey key, const capro::ServiceDescription& serviceDescription) noexcept;
+
+    static uint32_t toBucketIndex(const uint64_t hash) noexcept;
+
+    void insertIntoIndices(const uint32_t index) noexcept;
+
+    void removeFromIndices(const uint32_t index) noexcept;
 };
 
 } // namespace roudi
@@ -0,0 +1,90 @@
+// Copyright (c) 2026 by agent <agent@local>. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_ROUDI_SERVICE_REGISTRY_CHANGE_LOG_HPP
+#define IOX_POSH_ROUDI_SERVICE_REGISTRY_CHANGE_LOG_HPP
+
+#include "iceoryx_posh/capro/service_description.hpp"
+#include "iceoryx_posh/internal/roudi/service_registry.hpp"
+#include "iox/expected.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace roudi
+{
+/// @brief The ServiceRegistryChangeLog contains the latest modifications of the ServiceRegistry of RouDi. It is
+/// published together with the ServiceRegistry, which allows the ServiceDiscovery to keep its copy of the registry up
+/// to date by applying only the modifications since its last update instead of copying the whole registry.
+/// @note The change of generation g is stored in a ring buffer at position (g - 1) % CAPACITY, therefore only the
+/// latest CAPACITY changes are available. A registry which is older has to be replaced by a newer snapshot.
+class ServiceRegistryChangeLog
+{
+  public:
+    enum class Error
+    {
+        CHANGES_ARE_NO_LONGER_AVAILABLE,
+    };
+
+    /// @brief The modifications of the ServiceRegistry
+    enum class Operation : uint8_t
+    {
+        ADD_PUBLISHER,
+        REMOVE_PUBLISHER,
+        ADD_SERVER,
+        REMOVE_SERVER,
+    };
+
+    struct Change
+    {
+        Operation operation{Operation::ADD_PUBLISHER};
+        capro::ServiceDescription serviceDescription;
+    };
+
+    static constexpr uint64_t CAPACITY{64U};
+
+    /// @brief The publisher of the change log publishes a snapshot of the registry every SNAPSHOT_INTERVAL changes
+    /// before the change log, hence the latest change log always contains all changes since the latest snapshot
+    static constexpr uint64_t SNAPSHOT_INTERVAL{CAPACITY / 2U};
+
+    /// @brief Records a modification of the registry
+    /// @param[in] generation of the registry after the modification, must be the successor of the latest recorded
+    /// generation
+    /// @param[in] operation which was applied to the registry
+    /// @param[in] serviceDescription the operation was applied to
+    void record(const uint64_t generation,
+                const Operation operation,
+                const capro::ServiceDescription& serviceDescription) noexcept;
+
+    /// @brief Returns the generation of the registry after the latest recorded change
+    /// @return the latest recorded generation, 0 if no change was recorded
+    uint64_t generation() const noexcept;
+
+    /// @brief Applies all changes which are newer than the generation of the provided registry
+    /// @param[in] registry which is a copy of the registry whose changes were recorded
+    /// @return CHANGES_ARE_NO_LONGER_AVAILABLE if the registry is too old for the recorded changes, the registry is
+    /// not modified in this case
+    expected<Error> applyTo(ServiceRegistry& registry) const noexcept;
+
+  private:
+    uint64_t m_generation{0U};
+    Change m_changes[CAPACITY];
+};
+
+} // namespace roudi
+} // namespace iox
+
+#endif // IOX_POSH_ROUDI_SERVICE_REGISTRY_CHANGE_LOG_HPP
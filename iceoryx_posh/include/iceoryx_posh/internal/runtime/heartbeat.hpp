@@ -0,0 +1,56 @@
+// Copyright (c) 2026 by agent <agent@local>. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_RUNTIME_HEARTBEAT_HPP
+#define IOX_POSH_RUNTIME_HEARTBEAT_HPP
+
+#include "iox/duration.hpp"
+
+#include <atomic>
+#include <cstdint>
+
+namespace iox
+{
+namespace runtime
+{
+/// @brief The Heartbeat is located in the management segment. The runtime of a monitored process beats it
+/// periodically and RouDi reads it to detect processes which are not responding anymore.
+class Heartbeat
+{
+  public:
+    /// @brief Creates a Heartbeat which has just beaten
+    Heartbeat() noexcept;
+
+    Heartbeat(const Heartbeat&) = delete;
+    Heartbeat(Heartbeat&&) = delete;
+    Heartbeat& operator=(const Heartbeat&) = delete;
+    Heartbeat& operator=(Heartbeat&&) = delete;
+
+    /// @brief Stores the current time as time of the last beat
+    void beat() noexcept;
+
+    /// @brief Returns the time which has passed since the last beat
+    /// @return duration since the last beat
+    units::Duration durationSinceLastBeat() const noexcept;
+
+  private:
+    static uint64_t nowInNanoseconds() noexcept;
+
+    std::atomic<uint64_t> m_lastBeatInNanoseconds{0U};
+};
+} // namespace runtime
+} // namespace iox
+
+#endif // IOX_POSH_RUNTIME_HEARTBEAT_HPP
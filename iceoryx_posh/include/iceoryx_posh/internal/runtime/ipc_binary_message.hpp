@@ -0,0 +1,171 @@
+// Copyright (c) 2026 by agent <agent@local>. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_RUNTIME_IPC_BINARY_MESSAGE_HPP
+#define IOX_POSH_RUNTIME_IPC_BINARY_MESSAGE_HPP
+
+#include "iceoryx_posh/capro/service_description.hpp"
+#include "iceoryx_posh/internal/runtime/ipc_interface_base.hpp"
+#include "iceoryx_posh/popo/client_options.hpp"
+#include "iceoryx_posh/popo/publisher_options.hpp"
+#include "iceoryx_posh/popo/server_options.hpp"
+#include "iceoryx_posh/popo/subscriber_options.hpp"
+#include "iceoryx_posh/runtime/port_config_info.hpp"
+#include "iox/string.hpp"
+
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+namespace iox
+{
+namespace runtime
+{
+/// @brief A message between a runtime and RouDi with a fixed binary layout. Every field is stored with its native
+/// representation at a position which is given by the fields written before, i.e. the layout of a message type is
+/// fixed by the order of the operator<< calls and read in the same order with operator>>. Strings are stored with
+/// their size followed by their characters. The message lives completely on the stack.
+/// @code
+///     IpcBinaryMessage request{IpcMessageType::CREATE_PUBLISHER};
+///     request << runtimeName << service << publisherOptions << portConfigInfo;
+///
+///     // on the receiving side
+///     request >> runtimeName >> service >> publisherOptions >> portConfigInfo;
+///     if (!request.isValid()) { /* handle the malformed message */ }
+/// @endcode
+/// @note The IPC channels only transfer null-terminated strings, therefore the message is encoded with the consistent
+/// overhead byte stuffing (COBS) for the transport, which removes all null bytes with an overhead of one byte per 254
+/// bytes.
+class IpcBinaryMessage
+{
+  public:
+    /// @brief The version of the layout; a runtime and RouDi only use the binary protocol when they use the same one
+    static constexpr uint8_t PROTOCOL_VERSION{1U};
+    /// @brief The maximum size of a message without the encoding for the transport
+    static constexpr uint64_t CAPACITY{1024U};
+    /// @brief The first character of a binary message on the IPC channel; text messages always start with a number
+    static constexpr char ENCODING_MARKER{'\x1B'};
+
+    /// @brief Creates an invalid message without a type, e.g. to receive a message
+    IpcBinaryMessage() noexcept = default;
+
+    /// @brief Creates a valid message of the given type without any fields
+    /// @param[in] type of the message
+    explicit IpcBinaryMessage(const IpcMessageType type) noexcept;
+
+    IpcBinaryMessage(const IpcBinaryMessage&) noexcept = default;
+    IpcBinaryMessage(IpcBinaryMessage&&) noexcept = default;
+    IpcBinaryMessage& operator=(const IpcBinaryMessage&) noexcept = default;
+    IpcBinaryMessage& operator=(IpcBinaryMessage&&) noexcept = default;
+    ~IpcBinaryMessage() noexcept = default;
+
+    /// @brief Returns the type of the message
+    /// @return the type of the message or IpcMessageType::NOTYPE for a message which was not successfully created or
+    /// decoded
+    IpcMessageType getType() const noexcept;
+
+    /// @brief A message becomes invalid when a field does not fit into the message anymore or when a field is read
+    /// which was not contained in the message
+    /// @return true if all writes and reads so far were successful, otherwise false
+    bool isValid() const noexcept;
+
+    /// @brief Marks the message as invalid, e.g. when a field contains a value which is out of range for its type
+    void invalidate() noexcept;
+
+    /// @brief Returns the number of bytes of the message including the header
+    uint64_t size() const noexcept;
+
+    /// @brief Appends an arithmetic value or an enum with its native representation
+    /// @param[in] value to append
+    /// @return reference to this message
+    template <typename T>
+    IpcBinaryMessage& operator<<(const T& value) noexcept;
+
+    /// @brief Appends a bool as single byte
+    IpcBinaryMessage& operator<<(const bool value) noexcept;
+
+    /// @brief Appends the size and the characters of a string
+    template <uint64_t Capacity>
+    IpcBinaryMessage& operator<<(const string<Capacity>& value) noexcept;
+
+    /// @brief Reads the next field as arithmetic value or enum
+    /// @param[out] value is only set when the message contained the field
+    /// @return reference to this message, which becomes invalid if the field was not contained
+    template <typename T>
+    IpcBinaryMessage& operator>>(T& value) noexcept;
+
+    /// @brief Reads the next field as bool
+    IpcBinaryMessage& operator>>(bool& value) noexcept;
+
+    /// @brief Reads the next field as string; the message becomes invalid if the string exceeds the capacity
+    template <uint64_t Capacity>
+    IpcBinaryMessage& operator>>(string<Capacity>& value) noexcept;
+
+    /// @brief Encodes the message for the transport over an IPC channel
+    /// @return the encoded message which does not contain null characters
+    std::string encode() const noexcept;
+
+    /// @brief Replaces the content of this message with the decoded one
+    /// @param[in] encoded message as received from the IPC channel
+    /// @return true if the encoded message was a valid binary message with the current protocol version, otherwise
+    /// false and the message is invalid
+    bool decode(const std::string& encoded) noexcept;
+
+    /// @brief Checks if a message from the IPC channel was created with encode()
+    /// @param[in] message as received from the IPC channel
+    /// @return true if it is a binary encoded message, false if it is a text message
+    static bool isBinaryEncoded(const std::string& message) noexcept;
+
+  private:
+    static constexpr uint64_t VERSION_POSITION{0U};
+    static constexpr uint64_t TYPE_POSITION{VERSION_POSITION + sizeof(PROTOCOL_VERSION)};
+    static constexpr uint64_t HEADER_SIZE{TYPE_POSITION + sizeof(IpcMessageType)};
+
+    void write(const void* const data, const uint64_t size) noexcept;
+    void read(void* const data, const uint64_t size) noexcept;
+
+    // NOLINTJUSTIFICATION the message shall live on the stack; access is bounds checked by write and read
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays)
+    uint8_t m_data[CAPACITY];
+    uint64_t m_size{0U};
+    uint64_t m_readPosition{HEADER_SIZE};
+    bool m_isValid{false};
+};
+
+IpcBinaryMessage& operator<<(IpcBinaryMessage& message, const capro::ServiceDescription& service) noexcept;
+IpcBinaryMessage& operator>>(IpcBinaryMessage& message, capro::ServiceDescription& service) noexcept;
+
+IpcBinaryMessage& operator<<(IpcBinaryMessage& message, const popo::PublisherOptions& options) noexcept;
+IpcBinaryMessage& operator>>(IpcBinaryMessage& message, popo::PublisherOptions& options) noexcept;
+
+IpcBinaryMessage& operator<<(IpcBinaryMessage& message, const popo::SubscriberOptions& options) noexcept;
+IpcBinaryMessage& operator>>(IpcBinaryMessage& message, popo::SubscriberOptions& options) noexcept;
+
+IpcBinaryMessage& operator<<(IpcBinaryMessage& message, const popo::ClientOptions& options) noexcept;
+IpcBinaryMessage& operator>>(IpcBinaryMessage& message, popo::ClientOptions& options) noexcept;
+
+IpcBinaryMessage& operator<<(IpcBinaryMessage& message, const popo::ServerOptions& options) noexcept;
+IpcBinaryMessage& operator>>(IpcBinaryMessage& message, popo::ServerOptions& options) noexcept;
+
+IpcBinaryMessage& operator<<(IpcBinaryMessage& message, const PortConfigInfo& portConfigInfo) noexcept;
+IpcBinaryMessage& operator>>(IpcBinaryMessage& message, PortConfigInfo& portConfigInfo) noexcept;
+
+} // namespace runtime
+} // namespace iox
+
+#include "iceoryx_posh/internal/runtime/ipc_binary_message.inl"
+
+#endif // IOX_POSH_RUNTIME_IPC_BINARY_MESSAGE_HPP
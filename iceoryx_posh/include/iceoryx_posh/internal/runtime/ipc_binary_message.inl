@@ -0,0 +1,74 @@
+// Copyright (c) 2026 by agent <agent@local>. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_RUNTIME_IPC_BINARY_MESSAGE_INL
+#define IOX_POSH_RUNTIME_IPC_BINARY_MESSAGE_INL
+
+#include "iceoryx_posh/internal/runtime/ipc_binary_message.hpp"
+
+namespace iox
+{
+namespace runtime
+{
+template <typename T>
+inline IpcBinaryMessage& IpcBinaryMessage::operator<<(const T& value) noexcept
+{
+    static_assert(std::is_arithmetic<T>::value || std::is_enum<T>::value,
+                  "Only arithmetic types and enums can be written with their native representation");
+    write(&value, sizeof(T));
+    return *this;
+}
+
+template <uint64_t Capacity>
+inline IpcBinaryMessage& IpcBinaryMessage::operator<<(const string<Capacity>& value) noexcept
+{
+    const uint64_t size{value.size()};
+    write(&size, sizeof(size));
+    write(value.c_str(), size);
+    return *this;
+}
+
+template <typename T>
+inline IpcBinaryMessage& IpcBinaryMessage::operator>>(T& value) noexcept
+{
+    static_assert(std::is_arithmetic<T>::value || std::is_enum<T>::value,
+                  "Only arithmetic types and enums can be read with their native representation");
+    read(&value, sizeof(T));
+    return *this;
+}
+
+template <uint64_t Capacity>
+inline IpcBinaryMessage& IpcBinaryMessage::operator>>(string<Capacity>& value) noexcept
+{
+    uint64_t size{0U};
+    read(&size, sizeof(size));
+    if (!m_isValid || size > Capacity || size > m_size - m_readPosition)
+    {
+        m_isValid = false;
+        return *this;
+    }
+
+    // NOLINTJUSTIFICATION the bounds are checked above
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    value = string<Capacity>(TruncateToCapacity, reinterpret_cast<const char*>(&m_data[m_readPosition]), size);
+    m_readPosition += size;
+    return *this;
+}
+
+} // namespace runtime
+} // namespace iox
+
+#endif // IOX_POSH_RUNTIME_IPC_BINARY_MESSAGE_INL
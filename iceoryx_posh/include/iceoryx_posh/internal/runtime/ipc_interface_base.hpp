@@ -28,6 +28,7 @@
 #include "iceoryx_posh/internal/runtime/ipc_message.hpp"
 #include "iox/deadline_timer.hpp"
 #include "iox/duration.hpp"
+#include "iox/optional.hpp"
 #include "iox/relative_pointer.hpp"
 
 #include "iceoryx_dust/posix_wrapper/message_queue.hpp"
@@ -75,7 +76,7 @@ enum class IpcMessageType : int32_t
     CREATE_CONDITION_VARIABLE_ACK,
     CREATE_NODE,
     CREATE_NODE_ACK,
-    KEEPALIVE,
+    KEEPALIVE, // unused since the liveliness is monitored via the heartbeat in shared memory
     TERMINATION,
     TERMINATION_ACK,
     PREPARE_APP_TERMINATION,
@@ -121,6 +122,16 @@ enum class IpcMessageErrorType : int32_t
 };
 
 
+/// @brief The encodings of the messages between the runtimes and RouDi
+enum class IpcProtocol : uint8_t
+{
+    /// @brief separator separated strings of the IpcMessage
+    TEXT,
+    /// @brief fixed layout of the IpcBinaryMessage; used for the port requests when RouDi and the runtime agreed on
+    /// it with the registration
+    BINARY
+};
+
 /// @brief Converts a string to the message type enumeration
 /// @param[in] str string to convert
 IpcMessageType stringToIpcMessageType(const char* str) noexcept;
@@ -138,6 +149,7 @@ std::string IpcMessageErrorTypeToString(const IpcMessageErrorType msg) noexcept;
 
 class IpcInterfaceUser;
 class IpcInterfaceCreator;
+class IpcBinaryMessage;
 
 /// @brief Class should never be used by the end-user.
 ///     Handles the common properties and methods for the IpcChannelType. The handling of
@@ -169,6 +181,27 @@ class IpcInterface
     ///         It also returns false if clock_gettime() failed
     bool timedReceive(const units::Duration timeout, IpcMessage& answer) const noexcept;
 
+    /// @brief Receives a binary message from the IPC channel and stores it in answer.
+    /// @param[out] answer If a message is received it is stored there.
+    /// @return If the call failed or the received message was not a valid binary message it returns false,
+    ///             otherwise true.
+    bool receive(IpcBinaryMessage& answer) const noexcept;
+
+    /// @brief Tries to receive a binary message from the IPC channel within a specified timeout.
+    /// @param[in] timeout for receiving a message.
+    /// @param[out] answer The answer of the IPC channel. If timedReceive failed the answer is invalid.
+    /// @return If a valid binary message was received before the timeout occurs it returns true, otherwise false.
+    bool timedReceive(const units::Duration timeout, IpcBinaryMessage& answer) const noexcept;
+
+    /// @brief Tries to receive a message of either protocol from the IPC channel within a specified timeout.
+    /// @param[in] timeout for receiving a message.
+    /// @param[out] answer stores a received text message
+    /// @param[out] binaryAnswer stores a received binary message
+    /// @return the protocol of the valid message which was received before the timeout occurred, otherwise
+    ///             nullopt
+    optional<IpcProtocol>
+    timedReceive(const units::Duration timeout, IpcMessage& answer, IpcBinaryMessage& binaryAnswer) const noexcept;
+
     /// @brief Tries to send the message specified in msg.
     /// @param[in] msg Must be a valid message, if its an invalid message
     ///                 send will return false
@@ -185,6 +218,17 @@ class IpcInterface
     ///             otherwise if the message was invalid it will return false.
     bool timedSend(const IpcMessage& msg, const units::Duration timeout) const noexcept;
 
+    /// @brief Tries to send the binary message specified in msg.
+    /// @param[in] msg Must be a valid message, if its an invalid message send will return false
+    /// @return If a valid message was send it returns true, otherwise false.
+    bool send(const IpcBinaryMessage& msg) const noexcept;
+
+    /// @brief Tries to send the binary message specified in msg within a specified timeout.
+    /// @param[in] msg Must be a valid message, if its an invalid message send will return false
+    /// @param[in] timeout specifies the duration to wait for sending.
+    /// @return If a valid message was send it returns true, otherwise false.
+    bool timedSend(const IpcBinaryMessage& msg, const units::Duration timeout) const noexcept;
+
     /// @brief Returns the interface name, the unique char string which
     ///         explicitly identifies the IPC channel.
     /// @return name of the IPC channel
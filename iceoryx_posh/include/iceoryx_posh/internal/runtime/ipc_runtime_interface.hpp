@@ -44,20 +44,30 @@ class IpcRuntimeInterface
     IpcRuntimeInterface(IpcRuntimeInterface&&) = delete;
     IpcRuntimeInterface& operator=(IpcRuntimeInterface&&) = delete;
 
-    /// @brief sends the keep alive trigger to the RouDi daemon
-    /// @return true if sending was successful, false if not
-    bool sendKeepalive() noexcept;
-
     /// @brief send a request to the RouDi daemon
     /// @param[in] msg request to RouDi
     /// @param[out] answer response from RouDi
     /// @return true if communication was successful, false if not
     bool sendRequestToRouDi(const IpcMessage& msg, IpcMessage& answer) noexcept;
 
+    /// @brief send a binary request to the RouDi daemon; must only be used with IpcProtocol::BINARY
+    /// @param[in] msg request to RouDi
+    /// @param[out] answer response from RouDi
+    /// @return true if communication was successful, false if not
+    bool sendRequestToRouDi(const IpcBinaryMessage& msg, IpcBinaryMessage& answer) noexcept;
+
+    /// @brief get the protocol which was negotiated with RouDi during the registration
+    /// @return IpcProtocol::BINARY if RouDi supports the same binary protocol version, otherwise IpcProtocol::TEXT
+    IpcProtocol getIpcProtocol() const noexcept;
+
     /// @brief get the adress offset of the segment manager
     /// @return address offset as iox::RelativePointer::offset_t
     UntypedRelativePointer::offset_t getSegmentManagerAddressOffset() const noexcept;
 
+    /// @brief get the adress offset of the heartbeat in the management segment
+    /// @return address offset as iox::RelativePointer::offset_t, nullopt if the process is not monitored by RouDi
+    optional<UntypedRelativePointer::offset_t> getHeartbeatAddressOffset() const noexcept;
+
     /// @brief get the size of the management shared memory object
     /// @return size in bytes
     size_t getShmTopicSize() noexcept;
@@ -84,7 +94,8 @@ class IpcRuntimeInterface
     IpcInterfaceUser m_RoudiIpcInterface;
     uint64_t m_shmTopicSize{0U};
     uint64_t m_segmentId{0U};
-    bool m_sendKeepalive = true;
+    optional<UntypedRelativePointer::offset_t> m_heartbeatAddressOffset;
+    IpcProtocol m_ipcProtocol{IpcProtocol::TEXT};
 };
 
 } // namespace runtime
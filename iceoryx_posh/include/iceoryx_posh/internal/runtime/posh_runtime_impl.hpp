@@ -19,6 +19,7 @@
 
 #include "iceoryx_hoofs/internal/concurrent/periodic_task.hpp"
 #include "iceoryx_hoofs/internal/posix_wrapper/mutex.hpp"
+#include "iceoryx_posh/internal/runtime/heartbeat.hpp"
 #include "iceoryx_posh/internal/runtime/shared_memory_user.hpp"
 #include "iceoryx_posh/runtime/posh_runtime.hpp"
 #include "iox/function.hpp"
@@ -104,10 +105,30 @@ class PoshRuntimeImpl : public PoshRuntime
     expected<popo::ConditionVariableData*, IpcMessageErrorType>
     requestConditionVariableFromRoudi(const IpcMessage& sendBuffer) noexcept;
 
+    /// @brief Requests a port or a condition variable with the binary protocol
+    /// @param[in] request the binary request to RouDi
+    /// @param[in] expectedAck the type of the response containing the relative pointer to the created object
+    /// @param[in] invalidResponseError the error when the communication with RouDi failed
+    /// @param[in] wrongResponseError the error when RouDi sent an unexpected response
+    /// @return pointer to the created object or the error sent by RouDi
+    template <typename T>
+    expected<T*, IpcMessageErrorType> requestFromRoudi(const IpcBinaryMessage& request,
+                                                       const IpcMessageType expectedAck,
+                                                       const IpcMessageErrorType invalidResponseError,
+                                                       const IpcMessageErrorType wrongResponseError) noexcept;
+
+    bool sendRequestToRouDi(const IpcBinaryMessage& msg, IpcBinaryMessage& answer) noexcept;
+
+    /// @brief Checks if the node name of a port can be transferred with every IPC protocol
+    /// @return true if the node name is valid, otherwise false and an error is logged
+    static bool isValidNodeName(const NodeName_t& nodeName) noexcept;
+
     mutable posix::mutex m_appIpcRequestMutex{false};
 
     IpcRuntimeInterface m_ipcChannelInterface;
     optional<SharedMemoryUser> m_ShmInterface;
+    // the heartbeat in the management segment; nullptr if the process is not monitored by RouDi
+    Heartbeat* m_heartbeat{nullptr};
 
     void sendKeepAliveAndHandleShutdownPreparation() noexcept;
     static_assert(PROCESS_KEEP_ALIVE_INTERVAL > roudi::DISCOVERY_INTERVAL, "Keep alive interval too small");
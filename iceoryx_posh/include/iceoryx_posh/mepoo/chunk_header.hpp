@@ -60,7 +60,7 @@ struct ChunkHeader
     ///            - data width of members changes
     ///            - members are rearranged
     ///            - semantic meaning of a member changes
-    static constexpr uint8_t CHUNK_HEADER_VERSION{1U};
+    static constexpr uint8_t CHUNK_HEADER_VERSION{2U};
 
     /// @brief User-Header id for no user-header
     static constexpr uint16_t NO_USER_HEADER{0x0000};
@@ -139,6 +139,10 @@ struct ChunkHeader
     /// @brief the serquence number of the chunk
     uint64_t sequenceNumber() const noexcept;
 
+    /// @brief The time the chunk was sent as nanoseconds since the epoch of mepoo::BaseClock_t
+    /// @return the send timestamp of the chunk or 0 if it was not sent by a publisher
+    uint64_t sendTimestamp() const noexcept;
+
   private:
     template <typename T>
     friend class popo::ChunkSender;
@@ -147,6 +151,8 @@ struct ChunkHeader
 
     void setSequenceNumber(const uint64_t sequenceNumber) noexcept;
 
+    void setSendTimestamp(const uint64_t sendTimestamp) noexcept;
+
     uint64_t overflowSafeUsedSizeOfChunk() const noexcept;
 
   private:
@@ -164,6 +170,7 @@ struct ChunkHeader
     uint16_t m_userHeaderId{NO_USER_HEADER};
     popo::UniquePortId m_originId{popo::InvalidPortId};
     uint64_t m_sequenceNumber{0U};
+    uint64_t m_sendTimestamp{0U};
     uint32_t m_userHeaderSize{0U};
     uint32_t m_userPayloadSize{0U};
     uint32_t m_userPayloadAlignment{1U};
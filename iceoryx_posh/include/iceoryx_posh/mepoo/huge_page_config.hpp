@@ -0,0 +1,50 @@
+// Copyright (c) 2026 by agent <agent@local>. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_MEPOO_HUGE_PAGE_CONFIG_HPP
+#define IOX_POSH_MEPOO_HUGE_PAGE_CONFIG_HPP
+
+#include "iox/path.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace mepoo
+{
+/// @brief Describes a hugetlbfs mount point which is used to back a shared memory with huge pages. The shared memory
+/// is created as file in the mount point and can therefore still be opened by name by the applications.
+struct HugePageConfig
+{
+    static constexpr uint64_t DEFAULT_PAGE_SIZE{2U * 1024U * 1024U};
+
+    /// @brief creates a HugePageConfig
+    /// @param[in] mountPoint the directory where a hugetlbfs is mounted
+    /// @param[in] pageSize the huge page size of the mount point
+    explicit HugePageConfig(const Path& mountPoint, const uint64_t pageSize = DEFAULT_PAGE_SIZE) noexcept
+        : m_mountPoint(mountPoint)
+        , m_pageSize(pageSize)
+    {
+    }
+
+    /// @brief the directory where a hugetlbfs is mounted, e.g. '/dev/hugepages'
+    Path m_mountPoint;
+    /// @brief the huge page size of the mount point; the size of the shared memory is rounded up to a multiple of it
+    uint64_t m_pageSize{DEFAULT_PAGE_SIZE};
+};
+} // namespace mepoo
+} // namespace iox
+
+#endif // IOX_POSH_MEPOO_HUGE_PAGE_CONFIG_HPP
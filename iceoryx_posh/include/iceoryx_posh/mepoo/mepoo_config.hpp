@@ -29,6 +29,22 @@ class PortManager;
 }
 namespace mepoo
 {
+/// @brief Defines from which mempool a chunk is acquired when the best fitting mempool is out of chunks
+enum class MemPoolAllocationPolicy : uint8_t
+{
+    /// @brief only the smallest mempool which fits the requested chunk size is used
+    STRICT_BEST_FIT,
+    /// @brief if the best fitting mempool is out of chunks, the next larger mempool is used
+    SPILL_TO_NEXT_LARGER,
+    /// @brief if the best fitting mempool is out of chunks, all larger mempools are tried in increasing order
+    SPILL_TO_ANY_LARGER,
+};
+
+/// @brief Converts the MemPoolAllocationPolicy to a string literal
+/// @param[in] value to convert to a string literal
+/// @return pointer to a string literal
+constexpr const char* asStringLiteral(const MemPoolAllocationPolicy value) noexcept;
+
 struct MePooConfig
 {
   public:
@@ -46,6 +62,8 @@ struct MePooConfig
 
     using MePooConfigContainerType = vector<Entry, MAX_NUMBER_OF_MEMPOOLS>;
     MePooConfigContainerType m_mempoolConfig;
+    MemPoolAllocationPolicy m_allocationPolicy{MemPoolAllocationPolicy::STRICT_BEST_FIT};
+    uint32_t m_chunkCacheCapacity{0U};
 
     /// @brief Default constructor to set the configuration for memory pools
     MePooConfig() noexcept = default;
@@ -63,8 +81,32 @@ struct MePooConfig
 
     /// @brief Function for optimizing the size of memory pool according to new entry
     MePooConfig& optimize() noexcept;
+
+    /// @brief Sets the policy which is used when the best fitting mempool is out of chunks
+    /// @param[in] allocationPolicy the policy to use
+    MePooConfig& setAllocationPolicy(const MemPoolAllocationPolicy allocationPolicy) noexcept;
+
+    /// @brief Enables the per-thread chunk caches in front of the free-lists of the mempools; each cache slot holds up
+    /// to the given number of free chunks which are acquired from and released to the free-list in batches
+    /// @param[in] chunkCacheCapacity the number of free chunks per cache slot; 0 disables the chunk caches
+    MePooConfig& setChunkCacheCapacity(const uint32_t chunkCacheCapacity) noexcept;
 };
 
+constexpr const char* asStringLiteral(const MemPoolAllocationPolicy value) noexcept
+{
+    switch (value)
+    {
+    case MemPoolAllocationPolicy::STRICT_BEST_FIT:
+        return "MemPoolAllocationPolicy::STRICT_BEST_FIT";
+    case MemPoolAllocationPolicy::SPILL_TO_NEXT_LARGER:
+        return "MemPoolAllocationPolicy::SPILL_TO_NEXT_LARGER";
+    case MemPoolAllocationPolicy::SPILL_TO_ANY_LARGER:
+        return "MemPoolAllocationPolicy::SPILL_TO_ANY_LARGER";
+    }
+
+    return "[Undefined MemPoolAllocationPolicy]";
+}
+
 } // namespace mepoo
 } // namespace iox
 
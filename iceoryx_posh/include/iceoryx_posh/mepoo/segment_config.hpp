@@ -16,11 +16,13 @@
 #ifndef IOX_POSH_MEPOO_SEGMENT_CONFIG_HPP
 #define IOX_POSH_MEPOO_SEGMENT_CONFIG_HPP
 
+#include "iceoryx_posh/mepoo/huge_page_config.hpp"
 #include "iceoryx_posh/mepoo/memory_info.hpp"
 #include "iceoryx_posh/mepoo/mepoo_config.hpp"
 
 #include "iceoryx_hoofs/posix_wrapper/posix_access_rights.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iox/optional.hpp"
 #include "iox/vector.hpp"
 
 namespace iox
@@ -34,11 +36,15 @@ struct SegmentConfig
         SegmentEntry(const posix::PosixGroup::groupName_t& readerGroup,
                      const posix::PosixGroup::groupName_t& writerGroup,
                      const MePooConfig& memPoolConfig,
-                     iox::mepoo::MemoryInfo memoryInfo = iox::mepoo::MemoryInfo()) noexcept
+                     iox::mepoo::MemoryInfo memoryInfo = iox::mepoo::MemoryInfo(),
+                     const optional<HugePageConfig>& hugePageConfig = nullopt,
+                     const optional<uint32_t>& numaNode = nullopt) noexcept
             : m_readerGroup(readerGroup)
             , m_writerGroup(writerGroup)
             , m_mempoolConfig(memPoolConfig)
             , m_memoryInfo(memoryInfo)
+            , m_hugePageConfig(hugePageConfig)
+            , m_numaNode(numaNode)
 
         {
         }
@@ -47,6 +53,10 @@ struct SegmentConfig
         posix::PosixGroup::groupName_t m_writerGroup;
         MePooConfig m_mempoolConfig;
         iox::mepoo::MemoryInfo m_memoryInfo;
+        /// @brief if set, the segment is backed by huge pages of the given hugetlbfs mount point
+        optional<HugePageConfig> m_hugePageConfig;
+        /// @brief if set, the memory of the segment is bound to the given NUMA node
+        optional<uint32_t> m_numaNode;
     };
 
     vector<SegmentEntry, MAX_SHM_SEGMENTS> m_sharedMemorySegments;
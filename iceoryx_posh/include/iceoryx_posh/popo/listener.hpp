@@ -17,8 +17,12 @@
 #ifndef IOX_POSH_POPO_LISTENER_HPP
 #define IOX_POSH_POPO_LISTENER_HPP
 
+#include "iceoryx_hoofs/concurrent/lockfree_queue.hpp"
 #include "iceoryx_hoofs/internal/concurrent/loffli.hpp"
 #include "iceoryx_hoofs/internal/concurrent/smart_lock.hpp"
+#include "iceoryx_hoofs/posix_wrapper/thread.hpp"
+#include "iceoryx_hoofs/posix_wrapper/unnamed_semaphore.hpp"
+#include "iceoryx_posh/error_handling/error_handling.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/condition_listener.hpp"
 #include "iceoryx_posh/popo/enum_trigger_type.hpp"
 #include "iceoryx_posh/popo/notification_attorney.hpp"
@@ -27,6 +31,8 @@
 #include "iceoryx_posh/runtime/posh_runtime.hpp"
 #include "iox/expected.hpp"
 #include "iox/function.hpp"
+#include "iox/optional.hpp"
+#include "iox/vector.hpp"
 
 #include <thread>
 
@@ -167,13 +173,27 @@ class ListenerImpl
     /// @return size of the Listener
     uint64_t size() const noexcept;
 
+    /// @brief Returns the number of worker threads which execute the callbacks
+    /// @return number of worker threads, 0 if the callbacks are executed by the thread which waits for the events
+    uint64_t numberOfWorkerThreads() const noexcept;
+
   protected:
     ListenerImpl(ConditionVariableData& conditionVariableData) noexcept;
 
+    /// @brief Creates a Listener which executes the callbacks in a pool of worker threads
+    /// @param[in] conditionVariableData the condition variable on which the events are signaled
+    /// @param[in] numberOfWorkerThreads number of worker threads, it is limited to
+    ///            MAX_NUMBER_OF_WORKER_THREADS_PER_LISTENER. With 0 the callbacks are executed by the thread which
+    ///            waits for the events.
+    ListenerImpl(ConditionVariableData& conditionVariableData, const uint64_t numberOfWorkerThreads) noexcept;
+
   private:
     class Event_t;
 
     void threadLoop() noexcept;
+    void workerLoop() noexcept;
+    void scheduleExecution(const uint64_t eventId) noexcept;
+    void executeScheduledEvent(const uint64_t eventId) noexcept;
     expected<uint32_t, ListenerError> addEvent(void* const origin,
                                                void* const userType,
                                                const uint64_t eventType,
@@ -213,6 +233,13 @@ class ListenerImpl
     std::atomic_bool m_wasDtorCalled{false};
     ConditionVariableData* m_conditionVariableData = nullptr;
     ConditionListener m_conditionListener;
+
+    /// @brief the number of notifications of an event which were not yet handled by a worker; an event is only
+    /// scheduled when its counter leaves zero, therefore its callbacks are never executed concurrently
+    std::atomic<uint64_t> m_pendingExecutions[Capacity];
+    concurrent::LockFreeQueue<uint32_t, Capacity> m_scheduledEvents;
+    optional<posix::UnnamedSemaphore> m_workerSemaphore;
+    vector<std::thread, MAX_NUMBER_OF_WORKER_THREADS_PER_LISTENER> m_workerThreads;
 };
 
 class Listener : public ListenerImpl<MAX_NUMBER_OF_EVENTS_PER_LISTENER>
@@ -225,6 +252,25 @@ class Listener : public ListenerImpl<MAX_NUMBER_OF_EVENTS_PER_LISTENER>
     Listener(ConditionVariableData& conditionVariableData) noexcept;
 };
 
+/// @brief The MultiThreadedListener is a Listener which executes the callbacks in a pool of worker threads.
+///        The callbacks of different events are executed concurrently, therefore a slow callback does not delay
+///        the other events. The callbacks of one event are never executed concurrently.
+/// @note  Notifications which arrive while the callback of the same event is still pending are handled by one
+///        additional callback call, like for the Listener.
+class MultiThreadedListener : public ListenerImpl<MAX_NUMBER_OF_EVENTS_PER_LISTENER>
+{
+  public:
+    using Parent = ListenerImpl<MAX_NUMBER_OF_EVENTS_PER_LISTENER>;
+
+    /// @brief Creates a MultiThreadedListener
+    /// @param[in] numberOfWorkerThreads number of worker threads which execute the callbacks, it is limited to
+    ///            MAX_NUMBER_OF_WORKER_THREADS_PER_LISTENER
+    explicit MultiThreadedListener(const uint64_t numberOfWorkerThreads) noexcept;
+
+  protected:
+    MultiThreadedListener(ConditionVariableData& conditionVariableData, const uint64_t numberOfWorkerThreads) noexcept;
+};
+
 } // namespace popo
 } // namespace iox
 
@@ -44,6 +44,16 @@ struct PublisherOptions
     /// @brief The option whether the publisher should block when the subscriber queue is full
     ConsumerTooSlowPolicy subscriberTooSlowPolicy{ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA};
 
+    /// @brief The option whether the subscribers are notified after the sample was delivered to all of them instead
+    /// of after each single delivery; reduces the wake-ups when many subscribers are attached to the same
+    /// WaitSet or Listener
+    bool batchSubscriberNotifications{false};
+
+    /// @brief The number of previously sent chunks which are kept for reuse by the next loans once all subscribers
+    /// released them; reduces the mempool accesses when alternating between a few payload sizes or holding multiple
+    /// loans, at the cost of keeping up to this number of additional chunks of the mempools
+    uint32_t recycledChunkCapacity{0U};
+
     /// @brief serialization of the PublisherOptions
     cxx::Serialization serialize() const noexcept;
     /// @brief deserialization of the PublisherOptions
@@ -0,0 +1,134 @@
+// Copyright (c) 2026 by agent <agent@local>. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_POPO_SERVER_WORKER_POOL_HPP
+#define IOX_POSH_POPO_SERVER_WORKER_POOL_HPP
+
+#include "iceoryx_hoofs/posix_wrapper/thread.hpp"
+#include "iceoryx_hoofs/posix_wrapper/unnamed_semaphore.hpp"
+#include "iceoryx_posh/capro/service_description.hpp"
+#include "iceoryx_posh/error_handling/error_handling.hpp"
+#include "iceoryx_posh/internal/popo/base_server.hpp"
+#include "iceoryx_posh/internal/popo/ports/concurrent_server_port_user.hpp"
+#include "iceoryx_posh/internal/popo/server_impl.hpp"
+#include "iceoryx_posh/popo/listener.hpp"
+#include "iceoryx_posh/popo/server_options.hpp"
+#include "iox/function.hpp"
+#include "iox/optional.hpp"
+#include "iox/vector.hpp"
+
+#include <atomic>
+#include <thread>
+
+namespace iox
+{
+namespace popo
+{
+/// @brief This struct is used to configure the ServerWorkerPool
+struct ServerWorkerPoolOptions
+{
+    /// @brief The number of worker threads which process the requests
+    uint64_t numberOfWorkerThreads{1U};
+
+    /// @brief The number of requests a worker takes from the request queue before it processes them; more requests
+    /// per worker reduce the accesses to the shared request queue but can delay a request while other workers are
+    /// idle
+    /// @note The requests of all workers are limited to MAX_REQUESTS_PROCESSED_SIMULTANEOUSLY
+    uint64_t inFlightRequestsPerWorker{1U};
+
+    /// @brief The options of the underlying server
+    ServerOptions serverOptions;
+};
+
+/// @brief The ServerWorkerPool is a server whose requests are processed by a pool of worker threads. All workers take
+/// the requests from the same request queue, therefore one service scales across multiple cores without the need to
+/// split it into multiple servers. A Listener thread wakes up an idle worker when requests arrive and a worker which
+/// leaves requests in the queue wakes up the next idle worker.
+/// @param[in] Req type of request data
+/// @param[in] Res type of response data, must be default constructible
+/// @note The handler is called concurrently by all workers, the order of the responses can therefore differ from the
+/// order of the requests
+template <typename Req, typename Res>
+class ServerWorkerPool
+{
+  public:
+    /// @brief The handler which creates the response to a request
+    using RequestHandler_t = function<void(const Req&, Res&)>;
+
+    /// @brief Creates a ServerWorkerPool
+    /// @param[in] service is the ServiceDescription for the server
+    /// @param[in] requestHandler is called by the workers for every request
+    /// @param[in] options like the number of worker threads; the number of workers and the in-flight requests per
+    /// worker are reduced when they would exceed MAX_REQUESTS_PROCESSED_SIMULTANEOUSLY
+    ServerWorkerPool(const capro::ServiceDescription& service,
+                     const RequestHandler_t& requestHandler,
+                     const ServerWorkerPoolOptions& options = {}) noexcept;
+    ~ServerWorkerPool() noexcept;
+
+    ServerWorkerPool(const ServerWorkerPool&) = delete;
+    ServerWorkerPool(ServerWorkerPool&&) = delete;
+    ServerWorkerPool& operator=(const ServerWorkerPool&) = delete;
+    ServerWorkerPool& operator=(ServerWorkerPool&&) = delete;
+
+    /// @brief Offer the service to be connected to when not already offering, otherwise nothing
+    void offer() noexcept;
+
+    /// @brief Stop offering the service when already offering, otherwise nothing
+    void stopOffer() noexcept;
+
+    /// @brief Check if the server is offering
+    /// @return True if service is currently being offered
+    bool isOffered() const noexcept;
+
+    /// @brief Check if the server has clients
+    /// @return True if currently has clients
+    bool hasClients() const noexcept;
+
+    /// @brief Returns the number of worker threads which process the requests
+    /// @return number of worker threads
+    uint64_t numberOfWorkerThreads() const noexcept;
+
+    /// @brief Returns the number of requests a worker takes from the request queue before processing them
+    /// @return in-flight requests per worker
+    uint64_t inFlightRequestsPerWorker() const noexcept;
+
+  private:
+    using Server_t = ServerImpl<Req, Res, BaseServer<ConcurrentServerPortUser>>;
+
+    static void onRequestReceived(Server_t* const server, ServerWorkerPool* const self);
+    void workerLoop() noexcept;
+    bool processRequests() noexcept;
+    void wakeUpIdleWorker() noexcept;
+    bool tryClaimIdleWorker() noexcept;
+    void waitForWakeUp() noexcept;
+
+  private:
+    RequestHandler_t m_requestHandler;
+    uint64_t m_inFlightRequestsPerWorker{1U};
+    Server_t m_server;
+    optional<posix::UnnamedSemaphore> m_workerSemaphore;
+    /// @brief the number of workers which wait or are about to wait for the semaphore and were not yet woken up
+    std::atomic<uint64_t> m_numberOfIdleWorkers{0U};
+    std::atomic_bool m_keepRunning{true};
+    vector<std::thread, MAX_REQUESTS_PROCESSED_SIMULTANEOUSLY> m_workerThreads;
+    Listener m_listener;
+};
+
+} // namespace popo
+} // namespace iox
+
+#include "iceoryx_posh/internal/popo/server_worker_pool.inl"
+
+#endif // IOX_POSH_POPO_SERVER_WORKER_POOL_HPP
@@ -51,6 +51,12 @@ struct SubscriberOptions
     ///        i.e. require historyCapacity > 0 to be eligible to be connected
     bool requiresPublisherHistorySupport{false};
 
+    /// @brief The option whether the end-to-end latency of the received samples is recorded in a histogram which is
+    /// published by the port introspection
+    /// @note At most MAX_LATENCY_HISTOGRAMS subscribers record the latency at the same time, further subscribers are
+    /// created without a histogram
+    bool recordLatencyHistogram{false};
+
     /// @brief serialization of the SubscriberOptions
     cxx::Serialization serialize() const noexcept;
     /// @brief deserialization of the SubscriberOptions
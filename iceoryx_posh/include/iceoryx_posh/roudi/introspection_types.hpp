@@ -41,6 +41,8 @@ struct MemPoolInfo
     uint32_t m_numChunks{0};
     uint32_t m_chunkSize{0};
     uint32_t m_chunkPayloadSize{0};
+    /// @brief number of chunk requests which were served by a larger mempool since this one was out of chunks
+    uint32_t m_spilledChunks{0};
 };
 
 /// @brief container for MemPoolInfo structs of all available mempools.
@@ -100,6 +102,20 @@ struct PortThroughputData
     double m_chunksPerMinute{0};
     uint64_t m_lastSendIntervalInNanoseconds{0};
     bool m_isField{false};
+    /// @brief number of loans which reused a previously sent chunk
+    uint64_t m_recycledChunkHits{0};
+    /// @brief number of loans which required a new chunk from the mempool; both counters stay 0 if the publisher does
+    /// not recycle chunks
+    uint64_t m_recycledChunkMisses{0};
+    /// @brief number of chunks sent since the publisher was created
+    uint64_t m_sentChunks{0};
+    /// @brief number of user-payload bytes sent since the publisher was created
+    uint64_t m_sentBytes{0};
+    /// @brief user-payload bytes per second since the previous throughput sample
+    double m_bytesPerSecond{0};
+    uint64_t m_averageSendIntervalInNanoseconds{0};
+    /// @brief number of deliveries which were dropped since a subscriber queue was full
+    uint64_t m_lostChunks{0};
 };
 
 /// @brief the topic for the port throughput that a user can subscribe to
@@ -118,6 +134,15 @@ struct SubscriberPortChangingData
     uint64_t fifoCapacity{0};
     iox::SubscribeState subscriptionState{iox::SubscribeState::NOT_SUBSCRIBED};
     capro::Scope propagationScope{capro::Scope::INVALID};
+    uint64_t receivedChunks{0};
+    /// @brief number of chunks which were dropped since the queue was full
+    uint64_t lostChunks{0};
+    /// @brief number of samples in the end-to-end latency histogram; zero if the subscriber does not record it
+    uint64_t latencySamples{0};
+    /// @brief the percentiles of the end-to-end latency from sending to taking a chunk
+    uint64_t latencyP50InNanoseconds{0};
+    uint64_t latencyP99InNanoseconds{0};
+    uint64_t latencyP999InNanoseconds{0};
 };
 
 struct SubscriberPortChangingIntrospectionFieldTopic
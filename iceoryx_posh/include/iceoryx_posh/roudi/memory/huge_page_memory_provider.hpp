@@ -0,0 +1,84 @@
+// Copyright (c) 2026 by agent <agent@local>. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_ROUDI_MEMORY_HUGE_PAGE_MEMORY_PROVIDER_HPP
+#define IOX_POSH_ROUDI_MEMORY_HUGE_PAGE_MEMORY_PROVIDER_HPP
+
+#include "iceoryx_posh/roudi/memory/memory_provider.hpp"
+
+#include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object.hpp"
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/mepoo/huge_page_config.hpp"
+#include "iox/expected.hpp"
+#include "iox/filesystem.hpp"
+#include "iox/optional.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace roudi
+{
+/// @brief Creates a shared memory which is backed by huge pages. The shared memory is created as file in the mount point
+/// of a hugetlbfs in order to be accessible by name like a POSIX shared memory. Instead of zeroing the whole memory,
+/// only one byte per huge page is written to prefault the pages.
+class HugePageMemoryProvider : public MemoryProvider
+{
+  public:
+    /// @brief Constructs a HugePageMemoryProvider which can be used to request memory via MemoryBlocks
+    /// @param [in] shmName is the name of the file in the hugetlbfs mount point
+    /// @param [in] hugePageConfig is the hugetlbfs mount point and its huge page size
+    /// @param [in] accessMode defines the read and write access to the memory
+    /// @param [in] openMode defines the creation/open mode of the shared memory
+    /// @param [in] numaNode if set, the memory is bound to this NUMA node before it is prefaulted
+    HugePageMemoryProvider(const ShmName_t& shmName,
+                           const mepoo::HugePageConfig& hugePageConfig,
+                           const posix::AccessMode accessMode,
+                           const posix::OpenMode openMode,
+                           const optional<uint32_t>& numaNode = nullopt) noexcept;
+    ~HugePageMemoryProvider() noexcept;
+
+    HugePageMemoryProvider(HugePageMemoryProvider&&) = delete;
+    HugePageMemoryProvider& operator=(HugePageMemoryProvider&&) = delete;
+
+    HugePageMemoryProvider(const HugePageMemoryProvider&) = delete;
+    HugePageMemoryProvider& operator=(const HugePageMemoryProvider&) = delete;
+
+  protected:
+    /// @copydoc MemoryProvider::createMemory
+    /// @note This creates and maps a file in the hugetlbfs mount point; the size is rounded up to a multiple of the huge
+    /// page size
+    expected<void*, MemoryProviderError> createMemory(const uint64_t size, const uint64_t alignment) noexcept;
+
+    /// @copydoc MemoryProvider::destroyMemory
+    /// @note This unmaps and removes the file in the hugetlbfs mount point
+    expected<MemoryProviderError> destroyMemory() noexcept;
+
+  private:
+    ShmName_t m_shmName;
+    mepoo::HugePageConfig m_hugePageConfig;
+    posix::AccessMode m_accessMode{posix::AccessMode::READ_ONLY};
+    posix::OpenMode m_openMode{posix::OpenMode::OPEN_EXISTING};
+    optional<uint32_t> m_numaNode;
+    optional<posix::SharedMemoryObject> m_shmObject;
+
+    static constexpr access_rights SHM_MEMORY_PERMISSIONS =
+        perms::owner_read | perms::owner_write | perms::group_read | perms::group_write;
+};
+
+} // namespace roudi
+} // namespace iox
+
+#endif // IOX_POSH_ROUDI_MEMORY_HUGE_PAGE_MEMORY_PROVIDER_HPP
@@ -28,6 +28,7 @@
 #include "iceoryx_posh/internal/popo/ports/subscriber_port_multi_producer.hpp"
 #include "iceoryx_posh/internal/popo/ports/subscriber_port_single_producer.hpp"
 #include "iceoryx_posh/internal/roudi/port_pool_data.hpp"
+#include "iceoryx_posh/internal/runtime/heartbeat.hpp"
 #include "iceoryx_posh/internal/runtime/node_data.hpp"
 #include "iceoryx_posh/popo/client_options.hpp"
 #include "iceoryx_posh/popo/publisher_options.hpp"
@@ -35,6 +36,9 @@
 #include "iceoryx_posh/popo/subscriber_options.hpp"
 #include "iox/type_traits.hpp"
 
+#include <unordered_map>
+#include <vector>
+
 namespace iox
 {
 namespace roudi
@@ -54,6 +58,7 @@ enum class PortPoolError : uint8_t
     NODE_DATA_LIST_FULL,
     CONDITION_VARIABLE_LIST_FULL,
     EVENT_VARIABLE_LIST_FULL,
+    HEARTBEAT_LIST_FULL,
 };
 
 class PortPool
@@ -70,6 +75,37 @@ class PortPool
     vector<popo::InterfacePortData*, MAX_INTERFACE_NUMBER> getInterfacePortDataList() noexcept;
     vector<runtime::NodeData*, MAX_NODE_NUMBER> getNodeDataList() noexcept;
     vector<popo::ConditionVariableData*, MAX_NUMBER_OF_CONDITION_VARIABLES> getConditionVariableDataList() noexcept;
+    vector<runtime::Heartbeat*, MAX_PROCESS_NUMBER> getHeartbeatList() noexcept;
+
+    /// @brief Returns the publisher ports with a service description which is equal to the provided one
+    /// @param[in] service description of the requested publisher ports
+    /// @return the matching publisher ports in the order of their creation
+    /// @note the ports are looked up in an index and not searched in the whole port pool
+    vector<PublisherPortRouDiType::MemberType_t*, MAX_PUBLISHERS>
+    getPublisherPortDataList(const capro::ServiceDescription& service) noexcept;
+
+    /// @brief Returns the subscriber ports with a service description which is equal to the provided one
+    /// @param[in] service description of the requested subscriber ports
+    /// @return the matching subscriber ports in the order of their creation
+    /// @note the ports are looked up in an index and not searched in the whole port pool
+    vector<SubscriberPortType::MemberType_t*, MAX_SUBSCRIBERS>
+    getSubscriberPortDataList(const capro::ServiceDescription& service) noexcept;
+
+    /// @brief Returns the DiscoveryTrigger which is notified by the ports, nodes and condition variables of the pool
+    /// when they have pending requests for the discovery
+    /// @return reference to the DiscoveryTrigger in the management segment
+    popo::DiscoveryTrigger& getDiscoveryTrigger() noexcept;
+
+    /// @brief Returns the data at a position of the internal pool, see DiscoveryTrigger::collectDirtyEntries
+    /// @param[in] position of the data in the internal pool
+    /// @return pointer to the data or nullptr if the position is empty
+    PublisherPortRouDiType::MemberType_t* getPublisherPortData(const uint64_t position) noexcept;
+    SubscriberPortType::MemberType_t* getSubscriberPortData(const uint64_t position) noexcept;
+    popo::ClientPortData* getClientPortData(const uint64_t position) noexcept;
+    popo::ServerPortData* getServerPortData(const uint64_t position) noexcept;
+    popo::InterfacePortData* getInterfacePortData(const uint64_t position) noexcept;
+    runtime::NodeData* getNodeData(const uint64_t position) noexcept;
+    popo::ConditionVariableData* getConditionVariableData(const uint64_t position) noexcept;
 
     expected<PublisherPortRouDiType::MemberType_t*, PortPoolError>
     addPublisherPort(const capro::ServiceDescription& serviceDescription,
@@ -88,13 +124,15 @@ class PortPool
     iox::popo::SubscriberPortData* constructSubscriber(const capro::ServiceDescription& serviceDescription,
                                                        const RuntimeName_t& runtimeName,
                                                        const popo::SubscriberOptions& subscriberOptions,
-                                                       const mepoo::MemoryInfo& memoryInfo) noexcept;
+                                                       const mepoo::MemoryInfo& memoryInfo,
+                                                       popo::LatencyHistogram* const latencyHistogram) noexcept;
 
     template <typename T, std::enable_if_t<std::is_same<T, iox::build::OneToManyPolicy>::value>* = nullptr>
     iox::popo::SubscriberPortData* constructSubscriber(const capro::ServiceDescription& serviceDescription,
                                                        const RuntimeName_t& runtimeName,
                                                        const popo::SubscriberOptions& subscriberOptions,
-                                                       const mepoo::MemoryInfo& memoryInfo) noexcept;
+                                                       const mepoo::MemoryInfo& memoryInfo,
+                                                       popo::LatencyHistogram* const latencyHistogram) noexcept;
 
     /// @brief Adds a ClientPortData to the internal pool and returns a pointer for further usage
     /// @param[in] serviceDescription for the new client port
@@ -134,6 +172,11 @@ class PortPool
     expected<popo::ConditionVariableData*, PortPoolError>
     addConditionVariableData(const RuntimeName_t& runtimeName) noexcept;
 
+    /// @brief Adds a Heartbeat to the internal pool and returns a pointer for further usage
+    /// @param[in] runtimeName of the runtime the new heartbeat belongs to
+    /// @return on success a pointer to a Heartbeat; on error a PortPoolError
+    expected<runtime::Heartbeat*, PortPoolError> addHeartbeat(const RuntimeName_t& runtimeName) noexcept;
+
     /// @brief Removes a PublisherPortData from the internal pool
     /// @param[in] portData is a  pointer to the PublisherPortData to be removed
     /// @note after this call the provided PublisherPortData is no longer available for usage
@@ -169,8 +212,38 @@ class PortPool
     /// @note after this call the provided ConditionVariableData is no longer available for usage
     void removeConditionVariableData(const popo::ConditionVariableData* const conditionVariableData) noexcept;
 
+    /// @brief Removes a Heartbeat from the internal pool
+    /// @param[in] heartbeat is a pointer to the Heartbeat to be removed
+    /// @note after this call the provided Heartbeat is no longer available for usage
+    void removeHeartbeat(const runtime::Heartbeat* const heartbeat) noexcept;
+
   private:
+    /// @brief Maps the service descriptions to the ports with this service description
+    template <typename T>
+    using ServiceIndex_t = std::unordered_map<capro::ServiceDescription, std::vector<T*>, capro::ServiceDescriptionHash>;
+
+    template <typename T>
+    static void addToServiceIndex(ServiceIndex_t<T>& index, T* const portData) noexcept;
+
+    template <typename T>
+    static void removeFromServiceIndex(ServiceIndex_t<T>& index, const T* const portData) noexcept;
+
+    template <typename T, uint64_t Capacity>
+    static vector<T*, Capacity> lookUpInServiceIndex(const ServiceIndex_t<T>& index,
+                                                     const capro::ServiceDescription& service) noexcept;
+
+    /// @brief Attaches the DiscoveryNotifier of a new entry to the DiscoveryTrigger and marks the entry as dirty, so
+    /// that the next discovery processes it
+    template <typename T, uint64_t Capacity>
+    void attachToDiscovery(FixedPositionContainer<T, Capacity>& container,
+                           T* const entry,
+                           const popo::DiscoveryEntryKind kind) noexcept;
+
     PortPoolData* m_portPoolData;
+
+    /// @note the indices are only used by RouDi and are therefore located in the memory of the RouDi process
+    ServiceIndex_t<PublisherPortRouDiType::MemberType_t> m_publisherPortIndex;
+    ServiceIndex_t<SubscriberPortType::MemberType_t> m_subscriberPortIndex;
 };
 
 } // namespace roudi
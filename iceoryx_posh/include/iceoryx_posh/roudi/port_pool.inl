@@ -17,6 +17,8 @@
 #ifndef IOX_POSH_ROUDI_PORT_POOL_INL
 #define IOX_POSH_ROUDI_PORT_POOL_INL
 
+#include <algorithm>
+
 namespace iox
 {
 namespace roudi
@@ -25,7 +27,8 @@ template <typename T, std::enable_if_t<std::is_same<T, iox::build::ManyToManyPol
 inline iox::popo::SubscriberPortData* PortPool::constructSubscriber(const capro::ServiceDescription& serviceDescription,
                                                                     const RuntimeName_t& runtimeName,
                                                                     const popo::SubscriberOptions& subscriberOptions,
-                                                                    const mepoo::MemoryInfo& memoryInfo) noexcept
+                                                                    const mepoo::MemoryInfo& memoryInfo,
+                                                                    popo::LatencyHistogram* const latencyHistogram) noexcept
 {
     return m_portPoolData->m_subscriberPortMembers.insert(
         serviceDescription,
@@ -34,14 +37,16 @@ inline iox::popo::SubscriberPortData* PortPool::constructSubscriber(const capro:
             ? cxx::VariantQueueTypes::SoFi_MultiProducerSingleConsumer
             : cxx::VariantQueueTypes::FiFo_MultiProducerSingleConsumer,
         subscriberOptions,
-        memoryInfo);
+        memoryInfo,
+        latencyHistogram);
 }
 
 template <typename T, std::enable_if_t<std::is_same<T, iox::build::OneToManyPolicy>::value>*>
 inline iox::popo::SubscriberPortData* PortPool::constructSubscriber(const capro::ServiceDescription& serviceDescription,
                                                                     const RuntimeName_t& runtimeName,
                                                                     const popo::SubscriberOptions& subscriberOptions,
-                                                                    const mepoo::MemoryInfo& memoryInfo) noexcept
+                                                                    const mepoo::MemoryInfo& memoryInfo,
+                                                                    popo::LatencyHistogram* const latencyHistogram) noexcept
 {
     return m_portPoolData->m_subscriberPortMembers.insert(
         serviceDescription,
@@ -50,7 +55,58 @@ inline iox::popo::SubscriberPortData* PortPool::constructSubscriber(const capro:
             ? cxx::VariantQueueTypes::SoFi_SingleProducerSingleConsumer
             : cxx::VariantQueueTypes::FiFo_SingleProducerSingleConsumer,
         subscriberOptions,
-        memoryInfo);
+        memoryInfo,
+        latencyHistogram);
+}
+
+template <typename T, uint64_t Capacity>
+inline void PortPool::attachToDiscovery(FixedPositionContainer<T, Capacity>& container,
+                                        T* const entry,
+                                        const popo::DiscoveryEntryKind kind) noexcept
+{
+    entry->m_discoveryNotifier = popo::DiscoveryNotifier(
+        m_portPoolData->m_discoveryTrigger, popo::DiscoveryTrigger::toEntryIndex(kind, container.indexOf(entry)));
+    entry->m_discoveryNotifier.notify();
+}
+
+template <typename T>
+inline void PortPool::addToServiceIndex(ServiceIndex_t<T>& index, T* const portData) noexcept
+{
+    index[portData->m_serviceDescription].push_back(portData);
+}
+
+template <typename T>
+inline void PortPool::removeFromServiceIndex(ServiceIndex_t<T>& index, const T* const portData) noexcept
+{
+    auto entry = index.find(portData->m_serviceDescription);
+    if (entry == index.end())
+    {
+        return;
+    }
+
+    // the creation order is preserved since the matching ports are served in this order
+    auto& ports = entry->second;
+    ports.erase(std::remove(ports.begin(), ports.end(), portData), ports.end());
+    if (ports.empty())
+    {
+        index.erase(entry);
+    }
+}
+
+template <typename T, uint64_t Capacity>
+inline vector<T*, Capacity> PortPool::lookUpInServiceIndex(const ServiceIndex_t<T>& index,
+                                                           const capro::ServiceDescription& service) noexcept
+{
+    vector<T*, Capacity> matchingPorts;
+    auto entry = index.find(service);
+    if (entry != index.end())
+    {
+        for (auto port : entry->second)
+        {
+            matchingPorts.push_back(port);
+        }
+    }
+    return matchingPorts;
 }
 } // namespace roudi
 } // namespace iox
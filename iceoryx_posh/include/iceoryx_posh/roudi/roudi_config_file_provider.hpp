@@ -35,6 +35,9 @@ namespace roudi
 /// MAX_NUMBER_OF_MEMPOOLS_PER_SEGMENT_EXCEEDED - the max number of mempools per segment is exceeded
 /// MEMPOOL_WITHOUT_CHUNK_SIZE - chunk size not specified for the mempool
 /// MEMPOOL_WITHOUT_CHUNK_COUNT - chunk count not specified for the mempool
+/// INVALID_MEMPOOL_ALLOCATION_POLICY - the allocation policy of the segment is unknown
+/// INVALID_HUGE_PAGE_CONFIG - the huge page mount point is not a valid path, the huge page size is not a power of two
+/// or it was specified without a mount point
 enum class RouDiConfigFileParseError
 {
     FILE_OPEN_FAILED,
@@ -46,6 +49,8 @@ enum class RouDiConfigFileParseError
     MAX_NUMBER_OF_MEMPOOLS_PER_SEGMENT_EXCEEDED,
     MEMPOOL_WITHOUT_CHUNK_SIZE,
     MEMPOOL_WITHOUT_CHUNK_COUNT,
+    INVALID_MEMPOOL_ALLOCATION_POLICY,
+    INVALID_HUGE_PAGE_CONFIG,
     EXCEPTION_IN_PARSER
 };
 
@@ -58,6 +63,8 @@ constexpr const char* ROUDI_CONFIG_FILE_PARSE_ERROR_STRINGS[] = {"FILE_OPEN_FAIL
                                                                  "MAX_NUMBER_OF_MEMPOOLS_PER_SEGMENT_EXCEEDED",
                                                                  "MEMPOOL_WITHOUT_CHUNK_SIZE",
                                                                  "MEMPOOL_WITHOUT_CHUNK_COUNT",
+                                                                 "INVALID_MEMPOOL_ALLOCATION_POLICY",
+                                                                 "INVALID_HUGE_PAGE_CONFIG",
                                                                  "EXCEPTION_IN_PARSER"};
 
 /// @brief Base class for a config file provider.
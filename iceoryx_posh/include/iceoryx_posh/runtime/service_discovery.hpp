@@ -19,6 +19,7 @@
 
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/roudi/service_registry.hpp"
+#include "iceoryx_posh/internal/roudi/service_registry_change_log.hpp"
 #include "iceoryx_posh/popo/subscriber.hpp"
 #include "iceoryx_posh/runtime/posh_runtime.hpp"
 
@@ -79,9 +80,14 @@ class ServiceDiscovery
     std::unique_ptr<roudi::ServiceRegistry> m_serviceRegistry{new iox::roudi::ServiceRegistry};
     std::mutex m_serviceRegistryMutex;
 
+    // the snapshot of the registry is only taken on the first update or when the registry fell behind the change log
     popo::Subscriber<roudi::ServiceRegistry> m_serviceRegistrySubscriber{
         {SERVICE_DISCOVERY_SERVICE_NAME, SERVICE_DISCOVERY_INSTANCE_NAME, SERVICE_DISCOVERY_EVENT_NAME},
         {1U, 1U, iox::NodeName_t("Service Registry"), true}};
+    popo::Subscriber<roudi::ServiceRegistryChangeLog> m_serviceRegistryChangeLogSubscriber{
+        {SERVICE_DISCOVERY_SERVICE_NAME, SERVICE_DISCOVERY_INSTANCE_NAME, SERVICE_DISCOVERY_CHANGE_LOG_EVENT_NAME},
+        {1U, 1U, iox::NodeName_t("Service Registry"), true}};
+    optional<popo::Sample<const roudi::ServiceRegistryChangeLog>> m_changeLogSample;
 
     void update();
 };
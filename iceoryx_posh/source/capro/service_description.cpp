@@ -18,12 +18,32 @@
 #include "iceoryx_dust/cxx/convert.hpp"
 #include "iceoryx_dust/cxx/std_string_support.hpp"
 
+#include <initializer_list>
 #include <iomanip>
 
 namespace iox
 {
 namespace capro
 {
+namespace
+{
+constexpr uint64_t FNV_OFFSET_BASIS{14695981039346656037ULL};
+constexpr uint64_t FNV_PRIME{1099511628211ULL};
+
+uint64_t accumulateHash(uint64_t hash, const IdString_t& id) noexcept
+{
+    const auto* const characters = id.c_str();
+    for (uint64_t i = 0U; i < id.size(); ++i)
+    {
+        hash ^= static_cast<uint8_t>(characters[i]);
+        hash *= FNV_PRIME;
+    }
+    // the terminating zero separates the strings, otherwise e.g. "ab" + "c" and "a" + "bc" would have the same hash
+    hash *= FNV_PRIME;
+    return hash;
+}
+} // namespace
+
 ServiceDescription::ClassHash::ClassHash() noexcept
     : ClassHash{0U, 0U, 0U, 0U}
 {
@@ -229,6 +249,26 @@ bool serviceMatch(const ServiceDescription& first, const ServiceDescription& sec
     return (first.getServiceIDString() == second.getServiceIDString());
 }
 
+uint64_t hashIdString(const IdString_t& id) noexcept
+{
+    return accumulateHash(FNV_OFFSET_BASIS, id);
+}
+
+uint64_t ServiceDescriptionHash::operator()(const ServiceDescription& service) const noexcept
+{
+    // the hashes of the id strings are combined in order, i.e. swapping e.g. the service and the instance string
+    // results in a different hash
+    uint64_t hash{FNV_OFFSET_BASIS};
+    for (const auto idHash : {hashIdString(service.getServiceIDString()),
+                              hashIdString(service.getInstanceIDString()),
+                              hashIdString(service.getEventIDString())})
+    {
+        hash ^= idHash;
+        hash *= FNV_PRIME;
+    }
+    return hash;
+}
+
 std::ostream& operator<<(std::ostream& stream, const ServiceDescription& service) noexcept
 {
     /// @todo iox-#1141 Add classHash, scope and interface
@@ -221,6 +221,16 @@ void ChunkHeader::setSequenceNumber(const uint64_t sequenceNumber) noexcept
     m_sequenceNumber = sequenceNumber;
 }
 
+uint64_t ChunkHeader::sendTimestamp() const noexcept
+{
+    return m_sendTimestamp;
+}
+
+void ChunkHeader::setSendTimestamp(const uint64_t sendTimestamp) noexcept
+{
+    m_sendTimestamp = sendTimestamp;
+}
+
 uint64_t ChunkHeader::overflowSafeUsedSizeOfChunk() const noexcept
 {
     return static_cast<uint64_t>(m_userPayloadOffset) + static_cast<uint64_t>(m_userPayloadSize);
@@ -0,0 +1,204 @@
+// Copyright (c) 2026 by agent <agent@local>. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/mepoo/free_list_cache.hpp"
+#include "iceoryx_platform/unistd.hpp"
+
+#include <algorithm>
+
+namespace iox
+{
+namespace mepoo
+{
+namespace
+{
+uint32_t currentProcessId() noexcept
+{
+    // getpid is not cached by all libc implementations and would be a syscall on every claim
+    static const uint32_t pid{static_cast<uint32_t>(getpid())};
+    return pid;
+}
+} // namespace
+
+constexpr uint32_t FreeListCache::NUMBER_OF_SLOTS;
+constexpr uint32_t FreeListCache::NO_OWNER;
+
+void FreeListCache::init(not_null<Index_t*> magazineMemory, const uint32_t magazineCapacity) noexcept
+{
+    m_magazines = magazineMemory;
+    m_magazineCapacity = magazineCapacity;
+}
+
+bool FreeListCache::tryClaim(Slot& slot) noexcept
+{
+    // the load prevents the cache line from being acquired exclusively when the slot is already claimed
+    uint32_t expectedOwner{NO_OWNER};
+    return slot.m_owner.load(std::memory_order_relaxed) == NO_OWNER
+           && slot.m_owner.compare_exchange_strong(
+               expectedOwner, currentProcessId(), std::memory_order_acquire, std::memory_order_relaxed);
+}
+
+void FreeListCache::release(Slot& slot) noexcept
+{
+    slot.m_owner.store(NO_OWNER, std::memory_order_release);
+}
+
+FreeListCache::Index_t* FreeListCache::magazineOf(const uint32_t slotIndex) noexcept
+{
+    return m_magazines.get() + static_cast<uint64_t>(slotIndex) * m_magazineCapacity;
+}
+
+uint32_t FreeListCache::slotIndexOfCurrentThread() const noexcept
+{
+    // the threads of a process get consecutive slots; the process id shifts the first slot in order to spread the
+    // threads of different processes over the slots
+    static std::atomic<uint32_t> numberOfThreads{0U};
+    thread_local const uint32_t slotIndex{
+        (currentProcessId() + numberOfThreads.fetch_add(1U, std::memory_order_relaxed)) % NUMBER_OF_SLOTS};
+    return slotIndex;
+}
+
+bool FreeListCache::pop(concurrent::LoFFLi& freeList, Index_t& index) noexcept
+{
+    if (m_magazineCapacity == 0U)
+    {
+        return freeList.pop(index);
+    }
+
+    const auto slotIndex = slotIndexOfCurrentThread();
+    auto& slot = m_slots[slotIndex];
+    if (!tryClaim(slot))
+    {
+        return freeList.pop(index) || popFromOtherSlots(slotIndex, index);
+    }
+
+    auto* magazine = magazineOf(slotIndex);
+    auto numberOfIndices = slot.m_numberOfIndices.load(std::memory_order_relaxed);
+    if (numberOfIndices == 0U)
+    {
+        // only half of the magazine is refilled in order to have space left for the indices which are pushed
+        // back before the next refill is required
+        const uint32_t refillCount = std::max(m_magazineCapacity / 2U, 1U);
+        numberOfIndices = freeList.popN(magazine, refillCount);
+        slot.m_numberOfIndices.store(numberOfIndices, std::memory_order_relaxed);
+    }
+
+    const bool hasIndex{numberOfIndices > 0U};
+    if (hasIndex)
+    {
+        index = magazine[numberOfIndices - 1U];
+        slot.m_numberOfIndices.store(numberOfIndices - 1U, std::memory_order_relaxed);
+    }
+    release(slot);
+
+    return hasIndex || popFromOtherSlots(slotIndex, index);
+}
+
+bool FreeListCache::popFromOtherSlots(const uint32_t ownSlotIndex, Index_t& index) noexcept
+{
+    // the LoFFLi is exhausted but there might still be free indices in the magazines of other threads
+    for (uint32_t offset = 1U; offset < NUMBER_OF_SLOTS; ++offset)
+    {
+        const uint32_t slotIndex = (ownSlotIndex + offset) % NUMBER_OF_SLOTS;
+        auto& slot = m_slots[slotIndex];
+        if (slot.m_numberOfIndices.load(std::memory_order_relaxed) == 0U || !tryClaim(slot))
+        {
+            continue;
+        }
+
+        const auto numberOfIndices = slot.m_numberOfIndices.load(std::memory_order_relaxed);
+        if (numberOfIndices > 0U)
+        {
+            index = magazineOf(slotIndex)[numberOfIndices - 1U];
+            slot.m_numberOfIndices.store(numberOfIndices - 1U, std::memory_order_relaxed);
+            release(slot);
+            return true;
+        }
+        release(slot);
+    }
+
+    return false;
+}
+
+bool FreeListCache::push(concurrent::LoFFLi& freeList, const Index_t index) noexcept
+{
+    if (m_magazineCapacity == 0U)
+    {
+        return freeList.push(index);
+    }
+
+    const auto slotIndex = slotIndexOfCurrentThread();
+    auto& slot = m_slots[slotIndex];
+    if (!tryClaim(slot))
+    {
+        return freeList.push(index);
+    }
+
+    auto* magazine = magazineOf(slotIndex);
+    auto numberOfIndices = slot.m_numberOfIndices.load(std::memory_order_relaxed);
+    bool isValidPush{true};
+    if (numberOfIndices == m_magazineCapacity)
+    {
+        const uint32_t drainCount = std::max(m_magazineCapacity / 2U, 1U);
+        // the indices are removed from the magazine before they are pushed to the LoFFLi; when the process is killed
+        // in between, the indices are lost instead of being available twice
+        numberOfIndices -= drainCount;
+        slot.m_numberOfIndices.store(numberOfIndices, std::memory_order_relaxed);
+        if (!freeList.pushN(&magazine[numberOfIndices], drainCount))
+        {
+            // pushN pushes either all or none of the indices; the valid ones are returned individually
+            isValidPush = false;
+            for (uint32_t i = numberOfIndices; i < numberOfIndices + drainCount; ++i)
+            {
+                freeList.push(magazine[i]);
+            }
+        }
+    }
+
+    magazine[numberOfIndices] = index;
+    slot.m_numberOfIndices.store(numberOfIndices + 1U, std::memory_order_relaxed);
+    release(slot);
+
+    return isValidPush;
+}
+
+void FreeListCache::releaseSlotsOfProcess(const uint32_t pid) noexcept
+{
+    if (pid == NO_OWNER)
+    {
+        return;
+    }
+
+    for (auto& slot : m_slots)
+    {
+        uint32_t expectedOwner{pid};
+        slot.m_owner.compare_exchange_strong(
+            expectedOwner, NO_OWNER, std::memory_order_release, std::memory_order_relaxed);
+    }
+}
+
+uint32_t FreeListCache::getNumberOfCachedIndices() const noexcept
+{
+    uint32_t numberOfCachedIndices{0U};
+    for (const auto& slot : m_slots)
+    {
+        numberOfCachedIndices += slot.m_numberOfIndices.load(std::memory_order_relaxed);
+    }
+    return numberOfCachedIndices;
+}
+
+} // namespace mepoo
+} // namespace iox
@@ -18,6 +18,7 @@
 #include "iceoryx_posh/internal/mepoo/mem_pool.hpp"
 
 #include "iceoryx_posh/error_handling/error_handling.hpp"
+#include "iox/memory.hpp"
 
 #include <algorithm>
 
@@ -28,11 +29,13 @@ namespace mepoo
 MemPoolInfo::MemPoolInfo(const uint32_t usedChunks,
                          const uint32_t minFreeChunks,
                          const uint32_t numChunks,
-                         const uint32_t chunkSize) noexcept
+                         const uint32_t chunkSize,
+                         const uint32_t spilledChunks) noexcept
     : m_usedChunks(usedChunks)
     , m_minFreeChunks(minFreeChunks)
     , m_numChunks(numChunks)
     , m_chunkSize(chunkSize)
+    , m_spilledChunks(spilledChunks)
 {
 }
 
@@ -41,7 +44,8 @@ constexpr uint64_t MemPool::CHUNK_MEMORY_ALIGNMENT;
 MemPool::MemPool(const greater_or_equal<uint32_t, CHUNK_MEMORY_ALIGNMENT> chunkSize,
                  const greater_or_equal<uint32_t, 1> numberOfChunks,
                  iox::BumpAllocator& managementAllocator,
-                 iox::BumpAllocator& chunkMemoryAllocator) noexcept
+                 iox::BumpAllocator& chunkMemoryAllocator,
+                 const uint32_t chunkCacheCapacity) noexcept
     : m_chunkSize(chunkSize)
     , m_numberOfChunks(numberOfChunks)
     , m_minFree(numberOfChunks)
@@ -58,6 +62,15 @@ MemPool::MemPool(const greater_or_equal<uint32_t, CHUNK_MEMORY_ALIGNMENT> chunkS
         cxx::Expects(!allocationResult.has_error());
         auto* memoryLoFFLi = allocationResult.value();
         m_freeIndices.init(static_cast<concurrent::LoFFLi::Index_t*>(memoryLoFFLi), m_numberOfChunks);
+
+        if (chunkCacheCapacity > 0U)
+        {
+            allocationResult = managementAllocator.allocate(
+                FreeListCache::requiredMagazineMemorySize(chunkCacheCapacity), CHUNK_MEMORY_ALIGNMENT);
+            cxx::Expects(!allocationResult.has_error());
+            m_freeIndicesCache.init(static_cast<FreeListCache::Index_t*>(allocationResult.value()),
+                                    chunkCacheCapacity);
+        }
     }
     else
     {
@@ -82,7 +95,7 @@ void MemPool::adjustMinFree() noexcept
 void* MemPool::getChunk() noexcept
 {
     uint32_t l_index{0U};
-    if (!m_freeIndices.pop(l_index))
+    if (!m_freeIndicesCache.pop(m_freeIndices, l_index))
     {
         IOX_LOG(WARN) << "Mempool [m_chunkSize = " << m_chunkSize << ", numberOfChunks = " << m_numberOfChunks
                       << ", used_chunks = " << m_usedChunks << " ] has no more space left";
@@ -107,7 +120,7 @@ void MemPool::freeChunk(const void* chunk) noexcept
 
     uint32_t index = static_cast<uint32_t>(offset / m_chunkSize);
 
-    if (!m_freeIndices.push(index))
+    if (!m_freeIndicesCache.push(m_freeIndices, index))
     {
         errorHandler(PoshError::POSH__MEMPOOL_POSSIBLE_DOUBLE_FREE);
     }
@@ -115,6 +128,22 @@ void MemPool::freeChunk(const void* chunk) noexcept
     m_usedChunks.fetch_sub(1U, std::memory_order_relaxed);
 }
 
+void MemPool::releaseChunkCacheSlotsOfProcess(const uint32_t pid) noexcept
+{
+    m_freeIndicesCache.releaseSlotsOfProcess(pid);
+}
+
+uint64_t MemPool::requiredManagementMemorySize(const uint64_t numberOfChunks,
+                                               const uint32_t chunkCacheCapacity) noexcept
+{
+    uint64_t memorySize = align(freeList_t::requiredIndexMemorySize(numberOfChunks), CHUNK_MEMORY_ALIGNMENT);
+    if (chunkCacheCapacity > 0U)
+    {
+        memorySize += align(FreeListCache::requiredMagazineMemorySize(chunkCacheCapacity), CHUNK_MEMORY_ALIGNMENT);
+    }
+    return memorySize;
+}
+
 uint32_t MemPool::getChunkSize() const noexcept
 {
     return m_chunkSize;
@@ -135,12 +164,23 @@ uint32_t MemPool::getMinFree() const noexcept
     return m_minFree.load(std::memory_order_relaxed);
 }
 
+uint32_t MemPool::getSpilledChunks() const noexcept
+{
+    return m_spilledChunks.load(std::memory_order_relaxed);
+}
+
+void MemPool::countSpilledChunk() noexcept
+{
+    m_spilledChunks.fetch_add(1U, std::memory_order_relaxed);
+}
+
 MemPoolInfo MemPool::getInfo() const noexcept
 {
     return {m_usedChunks.load(std::memory_order_relaxed),
             m_minFree.load(std::memory_order_relaxed),
             m_numberOfChunks,
-            m_chunkSize};
+            m_chunkSize,
+            m_spilledChunks.load(std::memory_order_relaxed)};
 }
 
 } // namespace mepoo
@@ -22,12 +22,15 @@
 #include "iceoryx_posh/mepoo/mepoo_config.hpp"
 #include "iox/logging.hpp"
 
+#include <algorithm>
 #include <cstdint>
 
 namespace iox
 {
 namespace mepoo
 {
+constexpr uint32_t MemoryManager::NUMBER_OF_SIZE_CLASSES;
+
 void MemoryManager::printMemPoolVector(log::LogStream& log) const noexcept
 {
     for (auto& l_mempool : m_memPoolVector)
@@ -63,7 +66,8 @@ void MemoryManager::addMemPool(BumpAllocator& managementAllocator,
         errorHandler(iox::PoshError::MEPOO__MEMPOOL_CONFIG_MUST_BE_ORDERED_BY_INCREASING_SIZE);
     }
 
-    m_memPoolVector.emplace_back(adjustedChunkSize, numberOfChunks, managementAllocator, chunkMemoryAllocator);
+    m_memPoolVector.emplace_back(
+        adjustedChunkSize, numberOfChunks, managementAllocator, chunkMemoryAllocator, m_chunkCacheCapacity);
     m_totalNumberOfChunks += numberOfChunks;
 }
 
@@ -71,7 +75,93 @@ void MemoryManager::generateChunkManagementPool(BumpAllocator& managementAllocat
 {
     m_denyAddMemPool = true;
     uint32_t chunkSize = sizeof(ChunkManagement);
-    m_chunkManagementPool.emplace_back(chunkSize, m_totalNumberOfChunks, managementAllocator, managementAllocator);
+    m_chunkManagementPool.emplace_back(
+        chunkSize, m_totalNumberOfChunks, managementAllocator, managementAllocator, m_chunkCacheCapacity);
+
+    generateSizeClassLookup();
+}
+
+void MemoryManager::generateSizeClassLookup() noexcept
+{
+    m_sizeClassLookup.clear();
+
+    uint32_t memPoolIndex{0U};
+    for (uint32_t sizeClass = 0U; sizeClass < NUMBER_OF_SIZE_CLASSES; ++sizeClass)
+    {
+        const uint64_t lowerChunkSizeBound = static_cast<uint64_t>(1U) << sizeClass;
+        while (memPoolIndex < m_memPoolVector.size()
+               && m_memPoolVector[memPoolIndex].getChunkSize() < lowerChunkSizeBound)
+        {
+            ++memPoolIndex;
+        }
+        m_sizeClassLookup.emplace_back(memPoolIndex);
+    }
+}
+
+uint32_t MemoryManager::sizeClassOf(const uint32_t chunkSize) noexcept
+{
+    // floor(log2(chunkSize)) by a binary search over the bit positions; portable and with a fixed number of steps
+    uint32_t value{chunkSize};
+    uint32_t sizeClass{0U};
+    for (uint32_t shift = NUMBER_OF_SIZE_CLASSES / 2U; shift > 0U; shift /= 2U)
+    {
+        if (value >= (1U << shift))
+        {
+            value >>= shift;
+            sizeClass += shift;
+        }
+    }
+    return sizeClass;
+}
+
+optional<uint32_t> MemoryManager::findFittingMemPoolIndex(const uint32_t requiredChunkSize) const noexcept
+{
+    if (m_sizeClassLookup.empty())
+    {
+        return nullopt;
+    }
+
+    // the lookup table yields the first mempool in the size class of the requested chunk size; all mempools which are
+    // skipped below are in the same size class, i.e. the search is bounded by the number of mempools per size class
+    // and independent of the overall number of mempools
+    const auto numberOfMemPools = static_cast<uint32_t>(m_memPoolVector.size());
+    for (uint32_t index = m_sizeClassLookup[sizeClassOf(requiredChunkSize)]; index < numberOfMemPools; ++index)
+    {
+        if (m_memPoolVector[index].getChunkSize() >= requiredChunkSize)
+        {
+            return index;
+        }
+    }
+
+    return nullopt;
+}
+
+void* MemoryManager::getChunkFromFittingMemPools(const uint32_t fittingMemPoolIndex, MemPool*& memPoolPointer) noexcept
+{
+    auto& bestFittingMemPool = m_memPoolVector[fittingMemPoolIndex];
+    memPoolPointer = &bestFittingMemPool;
+    void* chunk = bestFittingMemPool.getChunk();
+    if (chunk != nullptr || m_allocationPolicy == MemPoolAllocationPolicy::STRICT_BEST_FIT)
+    {
+        return chunk;
+    }
+
+    const auto numberOfMemPools = static_cast<uint32_t>(m_memPoolVector.size());
+    const uint32_t lastMemPoolIndexToTry = (m_allocationPolicy == MemPoolAllocationPolicy::SPILL_TO_NEXT_LARGER)
+                                               ? std::min(fittingMemPoolIndex + 1U, numberOfMemPools - 1U)
+                                               : numberOfMemPools - 1U;
+    for (uint32_t index = fittingMemPoolIndex + 1U; index <= lastMemPoolIndexToTry; ++index)
+    {
+        chunk = m_memPoolVector[index].getChunk();
+        if (chunk != nullptr)
+        {
+            bestFittingMemPool.countSpilledChunk();
+            memPoolPointer = &m_memPoolVector[index];
+            return chunk;
+        }
+    }
+
+    return nullptr;
 }
 
 uint32_t MemoryManager::getNumberOfMemPools() const noexcept
@@ -83,11 +173,23 @@ MemPoolInfo MemoryManager::getMemPoolInfo(const uint32_t index) const noexcept
 {
     if (index >= m_memPoolVector.size())
     {
-        return {0, 0, 0, 0};
+        return {0, 0, 0, 0, 0};
     }
     return m_memPoolVector[index].getInfo();
 }
 
+void MemoryManager::releaseChunkCacheSlotsOfProcess(const uint32_t pid) noexcept
+{
+    for (auto& memPool : m_memPoolVector)
+    {
+        memPool.releaseChunkCacheSlotsOfProcess(pid);
+    }
+    for (auto& memPool : m_chunkManagementPool)
+    {
+        memPool.releaseChunkCacheSlotsOfProcess(pid);
+    }
+}
+
 uint32_t MemoryManager::sizeWithChunkHeaderStruct(const MaxChunkPayloadSize_t size) noexcept
 {
     return size + static_cast<uint32_t>(sizeof(ChunkHeader));
@@ -116,12 +218,11 @@ uint64_t MemoryManager::requiredManagementMemorySize(const MePooConfig& mePooCon
     for (const auto& mempool : mePooConfig.m_mempoolConfig)
     {
         sumOfAllChunks += mempool.m_chunkCount;
-        memorySize +=
-            align(MemPool::freeList_t::requiredIndexMemorySize(mempool.m_chunkCount), MemPool::CHUNK_MEMORY_ALIGNMENT);
+        memorySize += MemPool::requiredManagementMemorySize(mempool.m_chunkCount, mePooConfig.m_chunkCacheCapacity);
     }
 
     memorySize += align(sumOfAllChunks * sizeof(ChunkManagement), MemPool::CHUNK_MEMORY_ALIGNMENT);
-    memorySize += align(MemPool::freeList_t::requiredIndexMemorySize(sumOfAllChunks), MemPool::CHUNK_MEMORY_ALIGNMENT);
+    memorySize += MemPool::requiredManagementMemorySize(sumOfAllChunks, mePooConfig.m_chunkCacheCapacity);
 
     return memorySize;
 }
@@ -135,10 +236,12 @@ void MemoryManager::configureMemoryManager(const MePooConfig& mePooConfig,
                                            BumpAllocator& managementAllocator,
                                            BumpAllocator& chunkMemoryAllocator) noexcept
 {
+    m_chunkCacheCapacity = mePooConfig.m_chunkCacheCapacity;
     for (auto entry : mePooConfig.m_mempoolConfig)
     {
         addMemPool(managementAllocator, chunkMemoryAllocator, entry.m_size, entry.m_chunkCount);
     }
+    m_allocationPolicy = mePooConfig.m_allocationPolicy;
 
     generateChunkManagementPool(managementAllocator);
 }
@@ -146,21 +249,16 @@ void MemoryManager::configureMemoryManager(const MePooConfig& mePooConfig,
 expected<SharedChunk, MemoryManager::Error> MemoryManager::getChunk(const ChunkSettings& chunkSettings) noexcept
 {
     void* chunk{nullptr};
-    MemPool* memPoolPointer{nullptr};
     const auto requiredChunkSize = chunkSettings.requiredChunkSize();
 
     uint32_t aquiredChunkSize = 0U;
+    MemPool* memPoolPointer{nullptr};
 
-    for (auto& memPool : m_memPoolVector)
+    const auto fittingMemPoolIndex = findFittingMemPoolIndex(requiredChunkSize);
+    if (fittingMemPoolIndex.has_value())
     {
-        uint32_t chunkSizeOfMemPool = memPool.getChunkSize();
-        if (chunkSizeOfMemPool >= requiredChunkSize)
-        {
-            chunk = memPool.getChunk();
-            memPoolPointer = &memPool;
-            aquiredChunkSize = chunkSizeOfMemPool;
-            break;
-        }
+        chunk = getChunkFromFittingMemPools(fittingMemPoolIndex.value(), memPoolPointer);
+        aquiredChunkSize = memPoolPointer->getChunkSize();
     }
 
     if (m_memPoolVector.size() == 0)
@@ -89,5 +89,17 @@ MePooConfig& MePooConfig::optimize() noexcept
     return *this;
 }
 
+MePooConfig& MePooConfig::setAllocationPolicy(const MemPoolAllocationPolicy allocationPolicy) noexcept
+{
+    m_allocationPolicy = allocationPolicy;
+    return *this;
+}
+
+MePooConfig& MePooConfig::setChunkCacheCapacity(const uint32_t chunkCacheCapacity) noexcept
+{
+    m_chunkCacheCapacity = chunkCacheCapacity;
+    return *this;
+}
+
 } // namespace mepoo
 } // namespace iox
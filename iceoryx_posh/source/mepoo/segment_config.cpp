@@ -21,6 +21,8 @@ namespace iox
 {
 namespace mepoo
 {
+constexpr uint64_t HugePageConfig::DEFAULT_PAGE_SIZE;
+
 SegmentConfig& SegmentConfig::setDefaults() noexcept
 {
     auto groupName = posix::PosixGroup::getGroupOfCurrentProcess().getName();
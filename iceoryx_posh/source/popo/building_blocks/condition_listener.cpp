@@ -17,6 +17,8 @@
 
 #include "iceoryx_posh/internal/popo/building_blocks/condition_listener.hpp"
 #include "iceoryx_posh/error_handling/error_handling.hpp"
+#include "iox/algorithm.hpp"
+#include "iox/scope_guard.hpp"
 
 namespace iox
 {
@@ -81,21 +83,22 @@ ConditionListener::NotificationVector_t ConditionListener::timedWait(const units
 
 ConditionListener::NotificationVector_t ConditionListener::waitImpl(const function_ref<bool()>& waitCall) noexcept
 {
-    using Type_t = iox::BestFittingType_t<iox::MAX_NUMBER_OF_EVENTS_PER_LISTENER>;
     NotificationVector_t activeNotifications;
 
     resetSemaphore();
+
+    // notifiers only post the semaphore while a listener is waiting; the flag is set before the notifications are
+    // collected so that a notification which is not collected anymore is always followed by a post
+    ScopeGuard waitingListener{[this] {
+                                   getMembers()->m_hasWaitingListener.store(true, std::memory_order_relaxed);
+                                   std::atomic_thread_fence(std::memory_order_seq_cst);
+                               },
+                               [this] { getMembers()->m_hasWaitingListener.store(false, std::memory_order_relaxed); }};
+
     bool doReturnAfterNotificationCollection = false;
     while (!m_toBeDestroyed.load(std::memory_order_relaxed))
     {
-        for (Type_t i = 0U; i < MAX_NUMBER_OF_NOTIFIERS; i++)
-        {
-            if (getMembers()->m_activeNotifications[i].load(std::memory_order_relaxed))
-            {
-                resetUnchecked(i);
-                activeNotifications.emplace_back(i);
-            }
-        }
+        collectActiveNotifications(activeNotifications);
         if (!activeNotifications.empty() || doReturnAfterNotificationCollection)
         {
             return activeNotifications;
@@ -107,10 +110,32 @@ ConditionListener::NotificationVector_t ConditionListener::waitImpl(const functi
     return activeNotifications;
 }
 
-void ConditionListener::resetUnchecked(const uint64_t index) noexcept
+void ConditionListener::collectActiveNotifications(NotificationVector_t& activeNotifications) noexcept
 {
-    getMembers()->m_activeNotifications[index].store(false, std::memory_order_relaxed);
-    getMembers()->m_wasNotified.store(false, std::memory_order_relaxed);
+    using Type_t = iox::BestFittingType_t<iox::MAX_NUMBER_OF_EVENTS_PER_LISTENER>;
+    constexpr uint64_t NOTIFICATIONS_PER_WORD{ConditionVariableData::NOTIFICATIONS_PER_WORD};
+
+    // a summary bit which is set after the exchange stays set for the next collection; at worst the corresponding
+    // word is then already empty
+    auto activeWords = getMembers()->m_activeNotificationWordsSummary.exchange(0U, std::memory_order_acquire);
+    while (activeWords != 0U)
+    {
+        const uint64_t wordIndex{countTrailingZeros(activeWords)};
+        activeWords &= activeWords - 1U;
+
+        auto activeBits = getMembers()->m_activeNotificationWords[wordIndex].exchange(0U, std::memory_order_acquire);
+        while (activeBits != 0U)
+        {
+            activeNotifications.emplace_back(
+                static_cast<Type_t>(wordIndex * NOTIFICATIONS_PER_WORD + countTrailingZeros(activeBits)));
+            activeBits &= activeBits - 1U;
+        }
+    }
+
+    if (!activeNotifications.empty())
+    {
+        getMembers()->m_wasNotified.store(false, std::memory_order_relaxed);
+    }
 }
 
 const ConditionVariableData* ConditionListener::getMembers() const noexcept
@@ -36,8 +36,27 @@ ConditionNotifier::ConditionNotifier(ConditionVariableData& condVarDataRef, cons
 
 void ConditionNotifier::notify() noexcept
 {
-    getMembers()->m_activeNotifications[m_notificationIndex].store(true, std::memory_order_release);
+    notifyWithoutWakeUp();
+    wakeUp();
+}
+
+void ConditionNotifier::notifyWithoutWakeUp() noexcept
+{
+    getMembers()->setNotificationActive(m_notificationIndex);
+}
+
+void ConditionNotifier::wakeUp() noexcept
+{
     getMembers()->m_wasNotified.store(true, std::memory_order_relaxed);
+
+    // pairs with the fence in ConditionListener::waitImpl; either the listener sees the active notification or this
+    // notifier sees the waiting listener
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (!getMembers()->m_hasWaitingListener.load(std::memory_order_relaxed))
+    {
+        return;
+    }
+
     getMembers()->m_semaphore->post().or_else(
         [](auto) { errorHandler(PoshError::POPO__CONDITION_NOTIFIER_SEMAPHORE_CORRUPT_IN_NOTIFY, ErrorLevel::FATAL); });
 }
@@ -21,6 +21,9 @@ namespace iox
 {
 namespace popo
 {
+constexpr uint64_t ConditionVariableData::NOTIFICATIONS_PER_WORD;
+constexpr uint64_t ConditionVariableData::NUMBER_OF_NOTIFICATION_WORDS;
+
 ConditionVariableData::ConditionVariableData() noexcept
     : ConditionVariableData("")
 {
@@ -33,10 +36,25 @@ ConditionVariableData::ConditionVariableData(const RuntimeName_t& runtimeName) n
         errorHandler(PoshError::POPO__CONDITION_VARIABLE_DATA_FAILED_TO_CREATE_SEMAPHORE, ErrorLevel::FATAL);
     });
 
-    for (auto& id : m_activeNotifications)
+    for (auto& word : m_activeNotificationWords)
     {
-        id.store(false, std::memory_order_relaxed);
+        word.store(0U, std::memory_order_relaxed);
     }
 }
+
+void ConditionVariableData::setNotificationActive(const uint64_t index) noexcept
+{
+    const uint64_t wordIndex{index / NOTIFICATIONS_PER_WORD};
+    // the notification must be visible in the word before the summary bit can be consumed by the listener
+    m_activeNotificationWords[wordIndex].fetch_or(1ULL << (index % NOTIFICATIONS_PER_WORD), std::memory_order_release);
+    m_activeNotificationWordsSummary.fetch_or(1ULL << wordIndex, std::memory_order_release);
+}
+
+bool ConditionVariableData::isNotificationActive(const uint64_t index) const noexcept
+{
+    return (m_activeNotificationWords[index / NOTIFICATIONS_PER_WORD].load(std::memory_order_relaxed)
+            & (1ULL << (index % NOTIFICATIONS_PER_WORD)))
+           != 0U;
+}
 } // namespace popo
 } // namespace iox
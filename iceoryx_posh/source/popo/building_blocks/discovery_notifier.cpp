@@ -0,0 +1,41 @@
+// Copyright (c) 2026 by agent <agent@local>. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/popo/building_blocks/discovery_notifier.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/discovery_trigger.hpp"
+
+namespace iox
+{
+namespace popo
+{
+constexpr uint64_t DiscoveryNotifier::INVALID_ENTRY_INDEX;
+
+DiscoveryNotifier::DiscoveryNotifier(DiscoveryTrigger& discoveryTrigger, const uint64_t entryIndex) noexcept
+    : m_discoveryTrigger(&discoveryTrigger)
+    , m_entryIndex(entryIndex)
+{
+}
+
+void DiscoveryNotifier::notify() noexcept
+{
+    if (m_discoveryTrigger)
+    {
+        m_discoveryTrigger->notify(m_entryIndex);
+    }
+}
+
+} // namespace popo
+} // namespace iox
@@ -0,0 +1,128 @@
+// Copyright (c) 2026 by agent <agent@local>. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/popo/building_blocks/discovery_trigger.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_listener.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_notifier.hpp"
+#include "iox/algorithm.hpp"
+
+namespace iox
+{
+namespace popo
+{
+constexpr uint64_t DiscoveryTrigger::ENTRIES_PER_WORD;
+constexpr uint64_t DiscoveryTrigger::NUMBER_OF_ENTRIES;
+constexpr uint64_t DiscoveryTrigger::NUMBER_OF_ENTRY_WORDS;
+constexpr uint64_t DiscoveryTrigger::NUMBER_OF_SUMMARY_WORDS;
+
+namespace
+{
+/// @brief the discovery only waits for one notification, the dirty entries are tracked by the DiscoveryTrigger
+constexpr uint64_t DISCOVERY_NOTIFICATION_INDEX{0U};
+
+// the entries of each kind are consecutive and the kinds are ordered like DiscoveryEntryKind
+constexpr uint64_t NUMBER_OF_KINDS{7U};
+constexpr uint64_t ENTRIES_PER_KIND[NUMBER_OF_KINDS]{MAX_PUBLISHERS,
+                                                     MAX_SUBSCRIBERS,
+                                                     MAX_SERVERS,
+                                                     MAX_CLIENTS,
+                                                     MAX_INTERFACE_NUMBER,
+                                                     MAX_NODE_NUMBER,
+                                                     MAX_NUMBER_OF_CONDITION_VARIABLES};
+} // namespace
+
+DiscoveryTrigger::DiscoveryTrigger() noexcept
+    : m_conditionVariableData(RuntimeName_t(roudi::IPC_CHANNEL_ROUDI_NAME))
+{
+    for (auto& word : m_dirtyEntryWords)
+    {
+        word.store(0U, std::memory_order_relaxed);
+    }
+    for (auto& word : m_dirtyEntryWordsSummary)
+    {
+        word.store(0U, std::memory_order_relaxed);
+    }
+}
+
+uint64_t DiscoveryTrigger::toEntryIndex(const DiscoveryEntryKind kind, const uint64_t position) noexcept
+{
+    uint64_t entryIndex{position};
+    for (uint64_t i = 0U; i < static_cast<uint64_t>(kind); ++i)
+    {
+        entryIndex += ENTRIES_PER_KIND[i];
+    }
+    return entryIndex;
+}
+
+void DiscoveryTrigger::notify(const uint64_t entryIndex) noexcept
+{
+    cxx::Expects(entryIndex < NUMBER_OF_ENTRIES);
+
+    const uint64_t wordIndex{entryIndex / ENTRIES_PER_WORD};
+    // the dirty entry must be visible in the word before the summary bit can be consumed by the discovery
+    m_dirtyEntryWords[wordIndex].fetch_or(1ULL << (entryIndex % ENTRIES_PER_WORD), std::memory_order_release);
+    m_dirtyEntryWordsSummary[wordIndex / ENTRIES_PER_WORD].fetch_or(1ULL << (wordIndex % ENTRIES_PER_WORD),
+                                                                    std::memory_order_release);
+
+    wakeUp();
+}
+
+void DiscoveryTrigger::wakeUp() noexcept
+{
+    ConditionNotifier(m_conditionVariableData, DISCOVERY_NOTIFICATION_INDEX).notify();
+}
+
+void DiscoveryTrigger::timedWait(const units::Duration& timeout) noexcept
+{
+    ConditionListener(m_conditionVariableData).timedWait(timeout);
+}
+
+void DiscoveryTrigger::collectDirtyEntries(
+    const function_ref<void(const DiscoveryEntryKind, const uint64_t)> callback) noexcept
+{
+    uint64_t kind{0U};
+    uint64_t firstEntryOfKind{0U};
+
+    for (uint64_t summaryIndex = 0U; summaryIndex < NUMBER_OF_SUMMARY_WORDS; ++summaryIndex)
+    {
+        // a summary bit which is set after the exchange stays set for the next collection; at worst the corresponding
+        // word is then already empty
+        auto dirtyWords = m_dirtyEntryWordsSummary[summaryIndex].exchange(0U, std::memory_order_acquire);
+        while (dirtyWords != 0U)
+        {
+            const uint64_t wordIndex{summaryIndex * ENTRIES_PER_WORD + countTrailingZeros(dirtyWords)};
+            dirtyWords &= dirtyWords - 1U;
+
+            auto dirtyBits = m_dirtyEntryWords[wordIndex].exchange(0U, std::memory_order_acquire);
+            while (dirtyBits != 0U)
+            {
+                const uint64_t entryIndex{wordIndex * ENTRIES_PER_WORD + countTrailingZeros(dirtyBits)};
+                dirtyBits &= dirtyBits - 1U;
+
+                // the entries are visited in ascending order, therefore the kind only has to be advanced
+                while (entryIndex >= firstEntryOfKind + ENTRIES_PER_KIND[kind])
+                {
+                    firstEntryOfKind += ENTRIES_PER_KIND[kind];
+                    ++kind;
+                }
+                callback(static_cast<DiscoveryEntryKind>(kind), entryIndex - firstEntryOfKind);
+            }
+        }
+    }
+}
+
+} // namespace popo
+} // namespace iox
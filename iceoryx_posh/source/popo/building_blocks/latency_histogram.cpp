@@ -0,0 +1,120 @@
+// Copyright (c) 2026 by agent <agent@local>. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/popo/building_blocks/latency_histogram.hpp"
+
+#include <cmath>
+
+namespace iox
+{
+namespace popo
+{
+namespace
+{
+/// @brief the number of bits below the most significant one which select the sub bucket
+constexpr uint64_t SUB_BUCKET_BITS{2U};
+} // namespace
+
+constexpr uint64_t LatencyHistogram::SUB_BUCKETS_PER_OCTAVE;
+constexpr uint64_t LatencyHistogram::NUMBER_OF_OCTAVES;
+constexpr uint64_t LatencyHistogram::NUMBER_OF_BUCKETS;
+
+static_assert(LatencyHistogram::SUB_BUCKETS_PER_OCTAVE == (1U << SUB_BUCKET_BITS),
+              "The number of sub buckets must match the number of bits which select them");
+
+void LatencyHistogram::record(const uint64_t latencyInNanoseconds) noexcept
+{
+    // there is only one writer, a read-modify-write is not required
+    auto& bucket = m_buckets[bucketIndex(latencyInNanoseconds)];
+    bucket.store(bucket.load(std::memory_order_relaxed) + 1U, std::memory_order_relaxed);
+    m_count.store(m_count.load(std::memory_order_relaxed) + 1U, std::memory_order_relaxed);
+}
+
+uint64_t LatencyHistogram::count() const noexcept
+{
+    return m_count.load(std::memory_order_relaxed);
+}
+
+uint64_t LatencyHistogram::valueAtPercentile(const double percentile) const noexcept
+{
+    // the buckets are summed up instead of using m_count since the writer could record a sample in the meantime
+    uint64_t total{0U};
+    for (const auto& bucket : m_buckets)
+    {
+        total += bucket.load(std::memory_order_relaxed);
+    }
+    if (total == 0U)
+    {
+        return 0U;
+    }
+
+    const double clampedPercentile = (percentile < 0.0) ? 0.0 : ((percentile > 100.0) ? 100.0 : percentile);
+    auto rank = static_cast<uint64_t>(std::ceil(clampedPercentile / 100.0 * static_cast<double>(total)));
+    rank = (rank == 0U) ? 1U : ((rank > total) ? total : rank);
+
+    uint64_t accumulated{0U};
+    for (uint64_t index = 0U; index < NUMBER_OF_BUCKETS; ++index)
+    {
+        accumulated += m_buckets[index].load(std::memory_order_relaxed);
+        if (accumulated >= rank)
+        {
+            return bucketUpperBound(index);
+        }
+    }
+    return bucketUpperBound(NUMBER_OF_BUCKETS - 1U);
+}
+
+uint64_t LatencyHistogram::bucketIndex(const uint64_t value) noexcept
+{
+    // the values below the first octave with sub buckets have a bucket of their own
+    if (value < SUB_BUCKETS_PER_OCTAVE)
+    {
+        return value;
+    }
+
+    // floor(log2(value)) by a binary search over the bit positions; portable and with a fixed number of steps
+    uint64_t remainder{value};
+    uint64_t mostSignificantBit{0U};
+    for (uint64_t shift = 32U; shift > 0U; shift /= 2U)
+    {
+        if (remainder >= (1ULL << shift))
+        {
+            remainder >>= shift;
+            mostSignificantBit += shift;
+        }
+    }
+
+    const uint64_t subBucket = (value >> (mostSignificantBit - SUB_BUCKET_BITS)) & (SUB_BUCKETS_PER_OCTAVE - 1U);
+    const uint64_t index = (mostSignificantBit - 1U) * SUB_BUCKETS_PER_OCTAVE + subBucket;
+    return (index < NUMBER_OF_BUCKETS) ? index : NUMBER_OF_BUCKETS - 1U;
+}
+
+uint64_t LatencyHistogram::bucketUpperBound(const uint64_t index) noexcept
+{
+    if (index < SUB_BUCKETS_PER_OCTAVE)
+    {
+        return index;
+    }
+
+    const uint64_t clampedIndex = (index < NUMBER_OF_BUCKETS) ? index : NUMBER_OF_BUCKETS - 1U;
+    const uint64_t mostSignificantBit = clampedIndex / SUB_BUCKETS_PER_OCTAVE + 1U;
+    const uint64_t bucketWidth = 1ULL << (mostSignificantBit - SUB_BUCKET_BITS);
+    const uint64_t lowerBound = (SUB_BUCKETS_PER_OCTAVE + clampedIndex % SUB_BUCKETS_PER_OCTAVE) * bucketWidth;
+    return lowerBound + bucketWidth - 1U;
+}
+
+} // namespace popo
+} // namespace iox
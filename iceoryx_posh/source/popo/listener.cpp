@@ -29,6 +29,18 @@ Listener::Listener(ConditionVariableData& conditionVariableData) noexcept
 {
 }
 
+MultiThreadedListener::MultiThreadedListener(const uint64_t numberOfWorkerThreads) noexcept
+    : MultiThreadedListener(*runtime::PoshRuntime::getInstance().getMiddlewareConditionVariable(),
+                            numberOfWorkerThreads)
+{
+}
+
+MultiThreadedListener::MultiThreadedListener(ConditionVariableData& conditionVariableData,
+                                             const uint64_t numberOfWorkerThreads) noexcept
+    : Parent(conditionVariableData, numberOfWorkerThreads)
+{
+}
+
 namespace internal
 {
 Event_t::~Event_t() noexcept
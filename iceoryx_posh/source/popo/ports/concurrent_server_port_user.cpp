@@ -0,0 +1,63 @@
+// Copyright (c) 2026 by agent <agent@local>. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/popo/ports/concurrent_server_port_user.hpp"
+
+#include <mutex>
+
+namespace iox
+{
+namespace popo
+{
+ConcurrentServerPortUser::ConcurrentServerPortUser(MemberType_t& serverPortData) noexcept
+    : ServerPortUser(serverPortData)
+{
+}
+
+expected<const RequestHeader*, ServerRequestResult> ConcurrentServerPortUser::getRequest() noexcept
+{
+    return toRequestResult(m_chunkReceiver.tryGet(m_chunksInUseLock));
+}
+
+void ConcurrentServerPortUser::releaseRequest(const RequestHeader* const requestHeader) noexcept
+{
+    std::lock_guard<std::recursive_mutex> lock(m_chunksInUseLock);
+    ServerPortUser::releaseRequest(requestHeader);
+}
+
+expected<ResponseHeader*, AllocationError>
+ConcurrentServerPortUser::allocateResponse(const RequestHeader* const requestHeader,
+                                           const uint32_t userPayloadSize,
+                                           const uint32_t userPayloadAlignment) noexcept
+{
+    std::lock_guard<std::recursive_mutex> lock(m_chunksInUseLock);
+    return ServerPortUser::allocateResponse(requestHeader, userPayloadSize, userPayloadAlignment);
+}
+
+void ConcurrentServerPortUser::releaseResponse(const ResponseHeader* const responseHeader) noexcept
+{
+    std::lock_guard<std::recursive_mutex> lock(m_chunksInUseLock);
+    ServerPortUser::releaseResponse(responseHeader);
+}
+
+expected<ServerSendError> ConcurrentServerPortUser::sendResponse(ResponseHeader* const responseHeader) noexcept
+{
+    std::lock_guard<std::recursive_mutex> lock(m_chunksInUseLock);
+    return ServerPortUser::sendResponse(responseHeader);
+}
+
+} // namespace popo
+} // namespace iox
@@ -71,6 +71,24 @@ void PublisherPortUser::sendChunk(mepoo::ChunkHeader* const chunkHeader) noexcep
     }
 }
 
+void PublisherPortUser::sendChunks(mepoo::ChunkHeader* const* const chunkHeaders, const uint64_t numberOfChunks) noexcept
+{
+    const auto offerRequested = getMembers()->m_offeringRequested.load(std::memory_order_relaxed);
+
+    if (offerRequested)
+    {
+        m_chunkSender.sendBatch(chunkHeaders, numberOfChunks);
+    }
+    else
+    {
+        // see sendChunk, the chunks are only put in the history if the publisher port is not offered
+        for (uint64_t i = 0U; i < numberOfChunks; ++i)
+        {
+            m_chunkSender.pushToHistory(chunkHeaders[i]);
+        }
+    }
+}
+
 optional<const mepoo::ChunkHeader*> PublisherPortUser::tryGetPreviousChunk() const noexcept
 {
     return m_chunkSender.tryGetPreviousChunk();
@@ -81,6 +99,7 @@ void PublisherPortUser::offer() noexcept
     if (!getMembers()->m_offeringRequested.load(std::memory_order_relaxed))
     {
         getMembers()->m_offeringRequested.store(true, std::memory_order_relaxed);
+        getMembers()->m_discoveryNotifier.notify();
     }
 }
 
@@ -89,6 +108,7 @@ void PublisherPortUser::stopOffer() noexcept
     if (getMembers()->m_offeringRequested.load(std::memory_order_relaxed))
     {
         getMembers()->m_offeringRequested.store(false, std::memory_order_relaxed);
+        getMembers()->m_discoveryNotifier.notify();
     }
 }
 
@@ -40,8 +40,12 @@ ServerPortUser::MemberType_t* ServerPortUser::getMembers() noexcept
 
 expected<const RequestHeader*, ServerRequestResult> ServerPortUser::getRequest() noexcept
 {
-    auto getChunkResult = m_chunkReceiver.tryGet();
+    return toRequestResult(m_chunkReceiver.tryGet());
+}
 
+expected<const RequestHeader*, ServerRequestResult> ServerPortUser::toRequestResult(
+    const expected<const mepoo::ChunkHeader*, ChunkReceiveResult>& getChunkResult) const noexcept
+{
     if (getChunkResult.has_error())
     {
         if (!isOffered())
@@ -162,6 +166,7 @@ void ServerPortUser::offer() noexcept
     if (!getMembers()->m_offeringRequested.load(std::memory_order_relaxed))
     {
         getMembers()->m_offeringRequested.store(true, std::memory_order_relaxed);
+        getMembers()->m_discoveryNotifier.notify();
     }
 }
 
@@ -170,6 +175,7 @@ void ServerPortUser::stopOffer() noexcept
     if (getMembers()->m_offeringRequested.load(std::memory_order_relaxed))
     {
         getMembers()->m_offeringRequested.store(false, std::memory_order_relaxed);
+        getMembers()->m_discoveryNotifier.notify();
     }
 }
 
@@ -26,9 +26,10 @@ SubscriberPortData::SubscriberPortData(const capro::ServiceDescription& serviceD
                                        const RuntimeName_t& runtimeName,
                                        cxx::VariantQueueTypes queueType,
                                        const SubscriberOptions& subscriberOptions,
-                                       const mepoo::MemoryInfo& memoryInfo) noexcept
+                                       const mepoo::MemoryInfo& memoryInfo,
+                                       LatencyHistogram* const latencyHistogram) noexcept
     : BasePortData(serviceDescription, runtimeName, subscriberOptions.nodeName)
-    , m_chunkReceiverData(queueType, subscriberOptions.queueFullPolicy, memoryInfo)
+    , m_chunkReceiverData(queueType, subscriberOptions.queueFullPolicy, memoryInfo, latencyHistogram)
     , m_options{subscriberOptions}
     , m_subscribeRequested(subscriberOptions.subscribeOnCreate)
 {
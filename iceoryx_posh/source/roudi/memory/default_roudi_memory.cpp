@@ -17,6 +17,7 @@
 
 #include "iceoryx_posh/roudi/memory/default_roudi_memory.hpp"
 #include "iceoryx_posh/internal/mepoo/mem_pool.hpp"
+#include "iceoryx_posh/internal/roudi/service_registry_change_log.hpp"
 #include "iceoryx_posh/roudi/introspection_types.hpp"
 #include "iox/memory.hpp"
 
@@ -57,6 +58,8 @@ mepoo::MePooConfig DefaultRouDiMemory::introspectionMemPoolConfig() const noexce
     mempoolConfig.m_mempoolConfig.push_back(
         {align(static_cast<uint32_t>(sizeof(roudi::SubscriberPortChangingIntrospectionFieldTopic)), ALIGNMENT),
          CHUNK_COUNT});
+    mempoolConfig.m_mempoolConfig.push_back(
+        {align(static_cast<uint32_t>(sizeof(roudi::ServiceRegistryChangeLog)), ALIGNMENT), CHUNK_COUNT});
 
     mempoolConfig.optimize();
     return mempoolConfig;
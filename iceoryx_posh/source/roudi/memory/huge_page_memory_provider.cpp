@@ -0,0 +1,89 @@
+// Copyright (c) 2026 by agent <agent@local>. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/roudi/memory/huge_page_memory_provider.hpp"
+
+#include "iox/logging.hpp"
+#include "iox/memory.hpp"
+
+namespace iox
+{
+namespace roudi
+{
+constexpr access_rights HugePageMemoryProvider::SHM_MEMORY_PERMISSIONS;
+
+HugePageMemoryProvider::HugePageMemoryProvider(const ShmName_t& shmName,
+                                               const mepoo::HugePageConfig& hugePageConfig,
+                                               const posix::AccessMode accessMode,
+                                               const posix::OpenMode openMode,
+                                               const optional<uint32_t>& numaNode) noexcept
+    : m_shmName(shmName)
+    , m_hugePageConfig(hugePageConfig)
+    , m_accessMode(accessMode)
+    , m_openMode(openMode)
+    , m_numaNode(numaNode)
+{
+}
+
+HugePageMemoryProvider::~HugePageMemoryProvider() noexcept
+{
+    if (isAvailable())
+    {
+        destroy().or_else([](auto) { IOX_LOG(WARN) << "failed to cleanup huge page memory provider resources"; });
+    }
+}
+
+expected<void*, MemoryProviderError> HugePageMemoryProvider::createMemory(const uint64_t size,
+                                                                          const uint64_t alignment) noexcept
+{
+    if (alignment > m_hugePageConfig.m_pageSize)
+    {
+        return error<MemoryProviderError>(MemoryProviderError::MEMORY_ALIGNMENT_EXCEEDS_PAGE_SIZE);
+    }
+
+    // hugetlbfs only accepts multiples of the huge page size for truncate and mmap
+    if (!posix::SharedMemoryObjectBuilder()
+             .name(m_shmName)
+             .memorySizeInBytes(align(size, m_hugePageConfig.m_pageSize))
+             .accessMode(m_accessMode)
+             .openMode(m_openMode)
+             .permissions(SHM_MEMORY_PERMISSIONS)
+             .directory(m_hugePageConfig.m_mountPoint)
+             .numaNode(m_numaNode)
+             .prefaultPageSize(m_hugePageConfig.m_pageSize)
+             .create()
+             .and_then([this](auto& sharedMemoryObject) { m_shmObject.emplace(std::move(sharedMemoryObject)); }))
+    {
+        return error<MemoryProviderError>(MemoryProviderError::MEMORY_CREATION_FAILED);
+    }
+
+    auto baseAddress = m_shmObject->getBaseAddress();
+    if (baseAddress == nullptr)
+    {
+        return error<MemoryProviderError>(MemoryProviderError::MEMORY_CREATION_FAILED);
+    }
+
+    return success<void*>(baseAddress);
+}
+
+expected<MemoryProviderError> HugePageMemoryProvider::destroyMemory() noexcept
+{
+    m_shmObject.reset();
+    return success<void>();
+}
+
+} // namespace roudi
+} // namespace iox
@@ -66,15 +66,21 @@ PortManager::PortManager(RouDiMemoryInterface* roudiMemoryInterface) noexcept
     registryPortOptions.nodeName = iox::NodeName_t("Service Registry");
     registryPortOptions.offerOnCreate = true;
 
-    // we cannot (fully) perform discovery without this port
+    // we cannot (fully) perform discovery without these ports
     m_serviceRegistryPublisherPortData = acquireInternalPublisherPortDataWithoutDiscovery(
         {SERVICE_DISCOVERY_SERVICE_NAME, SERVICE_DISCOVERY_INSTANCE_NAME, SERVICE_DISCOVERY_EVENT_NAME},
         registryPortOptions,
         introspectionMemoryManager);
+    m_serviceRegistryChangeLogPublisherPortData = acquireInternalPublisherPortDataWithoutDiscovery(
+        {SERVICE_DISCOVERY_SERVICE_NAME, SERVICE_DISCOVERY_INSTANCE_NAME, SERVICE_DISCOVERY_CHANGE_LOG_EVENT_NAME},
+        registryPortOptions,
+        introspectionMemoryManager);
 
-    // if we arrive here, the port for service discovery exists and we perform the discovery
+    // if we arrive here, the ports for service discovery exist and we perform the discovery
     PublisherPortRouDiType serviceRegistryPort(*m_serviceRegistryPublisherPortData);
     doDiscoveryForPublisherPort(serviceRegistryPort);
+    PublisherPortRouDiType serviceRegistryChangeLogPort(*m_serviceRegistryChangeLogPublisherPortData);
+    doDiscoveryForPublisherPort(serviceRegistryChangeLogPort);
 
     popo::PublisherOptions options;
     options.historyCapacity = 1U;
@@ -102,35 +108,87 @@ void PortManager::stopPortIntrospection() noexcept
 
 void PortManager::doDiscovery() noexcept
 {
-    handlePublisherPorts();
-
-    handleSubscriberPorts();
-
-    handleServerPorts();
+    // only the entries which notified the DiscoveryTrigger can have pending requests; the entries are collected in
+    // the order of their kind, i.e. publishers are handled before subscribers, servers before clients and so on
+    vector<popo::InterfacePortData*, MAX_INTERFACE_NUMBER> interfacePortsForInitialForwarding;
 
-    handleClientPorts();
+    m_portPool->getDiscoveryTrigger().collectDirtyEntries(
+        [this, &interfacePortsForInitialForwarding](const popo::DiscoveryEntryKind kind, const uint64_t position) {
+            // an entry which was removed in the meantime has no pending requests
+            switch (kind)
+            {
+            case popo::DiscoveryEntryKind::PUBLISHER_PORT:
+                if (auto publisherPortData = m_portPool->getPublisherPortData(position))
+                {
+                    this->handlePublisherPort(publisherPortData);
+                }
+                break;
+            case popo::DiscoveryEntryKind::SUBSCRIBER_PORT:
+                if (auto subscriberPortData = m_portPool->getSubscriberPortData(position))
+                {
+                    this->handleSubscriberPort(subscriberPortData);
+                }
+                break;
+            case popo::DiscoveryEntryKind::SERVER_PORT:
+                if (auto serverPortData = m_portPool->getServerPortData(position))
+                {
+                    this->handleServerPort(serverPortData);
+                }
+                break;
+            case popo::DiscoveryEntryKind::CLIENT_PORT:
+                if (auto clientPortData = m_portPool->getClientPortData(position))
+                {
+                    this->handleClientPort(clientPortData);
+                }
+                break;
+            case popo::DiscoveryEntryKind::INTERFACE_PORT:
+                if (auto interfacePortData = m_portPool->getInterfacePortData(position))
+                {
+                    if (this->handleInterfacePort(interfacePortData))
+                    {
+                        interfacePortsForInitialForwarding.push_back(interfacePortData);
+                    }
+                }
+                break;
+            case popo::DiscoveryEntryKind::NODE:
+                if (auto nodeData = m_portPool->getNodeData(position))
+                {
+                    this->handleNode(nodeData);
+                }
+                break;
+            case popo::DiscoveryEntryKind::CONDITION_VARIABLE:
+                if (auto conditionVariableData = m_portPool->getConditionVariableData(position))
+                {
+                    this->handleConditionVariable(conditionVariableData);
+                }
+                break;
+            }
+        });
 
-    handleInterfaces();
+    forwardInitialOffersToInterfaces(interfacePortsForInitialForwarding);
+}
 
-    handleNodes();
+void PortManager::waitForDiscoveryRequest(const units::Duration& timeout) noexcept
+{
+    m_portPool->getDiscoveryTrigger().timedWait(timeout);
+}
 
-    handleConditionVariables();
+void PortManager::wakeUpDiscovery() noexcept
+{
+    m_portPool->getDiscoveryTrigger().wakeUp();
 }
 
-void PortManager::handlePublisherPorts() noexcept
+void PortManager::handlePublisherPort(PublisherPortRouDiType::MemberType_t* const publisherPortData) noexcept
 {
     // get the changes of publisher port offer state
-    for (auto publisherPortData : m_portPool->getPublisherPortDataList())
-    {
-        PublisherPortRouDiType publisherPort(publisherPortData);
+    PublisherPortRouDiType publisherPort(publisherPortData);
 
-        doDiscoveryForPublisherPort(publisherPort);
+    doDiscoveryForPublisherPort(publisherPort);
 
-        // check if we have to destroy this publisher port
-        if (publisherPort.toBeDestroyed())
-        {
-            destroyPublisherPort(publisherPortData);
-        }
+    // check if we have to destroy this publisher port
+    if (publisherPort.toBeDestroyed())
+    {
+        destroyPublisherPort(publisherPortData);
     }
 }
 
@@ -162,20 +220,17 @@ void PortManager::doDiscoveryForPublisherPort(PublisherPortRouDiType& publisherP
     });
 }
 
-void PortManager::handleSubscriberPorts() noexcept
+void PortManager::handleSubscriberPort(SubscriberPortType::MemberType_t* const subscriberPortData) noexcept
 {
     // get requests for change of subscription state of subscribers
-    for (auto subscriberPortData : m_portPool->getSubscriberPortDataList())
-    {
-        SubscriberPortType subscriberPort(subscriberPortData);
+    SubscriberPortType subscriberPort(subscriberPortData);
 
-        doDiscoveryForSubscriberPort(subscriberPort);
+    doDiscoveryForSubscriberPort(subscriberPort);
 
-        // check if we have to destroy this subscriber port
-        if (subscriberPort.toBeDestroyed())
-        {
-            destroySubscriberPort(subscriberPortData);
-        }
+    // check if we have to destroy this subscriber port
+    if (subscriberPort.toBeDestroyed())
+    {
+        destroySubscriberPort(subscriberPortData);
     }
 }
 
@@ -239,20 +294,17 @@ void PortManager::destroyClientPort(popo::ClientPortData* const clientPortData)
     m_portPool->removeClientPort(clientPortData);
 }
 
-void PortManager::handleClientPorts() noexcept
+void PortManager::handleClientPort(popo::ClientPortData* const clientPortData) noexcept
 {
     // get requests for change of connection state of clients
-    for (auto clientPortData : m_portPool->getClientPortDataList())
-    {
-        popo::ClientPortRouDi clientPort(*clientPortData);
+    popo::ClientPortRouDi clientPort(*clientPortData);
 
-        doDiscoveryForClientPort(clientPort);
+    doDiscoveryForClientPort(clientPort);
 
-        // check if we have to destroy this clinet port
-        if (clientPort.toBeDestroyed())
-        {
-            destroyClientPort(clientPortData);
-        }
+    // check if we have to destroy this clinet port
+    if (clientPort.toBeDestroyed())
+    {
+        destroyClientPort(clientPortData);
     }
 }
 
@@ -328,20 +380,17 @@ void PortManager::destroyServerPort(popo::ServerPortData* const serverPortData)
     m_portPool->removeServerPort(serverPortData);
 }
 
-void PortManager::handleServerPorts() noexcept
+void PortManager::handleServerPort(popo::ServerPortData* const serverPortData) noexcept
 {
     // get the changes of server port offer state
-    for (auto serverPortData : m_portPool->getServerPortDataList())
-    {
-        popo::ServerPortRouDi serverPort(*serverPortData);
+    popo::ServerPortRouDi serverPort(*serverPortData);
 
-        doDiscoveryForServerPort(serverPort);
+    doDiscoveryForServerPort(serverPort);
 
-        // check if we have to destroy this server port
-        if (serverPort.toBeDestroyed())
-        {
-            destroyServerPort(serverPortData);
-        }
+    // check if we have to destroy this server port
+    if (serverPort.toBeDestroyed())
+    {
+        destroyServerPort(serverPortData);
     }
 }
 
@@ -372,29 +421,27 @@ void PortManager::doDiscoveryForServerPort(popo::ServerPortRouDi& serverPort) no
     });
 }
 
-void PortManager::handleInterfaces() noexcept
+bool PortManager::handleInterfacePort(popo::InterfacePortData* const interfacePortData) noexcept
 {
-    // check if there are new interfaces that must get an initial offer information
-    vector<popo::InterfacePortData*, MAX_INTERFACE_NUMBER> interfacePortsForInitialForwarding;
+    // check if this is a new interface that must get an initial offer information
+    const bool doInitialOfferForward = interfacePortData->m_doInitialOfferForward;
+    interfacePortData->m_doInitialOfferForward = false;
 
-
-    for (auto interfacePortData : m_portPool->getInterfacePortDataList())
+    // check if we have to destroy this interface port
+    if (interfacePortData->m_toBeDestroyed.load(std::memory_order_relaxed))
     {
-        if (interfacePortData->m_doInitialOfferForward)
-        {
-            interfacePortsForInitialForwarding.push_back(interfacePortData);
-            interfacePortData->m_doInitialOfferForward = false;
-        }
-
-        // check if we have to destroy this interface port
-        if (interfacePortData->m_toBeDestroyed.load(std::memory_order_relaxed))
-        {
-            IOX_LOG(DEBUG) << "Destroy interface port from runtime '" << interfacePortData->m_runtimeName
-                           << "' and with service description '" << interfacePortData->m_serviceDescription << "'";
-            m_portPool->removeInterfacePort(interfacePortData);
-        }
+        IOX_LOG(DEBUG) << "Destroy interface port from runtime '" << interfacePortData->m_runtimeName
+                       << "' and with service description '" << interfacePortData->m_serviceDescription << "'";
+        m_portPool->removeInterfacePort(interfacePortData);
+        return false;
     }
 
+    return doInitialOfferForward;
+}
+
+void PortManager::forwardInitialOffersToInterfaces(
+    const vector<popo::InterfacePortData*, MAX_INTERFACE_NUMBER>& interfacePortsForInitialForwarding) noexcept
+{
     if (interfacePortsForInitialForwarding.size() > 0)
     {
         // provide offer information from all active publisher ports to all new interfaces
@@ -442,34 +489,28 @@ void PortManager::handleInterfaces() noexcept
     }
 }
 
-void PortManager::handleNodes() noexcept
+void PortManager::handleNode(runtime::NodeData* const nodeData) noexcept
 {
     /// @todo iox-#518 we have to update the introspection but node information is in process introspection which is not
     // accessible here. So currently nodes will be removed not before a process is removed
     // m_processIntrospection->removeNode(RuntimeName_t(process.c_str()),
     // NodeName_t(node.c_str()));
 
-    for (auto nodeData : m_portPool->getNodeDataList())
+    if (nodeData->m_toBeDestroyed.load(std::memory_order_relaxed))
     {
-        if (nodeData->m_toBeDestroyed.load(std::memory_order_relaxed))
-        {
-            IOX_LOG(DEBUG) << "Destroy NodeData from runtime '" << nodeData->m_runtimeName << "' and node name '"
-                           << nodeData->m_nodeName << "'";
-            m_portPool->removeNodeData(nodeData);
-        }
+        IOX_LOG(DEBUG) << "Destroy NodeData from runtime '" << nodeData->m_runtimeName << "' and node name '"
+                       << nodeData->m_nodeName << "'";
+        m_portPool->removeNodeData(nodeData);
     }
 }
 
-void PortManager::handleConditionVariables() noexcept
+void PortManager::handleConditionVariable(popo::ConditionVariableData* const conditionVariableData) noexcept
 {
-    for (auto conditionVariableData : m_portPool->getConditionVariableDataList())
+    if (conditionVariableData->m_toBeDestroyed.load(std::memory_order_relaxed))
     {
-        if (conditionVariableData->m_toBeDestroyed.load(std::memory_order_relaxed))
-        {
-            IOX_LOG(DEBUG) << "Destroy ConditionVariableData from runtime '" << conditionVariableData->m_runtimeName
-                           << "'";
-            m_portPool->removeConditionVariableData(conditionVariableData);
-        }
+        IOX_LOG(DEBUG) << "Destroy ConditionVariableData from runtime '" << conditionVariableData->m_runtimeName
+                       << "'";
+        m_portPool->removeConditionVariableData(conditionVariableData);
     }
 }
 
@@ -497,7 +538,8 @@ bool PortManager::sendToAllMatchingPublisherPorts(const capro::CaproMessage& mes
                                                   SubscriberPortType& subscriberSource) noexcept
 {
     bool publisherFound = false;
-    for (auto publisherPortData : m_portPool->getPublisherPortDataList())
+    // only the publishers with the same service description can be compatible
+    for (auto publisherPortData : m_portPool->getPublisherPortDataList(subscriberSource.getCaProServiceDescription()))
     {
         PublisherPortRouDiType publisherPort(publisherPortData);
 
@@ -508,7 +550,7 @@ bool PortManager::sendToAllMatchingPublisherPorts(const capro::CaproMessage& mes
         // they do not have the same interface otherwise we have cyclic connections in gateways
         if (publisherInterface != capro::Interfaces::INTERNAL && publisherInterface == messageInterface)
         {
-            break;
+            continue;
         }
 
         if (isCompatiblePubSub(publisherPort, subscriberSource))
@@ -535,7 +577,8 @@ bool PortManager::sendToAllMatchingPublisherPorts(const capro::CaproMessage& mes
 void PortManager::sendToAllMatchingSubscriberPorts(const capro::CaproMessage& message,
                                                    PublisherPortRouDiType& publisherSource) noexcept
 {
-    for (auto subscriberPortData : m_portPool->getSubscriberPortDataList())
+    // only the subscribers with the same service description can be compatible
+    for (auto subscriberPortData : m_portPool->getSubscriberPortDataList(publisherSource.getCaProServiceDescription()))
     {
         SubscriberPortType subscriberPort(subscriberPortData);
 
@@ -546,7 +589,7 @@ void PortManager::sendToAllMatchingSubscriberPorts(const capro::CaproMessage& me
         // they do not have the same interface otherwise we have cyclic connections in gateways
         if (subscriberInterface != capro::Interfaces::INTERNAL && subscriberInterface == messageInterface)
         {
-            break;
+            continue;
         }
 
         if (isCompatiblePubSub(publisherSource, subscriberPort))
@@ -723,6 +766,7 @@ void PortManager::deletePortsOfProcess(const RuntimeName_t& runtimeName) noexcep
     if (runtimeName == RuntimeName_t(iox::roudi::IPC_CHANNEL_ROUDI_NAME))
     {
         m_serviceRegistryPublisherPortData.reset();
+        m_serviceRegistryChangeLogPublisherPortData.reset();
     }
     for (auto port : m_portPool->getPublisherPortDataList())
     {
@@ -1058,6 +1102,49 @@ void PortManager::publishServiceRegistry() const noexcept
         .or_else([](auto&) { IOX_LOG(WARN) << "Could not allocate a chunk for the service registry!"; });
 }
 
+void PortManager::publishServiceRegistryChangeLog() const noexcept
+{
+    if (!m_serviceRegistryChangeLogPublisherPortData.has_value())
+    {
+        // should not happen (except during RouDi shutdown)
+        // the port always exists, otherwise we would terminate during startup
+        IOX_LOG(WARN) << "Could not publish service registry change log!";
+        return;
+    }
+    PublisherPortUserType publisher(m_serviceRegistryChangeLogPublisherPortData.value());
+    publisher
+        .tryAllocateChunk(sizeof(ServiceRegistryChangeLog),
+                          alignof(ServiceRegistryChangeLog),
+                          CHUNK_NO_USER_HEADER_SIZE,
+                          CHUNK_NO_USER_HEADER_ALIGNMENT)
+        .and_then([&](auto& chunk) {
+            new (chunk->userPayload()) ServiceRegistryChangeLog(m_serviceRegistryChangeLog);
+
+            publisher.sendChunk(chunk);
+        })
+        .or_else([](auto&) { IOX_LOG(WARN) << "Could not allocate a chunk for the service registry change log!"; });
+}
+
+void PortManager::publishServiceRegistryChange(const ServiceRegistryChangeLog::Operation operation,
+                                               const capro::ServiceDescription& service) noexcept
+{
+    const auto generation = m_serviceRegistry.generation();
+    if (generation == m_serviceRegistryChangeLog.generation())
+    {
+        // the registry was not modified, e.g. since it is full
+        return;
+    }
+    m_serviceRegistryChangeLog.record(generation, operation, service);
+
+    // the snapshot has to be published before the change log, the ServiceDiscovery then always finds a snapshot
+    // which is covered by the latest change log
+    if (generation % ServiceRegistryChangeLog::SNAPSHOT_INTERVAL == 0U)
+    {
+        publishServiceRegistry();
+    }
+    publishServiceRegistryChangeLog();
+}
+
 const ServiceRegistry& PortManager::serviceRegistry() const noexcept
 {
     return m_serviceRegistry;
@@ -1069,13 +1156,13 @@ void PortManager::addPublisherToServiceRegistry(const capro::ServiceDescription&
         IOX_LOG(WARN) << "Could not add publisher with service description '" << service << "' to service registry!";
         errorHandler(PoshError::POSH__PORT_MANAGER_COULD_NOT_ADD_SERVICE_TO_REGISTRY, ErrorLevel::MODERATE);
     });
-    publishServiceRegistry();
+    publishServiceRegistryChange(ServiceRegistryChangeLog::Operation::ADD_PUBLISHER, service);
 }
 
 void PortManager::removePublisherFromServiceRegistry(const capro::ServiceDescription& service) noexcept
 {
     m_serviceRegistry.removePublisher(service);
-    publishServiceRegistry();
+    publishServiceRegistryChange(ServiceRegistryChangeLog::Operation::REMOVE_PUBLISHER, service);
 }
 
 void PortManager::addServerToServiceRegistry(const capro::ServiceDescription& service) noexcept
@@ -1084,13 +1171,13 @@ void PortManager::addServerToServiceRegistry(const capro::ServiceDescription& se
         IOX_LOG(WARN) << "Could not add server with service description '" << service << "' to service registry!";
         errorHandler(PoshError::POSH__PORT_MANAGER_COULD_NOT_ADD_SERVICE_TO_REGISTRY, ErrorLevel::MODERATE);
     });
-    publishServiceRegistry();
+    publishServiceRegistryChange(ServiceRegistryChangeLog::Operation::ADD_SERVER, service);
 }
 
 void PortManager::removeServerFromServiceRegistry(const capro::ServiceDescription& service) noexcept
 {
     m_serviceRegistry.removeServer(service);
-    publishServiceRegistry();
+    publishServiceRegistryChange(ServiceRegistryChangeLog::Operation::REMOVE_SERVER, service);
 }
 
 expected<runtime::NodeData*, PortPoolError> PortManager::acquireNodeData(const RuntimeName_t& runtimeName,
@@ -1105,6 +1192,16 @@ PortManager::acquireConditionVariableData(const RuntimeName_t& runtimeName) noex
     return m_portPool->addConditionVariableData(runtimeName);
 }
 
+expected<runtime::Heartbeat*, PortPoolError> PortManager::acquireHeartbeat(const RuntimeName_t& runtimeName) noexcept
+{
+    return m_portPool->addHeartbeat(runtimeName);
+}
+
+void PortManager::releaseHeartbeat(const runtime::Heartbeat* const heartbeat) noexcept
+{
+    m_portPool->removeHeartbeat(heartbeat);
+}
+
 bool PortManager::isInternal(const capro::ServiceDescription& service) const noexcept
 {
     for (auto& internalService : m_internalServices)
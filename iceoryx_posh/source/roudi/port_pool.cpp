@@ -43,12 +43,59 @@ PortPool::getConditionVariableDataList() noexcept
     return m_portPoolData->m_conditionVariableMembers.content();
 }
 
+vector<runtime::Heartbeat*, MAX_PROCESS_NUMBER> PortPool::getHeartbeatList() noexcept
+{
+    return m_portPoolData->m_heartbeatMembers.content();
+}
+
+popo::DiscoveryTrigger& PortPool::getDiscoveryTrigger() noexcept
+{
+    return m_portPoolData->m_discoveryTrigger;
+}
+
+PublisherPortRouDiType::MemberType_t* PortPool::getPublisherPortData(const uint64_t position) noexcept
+{
+    return m_portPoolData->m_publisherPortMembers.get(position);
+}
+
+SubscriberPortType::MemberType_t* PortPool::getSubscriberPortData(const uint64_t position) noexcept
+{
+    return m_portPoolData->m_subscriberPortMembers.get(position);
+}
+
+popo::ClientPortData* PortPool::getClientPortData(const uint64_t position) noexcept
+{
+    return m_portPoolData->m_clientPortMembers.get(position);
+}
+
+popo::ServerPortData* PortPool::getServerPortData(const uint64_t position) noexcept
+{
+    return m_portPoolData->m_serverPortMembers.get(position);
+}
+
+popo::InterfacePortData* PortPool::getInterfacePortData(const uint64_t position) noexcept
+{
+    return m_portPoolData->m_interfacePortMembers.get(position);
+}
+
+runtime::NodeData* PortPool::getNodeData(const uint64_t position) noexcept
+{
+    return m_portPoolData->m_nodeMembers.get(position);
+}
+
+popo::ConditionVariableData* PortPool::getConditionVariableData(const uint64_t position) noexcept
+{
+    return m_portPoolData->m_conditionVariableMembers.get(position);
+}
+
 expected<popo::InterfacePortData*, PortPoolError> PortPool::addInterfacePort(const RuntimeName_t& runtimeName,
                                                                              const capro::Interfaces interface) noexcept
 {
     if (m_portPoolData->m_interfacePortMembers.hasFreeSpace())
     {
         auto interfacePortData = m_portPoolData->m_interfacePortMembers.insert(runtimeName, interface);
+        attachToDiscovery(
+            m_portPoolData->m_interfacePortMembers, interfacePortData, popo::DiscoveryEntryKind::INTERFACE_PORT);
         return success<popo::InterfacePortData*>(interfacePortData);
     }
     else
@@ -66,6 +113,7 @@ expected<runtime::NodeData*, PortPoolError> PortPool::addNodeData(const RuntimeN
     if (m_portPoolData->m_nodeMembers.hasFreeSpace())
     {
         auto nodeData = m_portPoolData->m_nodeMembers.insert(runtimeName, nodeName, nodeDeviceIdentifier);
+        attachToDiscovery(m_portPoolData->m_nodeMembers, nodeData, popo::DiscoveryEntryKind::NODE);
         return success<runtime::NodeData*>(nodeData);
     }
     else
@@ -83,6 +131,9 @@ PortPool::addConditionVariableData(const RuntimeName_t& runtimeName) noexcept
     if (m_portPoolData->m_conditionVariableMembers.hasFreeSpace())
     {
         auto conditionVariableData = m_portPoolData->m_conditionVariableMembers.insert(runtimeName);
+        attachToDiscovery(m_portPoolData->m_conditionVariableMembers,
+                          conditionVariableData,
+                          popo::DiscoveryEntryKind::CONDITION_VARIABLE);
         return success<popo::ConditionVariableData*>(conditionVariableData);
     }
     else
@@ -93,6 +144,21 @@ PortPool::addConditionVariableData(const RuntimeName_t& runtimeName) noexcept
     }
 }
 
+expected<runtime::Heartbeat*, PortPoolError> PortPool::addHeartbeat(const RuntimeName_t& runtimeName) noexcept
+{
+    if (m_portPoolData->m_heartbeatMembers.hasFreeSpace())
+    {
+        auto heartbeat = m_portPoolData->m_heartbeatMembers.insert();
+        return success<runtime::Heartbeat*>(heartbeat);
+    }
+    else
+    {
+        IOX_LOG(WARN) << "Out of heartbeats! Requested by runtime '" << runtimeName << "'";
+        errorHandler(PoshError::PORT_POOL__HEARTBEAT_LIST_OVERFLOW, ErrorLevel::MODERATE);
+        return error<PortPoolError>(PortPoolError::HEARTBEAT_LIST_FULL);
+    }
+}
+
 void PortPool::removeInterfacePort(const popo::InterfacePortData* const portData) noexcept
 {
     m_portPoolData->m_interfacePortMembers.erase(portData);
@@ -108,6 +174,11 @@ void PortPool::removeConditionVariableData(const popo::ConditionVariableData* co
     m_portPoolData->m_conditionVariableMembers.erase(conditionVariableData);
 }
 
+void PortPool::removeHeartbeat(const runtime::Heartbeat* const heartbeat) noexcept
+{
+    m_portPoolData->m_heartbeatMembers.erase(heartbeat);
+}
+
 vector<PublisherPortRouDiType::MemberType_t*, MAX_PUBLISHERS> PortPool::getPublisherPortDataList() noexcept
 {
     return m_portPoolData->m_publisherPortMembers.content();
@@ -118,6 +189,18 @@ vector<SubscriberPortType::MemberType_t*, MAX_SUBSCRIBERS> PortPool::getSubscrib
     return m_portPoolData->m_subscriberPortMembers.content();
 }
 
+vector<PublisherPortRouDiType::MemberType_t*, MAX_PUBLISHERS>
+PortPool::getPublisherPortDataList(const capro::ServiceDescription& service) noexcept
+{
+    return lookUpInServiceIndex<PublisherPortRouDiType::MemberType_t, MAX_PUBLISHERS>(m_publisherPortIndex, service);
+}
+
+vector<SubscriberPortType::MemberType_t*, MAX_SUBSCRIBERS>
+PortPool::getSubscriberPortDataList(const capro::ServiceDescription& service) noexcept
+{
+    return lookUpInServiceIndex<SubscriberPortType::MemberType_t, MAX_SUBSCRIBERS>(m_subscriberPortIndex, service);
+}
+
 expected<PublisherPortRouDiType::MemberType_t*, PortPoolError>
 PortPool::addPublisherPort(const capro::ServiceDescription& serviceDescription,
                            mepoo::MemoryManager* const memoryManager,
@@ -129,6 +212,9 @@ PortPool::addPublisherPort(const capro::ServiceDescription& serviceDescription,
     {
         auto publisherPortData = m_portPoolData->m_publisherPortMembers.insert(
             serviceDescription, runtimeName, memoryManager, publisherOptions, memoryInfo);
+        attachToDiscovery(
+            m_portPoolData->m_publisherPortMembers, publisherPortData, popo::DiscoveryEntryKind::PUBLISHER_PORT);
+        addToServiceIndex(m_publisherPortIndex, publisherPortData);
         return success<PublisherPortRouDiType::MemberType_t*>(publisherPortData);
     }
     else
@@ -148,8 +234,26 @@ PortPool::addSubscriberPort(const capro::ServiceDescription& serviceDescription,
 {
     if (m_portPoolData->m_subscriberPortMembers.hasFreeSpace())
     {
+        popo::LatencyHistogram* latencyHistogram{nullptr};
+        if (subscriberOptions.recordLatencyHistogram)
+        {
+            if (m_portPoolData->m_latencyHistogramMembers.hasFreeSpace())
+            {
+                latencyHistogram = m_portPoolData->m_latencyHistogramMembers.insert();
+            }
+            else
+            {
+                IOX_LOG(WARN) << "Out of latency histograms! The subscriber port requested by runtime '" << runtimeName
+                              << "' and with service description '" << serviceDescription
+                              << "' does not record the latency";
+            }
+        }
+
         auto subscriberPortData = constructSubscriber<iox::build::CommunicationPolicy>(
-            serviceDescription, runtimeName, subscriberOptions, memoryInfo);
+            serviceDescription, runtimeName, subscriberOptions, memoryInfo, latencyHistogram);
+        attachToDiscovery(
+            m_portPoolData->m_subscriberPortMembers, subscriberPortData, popo::DiscoveryEntryKind::SUBSCRIBER_PORT);
+        addToServiceIndex(m_subscriberPortIndex, subscriberPortData);
 
         return success<SubscriberPortType::MemberType_t*>(subscriberPortData);
     }
@@ -189,6 +293,7 @@ PortPool::addClientPort(const capro::ServiceDescription& serviceDescription,
 
     auto clientPortData = m_portPoolData->m_clientPortMembers.insert(
         serviceDescription, runtimeName, clientOptions, memoryManager, memoryInfo);
+    attachToDiscovery(m_portPoolData->m_clientPortMembers, clientPortData, popo::DiscoveryEntryKind::CLIENT_PORT);
     return success<popo::ClientPortData*>(clientPortData);
 }
 
@@ -209,16 +314,20 @@ PortPool::addServerPort(const capro::ServiceDescription& serviceDescription,
 
     auto serverPortData = m_portPoolData->m_serverPortMembers.insert(
         serviceDescription, runtimeName, serverOptions, memoryManager, memoryInfo);
+    attachToDiscovery(m_portPoolData->m_serverPortMembers, serverPortData, popo::DiscoveryEntryKind::SERVER_PORT);
     return success<popo::ServerPortData*>(serverPortData);
 }
 
 void PortPool::removePublisherPort(const PublisherPortRouDiType::MemberType_t* const portData) noexcept
 {
+    removeFromServiceIndex(m_publisherPortIndex, portData);
     m_portPoolData->m_publisherPortMembers.erase(portData);
 }
 
 void PortPool::removeSubscriberPort(const SubscriberPortType::MemberType_t* const portData) noexcept
 {
+    removeFromServiceIndex(m_subscriberPortIndex, portData);
+    m_portPoolData->m_latencyHistogramMembers.erase(portData->m_chunkReceiverData.m_latencyHistogram.get());
     m_portPoolData->m_subscriberPortMembers.erase(portData);
 }
 
@@ -18,6 +18,7 @@
 #include "iceoryx_posh/internal/roudi/process.hpp"
 #include "iceoryx_platform/types.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/runtime/ipc_binary_message.hpp"
 #include "iox/logging.hpp"
 
 using namespace iox::units::duration_literals;
@@ -28,14 +29,15 @@ namespace roudi
 Process::Process(const RuntimeName_t& name,
                  const uint32_t pid,
                  const posix::PosixUser& user,
-                 const bool isMonitored,
-                 const uint64_t sessionId) noexcept
+                 runtime::Heartbeat* const heartbeat,
+                 const uint64_t sessionId,
+                 const runtime::IpcProtocol ipcProtocol) noexcept
     : m_pid(pid)
     , m_ipcChannel(name)
-    , m_timestamp(mepoo::BaseClock_t::now())
+    , m_heartbeat(heartbeat)
     , m_user(user)
-    , m_isMonitored(isMonitored)
     , m_sessionId(sessionId)
+    , m_ipcProtocol(ipcProtocol)
 {
 }
 
@@ -59,19 +61,29 @@ void Process::sendViaIpcChannel(const runtime::IpcMessage& data) noexcept
     }
 }
 
-uint64_t Process::getSessionId() noexcept
+void Process::sendViaIpcChannel(const runtime::IpcBinaryMessage& data) noexcept
 {
-    return m_sessionId.load(std::memory_order_relaxed);
+    bool sendSuccess = m_ipcChannel.send(data);
+    if (!sendSuccess)
+    {
+        IOX_LOG(WARN) << "Process cannot send binary message over communication channel";
+        errorHandler(PoshError::POSH__ROUDI_PROCESS_SEND_VIA_IPC_CHANNEL_FAILED, ErrorLevel::MODERATE);
+    }
+}
+
+runtime::IpcProtocol Process::getIpcProtocol() const noexcept
+{
+    return m_ipcProtocol;
 }
 
-void Process::setTimestamp(const mepoo::TimePointNs_t timestamp) noexcept
+uint64_t Process::getSessionId() noexcept
 {
-    m_timestamp = timestamp;
+    return m_sessionId.load(std::memory_order_relaxed);
 }
 
-mepoo::TimePointNs_t Process::getTimestamp() noexcept
+runtime::Heartbeat* Process::getHeartbeat() const noexcept
 {
-    return m_timestamp;
+    return m_heartbeat;
 }
 
 posix::PosixUser Process::getUser() const noexcept
@@ -81,7 +93,7 @@ posix::PosixUser Process::getUser() const noexcept
 
 bool Process::isMonitored() const noexcept
 {
-    return m_isMonitored;
+    return m_heartbeat != nullptr;
 }
 
 } // namespace roudi
@@ -17,12 +17,12 @@
 
 #include "iceoryx_posh/internal/roudi/process_manager.hpp"
 #include "iceoryx_dust/cxx/convert.hpp"
-#include "iceoryx_dust/cxx/std_chrono_support.hpp"
 #include "iceoryx_hoofs/posix_wrapper/posix_call.hpp"
 #include "iceoryx_platform/signal.hpp"
 #include "iceoryx_platform/types.hpp"
 #include "iceoryx_platform/wait.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/runtime/ipc_binary_message.hpp"
 #include "iox/logging.hpp"
 #include "iox/relative_pointer.hpp"
 #include "iox/vector.hpp"
@@ -130,6 +130,10 @@ void ProcessManager::printWarningForRegisteredProcessesAndClearProcessList() noe
     {
         IOX_LOG(WARN) << "Process ID " << process.getPid() << " named '" << process.getName()
                       << "' is still running after SIGKILL was sent. RouDi is ignoring this process.";
+        if (process.isMonitored())
+        {
+            m_portManager.releaseHeartbeat(process.getHeartbeat());
+        }
     }
     m_processList.clear();
 }
@@ -193,7 +197,8 @@ bool ProcessManager::registerProcess(const RuntimeName_t& name,
                                      const bool isMonitored,
                                      const int64_t transmissionTimestamp,
                                      const uint64_t sessionId,
-                                     const version::VersionInfo& versionInfo) noexcept
+                                     const version::VersionInfo& versionInfo,
+                                     const runtime::IpcProtocol ipcProtocol) noexcept
 {
     bool returnValue{false};
 
@@ -222,13 +227,14 @@ bool ProcessManager::registerProcess(const RuntimeName_t& name,
             else
             {
                 // try registration again, should succeed since removal was successful
-                returnValue =
-                    this->addProcess(name, pid, user, isMonitored, transmissionTimestamp, sessionId, versionInfo);
+                returnValue = this->addProcess(
+                    name, pid, user, isMonitored, transmissionTimestamp, sessionId, versionInfo, ipcProtocol);
             }
         })
         .or_else([&]() {
             // process does not exist in list and can be added
-            returnValue = this->addProcess(name, pid, user, isMonitored, transmissionTimestamp, sessionId, versionInfo);
+            returnValue = this->addProcess(
+                name, pid, user, isMonitored, transmissionTimestamp, sessionId, versionInfo, ipcProtocol);
         });
 
     return returnValue;
@@ -240,7 +246,8 @@ bool ProcessManager::addProcess(const RuntimeName_t& name,
                                 const bool isMonitored,
                                 const int64_t transmissionTimestamp,
                                 const uint64_t sessionId,
-                                const version::VersionInfo& versionInfo) noexcept
+                                const version::VersionInfo& versionInfo,
+                                const runtime::IpcProtocol ipcProtocol) noexcept
 {
     if (!version::VersionInfo::getCurrentVersion().checkCompatibility(versionInfo, m_compatibilityCheckLevel))
     {
@@ -257,21 +264,43 @@ bool ProcessManager::addProcess(const RuntimeName_t& name,
         IOX_LOG(ERROR) << "Could not register process '" << name << "' - too many processes";
         return false;
     }
-    m_processList.emplace_back(name, pid, user, isMonitored, sessionId);
+
+    // the runtime of a monitored process beats the heartbeat in the management segment instead of sending keep alive
+    // messages; RouDi only reads it in monitorProcesses
+    runtime::Heartbeat* heartbeat{nullptr};
+    UntypedRelativePointer::offset_t heartbeatOffset{UntypedRelativePointer::NULL_POINTER_OFFSET};
+    if (isMonitored)
+    {
+        auto maybeHeartbeat = m_portManager.acquireHeartbeat(name);
+        if (maybeHeartbeat.has_error())
+        {
+            IOX_LOG(ERROR) << "Could not register process '" << name << "' - no heartbeat available";
+            return false;
+        }
+        heartbeat = maybeHeartbeat.value();
+        heartbeatOffset = UntypedRelativePointer::getOffset(segment_id_t{m_mgmtSegmentId}, heartbeat);
+    }
+
+    m_processList.emplace_back(name, pid, user, heartbeat, sessionId, ipcProtocol);
 
     // send REG_ACK and BaseAddrString
     runtime::IpcMessage sendBuffer;
-    const bool sendKeepAlive = isMonitored;
 
     auto offset = UntypedRelativePointer::getOffset(segment_id_t{m_mgmtSegmentId}, m_segmentManager);
     sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::REG_ACK)
                << m_roudiMemoryInterface.mgmtMemoryProvider()->size() << offset << transmissionTimestamp
-               << m_mgmtSegmentId << sendKeepAlive;
+               << m_mgmtSegmentId << isMonitored << heartbeatOffset
+               << ((ipcProtocol == runtime::IpcProtocol::BINARY)
+                       ? static_cast<uint32_t>(runtime::IpcBinaryMessage::PROTOCOL_VERSION)
+                       : 0U);
 
     m_processList.back().sendViaIpcChannel(sendBuffer);
 
-    // set current timestamp again (already done in Process's constructor
-    m_processList.back().setTimestamp(mepoo::BaseClock_t::now());
+    // the registration could have taken a while, therefore the heartbeat is reset before the monitoring starts
+    if (heartbeat != nullptr)
+    {
+        heartbeat->beat();
+    }
 
     m_processIntrospection->addProcess(static_cast<int>(pid), name);
 
@@ -316,7 +345,12 @@ bool ProcessManager::removeProcessAndDeleteRespectiveSharedMemoryObjects(Process
     if (processIter != m_processList.end())
     {
         m_portManager.deletePortsOfProcess(processIter->getName());
+        m_segmentManager->releaseChunkCacheSlotsOfProcess(processIter->getPid());
         m_processIntrospection->removeProcess(static_cast<int32_t>(processIter->getPid()));
+        if (processIter->isMonitored())
+        {
+            m_portManager.releaseHeartbeat(processIter->getHeartbeat());
+        }
 
         if (feedback == TerminationFeedback::SEND_ACK_TO_PROCESS)
         {
@@ -332,16 +366,6 @@ bool ProcessManager::removeProcessAndDeleteRespectiveSharedMemoryObjects(Process
     return false;
 }
 
-void ProcessManager::updateLivelinessOfProcess(const RuntimeName_t& name) noexcept
-{
-    findProcess(name)
-        .and_then([&](auto& process) {
-            // reset timestamp
-            process->setTimestamp(mepoo::BaseClock_t::now());
-        })
-        .or_else([&]() { IOX_LOG(WARN) << "Received Keepalive from unknown process " << name; });
-}
-
 void ProcessManager::addInterfaceForProcess(const RuntimeName_t& name,
                                             capro::Interfaces interface,
                                             const NodeName_t& node) noexcept
@@ -422,22 +446,14 @@ void ProcessManager::addSubscriberForProcess(const RuntimeName_t& name,
             if (!maybeSubscriber.has_error())
             {
                 // send SubscriberPort to app as a serialized relative pointer
-                auto offset = UntypedRelativePointer::getOffset(segment_id_t{m_mgmtSegmentId}, maybeSubscriber.value());
-
-                runtime::IpcMessage sendBuffer;
-                sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::CREATE_SUBSCRIBER_ACK)
-                           << cxx::convert::toString(offset) << cxx::convert::toString(m_mgmtSegmentId);
-                process->sendViaIpcChannel(sendBuffer);
+                sendAckToRuntime(*process, runtime::IpcMessageType::CREATE_SUBSCRIBER_ACK, maybeSubscriber.value());
 
                 IOX_LOG(DEBUG) << "Created new SubscriberPort for application '" << name
                                << "' with service description '" << service << "'";
             }
             else
             {
-                runtime::IpcMessage sendBuffer;
-                sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR);
-                sendBuffer << runtime::IpcMessageErrorTypeToString(runtime::IpcMessageErrorType::SUBSCRIBER_LIST_FULL);
-                process->sendViaIpcChannel(sendBuffer);
+                sendErrorToRuntime(*process, runtime::IpcMessageErrorType::SUBSCRIBER_LIST_FULL);
                 IOX_LOG(ERROR) << "Could not create SubscriberPort for application '" << name
                                << "' with service description '" << service << "'";
             }
@@ -460,11 +476,7 @@ void ProcessManager::addPublisherForProcess(const RuntimeName_t& name,
             if (!segmentInfo.m_memoryManager.has_value())
             {
                 // Tell the app no writable shared memory segment was found
-                runtime::IpcMessage sendBuffer;
-                sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR);
-                sendBuffer << runtime::IpcMessageErrorTypeToString(
-                    runtime::IpcMessageErrorType::REQUEST_PUBLISHER_NO_WRITABLE_SHM_SEGMENT);
-                process->sendViaIpcChannel(sendBuffer);
+                sendErrorToRuntime(*process, runtime::IpcMessageErrorType::REQUEST_PUBLISHER_NO_WRITABLE_SHM_SEGMENT);
                 return;
             }
 
@@ -474,44 +486,34 @@ void ProcessManager::addPublisherForProcess(const RuntimeName_t& name,
             if (!maybePublisher.has_error())
             {
                 // send PublisherPort to app as a serialized relative pointer
-                auto offset = UntypedRelativePointer::getOffset(segment_id_t{m_mgmtSegmentId}, maybePublisher.value());
-
-                runtime::IpcMessage sendBuffer;
-                sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::CREATE_PUBLISHER_ACK)
-                           << cxx::convert::toString(offset) << cxx::convert::toString(m_mgmtSegmentId);
-                process->sendViaIpcChannel(sendBuffer);
+                sendAckToRuntime(*process, runtime::IpcMessageType::CREATE_PUBLISHER_ACK, maybePublisher.value());
 
                 IOX_LOG(DEBUG) << "Created new PublisherPort for application '" << name
                                << "' with service description '" << service << "'";
             }
             else
             {
-                runtime::IpcMessage sendBuffer;
-                sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR);
-
-                std::string error;
+                runtime::IpcMessageErrorType error{runtime::IpcMessageErrorType::PUBLISHER_LIST_FULL};
                 switch (maybePublisher.get_error())
                 {
                 case PortPoolError::UNIQUE_PUBLISHER_PORT_ALREADY_EXISTS:
                 {
-                    error = runtime::IpcMessageErrorTypeToString(runtime::IpcMessageErrorType::NO_UNIQUE_CREATED);
+                    error = runtime::IpcMessageErrorType::NO_UNIQUE_CREATED;
                     break;
                 }
                 case PortPoolError::INTERNAL_SERVICE_DESCRIPTION_IS_FORBIDDEN:
                 {
-                    error = runtime::IpcMessageErrorTypeToString(
-                        runtime::IpcMessageErrorType::INTERNAL_SERVICE_DESCRIPTION_IS_FORBIDDEN);
+                    error = runtime::IpcMessageErrorType::INTERNAL_SERVICE_DESCRIPTION_IS_FORBIDDEN;
                     break;
                 }
                 default:
                 {
-                    error = runtime::IpcMessageErrorTypeToString(runtime::IpcMessageErrorType::PUBLISHER_LIST_FULL);
+                    error = runtime::IpcMessageErrorType::PUBLISHER_LIST_FULL;
                     break;
                 }
                 }
-                sendBuffer << error;
 
-                process->sendViaIpcChannel(sendBuffer);
+                sendErrorToRuntime(*process, error);
                 IOX_LOG(ERROR) << "Could not create PublisherPort for application '" << name
                                << "' with service description '" << service << "'";
             }
@@ -534,11 +536,7 @@ void ProcessManager::addClientForProcess(const RuntimeName_t& name,
             if (!segmentInfo.m_memoryManager.has_value())
             {
                 // Tell the app no writable shared memory segment was found
-                runtime::IpcMessage sendBuffer;
-                sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR);
-                sendBuffer << runtime::IpcMessageErrorTypeToString(
-                    runtime::IpcMessageErrorType::REQUEST_CLIENT_NO_WRITABLE_SHM_SEGMENT);
-                process->sendViaIpcChannel(sendBuffer);
+                sendErrorToRuntime(*process, runtime::IpcMessageErrorType::REQUEST_CLIENT_NO_WRITABLE_SHM_SEGMENT);
                 return;
             }
 
@@ -546,23 +544,13 @@ void ProcessManager::addClientForProcess(const RuntimeName_t& name,
                 .acquireClientPortData(
                     service, clientOptions, name, &segmentInfo.m_memoryManager.value().get(), portConfigInfo)
                 .and_then([&](auto& clientPort) {
-                    auto relativePtrToClientPort =
-                        UntypedRelativePointer::getOffset(segment_id_t{m_mgmtSegmentId}, clientPort);
-
-                    runtime::IpcMessage sendBuffer;
-                    sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::CREATE_CLIENT_ACK)
-                               << cxx::convert::toString(relativePtrToClientPort)
-                               << cxx::convert::toString(m_mgmtSegmentId);
-                    process->sendViaIpcChannel(sendBuffer);
+                    sendAckToRuntime(*process, runtime::IpcMessageType::CREATE_CLIENT_ACK, clientPort);
 
                     IOX_LOG(DEBUG) << "Created new ClientPort for application '" << name
                                    << "' with service description '" << service << "'";
                 })
                 .or_else([&](auto&) {
-                    runtime::IpcMessage sendBuffer;
-                    sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR);
-                    sendBuffer << runtime::IpcMessageErrorTypeToString(runtime::IpcMessageErrorType::CLIENT_LIST_FULL);
-                    process->sendViaIpcChannel(sendBuffer);
+                    sendErrorToRuntime(*process, runtime::IpcMessageErrorType::CLIENT_LIST_FULL);
 
                     IOX_LOG(ERROR) << "Could not create ClientPort for application '" << name
                                    << "' with service description '" << service << "'";
@@ -586,11 +574,7 @@ void ProcessManager::addServerForProcess(const RuntimeName_t& name,
             if (!segmentInfo.m_memoryManager.has_value())
             {
                 // Tell the app no writable shared memory segment was found
-                runtime::IpcMessage sendBuffer;
-                sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR);
-                sendBuffer << runtime::IpcMessageErrorTypeToString(
-                    runtime::IpcMessageErrorType::REQUEST_SERVER_NO_WRITABLE_SHM_SEGMENT);
-                process->sendViaIpcChannel(sendBuffer);
+                sendErrorToRuntime(*process, runtime::IpcMessageErrorType::REQUEST_SERVER_NO_WRITABLE_SHM_SEGMENT);
                 return;
             }
 
@@ -598,23 +582,13 @@ void ProcessManager::addServerForProcess(const RuntimeName_t& name,
                 .acquireServerPortData(
                     service, serverOptions, name, &segmentInfo.m_memoryManager.value().get(), portConfigInfo)
                 .and_then([&](auto& serverPort) {
-                    auto relativePtrToServerPort =
-                        UntypedRelativePointer::getOffset(segment_id_t{m_mgmtSegmentId}, serverPort);
-
-                    runtime::IpcMessage sendBuffer;
-                    sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::CREATE_SERVER_ACK)
-                               << cxx::convert::toString(relativePtrToServerPort)
-                               << cxx::convert::toString(m_mgmtSegmentId);
-                    process->sendViaIpcChannel(sendBuffer);
+                    sendAckToRuntime(*process, runtime::IpcMessageType::CREATE_SERVER_ACK, serverPort);
 
                     IOX_LOG(DEBUG) << "Created new ServerPort for application '" << name
                                    << "' with service description '" << service << "'";
                 })
                 .or_else([&](auto&) {
-                    runtime::IpcMessage sendBuffer;
-                    sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR);
-                    sendBuffer << runtime::IpcMessageErrorTypeToString(runtime::IpcMessageErrorType::SERVER_LIST_FULL);
-                    process->sendViaIpcChannel(sendBuffer);
+                    sendErrorToRuntime(*process, runtime::IpcMessageErrorType::SERVER_LIST_FULL);
 
                     IOX_LOG(ERROR) << "Could not create ServerPort for application '" << name
                                    << "' with service description '" << service << "'";
@@ -632,25 +606,15 @@ void ProcessManager::addConditionVariableForProcess(const RuntimeName_t& runtime
         .and_then([&](auto& process) { // Try to create a condition variable
             m_portManager.acquireConditionVariableData(runtimeName)
                 .and_then([&](auto condVar) {
-                    auto offset = UntypedRelativePointer::getOffset(segment_id_t{m_mgmtSegmentId}, condVar);
-
-                    runtime::IpcMessage sendBuffer;
-                    sendBuffer << runtime::IpcMessageTypeToString(
-                        runtime::IpcMessageType::CREATE_CONDITION_VARIABLE_ACK)
-                               << cxx::convert::toString(offset) << cxx::convert::toString(m_mgmtSegmentId);
-                    process->sendViaIpcChannel(sendBuffer);
+                    sendAckToRuntime(*process, runtime::IpcMessageType::CREATE_CONDITION_VARIABLE_ACK, condVar);
 
                     IOX_LOG(DEBUG) << "Created new ConditionVariable for application " << runtimeName;
                 })
                 .or_else([&](PortPoolError error) {
-                    runtime::IpcMessage sendBuffer;
-                    sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR);
-                    if (error == PortPoolError::CONDITION_VARIABLE_LIST_FULL)
-                    {
-                        sendBuffer << runtime::IpcMessageErrorTypeToString(
-                            runtime::IpcMessageErrorType::CONDITION_VARIABLE_LIST_FULL);
-                    }
-                    process->sendViaIpcChannel(sendBuffer);
+                    sendErrorToRuntime(*process,
+                                       (error == PortPoolError::CONDITION_VARIABLE_LIST_FULL)
+                                           ? runtime::IpcMessageErrorType::CONDITION_VARIABLE_LIST_FULL
+                                           : runtime::IpcMessageErrorType::NOTYPE);
 
                     IOX_LOG(DEBUG) << "Could not create new ConditionVariable for application " << runtimeName;
                 });
@@ -694,14 +658,12 @@ optional<Process*> ProcessManager::findProcess(const RuntimeName_t& name) noexce
 
 void ProcessManager::monitorProcesses() noexcept
 {
-    auto currentTimestamp = mepoo::BaseClock_t::now();
-
     auto processIterator = m_processList.begin();
     while (processIterator != m_processList.end())
     {
         if (processIterator->isMonitored())
         {
-            auto timediff = into<units::Duration>(currentTimestamp - processIterator->getTimestamp());
+            auto timediff = processIterator->getHeartbeat()->durationSinceLastBeat();
 
             static_assert(runtime::PROCESS_KEEP_ALIVE_TIMEOUT > runtime::PROCESS_KEEP_ALIVE_INTERVAL,
                           "keep alive timeout too small");
@@ -717,8 +679,10 @@ void ProcessManager::monitorProcesses() noexcept
                 // memory and the associated RouDi discovery ports
                 // @todo iox-#539 Check if ShmManager and Process Manager end up in unintended condition
                 m_portManager.deletePortsOfProcess(processIterator->getName());
+                m_segmentManager->releaseChunkCacheSlotsOfProcess(processIterator->getPid());
 
                 m_processIntrospection->removeProcess(static_cast<int32_t>(processIterator->getPid()));
+                m_portManager.releaseHeartbeat(processIterator->getHeartbeat());
 
                 // delete application
                 processIterator = m_processList.erase(processIterator);
@@ -734,5 +698,41 @@ void ProcessManager::discoveryUpdate() noexcept
     m_portManager.doDiscovery();
 }
 
+void ProcessManager::sendAckToRuntime(Process& process,
+                                      const runtime::IpcMessageType ackType,
+                                      void* const data) noexcept
+{
+    auto offset = UntypedRelativePointer::getOffset(segment_id_t{m_mgmtSegmentId}, data);
+
+    if (process.getIpcProtocol() == runtime::IpcProtocol::BINARY)
+    {
+        runtime::IpcBinaryMessage sendBuffer{ackType};
+        sendBuffer << offset << m_mgmtSegmentId;
+        process.sendViaIpcChannel(sendBuffer);
+        return;
+    }
+
+    runtime::IpcMessage sendBuffer;
+    sendBuffer << runtime::IpcMessageTypeToString(ackType) << cxx::convert::toString(offset)
+               << cxx::convert::toString(m_mgmtSegmentId);
+    process.sendViaIpcChannel(sendBuffer);
+}
+
+void ProcessManager::sendErrorToRuntime(Process& process, const runtime::IpcMessageErrorType error) noexcept
+{
+    if (process.getIpcProtocol() == runtime::IpcProtocol::BINARY)
+    {
+        runtime::IpcBinaryMessage sendBuffer{runtime::IpcMessageType::ERROR};
+        sendBuffer << error;
+        process.sendViaIpcChannel(sendBuffer);
+        return;
+    }
+
+    runtime::IpcMessage sendBuffer;
+    sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR)
+               << runtime::IpcMessageErrorTypeToString(error);
+    process.sendViaIpcChannel(sendBuffer);
+}
+
 } // namespace roudi
 } // namespace iox
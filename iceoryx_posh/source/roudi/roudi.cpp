@@ -21,6 +21,7 @@
 #include "iceoryx_hoofs/internal/posix_wrapper/system_configuration.hpp"
 #include "iceoryx_hoofs/posix_wrapper/posix_access_rights.hpp"
 #include "iceoryx_hoofs/posix_wrapper/thread.hpp"
+#include "iceoryx_posh/internal/runtime/ipc_binary_message.hpp"
 #include "iceoryx_posh/internal/runtime/node_property.hpp"
 #include "iceoryx_posh/popo/subscriber_options.hpp"
 #include "iceoryx_posh/roudi/introspection_types.hpp"
@@ -49,6 +50,7 @@ RouDi::RouDi(RouDiMemoryInterface& roudiMemoryInterface,
           PublisherPortUserType(m_prcMgr->addIntrospectionPublisherPort(IntrospectionMempoolService)))
     , m_monitoringMode(roudiStartupParameters.m_monitoringMode)
     , m_processKillDelay(roudiStartupParameters.m_processKillDelay)
+    , m_ipcProtocol(roudiStartupParameters.m_ipcProtocol)
 {
     if (internal::isCompiledOn32BitSystem())
     {
@@ -91,6 +93,7 @@ void RouDi::shutdown() noexcept
 
     // stop the process management thread in order to prevent application to register while shutting down
     m_runMonitoringAndDiscoveryThread = false;
+    m_portManager->wakeUpDiscovery();
     if (m_monitoringAndDiscoveryThread.joinable())
     {
         IOX_LOG(DEBUG) << "Joining 'Mon+Discover' thread...";
@@ -155,7 +158,9 @@ void RouDi::monitorAndDiscoveryUpdate() noexcept
 
         cyclicUpdateHook();
 
-        std::this_thread::sleep_for(std::chrono::milliseconds(DISCOVERY_INTERVAL.toMilliseconds()));
+        // the ports wake up the discovery when they have pending requests; the timeout keeps the process monitoring
+        // running when there are none
+        m_portManager->waitForDiscoveryRequest(DISCOVERY_INTERVAL);
     }
 }
 
@@ -168,15 +173,22 @@ void RouDi::processRuntimeMessages() noexcept
 
     while (m_runHandleRuntimeMessageThread)
     {
-        // read RouDi's IPC channel
+        // read RouDi's IPC channel; runtimes which negotiated the binary protocol send their port requests binary
         runtime::IpcMessage message;
-        if (roudiIpcInterface.timedReceive(m_runtimeMessagesThreadTimeout, message))
-        {
-            auto cmd = runtime::stringToIpcMessageType(message.getElementAtIndex(0).c_str());
-            RuntimeName_t runtimeName{into<lossy<RuntimeName_t>>(message.getElementAtIndex(1))};
-
-            processMessage(message, cmd, runtimeName);
-        }
+        runtime::IpcBinaryMessage binaryMessage;
+        roudiIpcInterface.timedReceive(m_runtimeMessagesThreadTimeout, message, binaryMessage)
+            .and_then([&](auto protocol) {
+                if (protocol == runtime::IpcProtocol::BINARY)
+                {
+                    this->processBinaryMessage(binaryMessage);
+                    return;
+                }
+
+                auto cmd = runtime::stringToIpcMessageType(message.getElementAtIndex(0).c_str());
+                RuntimeName_t runtimeName{into<lossy<RuntimeName_t>>(message.getElementAtIndex(1))};
+
+                this->processMessage(message, cmd, runtimeName);
+            });
     }
 }
 
@@ -200,7 +212,11 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
     {
     case runtime::IpcMessageType::REG:
     {
-        if (message.getNumberOfElements() != 6)
+        // runtimes without the binary protocol do not send the version of the protocol they support
+        constexpr uint32_t REGISTER_PARAMETERS_WITHOUT_PROTOCOL{6U};
+        constexpr uint32_t REGISTER_PARAMETERS{7U};
+        const auto numberOfElements = message.getNumberOfElements();
+        if (numberOfElements != REGISTER_PARAMETERS && numberOfElements != REGISTER_PARAMETERS_WITHOUT_PROTOCOL)
         {
             IOX_LOG(ERROR) << "Wrong number of parameters for \"IpcMessageType::REG\" from \"" << runtimeName
                            << "\"received!";
@@ -211,13 +227,19 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
             uid_t userId{0};
             int64_t transmissionTimestamp{0};
             version::VersionInfo versionInfo = parseRegisterMessage(message, pid, userId, transmissionTimestamp);
+            uint32_t ipcProtocolVersion{0U};
+            if (numberOfElements == REGISTER_PARAMETERS)
+            {
+                cxx::convert::fromString(message.getElementAtIndex(6).c_str(), ipcProtocolVersion);
+            }
 
             registerProcess(runtimeName,
                             pid,
                             iox::posix::PosixUser{userId},
                             transmissionTimestamp,
                             getUniqueSessionIdForProcess(),
-                            versionInfo);
+                            versionInfo,
+                            ipcProtocolVersion);
         }
         break;
     }
@@ -410,11 +432,6 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
         }
         break;
     }
-    case runtime::IpcMessageType::KEEPALIVE:
-    {
-        m_prcMgr->updateLivelinessOfProcess(runtimeName);
-        break;
-    }
     case runtime::IpcMessageType::PREPARE_APP_TERMINATION:
     {
         if (message.getNumberOfElements() != 2)
@@ -452,16 +469,115 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
     }
 }
 
+void RouDi::processBinaryMessage(runtime::IpcBinaryMessage& message) noexcept
+{
+    const auto cmd = message.getType();
+    RuntimeName_t runtimeName;
+    message >> runtimeName;
+    if (!message.isValid())
+    {
+        IOX_LOG(ERROR) << "Received a binary message without a runtime name!";
+        return;
+    }
+
+    auto logInvalidMessage = [&runtimeName](const char* const type) {
+        IOX_LOG(ERROR) << "Invalid binary message for \"IpcMessageType::" << type << "\" from \"" << runtimeName
+                       << "\" received!";
+    };
+
+    switch (cmd)
+    {
+    case runtime::IpcMessageType::CREATE_PUBLISHER:
+    {
+        capro::ServiceDescription service;
+        popo::PublisherOptions publisherOptions;
+        runtime::PortConfigInfo portConfigInfo;
+        message >> service >> publisherOptions >> portConfigInfo;
+        if (!message.isValid())
+        {
+            logInvalidMessage("CREATE_PUBLISHER");
+            break;
+        }
+
+        m_prcMgr->addPublisherForProcess(runtimeName, service, publisherOptions, portConfigInfo);
+        break;
+    }
+    case runtime::IpcMessageType::CREATE_SUBSCRIBER:
+    {
+        capro::ServiceDescription service;
+        popo::SubscriberOptions subscriberOptions;
+        runtime::PortConfigInfo portConfigInfo;
+        message >> service >> subscriberOptions >> portConfigInfo;
+        if (!message.isValid())
+        {
+            logInvalidMessage("CREATE_SUBSCRIBER");
+            break;
+        }
+
+        m_prcMgr->addSubscriberForProcess(runtimeName, service, subscriberOptions, portConfigInfo);
+        break;
+    }
+    case runtime::IpcMessageType::CREATE_CLIENT:
+    {
+        capro::ServiceDescription service;
+        popo::ClientOptions clientOptions;
+        runtime::PortConfigInfo portConfigInfo;
+        message >> service >> clientOptions >> portConfigInfo;
+        if (!message.isValid())
+        {
+            logInvalidMessage("CREATE_CLIENT");
+            break;
+        }
+
+        m_prcMgr->addClientForProcess(runtimeName, service, clientOptions, portConfigInfo);
+        break;
+    }
+    case runtime::IpcMessageType::CREATE_SERVER:
+    {
+        capro::ServiceDescription service;
+        popo::ServerOptions serverOptions;
+        runtime::PortConfigInfo portConfigInfo;
+        message >> service >> serverOptions >> portConfigInfo;
+        if (!message.isValid())
+        {
+            logInvalidMessage("CREATE_SERVER");
+            break;
+        }
+
+        m_prcMgr->addServerForProcess(runtimeName, service, serverOptions, portConfigInfo);
+        break;
+    }
+    case runtime::IpcMessageType::CREATE_CONDITION_VARIABLE:
+    {
+        m_prcMgr->addConditionVariableForProcess(runtimeName);
+        break;
+    }
+    default:
+    {
+        IOX_LOG(ERROR) << "Unknown binary IPC message command [" << runtime::IpcMessageTypeToString(cmd) << "]";
+
+        m_prcMgr->sendMessageNotSupportedToRuntime(runtimeName);
+        break;
+    }
+    }
+}
+
 void RouDi::registerProcess(const RuntimeName_t& name,
                             const uint32_t pid,
                             const posix::PosixUser user,
                             const int64_t transmissionTimestamp,
                             const uint64_t sessionId,
-                            const version::VersionInfo& versionInfo) noexcept
+                            const version::VersionInfo& versionInfo,
+                            const uint32_t ipcProtocolVersion) noexcept
 {
     bool monitorProcess = (m_monitoringMode == roudi::MonitoringMode::ON);
-    IOX_DISCARD_RESULT(
-        m_prcMgr->registerProcess(name, pid, user, monitorProcess, transmissionTimestamp, sessionId, versionInfo));
+    // the binary protocol is only used if both sides have the same layout of the messages
+    const auto ipcProtocol = (m_ipcProtocol == runtime::IpcProtocol::BINARY
+                              && ipcProtocolVersion == runtime::IpcBinaryMessage::PROTOCOL_VERSION)
+                                 ? runtime::IpcProtocol::BINARY
+                                 : runtime::IpcProtocol::TEXT;
+    IOX_DISCARD_RESULT(m_prcMgr->registerProcess(
+        name, pid, user, monitorProcess, transmissionTimestamp, sessionId, versionInfo, ipcProtocol));
 }
 
 uint64_t RouDi::getUniqueSessionIdForProcess() noexcept
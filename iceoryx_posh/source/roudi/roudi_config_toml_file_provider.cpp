@@ -23,6 +23,7 @@
 #include "iceoryx_platform/getopt.hpp"
 #include "iox/into.hpp"
 #include "iox/logging.hpp"
+#include "iox/path.hpp"
 #include "iox/string.hpp"
 #include "iox/vector.hpp"
 
@@ -134,6 +135,60 @@ TomlRouDiConfigFileProvider::parse(std::istream& stream) noexcept
         auto writer = segment->get_as<std::string>("writer").value_or(into<std::string>(groupOfCurrentProcess));
         auto reader = segment->get_as<std::string>("reader").value_or(into<std::string>(groupOfCurrentProcess));
         iox::mepoo::MePooConfig mempoolConfig;
+        auto allocationPolicy = segment->get_as<std::string>("allocation-policy");
+        if (allocationPolicy)
+        {
+            if (*allocationPolicy == "strict-best-fit")
+            {
+                mempoolConfig.setAllocationPolicy(iox::mepoo::MemPoolAllocationPolicy::STRICT_BEST_FIT);
+            }
+            else if (*allocationPolicy == "spill-to-next-larger")
+            {
+                mempoolConfig.setAllocationPolicy(iox::mepoo::MemPoolAllocationPolicy::SPILL_TO_NEXT_LARGER);
+            }
+            else if (*allocationPolicy == "spill-to-any-larger")
+            {
+                mempoolConfig.setAllocationPolicy(iox::mepoo::MemPoolAllocationPolicy::SPILL_TO_ANY_LARGER);
+            }
+            else
+            {
+                return iox::error<iox::roudi::RouDiConfigFileParseError>(
+                    iox::roudi::RouDiConfigFileParseError::INVALID_MEMPOOL_ALLOCATION_POLICY);
+            }
+        }
+
+        mempoolConfig.setChunkCacheCapacity(segment->get_as<uint32_t>("chunk-cache-capacity").value_or(0U));
+
+        iox::optional<iox::mepoo::HugePageConfig> hugePageConfig;
+        auto hugePageMountPoint = segment->get_as<std::string>("huge-page-mount-point");
+        auto hugePageSize = segment->get_as<uint64_t>("huge-page-size");
+        if (hugePageMountPoint)
+        {
+            const uint64_t pageSize = hugePageSize.value_or(iox::mepoo::HugePageConfig::DEFAULT_PAGE_SIZE);
+            const bool isPowerOfTwo = pageSize != 0U && (pageSize & (pageSize - 1U)) == 0U;
+            const bool fitsIntoPath = hugePageMountPoint->size() <= iox::Path::capacity();
+            auto mountPoint = iox::Path::create(iox::string<iox::Path::capacity()>(
+                iox::TruncateToCapacity, hugePageMountPoint->c_str(), hugePageMountPoint->size()));
+            if (!fitsIntoPath || !mountPoint.has_value() || !isPowerOfTwo)
+            {
+                return iox::error<iox::roudi::RouDiConfigFileParseError>(
+                    iox::roudi::RouDiConfigFileParseError::INVALID_HUGE_PAGE_CONFIG);
+            }
+            hugePageConfig.emplace(mountPoint.value(), pageSize);
+        }
+        else if (hugePageSize)
+        {
+            return iox::error<iox::roudi::RouDiConfigFileParseError>(
+                iox::roudi::RouDiConfigFileParseError::INVALID_HUGE_PAGE_CONFIG);
+        }
+
+        iox::optional<uint32_t> numaNode;
+        auto numaNodeEntry = segment->get_as<uint32_t>("numa-node");
+        if (numaNodeEntry)
+        {
+            numaNode.emplace(*numaNodeEntry);
+        }
+
         auto mempools = segment->get_table_array("mempool");
         if (!mempools)
         {
@@ -166,7 +221,10 @@ TomlRouDiConfigFileProvider::parse(std::istream& stream) noexcept
         parsedConfig.m_sharedMemorySegments.push_back(
             {iox::posix::PosixGroup::groupName_t(iox::TruncateToCapacity, reader.c_str(), reader.size()),
              iox::posix::PosixGroup::groupName_t(iox::TruncateToCapacity, writer.c_str(), writer.size()),
-             mempoolConfig});
+             mempoolConfig,
+             iox::mepoo::MemoryInfo(),
+             hugePageConfig,
+             numaNode});
     }
 
     return iox::success<iox::RouDiConfig_t>(parsedConfig);
@@ -16,6 +16,7 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "iceoryx_posh/internal/roudi/service_registry.hpp"
+#include "iox/algorithm.hpp"
 
 namespace iox
 {
@@ -37,43 +38,23 @@ expected<ServiceRegistry::Error> ServiceRegistry::add(const capro::ServiceDescri
         // entry exists, increment counter
         auto& entry = m_serviceDescriptions[index];
         ((*entry).*count)++;
+        ++m_generation;
         return success<>();
     }
 
-    // entry does not exist, find a free slot if it exists
-
-    // fast path to a free slot (which was occupied by previously removed entry),
-    // prefer to fill entries close to the front
-    if (m_freeIndex != NO_INDEX)
-    {
-        auto& entry = m_serviceDescriptions[m_freeIndex];
-        entry.emplace(serviceDescription);
-        (*entry).*count = 1U;
-        m_freeIndex = NO_INDEX;
-        return success<>();
-    }
-
-    // search from start
-    for (auto& entry : m_serviceDescriptions)
-    {
-        if (!entry)
-        {
-            entry.emplace(serviceDescription);
-            (*entry).*count = 1U;
-            return success<>();
-        }
-    }
-
-    // append new entry at the end (the size only grows up to capacity)
-    if (m_serviceDescriptions.emplace_back())
+    // entry does not exist, use the free slot closest to the front or append a new one
+    index = acquireFreeIndex();
+    if (index == NO_INDEX)
     {
-        auto& entry = m_serviceDescriptions.back();
-        entry.emplace(serviceDescription);
-        (*entry).*count = 1U;
-        return success<>();
+        return error<Error>(Error::SERVICE_REGISTRY_FULL);
     }
 
-    return error<Error>(Error::SERVICE_REGISTRY_FULL);
+    auto& entry = m_serviceDescriptions[index];
+    entry.emplace(serviceDescription);
+    (*entry).*count = 1U;
+    insertIntoIndices(index);
+    ++m_generation;
+    return success<>();
 }
 
 expected<ServiceRegistry::Error>
@@ -97,11 +78,10 @@ void ServiceRegistry::removePublisher(const capro::ServiceDescription& serviceDe
 
         if (entry && entry->publisherCount >= 1U)
         {
+            ++m_generation;
             if (--entry->publisherCount == 0U && entry->serverCount == 0)
             {
-                entry.reset();
-                // reuse the slot in the next insertion
-                m_freeIndex = index;
+                removeEntry(index);
             }
         }
     }
@@ -116,11 +96,10 @@ void ServiceRegistry::removeServer(const capro::ServiceDescription& serviceDescr
 
         if (entry && entry->serverCount >= 1U)
         {
+            ++m_generation;
             if (--entry->serverCount == 0U && entry->publisherCount == 0)
             {
-                entry.reset();
-                // reuse the slot in the next insertion
-                m_freeIndex = index;
+                removeEntry(index);
             }
         }
     }
@@ -131,10 +110,8 @@ void ServiceRegistry::purge(const capro::ServiceDescription& serviceDescription)
     auto index = findIndex(serviceDescription);
     if (index != NO_INDEX)
     {
-        auto& entry = m_serviceDescriptions[index];
-        entry.reset();
-        // reuse the slot in the next insertion
-        m_freeIndex = index;
+        removeEntry(index);
+        ++m_generation;
     }
 }
 
@@ -143,35 +120,182 @@ void ServiceRegistry::find(const optional<capro::IdString_t>& service,
                            const optional<capro::IdString_t>& event,
                            function_ref<void(const ServiceDescriptionEntry&)> callable) const noexcept
 {
-    for (auto& entry : m_serviceDescriptions)
+    if (service && instance && event)
     {
-        if (entry)
+        auto index = findIndex(capro::ServiceDescription(*service, *instance, *event));
+        if (index != NO_INDEX)
         {
-            bool match = (service) ? (entry->serviceDescription.getServiceIDString() == *service) : true;
-            match &= (instance) ? (entry->serviceDescription.getInstanceIDString() == *instance) : true;
-            match &= (event) ? (entry->serviceDescription.getEventIDString() == *event) : true;
+            callable(*m_serviceDescriptions[index]);
+        }
+        return;
+    }
 
-            if (match)
+    // only the chain of the specified string with the fewest entries in its bucket is visited
+    const optional<capro::IdString_t>* const searchStrings[]{&service, &instance, &event};
+    const IndexKey searchKeys[]{IndexKey::SERVICE, IndexKey::INSTANCE, IndexKey::EVENT};
+    const Bucket* bucket{nullptr};
+    IndexKey key{IndexKey::SERVICE};
+    for (uint64_t i = 0U; i < 3U; ++i)
+    {
+        const auto& searchString = *searchStrings[i];
+        if (searchString)
+        {
+            const auto& candidate = m_buckets[static_cast<uint64_t>(searchKeys[i])]
+                                             [toBucketIndex(capro::hashIdString(*searchString))];
+            if (bucket == nullptr || candidate.numberOfEntries < bucket->numberOfEntries)
             {
-                callable(*entry);
+                bucket = &candidate;
+                key = searchKeys[i];
             }
         }
     }
+
+    if (bucket == nullptr)
+    {
+        forEach(callable);
+        return;
+    }
+
+    // the chain is not ordered, the matches are therefore collected first to visit them in the order of their slots
+    uint64_t matchingSlotWords[NUMBER_OF_SLOT_WORDS]{};
+    for (auto index = bucket->firstIndex; index != NO_INDEX;
+         index = m_chainLinks[static_cast<uint64_t>(key)][index].nextIndex)
+    {
+        const auto& serviceDescription = m_serviceDescriptions[index]->serviceDescription;
+        bool match = (service) ? (serviceDescription.getServiceIDString() == *service) : true;
+        match &= (instance) ? (serviceDescription.getInstanceIDString() == *instance) : true;
+        match &= (event) ? (serviceDescription.getEventIDString() == *event) : true;
+
+        if (match)
+        {
+            matchingSlotWords[index / BITS_PER_WORD] |= 1ULL << (index % BITS_PER_WORD);
+        }
+    }
+
+    for (uint64_t wordIndex = 0U; wordIndex < NUMBER_OF_SLOT_WORDS; ++wordIndex)
+    {
+        auto matchingSlots = matchingSlotWords[wordIndex];
+        while (matchingSlots != 0U)
+        {
+            const auto index = wordIndex * BITS_PER_WORD + countTrailingZeros(matchingSlots);
+            matchingSlots &= matchingSlots - 1U;
+            callable(*m_serviceDescriptions[index]);
+        }
+    }
 }
 
 uint32_t ServiceRegistry::findIndex(const capro::ServiceDescription& serviceDescription) const noexcept
 {
-    for (uint32_t i = 0; i < m_serviceDescriptions.size(); ++i)
+    const auto key = static_cast<uint64_t>(IndexKey::SERVICE_DESCRIPTION);
+    const auto& bucket = m_buckets[key][toBucketIndex(hash(IndexKey::SERVICE_DESCRIPTION, serviceDescription))];
+    for (auto index = bucket.firstIndex; index != NO_INDEX; index = m_chainLinks[key][index].nextIndex)
+    {
+        if (m_serviceDescriptions[index]->serviceDescription == serviceDescription)
+        {
+            return index;
+        }
+    }
+    return NO_INDEX;
+}
+
+uint32_t ServiceRegistry::acquireFreeIndex() noexcept
+{
+    for (uint32_t wordIndex = 0U; wordIndex < NUMBER_OF_SLOT_WORDS; ++wordIndex)
     {
-        auto& entry = m_serviceDescriptions[i];
-        if (entry && entry->serviceDescription == serviceDescription)
+        auto& freeSlots = m_freeSlotWords[wordIndex];
+        if (freeSlots != 0U)
         {
-            return i;
+            const auto index = static_cast<uint32_t>(wordIndex * BITS_PER_WORD + countTrailingZeros(freeSlots));
+            freeSlots &= freeSlots - 1U;
+            return index;
         }
     }
+
+    // append new entry at the end (the size only grows up to capacity)
+    if (m_serviceDescriptions.emplace_back())
+    {
+        return static_cast<uint32_t>(m_serviceDescriptions.size() - 1U);
+    }
     return NO_INDEX;
 }
 
+void ServiceRegistry::removeEntry(const uint32_t index) noexcept
+{
+    removeFromIndices(index);
+    m_serviceDescriptions[index].reset();
+    // reuse the slot in the next insertion
+    m_freeSlotWords[index / BITS_PER_WORD] |= 1ULL << (index % BITS_PER_WORD);
+}
+
+uint64_t ServiceRegistry::hash(const IndexKey key, const capro::ServiceDescription& serviceDescription) noexcept
+{
+    switch (key)
+    {
+    case IndexKey::SERVICE_DESCRIPTION:
+        return capro::ServiceDescriptionHash()(serviceDescription);
+    case IndexKey::SERVICE:
+        return capro::hashIdString(serviceDescription.getServiceIDString());
+    case IndexKey::INSTANCE:
+        return capro::hashIdString(serviceDescription.getInstanceIDString());
+    case IndexKey::EVENT:
+        return capro::hashIdString(serviceDescription.getEventIDString());
+    }
+    return 0U;
+}
+
+uint32_t ServiceRegistry::toBucketIndex(const uint64_t hash) noexcept
+{
+    // NUMBER_OF_BUCKETS is a power of two, the low bits of the hash are therefore the bucket index
+    return static_cast<uint32_t>(hash & (NUMBER_OF_BUCKETS - 1U));
+}
+
+void ServiceRegistry::insertIntoIndices(const uint32_t index) noexcept
+{
+    const auto& serviceDescription = m_serviceDescriptions[index]->serviceDescription;
+    for (uint64_t key = 0U; key < NUMBER_OF_INDEX_KEYS; ++key)
+    {
+        auto& bucket = m_buckets[key][toBucketIndex(hash(static_cast<IndexKey>(key), serviceDescription))];
+        auto& link = m_chainLinks[key][index];
+        link.nextIndex = bucket.firstIndex;
+        link.previousIndex = NO_INDEX;
+        if (bucket.firstIndex != NO_INDEX)
+        {
+            m_chainLinks[key][bucket.firstIndex].previousIndex = index;
+        }
+        bucket.firstIndex = index;
+        ++bucket.numberOfEntries;
+    }
+}
+
+void ServiceRegistry::removeFromIndices(const uint32_t index) noexcept
+{
+    const auto& serviceDescription = m_serviceDescriptions[index]->serviceDescription;
+    for (uint64_t key = 0U; key < NUMBER_OF_INDEX_KEYS; ++key)
+    {
+        auto& bucket = m_buckets[key][toBucketIndex(hash(static_cast<IndexKey>(key), serviceDescription))];
+        auto& link = m_chainLinks[key][index];
+        if (link.previousIndex != NO_INDEX)
+        {
+            m_chainLinks[key][link.previousIndex].nextIndex = link.nextIndex;
+        }
+        else
+        {
+            bucket.firstIndex = link.nextIndex;
+        }
+        if (link.nextIndex != NO_INDEX)
+        {
+            m_chainLinks[key][link.nextIndex].previousIndex = link.previousIndex;
+        }
+        --bucket.numberOfEntries;
+        link = ChainLink();
+    }
+}
+
+uint64_t ServiceRegistry::generation() const noexcept
+{
+    return m_generation;
+}
+
 void ServiceRegistry::forEach(function_ref<void(const ServiceDescriptionEntry&)> callable) const noexcept
 {
     for (auto& entry : m_serviceDescriptions)
@@ -0,0 +1,85 @@
+// Copyright (c) 2026 by agent <agent@local>. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/roudi/service_registry_change_log.hpp"
+#include "iceoryx_hoofs/cxx/requires.hpp"
+#include "iox/attributes.hpp"
+
+namespace iox
+{
+namespace roudi
+{
+constexpr uint64_t ServiceRegistryChangeLog::CAPACITY;
+constexpr uint64_t ServiceRegistryChangeLog::SNAPSHOT_INTERVAL;
+
+void ServiceRegistryChangeLog::record(const uint64_t generation,
+                                      const Operation operation,
+                                      const capro::ServiceDescription& serviceDescription) noexcept
+{
+    cxx::Expects(generation == m_generation + 1U);
+
+    auto& change = m_changes[(generation - 1U) % CAPACITY];
+    change.operation = operation;
+    change.serviceDescription = serviceDescription;
+    m_generation = generation;
+}
+
+uint64_t ServiceRegistryChangeLog::generation() const noexcept
+{
+    return m_generation;
+}
+
+expected<ServiceRegistryChangeLog::Error> ServiceRegistryChangeLog::applyTo(ServiceRegistry& registry) const noexcept
+{
+    const auto registryGeneration = registry.generation();
+    if (registryGeneration >= m_generation)
+    {
+        return success<>();
+    }
+
+    // the change of the successor of the registry generation was already overwritten
+    if (registryGeneration + CAPACITY < m_generation)
+    {
+        return error<Error>(Error::CHANGES_ARE_NO_LONGER_AVAILABLE);
+    }
+
+    for (auto generation = registryGeneration + 1U; generation <= m_generation; ++generation)
+    {
+        const auto& change = m_changes[(generation - 1U) % CAPACITY];
+        // the registry is in the same state as the one of RouDi before the change, therefore the change cannot fail
+        // when it succeeded in RouDi; failed modifications are not recorded
+        switch (change.operation)
+        {
+        case Operation::ADD_PUBLISHER:
+            IOX_DISCARD_RESULT(registry.addPublisher(change.serviceDescription));
+            break;
+        case Operation::REMOVE_PUBLISHER:
+            registry.removePublisher(change.serviceDescription);
+            break;
+        case Operation::ADD_SERVER:
+            IOX_DISCARD_RESULT(registry.addServer(change.serviceDescription));
+            break;
+        case Operation::REMOVE_SERVER:
+            registry.removeServer(change.serviceDescription);
+            break;
+        }
+    }
+
+    return success<>();
+}
+
+} // namespace roudi
+} // namespace iox
@@ -0,0 +1,51 @@
+// Copyright (c) 2026 by agent <agent@local>. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/runtime/heartbeat.hpp"
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+
+#include <chrono>
+
+namespace iox
+{
+namespace runtime
+{
+Heartbeat::Heartbeat() noexcept
+{
+    beat();
+}
+
+void Heartbeat::beat() noexcept
+{
+    m_lastBeatInNanoseconds.store(nowInNanoseconds(), std::memory_order_relaxed);
+}
+
+units::Duration Heartbeat::durationSinceLastBeat() const noexcept
+{
+    const auto now = nowInNanoseconds();
+    const auto lastBeat = m_lastBeatInNanoseconds.load(std::memory_order_relaxed);
+    // the beat can be stored by the runtime after RouDi took the current time
+    return units::Duration::fromNanoseconds((now > lastBeat) ? (now - lastBeat) : 0U);
+}
+
+uint64_t Heartbeat::nowInNanoseconds() noexcept
+{
+    // the steady clock is system wide and therefore comparable between the runtime and RouDi
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<mepoo::DurationNs_t>(mepoo::BaseClock_t::now().time_since_epoch()).count());
+}
+} // namespace runtime
+} // namespace iox
@@ -0,0 +1,345 @@
+// Copyright (c) 2026 by agent <agent@local>. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/runtime/ipc_binary_message.hpp"
+
+#include <cstring>
+
+namespace iox
+{
+namespace runtime
+{
+namespace
+{
+/// @brief a COBS code byte is the distance to the next null byte; the maximum one marks a block without a null byte
+constexpr uint8_t MAX_COBS_CODE{0xFFU};
+} // namespace
+
+constexpr uint8_t IpcBinaryMessage::PROTOCOL_VERSION;
+constexpr uint64_t IpcBinaryMessage::CAPACITY;
+constexpr char IpcBinaryMessage::ENCODING_MARKER;
+constexpr uint64_t IpcBinaryMessage::VERSION_POSITION;
+constexpr uint64_t IpcBinaryMessage::TYPE_POSITION;
+constexpr uint64_t IpcBinaryMessage::HEADER_SIZE;
+
+IpcBinaryMessage::IpcBinaryMessage(const IpcMessageType type) noexcept
+    : m_isValid(true)
+{
+    *this << PROTOCOL_VERSION << type;
+}
+
+IpcMessageType IpcBinaryMessage::getType() const noexcept
+{
+    if (!m_isValid || m_size < HEADER_SIZE)
+    {
+        return IpcMessageType::NOTYPE;
+    }
+
+    IpcMessageType type{IpcMessageType::NOTYPE};
+    std::memcpy(&type, &m_data[TYPE_POSITION], sizeof(type));
+    return type;
+}
+
+bool IpcBinaryMessage::isValid() const noexcept
+{
+    return m_isValid;
+}
+
+void IpcBinaryMessage::invalidate() noexcept
+{
+    m_isValid = false;
+}
+
+uint64_t IpcBinaryMessage::size() const noexcept
+{
+    return m_size;
+}
+
+IpcBinaryMessage& IpcBinaryMessage::operator<<(const bool value) noexcept
+{
+    const auto byte = static_cast<uint8_t>(value ? 1U : 0U);
+    write(&byte, sizeof(byte));
+    return *this;
+}
+
+IpcBinaryMessage& IpcBinaryMessage::operator>>(bool& value) noexcept
+{
+    uint8_t byte{0U};
+    read(&byte, sizeof(byte));
+    if (m_isValid)
+    {
+        value = (byte != 0U);
+    }
+    return *this;
+}
+
+void IpcBinaryMessage::write(const void* const data, const uint64_t size) noexcept
+{
+    if (!m_isValid || size > CAPACITY - m_size)
+    {
+        m_isValid = false;
+        return;
+    }
+
+    if (size > 0U)
+    {
+        std::memcpy(&m_data[m_size], data, size);
+        m_size += size;
+    }
+}
+
+void IpcBinaryMessage::read(void* const data, const uint64_t size) noexcept
+{
+    if (!m_isValid || size > m_size - m_readPosition)
+    {
+        m_isValid = false;
+        return;
+    }
+
+    std::memcpy(data, &m_data[m_readPosition], size);
+    m_readPosition += size;
+}
+
+std::string IpcBinaryMessage::encode() const noexcept
+{
+    std::string encoded;
+    encoded.reserve(2U + m_size + m_size / (MAX_COBS_CODE - 1U));
+    encoded.push_back(ENCODING_MARKER);
+
+    // every block starts with a code byte which is patched once the length of the block is known
+    uint64_t codePosition{encoded.size()};
+    uint8_t code{1U};
+    encoded.push_back(static_cast<char>(code));
+
+    for (uint64_t i = 0U; i < m_size; ++i)
+    {
+        if (m_data[i] != 0U)
+        {
+            encoded.push_back(static_cast<char>(m_data[i]));
+            ++code;
+        }
+
+        if (m_data[i] == 0U || code == MAX_COBS_CODE)
+        {
+            encoded[codePosition] = static_cast<char>(code);
+            codePosition = encoded.size();
+            code = 1U;
+            encoded.push_back(static_cast<char>(code));
+        }
+    }
+    encoded[codePosition] = static_cast<char>(code);
+
+    return encoded;
+}
+
+bool IpcBinaryMessage::decode(const std::string& encoded) noexcept
+{
+    m_size = 0U;
+    m_readPosition = HEADER_SIZE;
+    m_isValid = false;
+
+    if (!isBinaryEncoded(encoded))
+    {
+        return false;
+    }
+
+    uint64_t position{1U};
+    while (position < encoded.size())
+    {
+        const auto code = static_cast<uint8_t>(encoded[position]);
+        ++position;
+        if (code == 0U || code - 1U > encoded.size() - position || code - 1U > CAPACITY - m_size)
+        {
+            return false;
+        }
+
+        std::memcpy(&m_data[m_size], &encoded[position], code - 1U);
+        m_size += code - 1U;
+        position += code - 1U;
+
+        // a block which is shorter than the maximum one was terminated by a null byte, except for the last block
+        if (code != MAX_COBS_CODE && position < encoded.size())
+        {
+            if (m_size == CAPACITY)
+            {
+                return false;
+            }
+            m_data[m_size] = 0U;
+            ++m_size;
+        }
+    }
+
+    if (m_size < HEADER_SIZE || m_data[VERSION_POSITION] != PROTOCOL_VERSION)
+    {
+        return false;
+    }
+
+    m_isValid = true;
+    return true;
+}
+
+bool IpcBinaryMessage::isBinaryEncoded(const std::string& message) noexcept
+{
+    return !message.empty() && message[0] == ENCODING_MARKER;
+}
+
+IpcBinaryMessage& operator<<(IpcBinaryMessage& message, const capro::ServiceDescription& service) noexcept
+{
+    const auto classHash = service.getClassHash();
+    return message << service.getServiceIDString() << service.getInstanceIDString() << service.getEventIDString()
+                   << classHash[0U] << classHash[1U] << classHash[2U] << classHash[3U] << service.getScope()
+                   << service.getSourceInterface();
+}
+
+IpcBinaryMessage& operator>>(IpcBinaryMessage& message, capro::ServiceDescription& service) noexcept
+{
+    capro::IdString_t serviceString;
+    capro::IdString_t instanceString;
+    capro::IdString_t eventString;
+    capro::ServiceDescription::ClassHash classHash;
+    capro::Scope scope{capro::Scope::INVALID};
+    capro::Interfaces interfaceSource{capro::Interfaces::INTERFACE_END};
+
+    message >> serviceString >> instanceString >> eventString >> classHash[0U] >> classHash[1U] >> classHash[2U]
+        >> classHash[3U] >> scope >> interfaceSource;
+    if (scope >= capro::Scope::INVALID || interfaceSource >= capro::Interfaces::INTERFACE_END)
+    {
+        message.invalidate();
+    }
+    if (!message.isValid())
+    {
+        return message;
+    }
+
+    service = capro::ServiceDescription(serviceString, instanceString, eventString, classHash, interfaceSource);
+    if (scope == capro::Scope::LOCAL)
+    {
+        service.setLocal();
+    }
+    return message;
+}
+
+IpcBinaryMessage& operator<<(IpcBinaryMessage& message, const popo::PublisherOptions& options) noexcept
+{
+    return message << options.historyCapacity << options.nodeName << options.offerOnCreate
+                   << options.subscriberTooSlowPolicy << options.batchSubscriberNotifications
+                   << options.recycledChunkCapacity;
+}
+
+IpcBinaryMessage& operator>>(IpcBinaryMessage& message, popo::PublisherOptions& options) noexcept
+{
+    popo::PublisherOptions received;
+    message >> received.historyCapacity >> received.nodeName >> received.offerOnCreate
+        >> received.subscriberTooSlowPolicy >> received.batchSubscriberNotifications >> received.recycledChunkCapacity;
+    if (received.subscriberTooSlowPolicy > popo::ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA)
+    {
+        message.invalidate();
+    }
+    if (message.isValid())
+    {
+        options = received;
+    }
+    return message;
+}
+
+IpcBinaryMessage& operator<<(IpcBinaryMessage& message, const popo::SubscriberOptions& options) noexcept
+{
+    return message << options.queueCapacity << options.historyRequest << options.nodeName << options.subscribeOnCreate
+                   << options.queueFullPolicy << options.requiresPublisherHistorySupport
+                   << options.recordLatencyHistogram;
+}
+
+IpcBinaryMessage& operator>>(IpcBinaryMessage& message, popo::SubscriberOptions& options) noexcept
+{
+    popo::SubscriberOptions received;
+    message >> received.queueCapacity >> received.historyRequest >> received.nodeName >> received.subscribeOnCreate
+        >> received.queueFullPolicy >> received.requiresPublisherHistorySupport >> received.recordLatencyHistogram;
+    if (received.queueFullPolicy > popo::QueueFullPolicy::DISCARD_OLDEST_DATA)
+    {
+        message.invalidate();
+    }
+    if (message.isValid())
+    {
+        options = received;
+    }
+    return message;
+}
+
+IpcBinaryMessage& operator<<(IpcBinaryMessage& message, const popo::ClientOptions& options) noexcept
+{
+    return message << options.responseQueueCapacity << options.nodeName << options.connectOnCreate
+                   << options.responseQueueFullPolicy << options.serverTooSlowPolicy;
+}
+
+IpcBinaryMessage& operator>>(IpcBinaryMessage& message, popo::ClientOptions& options) noexcept
+{
+    popo::ClientOptions received;
+    message >> received.responseQueueCapacity >> received.nodeName >> received.connectOnCreate
+        >> received.responseQueueFullPolicy >> received.serverTooSlowPolicy;
+    if (received.responseQueueFullPolicy > popo::QueueFullPolicy::DISCARD_OLDEST_DATA
+        || received.serverTooSlowPolicy > popo::ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA)
+    {
+        message.invalidate();
+    }
+    if (message.isValid())
+    {
+        options = received;
+    }
+    return message;
+}
+
+IpcBinaryMessage& operator<<(IpcBinaryMessage& message, const popo::ServerOptions& options) noexcept
+{
+    return message << options.requestQueueCapacity << options.nodeName << options.offerOnCreate
+                   << options.requestQueueFullPolicy << options.clientTooSlowPolicy;
+}
+
+IpcBinaryMessage& operator>>(IpcBinaryMessage& message, popo::ServerOptions& options) noexcept
+{
+    popo::ServerOptions received;
+    message >> received.requestQueueCapacity >> received.nodeName >> received.offerOnCreate
+        >> received.requestQueueFullPolicy >> received.clientTooSlowPolicy;
+    if (received.requestQueueFullPolicy > popo::QueueFullPolicy::DISCARD_OLDEST_DATA
+        || received.clientTooSlowPolicy > popo::ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA)
+    {
+        message.invalidate();
+    }
+    if (message.isValid())
+    {
+        options = received;
+    }
+    return message;
+}
+
+IpcBinaryMessage& operator<<(IpcBinaryMessage& message, const PortConfigInfo& portConfigInfo) noexcept
+{
+    return message << portConfigInfo.portType << portConfigInfo.memoryInfo.deviceId
+                   << portConfigInfo.memoryInfo.memoryType;
+}
+
+IpcBinaryMessage& operator>>(IpcBinaryMessage& message, PortConfigInfo& portConfigInfo) noexcept
+{
+    PortConfigInfo received;
+    message >> received.portType >> received.memoryInfo.deviceId >> received.memoryInfo.memoryType;
+    if (message.isValid())
+    {
+        portConfigInfo = received;
+    }
+    return message;
+}
+
+} // namespace runtime
+} // namespace iox
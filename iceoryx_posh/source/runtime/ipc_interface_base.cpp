@@ -17,6 +17,7 @@
 
 #include "iceoryx_posh/internal/runtime/ipc_interface_base.hpp"
 #include "iceoryx_dust/cxx/convert.hpp"
+#include "iceoryx_posh/internal/runtime/ipc_binary_message.hpp"
 #include "iceoryx_posh/internal/runtime/ipc_message.hpp"
 #include "iox/logging.hpp"
 
@@ -98,6 +99,54 @@ bool IpcInterface<IpcChannelType>::timedReceive(const units::Duration timeout, I
            && answer.isValid();
 }
 
+template <typename IpcChannelType>
+bool IpcInterface<IpcChannelType>::receive(IpcBinaryMessage& answer) const noexcept
+{
+    auto message = m_ipcChannel.receive();
+    if (message.has_error())
+    {
+        return false;
+    }
+
+    return answer.decode(message.value());
+}
+
+template <typename IpcChannelType>
+bool IpcInterface<IpcChannelType>::timedReceive(const units::Duration timeout,
+                                                IpcBinaryMessage& answer) const noexcept
+{
+    return !m_ipcChannel.timedReceive(timeout)
+                .and_then([&answer](auto& message) { answer.decode(message); })
+                .has_error()
+           && answer.isValid();
+}
+
+template <typename IpcChannelType>
+optional<IpcProtocol> IpcInterface<IpcChannelType>::timedReceive(const units::Duration timeout,
+                                                                 IpcMessage& answer,
+                                                                 IpcBinaryMessage& binaryAnswer) const noexcept
+{
+    optional<IpcProtocol> protocol;
+    m_ipcChannel.timedReceive(timeout).and_then([&](auto& message) {
+        if (IpcBinaryMessage::isBinaryEncoded(message))
+        {
+            if (binaryAnswer.decode(message))
+            {
+                protocol.emplace(IpcProtocol::BINARY);
+            }
+            else
+            {
+                IOX_LOG(ERROR) << "The received binary message of " << message.size() << " bytes is not valid";
+            }
+        }
+        else if (IpcInterface<IpcChannelType>::setMessageFromString(message.c_str(), answer))
+        {
+            protocol.emplace(IpcProtocol::TEXT);
+        }
+    });
+    return protocol;
+}
+
 template <typename IpcChannelType>
 bool IpcInterface<IpcChannelType>::setMessageFromString(const char* buffer, IpcMessage& answer) noexcept
 {
@@ -150,6 +199,48 @@ bool IpcInterface<IpcChannelType>::timedSend(const IpcMessage& msg, units::Durat
     return !m_ipcChannel.timedSend(msg.getMessage(), timeout).or_else(logLengthError).has_error();
 }
 
+template <typename IpcChannelType>
+bool IpcInterface<IpcChannelType>::send(const IpcBinaryMessage& msg) const noexcept
+{
+    if (!msg.isValid())
+    {
+        IOX_LOG(ERROR) << "Trying to send an invalid binary message of type "
+                       << static_cast<std::underlying_type<IpcMessageType>::type>(msg.getType());
+        return false;
+    }
+
+    const auto encoded = msg.encode();
+    auto logLengthError = [&encoded](posix::IpcChannelError& error) {
+        if (error == posix::IpcChannelError::MESSAGE_TOO_LONG)
+        {
+            const uint64_t messageSize = encoded.size() + platform::IoxIpcChannelType::NULL_TERMINATOR_SIZE;
+            IOX_LOG(ERROR) << "msg size of " << messageSize << " bigger than configured max message size";
+        }
+    };
+    return !m_ipcChannel.send(encoded).or_else(logLengthError).has_error();
+}
+
+template <typename IpcChannelType>
+bool IpcInterface<IpcChannelType>::timedSend(const IpcBinaryMessage& msg, units::Duration timeout) const noexcept
+{
+    if (!msg.isValid())
+    {
+        IOX_LOG(ERROR) << "Trying to send an invalid binary message of type "
+                       << static_cast<std::underlying_type<IpcMessageType>::type>(msg.getType());
+        return false;
+    }
+
+    const auto encoded = msg.encode();
+    auto logLengthError = [&encoded](posix::IpcChannelError& error) {
+        if (error == posix::IpcChannelError::MESSAGE_TOO_LONG)
+        {
+            const uint64_t messageSize = encoded.size() + platform::IoxIpcChannelType::NULL_TERMINATOR_SIZE;
+            IOX_LOG(ERROR) << "msg size of " << messageSize << " bigger than configured max message size";
+        }
+    };
+    return !m_ipcChannel.timedSend(encoded, timeout).or_else(logLengthError).has_error();
+}
+
 template <typename IpcChannelType>
 const RuntimeName_t& IpcInterface<IpcChannelType>::getRuntimeName() const noexcept
 {
@@ -20,6 +20,7 @@
 #include "iceoryx_dust/cxx/std_string_support.hpp"
 #include "iceoryx_hoofs/posix_wrapper/posix_access_rights.hpp"
 #include "iceoryx_posh/error_handling/error_handling.hpp"
+#include "iceoryx_posh/internal/runtime/ipc_binary_message.hpp"
 #include "iceoryx_posh/version/version_info.hpp"
 #include "iox/into.hpp"
 
@@ -93,7 +94,8 @@ IpcRuntimeInterface::IpcRuntimeInterface(const RuntimeName_t& roudiName,
             sendBuffer << IpcMessageTypeToString(IpcMessageType::REG) << m_runtimeName << cxx::convert::toString(pid)
                        << cxx::convert::toString(posix::PosixUser::getUserOfCurrentProcess().getID())
                        << cxx::convert::toString(transmissionTimestamp)
-                       << static_cast<cxx::Serialization>(version::VersionInfo::getCurrentVersion()).toString();
+                       << static_cast<cxx::Serialization>(version::VersionInfo::getCurrentVersion()).toString()
+                       << cxx::convert::toString(static_cast<uint32_t>(IpcBinaryMessage::PROTOCOL_VERSION));
 
             bool successfullySent = m_RoudiIpcInterface.timedSend(sendBuffer, 100_ms);
 
@@ -145,13 +147,6 @@ IpcRuntimeInterface::IpcRuntimeInterface(const RuntimeName_t& roudiName,
     }
 }
 
-bool IpcRuntimeInterface::sendKeepalive() noexcept
-{
-    return (m_sendKeepalive) ? m_RoudiIpcInterface.send(
-               {IpcMessageTypeToString(IpcMessageType::KEEPALIVE), into<std::string>(m_runtimeName)})
-                             : true;
-}
-
 UntypedRelativePointer::offset_t IpcRuntimeInterface::getSegmentManagerAddressOffset() const noexcept
 {
     cxx::Ensures(m_segmentManagerAddressOffset.has_value()
@@ -159,6 +154,11 @@ UntypedRelativePointer::offset_t IpcRuntimeInterface::getSegmentManagerAddressOf
     return m_segmentManagerAddressOffset.value();
 }
 
+optional<UntypedRelativePointer::offset_t> IpcRuntimeInterface::getHeartbeatAddressOffset() const noexcept
+{
+    return m_heartbeatAddressOffset;
+}
+
 bool IpcRuntimeInterface::sendRequestToRouDi(const IpcMessage& msg, IpcMessage& answer) noexcept
 {
     if (!m_RoudiIpcInterface.send(msg))
@@ -176,6 +176,28 @@ bool IpcRuntimeInterface::sendRequestToRouDi(const IpcMessage& msg, IpcMessage&
     return true;
 }
 
+bool IpcRuntimeInterface::sendRequestToRouDi(const IpcBinaryMessage& msg, IpcBinaryMessage& answer) noexcept
+{
+    if (!m_RoudiIpcInterface.send(msg))
+    {
+        IOX_LOG(ERROR) << "Could not send binary request via RouDi IPC channel interface.\n";
+        return false;
+    }
+
+    if (!m_AppIpcInterface->receive(answer))
+    {
+        IOX_LOG(ERROR) << "Could not receive binary response via App IPC channel interface.\n";
+        return false;
+    }
+
+    return true;
+}
+
+IpcProtocol IpcRuntimeInterface::getIpcProtocol() const noexcept
+{
+    return m_ipcProtocol;
+}
+
 size_t IpcRuntimeInterface::getShmTopicSize() noexcept
 {
     return m_shmTopicSize;
@@ -226,8 +248,12 @@ IpcRuntimeInterface::RegAckResult IpcRuntimeInterface::waitForRegAck(int64_t tra
 
             if (stringToIpcMessageType(cmd.c_str()) == IpcMessageType::REG_ACK)
             {
-                constexpr uint32_t REGISTER_ACK_PARAMETERS = 6U;
-                if (receiveBuffer.getNumberOfElements() != REGISTER_ACK_PARAMETERS)
+                // a RouDi without the binary protocol does not send the negotiated protocol version
+                constexpr uint32_t REGISTER_ACK_PARAMETERS_WITHOUT_PROTOCOL = 7U;
+                constexpr uint32_t REGISTER_ACK_PARAMETERS = 8U;
+                const auto numberOfElements = receiveBuffer.getNumberOfElements();
+                if (numberOfElements != REGISTER_ACK_PARAMETERS
+                    && numberOfElements != REGISTER_ACK_PARAMETERS_WITHOUT_PROTOCOL)
                 {
                     errorHandler(PoshError::IPC_INTERFACE__REG_ACK_INVALIG_NUMBER_OF_PARAMS);
                 }
@@ -241,7 +267,26 @@ IpcRuntimeInterface::RegAckResult IpcRuntimeInterface::waitForRegAck(int64_t tra
                 int64_t receivedTimestamp{0U};
                 cxx::convert::fromString(receiveBuffer.getElementAtIndex(3U).c_str(), receivedTimestamp);
                 cxx::convert::fromString(receiveBuffer.getElementAtIndex(4U).c_str(), m_segmentId);
-                cxx::convert::fromString(receiveBuffer.getElementAtIndex(5U).c_str(), m_sendKeepalive);
+                bool isMonitored{true};
+                cxx::convert::fromString(receiveBuffer.getElementAtIndex(5U).c_str(), isMonitored);
+                if (isMonitored)
+                {
+                    UntypedRelativePointer::offset_t heartbeatOffset{0U};
+                    cxx::convert::fromString(receiveBuffer.getElementAtIndex(6U).c_str(), heartbeatOffset);
+                    m_heartbeatAddressOffset.emplace(heartbeatOffset);
+                }
+                else
+                {
+                    m_heartbeatAddressOffset.reset();
+                }
+                uint32_t protocolVersion{0U};
+                if (numberOfElements == REGISTER_ACK_PARAMETERS)
+                {
+                    cxx::convert::fromString(receiveBuffer.getElementAtIndex(7U).c_str(), protocolVersion);
+                }
+                m_ipcProtocol = (protocolVersion == static_cast<uint32_t>(IpcBinaryMessage::PROTOCOL_VERSION))
+                                    ? IpcProtocol::BINARY
+                                    : IpcProtocol::TEXT;
                 if (transmissionTimestamp == receivedTimestamp)
                 {
                     return RegAckResult::SUCCESS;
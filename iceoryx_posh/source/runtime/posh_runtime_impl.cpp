@@ -21,9 +21,11 @@
 #include "iox/variant.hpp"
 
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/runtime/ipc_binary_message.hpp"
 #include "iceoryx_posh/internal/runtime/ipc_message.hpp"
 #include "iceoryx_posh/runtime/port_config_info.hpp"
 #include "iox/logging.hpp"
+#include "iox/relative_pointer.hpp"
 
 #include <cstdint>
 
@@ -44,11 +46,24 @@ PoshRuntimeImpl::PoshRuntimeImpl(optional<const RuntimeName_t*> name, const Runt
                                                  m_ipcChannelInterface.getSegmentId(),
                                                  m_ipcChannelInterface.getSegmentManagerAddressOffset()});
     }())
+    , m_heartbeat([&]() -> Heartbeat* {
+        auto heartbeatOffset = m_ipcChannelInterface.getHeartbeatAddressOffset();
+        if (!heartbeatOffset.has_value())
+        {
+            return nullptr;
+        }
+        // the management segment is either registered by the SharedMemoryUser or by RouDi itself
+        return RelativePointer<Heartbeat>(heartbeatOffset.value(), segment_id_t{m_ipcChannelInterface.getSegmentId()})
+            .get();
+    }())
 {
 }
 
 PoshRuntimeImpl::~PoshRuntimeImpl() noexcept
 {
+    // the heartbeat must not be beaten anymore once RouDi released it after the TERMINATION request
+    m_keepAliveTask.stop();
+
     // Inform RouDi that we're shutting down
     IpcMessage sendBuffer;
     sendBuffer << IpcMessageTypeToString(IpcMessageType::TERMINATION) << m_appName;
@@ -75,6 +90,49 @@ PoshRuntimeImpl::~PoshRuntimeImpl() noexcept
     }
 }
 
+template <typename T>
+expected<T*, IpcMessageErrorType>
+PoshRuntimeImpl::requestFromRoudi(const IpcBinaryMessage& request,
+                                  const IpcMessageType expectedAck,
+                                  const IpcMessageErrorType invalidResponseError,
+                                  const IpcMessageErrorType wrongResponseError) noexcept
+{
+    IpcBinaryMessage response;
+    if (!sendRequestToRouDi(request, response))
+    {
+        IOX_LOG(ERROR) << "Request " << IpcMessageTypeToString(request.getType()) << " got invalid response!";
+        return error<IpcMessageErrorType>(invalidResponseError);
+    }
+
+    const auto responseType = response.getType();
+    if (responseType == expectedAck)
+    {
+        UntypedRelativePointer::offset_t offset{0U};
+        segment_id_underlying_t segmentId{0U};
+        response >> offset >> segmentId;
+        if (response.isValid())
+        {
+            auto ptr = UntypedRelativePointer::getPtr(segment_id_t{segmentId}, offset);
+            return success<T*>(reinterpret_cast<T*>(ptr));
+        }
+    }
+    else if (responseType == IpcMessageType::ERROR)
+    {
+        IpcMessageErrorType errorType{IpcMessageErrorType::NOTYPE};
+        response >> errorType;
+        if (response.isValid())
+        {
+            IOX_LOG(ERROR) << "Request " << IpcMessageTypeToString(request.getType())
+                           << " received an error response from RouDi.";
+            return error<IpcMessageErrorType>(errorType);
+        }
+    }
+
+    IOX_LOG(ERROR) << "Request " << IpcMessageTypeToString(request.getType())
+                   << " got wrong response from IPC channel of type " << IpcMessageTypeToString(responseType);
+    return error<IpcMessageErrorType>(wrongResponseError);
+}
+
 PublisherPortUserType::MemberType_t*
 PoshRuntimeImpl::getMiddlewarePublisher(const capro::ServiceDescription& service,
                                         const popo::PublisherOptions& publisherOptions,
@@ -97,12 +155,29 @@ PoshRuntimeImpl::getMiddlewarePublisher(const capro::ServiceDescription& service
         options.nodeName = m_appName;
     }
 
-    IpcMessage sendBuffer;
-    sendBuffer << IpcMessageTypeToString(IpcMessageType::CREATE_PUBLISHER) << m_appName
-               << static_cast<cxx::Serialization>(service).toString() << publisherOptions.serialize().toString()
-               << static_cast<cxx::Serialization>(portConfigInfo).toString();
+    auto maybePublisher = [&]() -> expected<PublisherPortUserType::MemberType_t*, IpcMessageErrorType> {
+        if (!isValidNodeName(options.nodeName))
+        {
+            return error<IpcMessageErrorType>(IpcMessageErrorType::REQUEST_PUBLISHER_INVALID_RESPONSE);
+        }
+
+        if (m_ipcChannelInterface.getIpcProtocol() == IpcProtocol::BINARY)
+        {
+            IpcBinaryMessage request{IpcMessageType::CREATE_PUBLISHER};
+            request << m_appName << service << publisherOptions << portConfigInfo;
+            return requestFromRoudi<PublisherPortUserType::MemberType_t>(
+                request,
+                IpcMessageType::CREATE_PUBLISHER_ACK,
+                IpcMessageErrorType::REQUEST_PUBLISHER_INVALID_RESPONSE,
+                IpcMessageErrorType::REQUEST_PUBLISHER_WRONG_IPC_MESSAGE_RESPONSE);
+        }
 
-    auto maybePublisher = requestPublisherFromRoudi(sendBuffer);
+        IpcMessage sendBuffer;
+        sendBuffer << IpcMessageTypeToString(IpcMessageType::CREATE_PUBLISHER) << m_appName
+                   << static_cast<cxx::Serialization>(service).toString() << publisherOptions.serialize().toString()
+                   << static_cast<cxx::Serialization>(portConfigInfo).toString();
+        return requestPublisherFromRoudi(sendBuffer);
+    }();
     if (maybePublisher.has_error())
     {
         switch (maybePublisher.get_error())
@@ -222,12 +297,29 @@ PoshRuntimeImpl::getMiddlewareSubscriber(const capro::ServiceDescription& servic
         options.nodeName = m_appName;
     }
 
-    IpcMessage sendBuffer;
-    sendBuffer << IpcMessageTypeToString(IpcMessageType::CREATE_SUBSCRIBER) << m_appName
-               << static_cast<cxx::Serialization>(service).toString() << options.serialize().toString()
-               << static_cast<cxx::Serialization>(portConfigInfo).toString();
+    auto maybeSubscriber = [&]() -> expected<SubscriberPortUserType::MemberType_t*, IpcMessageErrorType> {
+        if (!isValidNodeName(options.nodeName))
+        {
+            return error<IpcMessageErrorType>(IpcMessageErrorType::REQUEST_SUBSCRIBER_INVALID_RESPONSE);
+        }
 
-    auto maybeSubscriber = requestSubscriberFromRoudi(sendBuffer);
+        if (m_ipcChannelInterface.getIpcProtocol() == IpcProtocol::BINARY)
+        {
+            IpcBinaryMessage request{IpcMessageType::CREATE_SUBSCRIBER};
+            request << m_appName << service << options << portConfigInfo;
+            return requestFromRoudi<SubscriberPortUserType::MemberType_t>(
+                request,
+                IpcMessageType::CREATE_SUBSCRIBER_ACK,
+                IpcMessageErrorType::REQUEST_SUBSCRIBER_INVALID_RESPONSE,
+                IpcMessageErrorType::REQUEST_SUBSCRIBER_WRONG_IPC_MESSAGE_RESPONSE);
+        }
+
+        IpcMessage sendBuffer;
+        sendBuffer << IpcMessageTypeToString(IpcMessageType::CREATE_SUBSCRIBER) << m_appName
+                   << static_cast<cxx::Serialization>(service).toString() << options.serialize().toString()
+                   << static_cast<cxx::Serialization>(portConfigInfo).toString();
+        return requestSubscriberFromRoudi(sendBuffer);
+    }();
 
     if (maybeSubscriber.has_error())
     {
@@ -319,12 +411,29 @@ popo::ClientPortUser::MemberType_t* PoshRuntimeImpl::getMiddlewareClient(const c
         options.responseQueueCapacity = 1U;
     }
 
-    IpcMessage sendBuffer;
-    sendBuffer << IpcMessageTypeToString(IpcMessageType::CREATE_CLIENT) << m_appName
-               << static_cast<cxx::Serialization>(service).toString() << options.serialize().toString()
-               << static_cast<cxx::Serialization>(portConfigInfo).toString();
+    auto maybeClient = [&]() -> expected<popo::ClientPortUser::MemberType_t*, IpcMessageErrorType> {
+        if (!isValidNodeName(options.nodeName))
+        {
+            return error<IpcMessageErrorType>(IpcMessageErrorType::REQUEST_CLIENT_INVALID_RESPONSE);
+        }
+
+        if (m_ipcChannelInterface.getIpcProtocol() == IpcProtocol::BINARY)
+        {
+            IpcBinaryMessage request{IpcMessageType::CREATE_CLIENT};
+            request << m_appName << service << options << portConfigInfo;
+            return requestFromRoudi<popo::ClientPortUser::MemberType_t>(
+                request,
+                IpcMessageType::CREATE_CLIENT_ACK,
+                IpcMessageErrorType::REQUEST_CLIENT_INVALID_RESPONSE,
+                IpcMessageErrorType::REQUEST_CLIENT_WRONG_IPC_MESSAGE_RESPONSE);
+        }
 
-    auto maybeClient = requestClientFromRoudi(sendBuffer);
+        IpcMessage sendBuffer;
+        sendBuffer << IpcMessageTypeToString(IpcMessageType::CREATE_CLIENT) << m_appName
+                   << static_cast<cxx::Serialization>(service).toString() << options.serialize().toString()
+                   << static_cast<cxx::Serialization>(portConfigInfo).toString();
+        return requestClientFromRoudi(sendBuffer);
+    }();
     if (maybeClient.has_error())
     {
         switch (maybeClient.get_error())
@@ -423,12 +532,29 @@ popo::ServerPortUser::MemberType_t* PoshRuntimeImpl::getMiddlewareServer(const c
         options.requestQueueCapacity = 1U;
     }
 
-    IpcMessage sendBuffer;
-    sendBuffer << IpcMessageTypeToString(IpcMessageType::CREATE_SERVER) << m_appName
-               << static_cast<cxx::Serialization>(service).toString() << options.serialize().toString()
-               << static_cast<cxx::Serialization>(portConfigInfo).toString();
+    auto maybeServer = [&]() -> expected<popo::ServerPortUser::MemberType_t*, IpcMessageErrorType> {
+        if (!isValidNodeName(options.nodeName))
+        {
+            return error<IpcMessageErrorType>(IpcMessageErrorType::REQUEST_SERVER_INVALID_RESPONSE);
+        }
 
-    auto maybeServer = requestServerFromRoudi(sendBuffer);
+        if (m_ipcChannelInterface.getIpcProtocol() == IpcProtocol::BINARY)
+        {
+            IpcBinaryMessage request{IpcMessageType::CREATE_SERVER};
+            request << m_appName << service << options << portConfigInfo;
+            return requestFromRoudi<popo::ServerPortUser::MemberType_t>(
+                request,
+                IpcMessageType::CREATE_SERVER_ACK,
+                IpcMessageErrorType::REQUEST_SERVER_INVALID_RESPONSE,
+                IpcMessageErrorType::REQUEST_SERVER_WRONG_IPC_MESSAGE_RESPONSE);
+        }
+
+        IpcMessage sendBuffer;
+        sendBuffer << IpcMessageTypeToString(IpcMessageType::CREATE_SERVER) << m_appName
+                   << static_cast<cxx::Serialization>(service).toString() << options.serialize().toString()
+                   << static_cast<cxx::Serialization>(portConfigInfo).toString();
+        return requestServerFromRoudi(sendBuffer);
+    }();
     if (maybeServer.has_error())
     {
         switch (maybeServer.get_error())
@@ -616,10 +742,22 @@ PoshRuntimeImpl::requestConditionVariableFromRoudi(const IpcMessage& sendBuffer)
 
 popo::ConditionVariableData* PoshRuntimeImpl::getMiddlewareConditionVariable() noexcept
 {
-    IpcMessage sendBuffer;
-    sendBuffer << IpcMessageTypeToString(IpcMessageType::CREATE_CONDITION_VARIABLE) << m_appName;
+    auto maybeConditionVariable = [&] {
+        if (m_ipcChannelInterface.getIpcProtocol() == IpcProtocol::BINARY)
+        {
+            IpcBinaryMessage request{IpcMessageType::CREATE_CONDITION_VARIABLE};
+            request << m_appName;
+            return requestFromRoudi<popo::ConditionVariableData>(
+                request,
+                IpcMessageType::CREATE_CONDITION_VARIABLE_ACK,
+                IpcMessageErrorType::REQUEST_CONDITION_VARIABLE_INVALID_RESPONSE,
+                IpcMessageErrorType::REQUEST_CONDITION_VARIABLE_WRONG_IPC_MESSAGE_RESPONSE);
+        }
 
-    auto maybeConditionVariable = requestConditionVariableFromRoudi(sendBuffer);
+        IpcMessage sendBuffer;
+        sendBuffer << IpcMessageTypeToString(IpcMessageType::CREATE_CONDITION_VARIABLE) << m_appName;
+        return requestConditionVariableFromRoudi(sendBuffer);
+    }();
     if (maybeConditionVariable.has_error())
     {
         switch (maybeConditionVariable.get_error())
@@ -649,6 +787,18 @@ popo::ConditionVariableData* PoshRuntimeImpl::getMiddlewareConditionVariable() n
     return maybeConditionVariable.value();
 }
 
+bool PoshRuntimeImpl::isValidNodeName(const NodeName_t& nodeName) noexcept
+{
+    // the text protocol cannot transfer a node name which contains the separator of an IpcMessage; the node name is
+    // rejected with both protocols, otherwise the behavior of the API would depend on the protocol negotiated with RouDi
+    if (IpcMessage().isValidEntry(nodeName.c_str()))
+    {
+        return true;
+    }
+    IOX_LOG(ERROR) << "The node name '" << nodeName << "' contains the separator of the IPC messages!";
+    return false;
+}
+
 bool PoshRuntimeImpl::sendRequestToRouDi(const IpcMessage& msg, IpcMessage& answer) noexcept
 {
     // runtime must be thread safe
@@ -656,12 +806,19 @@ bool PoshRuntimeImpl::sendRequestToRouDi(const IpcMessage& msg, IpcMessage& answ
     return m_ipcChannelInterface.sendRequestToRouDi(msg, answer);
 }
 
+bool PoshRuntimeImpl::sendRequestToRouDi(const IpcBinaryMessage& msg, IpcBinaryMessage& answer) noexcept
+{
+    // runtime must be thread safe
+    std::lock_guard<posix::mutex> g(m_appIpcRequestMutex);
+    return m_ipcChannelInterface.sendRequestToRouDi(msg, answer);
+}
+
 // this is the callback for the m_keepAliveTimer
 void PoshRuntimeImpl::sendKeepAliveAndHandleShutdownPreparation() noexcept
 {
-    if (!m_ipcChannelInterface.sendKeepalive())
+    if (m_heartbeat != nullptr)
     {
-        IOX_LOG(WARN) << "Error in sending keep alive";
+        m_heartbeat->beat();
     }
 
     // this is not the nicest solution, but we cannot send this in the signal handler where m_shutdownRequested is
@@ -29,9 +29,30 @@ void ServiceDiscovery::update()
 {
     // allows us to use update and hence findService concurrently
     std::lock_guard<std::mutex> lock(m_serviceRegistryMutex);
-    m_serviceRegistrySubscriber.take().and_then([&](popo::Sample<const roudi::ServiceRegistry>& serviceRegistrySample) {
-        *m_serviceRegistry = *serviceRegistrySample;
-    });
+    m_serviceRegistryChangeLogSubscriber.take().and_then(
+        [&](popo::Sample<const roudi::ServiceRegistryChangeLog>& changeLogSample) {
+            m_changeLogSample.emplace(std::move(changeLogSample));
+        });
+    if (!m_changeLogSample.has_value())
+    {
+        return;
+    }
+
+    if (m_changeLogSample.value()->applyTo(*m_serviceRegistry).has_error())
+    {
+        // the registry is too old for the change log, e.g. on the first update, and is replaced by the latest
+        // snapshot; RouDi publishes the snapshot before the change log, hence the change log covers the snapshot
+        m_serviceRegistrySubscriber.take().and_then(
+            [&](popo::Sample<const roudi::ServiceRegistry>& serviceRegistrySample) {
+                *m_serviceRegistry = *serviceRegistrySample;
+            });
+        if (m_changeLogSample.value()->applyTo(*m_serviceRegistry).has_error())
+        {
+            // the snapshot was not yet received, the change log is kept to apply it with the next update
+            return;
+        }
+    }
+    m_changeLogSample.reset();
 }
 
 void ServiceDiscovery::findService(const optional<capro::IdString_t>& service,
@@ -80,7 +101,7 @@ void ServiceDiscovery::enableEvent(popo::TriggerHandle&& triggerHandle, const Se
     {
     case ServiceDiscoveryEvent::SERVICE_REGISTRY_CHANGED:
     {
-        m_serviceRegistrySubscriber.enableEvent(std::move(triggerHandle), popo::SubscriberEvent::DATA_RECEIVED);
+        m_serviceRegistryChangeLogSubscriber.enableEvent(std::move(triggerHandle), popo::SubscriberEvent::DATA_RECEIVED);
         break;
     }
     default:
@@ -97,7 +118,7 @@ void ServiceDiscovery::disableEvent(const ServiceDiscoveryEvent event) noexcept
     {
     case ServiceDiscoveryEvent::SERVICE_REGISTRY_CHANGED:
     {
-        m_serviceRegistrySubscriber.disableEvent(popo::SubscriberEvent::DATA_RECEIVED);
+        m_serviceRegistryChangeLogSubscriber.disableEvent(popo::SubscriberEvent::DATA_RECEIVED);
         break;
     }
     default:
@@ -110,13 +131,13 @@ void ServiceDiscovery::disableEvent(const ServiceDiscoveryEvent event) noexcept
 
 void ServiceDiscovery::invalidateTrigger(const uint64_t uniqueTriggerId)
 {
-    m_serviceRegistrySubscriber.invalidateTrigger(uniqueTriggerId);
+    m_serviceRegistryChangeLogSubscriber.invalidateTrigger(uniqueTriggerId);
 }
 
 popo::WaitSetIsConditionSatisfiedCallback
 ServiceDiscovery::getCallbackForIsStateConditionSatisfied(const popo::SubscriberState state)
 {
-    return m_serviceRegistrySubscriber.getCallbackForIsStateConditionSatisfied(state);
+    return m_serviceRegistryChangeLogSubscriber.getCallbackForIsStateConditionSatisfied(state);
 }
 
 } // namespace runtime
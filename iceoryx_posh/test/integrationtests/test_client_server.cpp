@@ -18,6 +18,7 @@
 #include "iceoryx_hoofs/testing/watch_dog.hpp"
 #include "iceoryx_posh/popo/client.hpp"
 #include "iceoryx_posh/popo/server.hpp"
+#include "iceoryx_posh/popo/server_worker_pool.hpp"
 #include "iceoryx_posh/popo/untyped_client.hpp"
 #include "iceoryx_posh/popo/untyped_server.hpp"
 #include "iceoryx_posh/runtime/posh_runtime.hpp"
@@ -25,6 +26,9 @@
 
 #include "test.hpp"
 
+#include <algorithm>
+#include <vector>
+
 namespace
 {
 using namespace ::testing;
@@ -443,4 +447,134 @@ TEST_F(ClientServer_test, ClientTakesResponseUnblocksServerSendingResponse)
     EXPECT_THAT(wasResponseSent.load(), Eq(true));
 }
 
+TEST_F(ClientServer_test, ServerWorkerPoolProcessesAllRequests)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3913c05f-784e-40e2-a041-921962eef916");
+
+    constexpr uint64_t NUMBER_OF_ROUNDS{100U};
+    constexpr uint64_t REQUESTS_PER_ROUND{iox::MAX_REQUESTS_ALLOCATED_SIMULTANEOUSLY};
+
+    ServerWorkerPoolOptions options;
+    options.numberOfWorkerThreads = iox::MAX_REQUESTS_PROCESSED_SIMULTANEOUSLY;
+    ServerWorkerPool<DummyRequest, DummyResponse> sut{
+        sd, [](const DummyRequest& request, DummyResponse& response) { response.sum = request.augend + request.addend; },
+        options};
+    Client<DummyRequest, DummyResponse> client{sd};
+
+    ASSERT_TRUE(sut.hasClients());
+    ASSERT_THAT(client.getConnectionState(), Eq(iox::ConnectionState::CONNECTED));
+
+    for (uint64_t round = 0U; round < NUMBER_OF_ROUNDS; ++round)
+    {
+        for (uint64_t i = 0U; i < REQUESTS_PER_ROUND; ++i)
+        {
+            auto loanResult = client.loan();
+            ASSERT_FALSE(loanResult.has_error());
+            auto& request = loanResult.value();
+            request.getRequestHeader().setSequenceId(static_cast<int64_t>(i));
+            request->augend = round;
+            request->addend = i;
+            ASSERT_FALSE(client.send(std::move(request)).has_error());
+        }
+
+        // the workers process the requests concurrently, therefore the responses arrive in any order
+        std::vector<bool> isResponseReceived(REQUESTS_PER_ROUND, false);
+        for (uint64_t i = 0U; i < REQUESTS_PER_ROUND;)
+        {
+            auto takeResult = client.take();
+            if (takeResult.has_error())
+            {
+                std::this_thread::yield();
+                continue;
+            }
+            auto& response = takeResult.value();
+            const auto sequenceId = static_cast<uint64_t>(response.getResponseHeader().getSequenceId());
+            ASSERT_THAT(sequenceId, Lt(REQUESTS_PER_ROUND));
+            EXPECT_FALSE(isResponseReceived[sequenceId]);
+            EXPECT_THAT(response->sum, Eq(round + sequenceId));
+            isResponseReceived[sequenceId] = true;
+            ++i;
+        }
+    }
+}
+
+TEST_F(ClientServer_test, ServerWorkerPoolProcessesRequestsConcurrently)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6f2bc79d-3599-4451-b182-bc1a20d709dd");
+
+    constexpr uint64_t NUMBER_OF_WORKERS{
+        std::min(iox::MAX_REQUESTS_PROCESSED_SIMULTANEOUSLY, iox::MAX_REQUESTS_ALLOCATED_SIMULTANEOUSLY)};
+
+    // every handler waits until all workers are in the handler; if the requests were processed sequentially, the
+    // deadlock watchdog would terminate the test
+    Barrier areAllWorkersInHandler(NUMBER_OF_WORKERS);
+    ServerWorkerPoolOptions options;
+    options.numberOfWorkerThreads = NUMBER_OF_WORKERS;
+    ServerWorkerPool<DummyRequest, DummyResponse> sut{sd,
+                                                      [&](const DummyRequest& request, DummyResponse& response) {
+                                                          areAllWorkersInHandler.notify();
+                                                          areAllWorkersInHandler.wait();
+                                                          response.sum = request.augend + request.addend;
+                                                      },
+                                                      options};
+    Client<DummyRequest, DummyResponse> client{sd};
+
+    ASSERT_TRUE(sut.hasClients());
+    ASSERT_THAT(client.getConnectionState(), Eq(iox::ConnectionState::CONNECTED));
+
+    for (uint64_t i = 0U; i < NUMBER_OF_WORKERS; ++i)
+    {
+        auto loanResult = client.loan();
+        ASSERT_FALSE(loanResult.has_error());
+        loanResult.value()->augend = i;
+        loanResult.value()->addend = i;
+        ASSERT_FALSE(loanResult.value().send().has_error());
+    }
+
+    uint64_t sumOfResponses{0U};
+    for (uint64_t i = 0U; i < NUMBER_OF_WORKERS;)
+    {
+        auto takeResult = client.take();
+        if (takeResult.has_error())
+        {
+            std::this_thread::yield();
+            continue;
+        }
+        sumOfResponses += takeResult.value()->sum;
+        ++i;
+    }
+    EXPECT_THAT(sumOfResponses, Eq(NUMBER_OF_WORKERS * (NUMBER_OF_WORKERS - 1U)));
+}
+
+TEST_F(ClientServer_test, ServerWorkerPoolLimitsWorkersAndInFlightRequestsToRequestsProcessedSimultaneously)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e618f386-1f55-409f-b2fa-198e4b7aaa2d");
+
+    auto handler = [](const DummyRequest&, DummyResponse&) {};
+    {
+        ServerWorkerPoolOptions options;
+        options.numberOfWorkerThreads = iox::MAX_REQUESTS_PROCESSED_SIMULTANEOUSLY + 1U;
+        options.inFlightRequestsPerWorker = 2U;
+        ServerWorkerPool<DummyRequest, DummyResponse> sut{sd, handler, options};
+        EXPECT_THAT(sut.numberOfWorkerThreads(), Eq(iox::MAX_REQUESTS_PROCESSED_SIMULTANEOUSLY));
+        EXPECT_THAT(sut.inFlightRequestsPerWorker(), Eq(1U));
+    }
+    {
+        ServerWorkerPoolOptions options;
+        options.numberOfWorkerThreads = 0U;
+        options.inFlightRequestsPerWorker = 0U;
+        ServerWorkerPool<DummyRequest, DummyResponse> sut{sd, handler, options};
+        EXPECT_THAT(sut.numberOfWorkerThreads(), Eq(1U));
+        EXPECT_THAT(sut.inFlightRequestsPerWorker(), Eq(1U));
+    }
+    {
+        ServerWorkerPoolOptions options;
+        options.numberOfWorkerThreads = 1U;
+        options.inFlightRequestsPerWorker = iox::MAX_REQUESTS_PROCESSED_SIMULTANEOUSLY + 1U;
+        ServerWorkerPool<DummyRequest, DummyResponse> sut{sd, handler, options};
+        EXPECT_THAT(sut.numberOfWorkerThreads(), Eq(1U));
+        EXPECT_THAT(sut.inFlightRequestsPerWorker(), Eq(iox::MAX_REQUESTS_PROCESSED_SIMULTANEOUSLY));
+    }
+}
+
 } // namespace
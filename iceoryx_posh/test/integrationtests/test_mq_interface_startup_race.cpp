@@ -81,7 +81,7 @@ class CMqInterfaceStartupRace_test : public Test
 
     void checkRegRequest(const IpcMessage& msg) const
     {
-        ASSERT_THAT(msg.getNumberOfElements(), Eq(6u));
+        ASSERT_THAT(msg.getNumberOfElements(), Eq(7u));
 
         std::string cmd = msg.getElementAtIndex(0);
         ASSERT_THAT(cmd.c_str(), StrEq(IpcMessageTypeToString(IpcMessageType::REG)));
@@ -98,9 +98,12 @@ class CMqInterfaceStartupRace_test : public Test
         constexpr uint32_t DUMMY_SHM_OFFSET{73};
         constexpr uint32_t DUMMY_SEGMENT_ID{13};
         constexpr uint32_t INDEX_OF_TIMESTAMP{4};
-        constexpr uint32_t SEND_KEEP_ALIVE{true};
+        constexpr bool IS_MONITORED{true};
+        constexpr uint32_t DUMMY_HEARTBEAT_OFFSET{42};
+        constexpr uint32_t TEXT_PROTOCOL_VERSION{0};
         regAck << IpcMessageTypeToString(IpcMessageType::REG_ACK) << DUMMY_SHM_SIZE << DUMMY_SHM_OFFSET
-               << oldMsg.getElementAtIndex(INDEX_OF_TIMESTAMP) << DUMMY_SEGMENT_ID << SEND_KEEP_ALIVE;
+               << oldMsg.getElementAtIndex(INDEX_OF_TIMESTAMP) << DUMMY_SEGMENT_ID << IS_MONITORED
+               << DUMMY_HEARTBEAT_OFFSET << TEXT_PROTOCOL_VERSION;
 
         if (m_appQueue.has_error())
         {
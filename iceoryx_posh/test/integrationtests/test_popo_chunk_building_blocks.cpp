@@ -221,8 +221,11 @@ class ChunkBuildingBlocks_IntegrationTest : public Test
     ChunkQueuePopper_t m_popper{&m_chunkQueueData};
 
     // Objects used by subscribing thread
+    LatencyHistogram m_latencyHistogram;
     ChunkReceiverData_t m_chunkReceiverData{iox::cxx::VariantQueueTypes::FiFo_SingleProducerSingleConsumer,
-                                            QueueFullPolicy::DISCARD_OLDEST_DATA}; // SoFi intentionally not used
+                                            QueueFullPolicy::DISCARD_OLDEST_DATA,
+                                            iox::mepoo::MemoryInfo(),
+                                            &m_latencyHistogram}; // SoFi intentionally not used
     ChunkReceiver<ChunkReceiverData_t> m_chunkReceiver{&m_chunkReceiverData};
 };
 
@@ -251,6 +254,7 @@ TEST_F(ChunkBuildingBlocks_IntegrationTest, TwoHopsThreeThreadsNoSoFi)
     ASSERT_FALSE(m_popper.hasLostChunks());
     ASSERT_FALSE(m_chunkReceiver.hasLostChunks());
     EXPECT_EQ(m_sendCounter, m_receiveCounter);
+    EXPECT_EQ(m_latencyHistogram.count(), m_receiveCounter);
 }
 
 } // namespace
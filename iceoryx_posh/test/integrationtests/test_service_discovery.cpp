@@ -15,6 +15,7 @@
 //
 // SPDX-License-Identifier: Apache-2.0
 
+#include "iceoryx_dust/cxx/convert.hpp"
 #include "iceoryx_hoofs/testing/timing_test.hpp"
 #include "iceoryx_hoofs/testing/watch_dog.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
@@ -28,6 +29,7 @@
 #include "iceoryx_posh/testing/roudi_gtest.hpp"
 #include "test.hpp"
 
+#include <memory>
 #include <random>
 #include <set>
 #include <type_traits>
@@ -191,7 +193,7 @@ TEST_F(ServiceDiscoveryBase_test, FindServiceWithWildcardsReturnsOnlyIntrospecti
     ::testing::Test::RecordProperty("TEST_ID", "d944f32c-edef-44f5-a6eb-c19ee73c98eb");
     findService(iox::capro::Wildcard, iox::capro::Wildcard, iox::capro::Wildcard, MessagingPattern::PUB_SUB);
 
-    constexpr uint32_t NUM_INTERNAL_SERVICES = 6U;
+    constexpr uint32_t NUM_INTERNAL_SERVICES = 7U;
     EXPECT_EQ(serviceContainer.size(), NUM_INTERNAL_SERVICES);
     for (auto& service : serviceContainer)
     {
@@ -251,6 +253,29 @@ TYPED_TEST(ServiceDiscovery_test, ServiceOfferedMultipleTimesCanBeFound)
     EXPECT_THAT(serviceContainer[0], Eq(SERVICE_DESCRIPTION));
 }
 
+TYPED_TEST(ServiceDiscovery_test, ServiceDiscoveryWhichMissedMoreChangesThanTheChangeLogContainsFindsAllServices)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b3c4b0a3-1f55-4a51-8d64-2f2c1b2f6e0d");
+    // the internal services are also added to the registry, therefore the change log does not contain all changes
+    constexpr uint64_t NUMBER_OF_PRODUCERS{iox::roudi::ServiceRegistryChangeLog::CAPACITY};
+    using Producer = typename TestFixture::CommunicationKind::Producer;
+    std::vector<std::unique_ptr<Producer>> producers;
+    for (uint64_t i = 0U; i < NUMBER_OF_PRODUCERS; ++i)
+    {
+        producers.emplace_back(new Producer(ServiceDescription(
+            "ChangeLog", "Producer", iox::into<iox::lossy<IdString_t>>(iox::cxx::convert::toString(i)))));
+    }
+
+    // the registry of the ServiceDiscovery is restored from a snapshot and brought up to date with the change log
+    do
+    {
+        this->waitUntilServiceChange();
+        this->findService(IdString_t("ChangeLog"), iox::capro::Wildcard, iox::capro::Wildcard);
+    } while (serviceContainer.size() < NUMBER_OF_PRODUCERS);
+
+    EXPECT_THAT(serviceContainer.size(), Eq(NUMBER_OF_PRODUCERS));
+}
+
 //
 // Notification Tests
 // Check whether attaching, notification and detaching of waitset and listener works
@@ -457,6 +482,9 @@ class ReferenceDiscovery
             services.emplace(iox::SERVICE_DISCOVERY_SERVICE_NAME,
                              iox::SERVICE_DISCOVERY_INSTANCE_NAME,
                              iox::SERVICE_DISCOVERY_EVENT_NAME);
+            services.emplace(iox::SERVICE_DISCOVERY_SERVICE_NAME,
+                             iox::SERVICE_DISCOVERY_INSTANCE_NAME,
+                             iox::SERVICE_DISCOVERY_CHANGE_LOG_EVENT_NAME);
         }
     }
 
@@ -452,6 +452,44 @@ TEST_F(ServiceDescription_test, LogStreamConvertsServiceDescriptionToString)
     EXPECT_THAT(loggerMock.logs[0].message, StrEq(SERVICE_DESCRIPTION_AS_STRING));
 }
 
+TEST_F(ServiceDescription_test, EqualServiceDescriptionsHaveTheSameHash)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ba04009d-45fe-4f25-aba0-d6fabbdd5b72");
+    ServiceDescription serviceDescription1("TestService", "TestInstance", "TestEvent", {1U, 2U, 3U, 4U});
+    ServiceDescription serviceDescription2(
+        "TestService", "TestInstance", "TestEvent", {5U, 6U, 7U, 8U}, Interfaces::DDS);
+    ASSERT_TRUE(serviceDescription1 == serviceDescription2);
+
+    EXPECT_THAT(ServiceDescriptionHash()(serviceDescription1), Eq(ServiceDescriptionHash()(serviceDescription2)));
+}
+
+TEST_F(ServiceDescription_test, HashDistinguishesTheBoundariesOfTheStrings)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6c22bac2-1859-435f-89ef-c58bdd6213e7");
+    ServiceDescription serviceDescription1("ab", "c", "d");
+    ServiceDescription serviceDescription2("a", "bc", "d");
+
+    EXPECT_THAT(ServiceDescriptionHash()(serviceDescription1), Ne(ServiceDescriptionHash()(serviceDescription2)));
+}
+
+TEST_F(ServiceDescription_test, HashDependsOnTheOrderOfTheStrings)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9b7e4d21-3f6a-4c58-8d0e-2a5c7f1b9e36");
+    ServiceDescription serviceDescription1("a", "b", "c");
+    ServiceDescription serviceDescription2("b", "a", "c");
+
+    EXPECT_THAT(ServiceDescriptionHash()(serviceDescription1), Ne(ServiceDescriptionHash()(serviceDescription2)));
+}
+
+TEST_F(ServiceDescription_test, HashOfIdStringIsIndependentOfTheProcess)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "cdbbfa42-7724-49e2-8471-501f7f66605f");
+    // the hash may be stored in shared memory, therefore it must be the FNV-1a hash in every process
+    constexpr uint64_t FNV_1A_HASH_OF_EMPTY_STRING_WITH_TERMINATOR{0xaf63bd4c8601b7dfULL};
+    EXPECT_THAT(hashIdString(""), Eq(FNV_1A_HASH_OF_EMPTY_STRING_WITH_TERMINATOR));
+    EXPECT_THAT(hashIdString("TestService"), Ne(hashIdString("TestInstance")));
+}
+
 /// END SERVICEDESCRIPTION TESTS
 
 } // namespace
@@ -52,11 +52,12 @@ TEST(ChunkHeader_test, ChunkHeaderHasInitializedMembers)
     EXPECT_THAT(sut.chunkSize(), Eq(CHUNK_SIZE));
 
     // deliberately used a magic number to make the test fail when CHUNK_HEADER_VERSION changes
-    EXPECT_THAT(sut.chunkHeaderVersion(), Eq(1U));
+    EXPECT_THAT(sut.chunkHeaderVersion(), Eq(2U));
 
     EXPECT_THAT(sut.originId(), Eq(iox::popo::UniquePortId(iox::popo::InvalidPortId)));
 
     EXPECT_THAT(sut.sequenceNumber(), Eq(0U));
+    EXPECT_THAT(sut.sendTimestamp(), Eq(0U));
 
     EXPECT_THAT(sut.userHeaderId(), Eq(ChunkHeader::NO_USER_HEADER));
     EXPECT_THAT(sut.userHeaderSize(), Eq(0U));
@@ -85,13 +86,14 @@ TEST(ChunkHeader_test, ChunkHeaderBinaryCompatibilityCheck)
         uint16_t userHeaderId{0};
         uint64_t originId{0U};
         uint64_t sequenceNumber{0U};
+        uint64_t sendTimestamp{0U};
         uint32_t userHeaderSize{0U};
         uint32_t userPayloadSize{0U};
         uint32_t userPayloadAlignment{0U};
         uint32_t userPayloadOffset{0U};
     };
 
-    constexpr auto EXPECTED_CHUNK_HEADER_VERSION{1U};
+    constexpr auto EXPECTED_CHUNK_HEADER_VERSION{2U};
     EXPECT_THAT(ChunkHeader::CHUNK_HEADER_VERSION, Eq(EXPECTED_CHUNK_HEADER_VERSION));
 
     EXPECT_THAT(sizeof(ChunkHeader), Eq(sizeof(ExpectedChunkHeaderLayout)));
@@ -119,6 +121,7 @@ TEST(ChunkHeader_test, ChunkHeaderBinaryCompatibilityCheck)
     IOX_TEST_CHUNK_HEADER_MEMBER_COMPATIBILITY(chunkHeaderVersion);
     IOX_TEST_CHUNK_HEADER_MEMBER_COMPATIBILITY(userHeaderId);
     IOX_TEST_CHUNK_HEADER_MEMBER_COMPATIBILITY(sequenceNumber);
+    IOX_TEST_CHUNK_HEADER_MEMBER_COMPATIBILITY(sendTimestamp);
     IOX_TEST_CHUNK_HEADER_MEMBER_COMPATIBILITY(userHeaderSize);
     IOX_TEST_CHUNK_HEADER_MEMBER_COMPATIBILITY(userPayloadSize);
     IOX_TEST_CHUNK_HEADER_MEMBER_COMPATIBILITY(userPayloadAlignment);
@@ -0,0 +1,186 @@
+// Copyright (c) 2026 by agent <agent@local>. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_platform/unistd.hpp"
+#include "iceoryx_posh/internal/mepoo/free_list_cache.hpp"
+#include "test.hpp"
+
+#include <set>
+#include <thread>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::mepoo;
+
+class FreeListCache_test : public Test
+{
+  public:
+    static constexpr uint32_t NUMBER_OF_INDICES{100U};
+    static constexpr uint32_t MAGAZINE_CAPACITY{8U};
+
+    using Index_t = FreeListCache::Index_t;
+
+    FreeListCache_test()
+    {
+        m_freeList.init(&m_freeListMemory[0], NUMBER_OF_INDICES);
+        m_sut.init(&m_magazineMemory[0], MAGAZINE_CAPACITY);
+    }
+
+    std::set<Index_t> popAllIndices(FreeListCache& sut)
+    {
+        std::set<Index_t> indices;
+        Index_t index{0U};
+        while (sut.pop(m_freeList, index))
+        {
+            EXPECT_TRUE(indices.insert(index).second);
+        }
+        return indices;
+    }
+
+    Index_t m_freeListMemory[iox::concurrent::LoFFLi::requiredIndexMemorySize(NUMBER_OF_INDICES) / sizeof(Index_t)];
+    Index_t m_magazineMemory[FreeListCache::requiredMagazineMemorySize(MAGAZINE_CAPACITY) / sizeof(Index_t)];
+    iox::concurrent::LoFFLi m_freeList;
+    FreeListCache m_sut;
+};
+
+TEST_F(FreeListCache_test, PopWithoutMagazinesUsesFreeListDirectly)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9d32e606-e912-41c5-9bb2-6b654e0412f6");
+    FreeListCache sut;
+    Index_t index{0U};
+
+    ASSERT_TRUE(sut.pop(m_freeList, index));
+
+    EXPECT_THAT(sut.getNumberOfCachedIndices(), Eq(0U));
+    EXPECT_THAT(popAllIndices(sut).size(), Eq(NUMBER_OF_INDICES - 1U));
+}
+
+TEST_F(FreeListCache_test, PopRefillsHalfOfTheMagazineFromTheFreeList)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "48be4378-859d-4ab6-8dd9-6c5c9fafbbe8");
+    Index_t index{0U};
+
+    ASSERT_TRUE(m_sut.pop(m_freeList, index));
+
+    EXPECT_THAT(m_sut.getNumberOfCachedIndices(), Eq(MAGAZINE_CAPACITY / 2U - 1U));
+}
+
+TEST_F(FreeListCache_test, AllIndicesCanBePoppedOnceWhenCacheIsUsed)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5ded728e-ab8a-4f09-a565-0bafe73b57e4");
+    auto indices = popAllIndices(m_sut);
+
+    EXPECT_THAT(indices.size(), Eq(NUMBER_OF_INDICES));
+    EXPECT_THAT(m_sut.getNumberOfCachedIndices(), Eq(0U));
+}
+
+TEST_F(FreeListCache_test, PushDrainsHalfOfTheMagazineToTheFreeListWhenItIsFull)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c393fa51-85b9-4989-b0cc-820231f0b5d1");
+    auto indices = popAllIndices(m_sut);
+
+    for (auto index : indices)
+    {
+        EXPECT_TRUE(m_sut.push(m_freeList, index));
+        EXPECT_THAT(m_sut.getNumberOfCachedIndices(), Le(MAGAZINE_CAPACITY));
+    }
+
+    EXPECT_THAT(popAllIndices(m_sut).size(), Eq(NUMBER_OF_INDICES));
+}
+
+TEST_F(FreeListCache_test, IndicesCachedByAnotherThreadCanBePoppedWhenFreeListIsExhausted)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5fdda701-03c0-4c30-91e8-3e8406860bb1");
+    std::thread otherThread([&] {
+        Index_t index{0U};
+        ASSERT_TRUE(m_sut.pop(m_freeList, index));
+        ASSERT_TRUE(m_sut.push(m_freeList, index));
+    });
+    otherThread.join();
+    ASSERT_THAT(m_sut.getNumberOfCachedIndices(), Eq(MAGAZINE_CAPACITY / 2U));
+
+    EXPECT_THAT(popAllIndices(m_sut).size(), Eq(NUMBER_OF_INDICES));
+    EXPECT_THAT(m_sut.getNumberOfCachedIndices(), Eq(0U));
+}
+
+TEST_F(FreeListCache_test, DoubleFreeIsDetectedWhenTheMagazineIsDrained)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9919fab3-aa32-4277-ab64-3c9f857fd971");
+    Index_t index{0U};
+    ASSERT_TRUE(m_sut.pop(m_freeList, index));
+
+    bool isDoubleFreeDetected{false};
+    for (uint32_t i = 0U; i < 2U * MAGAZINE_CAPACITY && !isDoubleFreeDetected; ++i)
+    {
+        isDoubleFreeDetected = !m_sut.push(m_freeList, index);
+    }
+
+    EXPECT_TRUE(isDoubleFreeDetected);
+}
+
+TEST_F(FreeListCache_test, ReleasingSlotsOfProcessKeepsCachedIndicesAvailable)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "650958e5-183d-4d4d-b244-9bca9911e149");
+    Index_t index{0U};
+    ASSERT_TRUE(m_sut.pop(m_freeList, index));
+    ASSERT_TRUE(m_sut.push(m_freeList, index));
+
+    m_sut.releaseSlotsOfProcess(static_cast<uint32_t>(getpid()));
+
+    EXPECT_THAT(m_sut.getNumberOfCachedIndices(), Eq(MAGAZINE_CAPACITY / 2U));
+    EXPECT_THAT(popAllIndices(m_sut).size(), Eq(NUMBER_OF_INDICES));
+}
+
+TEST_F(FreeListCache_test, ConcurrentPopAndPushNeitherLosesNorDuplicatesIndices)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6f1fae8b-da45-4bdb-888b-bda6593f3f59");
+    constexpr uint32_t NUMBER_OF_THREADS{4U};
+    constexpr uint32_t NUMBER_OF_ITERATIONS{10000U};
+
+    std::vector<std::thread> threads;
+    for (uint32_t t = 0U; t < NUMBER_OF_THREADS; ++t)
+    {
+        threads.emplace_back([&] {
+            std::vector<Index_t> acquiredIndices;
+            for (uint32_t i = 0U; i < NUMBER_OF_ITERATIONS; ++i)
+            {
+                Index_t index{0U};
+                if (i % 3U != 2U && m_sut.pop(m_freeList, index))
+                {
+                    acquiredIndices.push_back(index);
+                }
+                else if (!acquiredIndices.empty())
+                {
+                    EXPECT_TRUE(m_sut.push(m_freeList, acquiredIndices.back()));
+                    acquiredIndices.pop_back();
+                }
+            }
+            for (auto index : acquiredIndices)
+            {
+                EXPECT_TRUE(m_sut.push(m_freeList, index));
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_THAT(popAllIndices(m_sut).size(), Eq(NUMBER_OF_INDICES));
+}
+
+} // namespace
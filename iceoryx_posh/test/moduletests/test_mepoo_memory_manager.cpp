@@ -275,6 +275,32 @@ TEST_F(MemoryManager_test, getChunkSingleMemPoolAllChunks)
     EXPECT_EQ(sut->getMemPoolInfo(0U).m_usedChunks, CHUNK_COUNT);
 }
 
+TEST_F(MemoryManager_test, getChunkWithEnabledChunkCacheAcquiresAllChunksWithinRequiredMemorySize)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4076480c-dfc3-4773-b50c-2455c18e3d3a");
+    constexpr uint32_t CHUNK_COUNT{100U};
+    constexpr uint32_t CHUNK_CACHE_CAPACITY{16U};
+
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_64, CHUNK_COUNT});
+    mempoolconf.setChunkCacheCapacity(CHUNK_CACHE_CAPACITY);
+    const auto requiredMemorySize = iox::mepoo::MemoryManager::requiredFullMemorySize(mempoolconf);
+    ASSERT_THAT(requiredMemorySize, Le(rawMemorySize));
+    iox::BumpAllocator exactlySizedAllocator{rawMemory, requiredMemorySize};
+    sut->configureMemoryManager(mempoolconf, exactlySizedAllocator, exactlySizedAllocator);
+
+    for (uint32_t i = 0U; i < 2U; ++i)
+    {
+        auto chunkStore32 = getChunksFromSut(CHUNK_COUNT, chunkSettings_32);
+        auto chunkStore64 = getChunksFromSut(CHUNK_COUNT, chunkSettings_64);
+
+        EXPECT_EQ(sut->getMemPoolInfo(0U).m_usedChunks, CHUNK_COUNT);
+        EXPECT_EQ(sut->getMemPoolInfo(1U).m_usedChunks, CHUNK_COUNT);
+    }
+    EXPECT_EQ(sut->getMemPoolInfo(0U).m_usedChunks, 0U);
+    EXPECT_EQ(sut->getMemPoolInfo(1U).m_usedChunks, 0U);
+}
+
 TEST_F(MemoryManager_test, getChunkSingleMemPoolToMuchChunks)
 {
     ::testing::Test::RecordProperty("TEST_ID", "8af072c7-425b-4820-bc28-0c1e6bad0441");
@@ -452,6 +478,129 @@ TEST_F(MemoryManager_test, freeChunkMultiMemPoolFullToEmptyToFull)
     EXPECT_THAT(sut->getMemPoolInfo(3).m_usedChunks, Eq(CHUNK_COUNT));
 }
 
+TEST_F(MemoryManager_test, getChunkAcquiresChunkFromSmallestFittingMemPoolWithManyMemPoolsPerSizeClass)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3ff401d5-4abe-4d77-8138-b71130202198");
+    constexpr uint32_t CHUNK_COUNT{1U};
+    // mempools in the same size class as well as size classes without any mempool
+    const std::vector<uint32_t> chunkPayloadSizes{8U, 16U, 24U, 32U, 40U, 48U, 56U, 64U, 1024U, 1032U, 65536U};
+    for (const auto chunkPayloadSize : chunkPayloadSizes)
+    {
+        mempoolconf.addMemPool({chunkPayloadSize, CHUNK_COUNT});
+    }
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    const std::vector<uint32_t> requestedUserPayloadSizes{1U, 8U, 9U, 33U, 63U, 64U, 65U, 1024U, 1025U, 4096U, 65536U};
+    const std::vector<uint32_t> expectedMemPoolIndices{0U, 0U, 1U, 4U, 7U, 7U, 8U, 8U, 9U, 10U, 10U};
+    for (uint32_t i = 0U; i < requestedUserPayloadSizes.size(); ++i)
+    {
+        auto chunkSettingsResult =
+            ChunkSettings::create(requestedUserPayloadSizes[i], iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT);
+        ASSERT_FALSE(chunkSettingsResult.has_error());
+
+        sut->getChunk(chunkSettingsResult.value())
+            .and_then([&](auto& chunk) {
+                EXPECT_THAT(chunk.getChunkHeader()->chunkSize(),
+                            Eq(sut->getMemPoolInfo(expectedMemPoolIndices[i]).m_chunkSize));
+            })
+            .or_else([](const auto& error) { GTEST_FAIL() << "getChunk failed with: " << error; });
+    }
+}
+
+TEST_F(MemoryManager_test, getChunkWithStrictBestFitPolicyFailsWhenBestFittingMemPoolIsExhausted)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "724f9e62-9d18-4369-a264-f5fa0be31031");
+    constexpr uint32_t CHUNK_COUNT{1U};
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_64, CHUNK_COUNT});
+    mempoolconf.setAllocationPolicy(iox::mepoo::MemPoolAllocationPolicy::STRICT_BEST_FIT);
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    auto chunkStore = getChunksFromSut(CHUNK_COUNT, chunkSettings_32);
+
+    auto errorHandlerGuard = iox::ErrorHandlerMock::setTemporaryErrorHandler<iox::PoshError>(
+        [](const iox::PoshError, const iox::ErrorLevel) {});
+    constexpr auto EXPECTED_ERROR{iox::mepoo::MemoryManager::Error::MEMPOOL_OUT_OF_CHUNKS};
+    sut->getChunk(chunkSettings_32)
+        .and_then(
+            [&](auto&) { GTEST_FAIL() << "getChunk should fail with '" << EXPECTED_ERROR << "' but did not fail"; })
+        .or_else([&](const auto& error) { EXPECT_EQ(error, EXPECTED_ERROR); });
+
+    EXPECT_THAT(sut->getMemPoolInfo(1).m_usedChunks, Eq(0U));
+    EXPECT_THAT(sut->getMemPoolInfo(0).m_spilledChunks, Eq(0U));
+}
+
+TEST_F(MemoryManager_test, getChunkWithSpillToNextLargerPolicyUsesOnlyTheNextLargerMemPool)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e330d356-f709-47d1-b92a-ae34728b022c");
+    constexpr uint32_t CHUNK_COUNT{1U};
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_64, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_128, CHUNK_COUNT});
+    mempoolconf.setAllocationPolicy(iox::mepoo::MemPoolAllocationPolicy::SPILL_TO_NEXT_LARGER);
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    auto chunkStore = getChunksFromSut(2U, chunkSettings_32);
+
+    EXPECT_THAT(sut->getMemPoolInfo(0).m_usedChunks, Eq(1U));
+    EXPECT_THAT(sut->getMemPoolInfo(1).m_usedChunks, Eq(1U));
+    EXPECT_THAT(sut->getMemPoolInfo(0).m_spilledChunks, Eq(1U));
+
+    auto errorHandlerGuard = iox::ErrorHandlerMock::setTemporaryErrorHandler<iox::PoshError>(
+        [](const iox::PoshError, const iox::ErrorLevel) {});
+    constexpr auto EXPECTED_ERROR{iox::mepoo::MemoryManager::Error::MEMPOOL_OUT_OF_CHUNKS};
+    sut->getChunk(chunkSettings_32)
+        .and_then(
+            [&](auto&) { GTEST_FAIL() << "getChunk should fail with '" << EXPECTED_ERROR << "' but did not fail"; })
+        .or_else([&](const auto& error) { EXPECT_EQ(error, EXPECTED_ERROR); });
+
+    EXPECT_THAT(sut->getMemPoolInfo(2).m_usedChunks, Eq(0U));
+}
+
+TEST_F(MemoryManager_test, getChunkWithSpillToAnyLargerPolicyUsesAllLargerMemPools)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d74984eb-0769-42ed-a11b-93c5684631d2");
+    constexpr uint32_t CHUNK_COUNT{1U};
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_64, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_128, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_256, CHUNK_COUNT});
+    mempoolconf.setAllocationPolicy(iox::mepoo::MemPoolAllocationPolicy::SPILL_TO_ANY_LARGER);
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    auto chunkStore_128 = getChunksFromSut(CHUNK_COUNT, chunkSettings_128);
+    auto chunkStore_32 = getChunksFromSut(3U, chunkSettings_32);
+
+    EXPECT_THAT(sut->getMemPoolInfo(0).m_usedChunks, Eq(1U));
+    EXPECT_THAT(sut->getMemPoolInfo(1).m_usedChunks, Eq(1U));
+    EXPECT_THAT(sut->getMemPoolInfo(2).m_usedChunks, Eq(1U));
+    EXPECT_THAT(sut->getMemPoolInfo(3).m_usedChunks, Eq(1U));
+    EXPECT_THAT(sut->getMemPoolInfo(0).m_spilledChunks, Eq(2U));
+    EXPECT_THAT(sut->getMemPoolInfo(1).m_spilledChunks, Eq(0U));
+}
+
+TEST_F(MemoryManager_test, getChunkWithSpillPolicyDoesNotUseSmallerMemPools)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "caf55c56-3d7c-4e34-a9e3-78b2158d8d39");
+    constexpr uint32_t CHUNK_COUNT{1U};
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_64, CHUNK_COUNT});
+    mempoolconf.setAllocationPolicy(iox::mepoo::MemPoolAllocationPolicy::SPILL_TO_ANY_LARGER);
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    auto chunkStore = getChunksFromSut(CHUNK_COUNT, chunkSettings_64);
+
+    auto errorHandlerGuard = iox::ErrorHandlerMock::setTemporaryErrorHandler<iox::PoshError>(
+        [](const iox::PoshError, const iox::ErrorLevel) {});
+    constexpr auto EXPECTED_ERROR{iox::mepoo::MemoryManager::Error::MEMPOOL_OUT_OF_CHUNKS};
+    sut->getChunk(chunkSettings_64)
+        .and_then(
+            [&](auto&) { GTEST_FAIL() << "getChunk should fail with '" << EXPECTED_ERROR << "' but did not fail"; })
+        .or_else([&](const auto& error) { EXPECT_EQ(error, EXPECTED_ERROR); });
+
+    EXPECT_THAT(sut->getMemPoolInfo(0).m_usedChunks, Eq(0U));
+}
+
 TEST_F(MemoryManager_test, getChunkWithUserPayloadSizeZeroShouldNotFail)
 {
     ::testing::Test::RecordProperty("TEST_ID", "9fbfe1ff-9d59-449b-b164-433bbb031125");
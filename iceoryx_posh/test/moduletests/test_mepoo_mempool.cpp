@@ -209,6 +209,36 @@ TEST_F(MemPool_test, GetMinFreeMethodReturnsTheNumberOfFreeChunks)
     }
 }
 
+TEST_F(MemPool_test, AllChunksAreAcquirableWhenChunkCacheIsEnabled)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "eb3a3dbb-c51e-4471-a126-3c80b00f82c1");
+    constexpr uint32_t CHUNK_CACHE_CAPACITY{16U};
+    const uint64_t managementMemorySize{MemPool::requiredManagementMemorySize(NUMBER_OF_CHUNKS, CHUNK_CACHE_CAPACITY)};
+    std::vector<uint64_t> managementMemory(managementMemorySize / sizeof(uint64_t));
+    iox::BumpAllocator managementAllocator{managementMemory.data(), managementMemorySize};
+    alignas(MemPool::CHUNK_MEMORY_ALIGNMENT) uint8_t chunkMemory[NUMBER_OF_CHUNKS * CHUNK_SIZE];
+    iox::BumpAllocator chunkMemoryAllocator{chunkMemory, NUMBER_OF_CHUNKS * CHUNK_SIZE};
+
+    iox::mepoo::MemPool sut(
+        CHUNK_SIZE, NUMBER_OF_CHUNKS, managementAllocator, chunkMemoryAllocator, CHUNK_CACHE_CAPACITY);
+
+    std::vector<void*> chunks;
+    for (uint32_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        chunks.push_back(sut.getChunk());
+        ASSERT_THAT(chunks.back(), Ne(nullptr));
+    }
+    EXPECT_THAT(sut.getChunk(), Eq(nullptr));
+    EXPECT_THAT(sut.getUsedChunks(), Eq(NUMBER_OF_CHUNKS));
+
+    for (auto chunk : chunks)
+    {
+        sut.freeChunk(chunk);
+    }
+    EXPECT_THAT(sut.getUsedChunks(), Eq(0U));
+    EXPECT_THAT(sut.getMinFree(), Eq(0U));
+}
+
 TEST_F(MemPool_test, dieWhenMempoolChunkSizeIsSmallerThan32Bytes)
 {
     ::testing::Test::RecordProperty("TEST_ID", "7704246e-42b5-46fd-8827-ebac200390e1");
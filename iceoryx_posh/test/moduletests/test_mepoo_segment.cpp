@@ -108,6 +108,12 @@ class MePooSegment_test : public Test
 
         IOX_BUILDER_PARAMETER(iox::access_rights, permissions, iox::perms::none)
 
+        IOX_BUILDER_PARAMETER(iox::optional<iox::Path>, directory, iox::nullopt)
+
+        IOX_BUILDER_PARAMETER(iox::optional<uint32_t>, numaNode, iox::nullopt)
+
+        IOX_BUILDER_PARAMETER(uint64_t, prefaultPageSize, 0U)
+
       public:
         iox::expected<SharedMemoryObject_MOCK, SharedMemoryObjectError> create() noexcept
         {
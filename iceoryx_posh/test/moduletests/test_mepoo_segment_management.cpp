@@ -40,7 +40,9 @@ class MePooSegmentMock
                      iox::BumpAllocator& managementAllocator IOX_MAYBE_UNUSED,
                      const PosixGroup& readerGroup IOX_MAYBE_UNUSED,
                      const PosixGroup& writerGroup IOX_MAYBE_UNUSED,
-                     const MemoryInfo& memoryInfo IOX_MAYBE_UNUSED) noexcept
+                     const MemoryInfo& memoryInfo IOX_MAYBE_UNUSED,
+                     const iox::optional<HugePageConfig>& hugePageConfig IOX_MAYBE_UNUSED,
+                     const iox::optional<uint32_t>& numaNode IOX_MAYBE_UNUSED) noexcept
     {
     }
 };
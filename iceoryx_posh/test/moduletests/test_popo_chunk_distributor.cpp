@@ -26,6 +26,7 @@
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_data.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_popper.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_pusher.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_listener.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/locking_policy.hpp"
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
 #include "test.hpp"
@@ -823,4 +824,291 @@ TYPED_TEST(ChunkDistributor_test, MultipleBlockingQueuesWillBeFilledWhenThereBec
     }
 }
 
+TYPED_TEST(ChunkDistributor_test, DeliverToAllStoredQueuesWithoutHistoryDoesNotTakeTheLock)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "205bdf89-ff10-41b2-b1dd-fd16f879fd82");
+    auto sutData = std::make_shared<typename TestFixture::ChunkDistributorData_t>(
+        ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA, 0U);
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData = this->getChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+
+    uint64_t numberOfDeliveries{0U};
+    sutData->lock();
+    std::thread t1([&] { numberOfDeliveries = sut.deliverToAllStoredQueues(this->allocateChunk(4242U)); });
+    t1.join();
+    sutData->unlock();
+
+    EXPECT_THAT(numberOfDeliveries, Eq(1U));
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    auto maybeSharedChunk = queue.tryPop();
+    ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+    EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(4242U));
+}
+
+TYPED_TEST(ChunkDistributor_test, QueuesCanBeAddedAndRemovedWhileChunksAreDelivered)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "142b1029-43a2-461a-ba36-05023cbc3e6d");
+    constexpr uint64_t NUMBER_OF_CHUNKS{1000U};
+    auto sutData = std::make_shared<typename TestFixture::ChunkDistributorData_t>(
+        ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA, 0U);
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto permanentQueueData = this->getChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(permanentQueueData.get()).has_error());
+
+    std::atomic_bool isDeliveryFinished{false};
+    std::thread publisher([&] {
+        for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+        {
+            EXPECT_THAT(sut.deliverToAllStoredQueues(this->allocateChunk(i)), Ge(1U));
+        }
+        isDeliveryFinished = true;
+    });
+
+    while (!isDeliveryFinished)
+    {
+        auto queueData = this->getChunkQueueData();
+        EXPECT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+        EXPECT_FALSE(sut.tryRemoveQueue(queueData.get()).has_error());
+        // the removed queue is destroyed and must not be accessed by the publisher anymore
+        ChunkQueuePopper<typename TestFixture::ChunkQueueData_t>(queueData.get()).clear();
+    }
+    publisher.join();
+
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> permanentQueue(permanentQueueData.get());
+    EXPECT_THAT(permanentQueue.size(), Gt(0U));
+    permanentQueue.clear();
+}
+
+TYPED_TEST(ChunkDistributor_test, QueueAddedDuringDeliveryReceivesTheChunkAfterTheHistory)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "18f0dfcd-fa45-43bd-b3fd-8a553f2989b2");
+    auto sutData = this->getChunkDistributorData(ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER);
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto blockingQueueData =
+        this->getChunkQueueData(QueueFullPolicy::BLOCK_PRODUCER, VariantQueueTypes::FiFo_MultiProducerSingleConsumer);
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> blockingQueue(blockingQueueData.get());
+    blockingQueue.setCapacity(1U);
+    ASSERT_FALSE(sut.tryAddQueue(blockingQueueData.get()).has_error());
+    sut.deliverToAllStoredQueues(this->allocateChunk(1U));
+
+    Barrier isThreadStarted(1U);
+    std::thread t1([&] {
+        isThreadStarted.notify();
+        sut.deliverToAllStoredQueues(this->allocateChunk(2U));
+    });
+    isThreadStarted.wait();
+    std::this_thread::sleep_for(this->BLOCKING_DURATION);
+
+    // the delivery of the second chunk is blocked by the full queue while the new queue gets the history
+    auto addedQueueData = this->getChunkQueueData();
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> addedQueue(addedQueueData.get());
+    ASSERT_FALSE(sut.tryAddQueue(addedQueueData.get(), this->HISTORY_SIZE).has_error());
+
+    EXPECT_TRUE(blockingQueue.tryPop().has_value());
+    t1.join();
+
+    ASSERT_THAT(addedQueue.size(), Eq(2U));
+    auto maybeSharedChunk = addedQueue.tryPop();
+    ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+    EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(1U));
+    maybeSharedChunk = addedQueue.tryPop();
+    ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+    EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(2U));
+}
+
+TYPED_TEST(ChunkDistributor_test, BatchedNotificationsWakeUpSharedConditionVariableOnlyOnce)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "de789259-885a-4f45-8619-20744fdbf1cd");
+    constexpr bool BATCH_CONSUMER_NOTIFICATIONS{true};
+    auto sutData = std::make_shared<typename TestFixture::ChunkDistributorData_t>(
+        ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA, 0U, BATCH_CONSUMER_NOTIFICATIONS);
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+    ConditionVariableData condVar("Horscht");
+    // the semaphore is only posted when a listener is blocked in wait
+    condVar.m_hasWaitingListener.store(true);
+
+    constexpr uint64_t NUMBER_OF_QUEUES{4U};
+    std::vector<std::shared_ptr<typename TestFixture::ChunkQueueData_t>> queueData;
+    for (uint64_t i = 0U; i < NUMBER_OF_QUEUES; ++i)
+    {
+        queueData.emplace_back(this->getChunkQueueData());
+        ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.back().get());
+        queue.setConditionVariable(condVar, i);
+        ASSERT_FALSE(sut.tryAddQueue(queueData.back().get()).has_error());
+    }
+
+    EXPECT_THAT(sut.deliverToAllStoredQueues(this->allocateChunk(7331U)), Eq(NUMBER_OF_QUEUES));
+
+    uint64_t numberOfWakeUps{0U};
+    while (condVar.m_semaphore->tryWait().value())
+    {
+        ++numberOfWakeUps;
+    }
+    EXPECT_THAT(numberOfWakeUps, Eq(1U));
+    for (uint64_t i = 0U; i < NUMBER_OF_QUEUES; ++i)
+    {
+        EXPECT_TRUE(condVar.isNotificationActive(i));
+        ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData[i].get());
+        auto maybeSharedChunk = queue.tryPop();
+        ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+        EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(7331U));
+    }
+}
+
+TYPED_TEST(ChunkDistributor_test, BatchedNotificationsWakeUpEveryConditionVariable)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0ced2a21-e40c-4931-9cd7-00bd35dbc9a5");
+    constexpr bool BATCH_CONSUMER_NOTIFICATIONS{true};
+    auto sutData = std::make_shared<typename TestFixture::ChunkDistributorData_t>(
+        ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA, 0U, BATCH_CONSUMER_NOTIFICATIONS);
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+    ConditionVariableData condVar1("Horscht");
+    ConditionVariableData condVar2("Schnuppi");
+    ConditionListener condVarWaiter1{condVar1};
+    ConditionListener condVarWaiter2{condVar2};
+
+    auto queueData1 = this->getChunkQueueData();
+    auto queueData2 = this->getChunkQueueData();
+    auto queueDataWithoutConditionVariable = this->getChunkQueueData();
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t>(queueData1.get()).setConditionVariable(condVar1, 0U);
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t>(queueData2.get()).setConditionVariable(condVar2, 0U);
+    ASSERT_FALSE(sut.tryAddQueue(queueData1.get()).has_error());
+    ASSERT_FALSE(sut.tryAddQueue(queueDataWithoutConditionVariable.get()).has_error());
+    ASSERT_FALSE(sut.tryAddQueue(queueData2.get()).has_error());
+
+    EXPECT_THAT(sut.deliverToAllStoredQueues(this->allocateChunk(7332U)), Eq(3U));
+
+    EXPECT_THAT(condVarWaiter1.timedWait(1_ns).empty(), Eq(false));
+    EXPECT_THAT(condVarWaiter2.timedWait(1_ns).empty(), Eq(false));
+}
+
+TYPED_TEST(ChunkDistributor_test, DeliverBatchToAllStoredQueuesKeepsTheOrderAndUpdatesTheHistory)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d8d49e23-4119-4cb2-b522-660f0ca8a66a");
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    constexpr uint64_t NUMBER_OF_QUEUES{2U};
+    std::vector<std::shared_ptr<typename TestFixture::ChunkQueueData_t>> queueData;
+    for (uint64_t i = 0U; i < NUMBER_OF_QUEUES; ++i)
+    {
+        queueData.emplace_back(this->getChunkQueueData());
+        ASSERT_FALSE(sut.tryAddQueue(queueData.back().get()).has_error());
+    }
+
+    constexpr uint64_t NUMBER_OF_CHUNKS{3U};
+    SharedChunk chunks[NUMBER_OF_CHUNKS]{this->allocateChunk(1U), this->allocateChunk(2U), this->allocateChunk(3U)};
+    EXPECT_THAT(sut.deliverToAllStoredQueues(chunks, NUMBER_OF_CHUNKS), Eq(NUMBER_OF_QUEUES));
+    EXPECT_THAT(sut.getHistorySize(), Eq(NUMBER_OF_CHUNKS));
+
+    auto lateQueueData = this->getChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(lateQueueData.get(), NUMBER_OF_CHUNKS).has_error());
+    queueData.emplace_back(lateQueueData);
+
+    for (auto& data : queueData)
+    {
+        ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(data.get());
+        for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+        {
+            auto maybeSharedChunk = queue.tryPop();
+            ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+            EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(i + 1U));
+        }
+        EXPECT_THAT(queue.empty(), Eq(true));
+    }
+}
+
+TYPED_TEST(ChunkDistributor_test, DeliverBatchToAllStoredQueuesNotifiesEveryQueueOnlyOnce)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3515581f-e4bb-4a80-ab83-3d81fd409791");
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+    ConditionVariableData condVar("Horscht");
+    // the semaphore is only posted when a listener is blocked in wait
+    condVar.m_hasWaitingListener.store(true);
+
+    auto queueData = this->getChunkQueueData();
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t>(queueData.get()).setConditionVariable(condVar, 0U);
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+
+    constexpr uint64_t NUMBER_OF_CHUNKS{3U};
+    SharedChunk chunks[NUMBER_OF_CHUNKS]{this->allocateChunk(1U), this->allocateChunk(2U), this->allocateChunk(3U)};
+    EXPECT_THAT(sut.deliverToAllStoredQueues(chunks, NUMBER_OF_CHUNKS), Eq(1U));
+
+    uint64_t numberOfWakeUps{0U};
+    while (condVar.m_semaphore->tryWait().value())
+    {
+        ++numberOfWakeUps;
+    }
+    EXPECT_THAT(numberOfWakeUps, Eq(1U));
+    EXPECT_THAT(ChunkQueuePopper<typename TestFixture::ChunkQueueData_t>(queueData.get()).size(), Eq(NUMBER_OF_CHUNKS));
+}
+
+TYPED_TEST(ChunkDistributor_test, DeliverBatchToBlockingQueueContinuesWithTheFirstChunkWhichWasNotDelivered)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "886b3872-9944-4bd6-912f-99339c2adb4a");
+    auto sutData = this->getChunkDistributorData(ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER);
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData =
+        this->getChunkQueueData(QueueFullPolicy::BLOCK_PRODUCER, VariantQueueTypes::FiFo_MultiProducerSingleConsumer);
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    queue.setCapacity(1U);
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+
+    constexpr uint64_t NUMBER_OF_CHUNKS{4U};
+    std::thread publisher([&] {
+        SharedChunk chunks[NUMBER_OF_CHUNKS]{
+            this->allocateChunk(1U), this->allocateChunk(2U), this->allocateChunk(3U), this->allocateChunk(4U)};
+        EXPECT_THAT(sut.deliverToAllStoredQueues(chunks, NUMBER_OF_CHUNKS), Eq(1U));
+    });
+
+    for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        auto maybeSharedChunk = queue.tryPop();
+        while (!maybeSharedChunk.has_value())
+        {
+            std::this_thread::yield();
+            maybeSharedChunk = queue.tryPop();
+        }
+        EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(i + 1U));
+    }
+    publisher.join();
+
+    EXPECT_THAT(queue.empty(), Eq(true));
+    EXPECT_THAT(sut.getHistorySize(), Eq(NUMBER_OF_CHUNKS));
+}
+
+TYPED_TEST(ChunkDistributor_test, RemovingQueueReclaimsReaderSectionOfTerminatedProcess)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6c0f5a39-5d6e-4f0b-9d2a-3e7b91c4a8f2");
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData = this->getChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+
+    // a process which was terminated while delivering a chunk never leaves its reader section
+    const auto generation = sutData->m_queuesGeneration.load();
+    constexpr uint64_t NUMBER_OF_QUEUE_CONTAINERS{TestFixture::ChunkDistributorData_t::NUMBER_OF_QUEUE_CONTAINERS};
+    auto& readers = sutData->m_queueReaders[generation % NUMBER_OF_QUEUE_CONTAINERS];
+    readers.fetch_add(1U);
+
+    iox::deadline_timer timer(TestFixture::ChunkDistributor_t::QUEUE_READERS_TIMEOUT);
+    EXPECT_FALSE(sut.tryRemoveQueue(queueData.get()).has_error());
+    EXPECT_TRUE(timer.hasExpired());
+    EXPECT_THAT(readers.load(), Eq(0U));
+    EXPECT_THAT(sut.hasStoredQueues(), Eq(false));
+
+    // the reclaimed section does not delay further modifications
+    timer.reset();
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+    EXPECT_FALSE(sut.tryRemoveQueue(queueData.get()).has_error());
+    EXPECT_FALSE(timer.hasExpired());
+}
+
 } // namespace
@@ -28,6 +28,11 @@
 
 #include "test.hpp"
 
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
 namespace
 {
 using namespace ::testing;
@@ -264,6 +269,58 @@ TYPED_TEST(ChunkQueue_test, AttachSecondConditionVariable)
     EXPECT_THAT(condVarWaiter2.timedWait(1_ms).empty(), Eq(false));
 }
 
+TYPED_TEST(ChunkQueue_test, PushWithoutNotificationDoesNotNotifyConditionVariable)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f3ef4d10-1bca-4278-82f9-0ba6df871269");
+    ConditionVariableData condVar("Horscht");
+    ConditionListener condVarWaiter{condVar};
+
+    this->m_popper.setConditionVariable(condVar, 0U);
+
+    auto chunk = this->allocateChunk();
+    EXPECT_TRUE(this->m_pusher.pushWithoutNotification(chunk));
+
+    EXPECT_THAT(condVarWaiter.timedWait(1_ns).empty(), Eq(true));
+    EXPECT_THAT(this->m_popper.size(), Eq(1U));
+}
+
+TYPED_TEST(ChunkQueue_test, ActivatedNotificationIsReceivedAfterWakeUp)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "742ee2ff-e78d-49a6-bef4-8c915abaa9c3");
+    ConditionVariableData condVar("Horscht");
+    ConditionListener condVarWaiter{condVar};
+
+    this->m_popper.setConditionVariable(condVar, 0U);
+
+    auto chunk = this->allocateChunk();
+    this->m_pusher.pushWithoutNotification(chunk);
+    const auto* activatedConditionVariable = this->m_pusher.activateNotification();
+    EXPECT_THAT(activatedConditionVariable, Eq(&condVar));
+    EXPECT_TRUE(this->m_pusher.wakeUpConsumer(activatedConditionVariable));
+
+    EXPECT_THAT(condVarWaiter.timedWait(1_ns).empty(), Eq(false));
+    EXPECT_THAT(condVarWaiter.timedWait(1_ns).empty(), Eq(true));
+}
+
+TYPED_TEST(ChunkQueue_test, ActivateNotificationWithoutConditionVariableReturnsNullptr)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6d71528c-48ea-41db-9ae1-2f23b20f510f");
+    EXPECT_THAT(this->m_pusher.activateNotification(), Eq(nullptr));
+}
+
+TYPED_TEST(ChunkQueue_test, WakeUpConsumerFailsWhenQueueIsAttachedToOtherConditionVariable)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e7e0aa69-ba58-4915-bfcb-d7e4d4209bf9");
+    ConditionVariableData condVar1("Horscht");
+    ConditionVariableData condVar2("Schnuppi");
+
+    this->m_popper.setConditionVariable(condVar1, 0U);
+    const auto* activatedConditionVariable = this->m_pusher.activateNotification();
+    this->m_popper.setConditionVariable(condVar2, 1U);
+
+    EXPECT_FALSE(this->m_pusher.wakeUpConsumer(activatedConditionVariable));
+}
+
 /// @note this could be changed to a parameterized ChunkQueueSaturatingFIFO_test when there are more FIFOs available
 using ChunkQueueFiFoTestSubjects = Types<ThreadSafePolicy, SingleThreadedPolicy>;
 
@@ -328,6 +385,151 @@ TYPED_TEST(ChunkQueueFiFo_test, PushFull)
     EXPECT_THAT(this->mempool.getUsedChunks(), Eq(0U));
 }
 
+using ChunkQueueBlockingProducerSubjects = Types<ThreadSafePolicy, SingleThreadedPolicy>;
+
+TYPED_TEST_SUITE(ChunkQueueBlockingProducer_test, ChunkQueueBlockingProducerSubjects, );
+
+template <typename PolicyType>
+class ChunkQueueBlockingProducer_test : public Test, public ChunkQueue_testBase
+{
+  public:
+    void SetUp() override
+    {
+        m_popper.setCapacity(CAPACITY);
+    };
+    void TearDown() override
+    {
+        m_popper.clear();
+    };
+
+    static uint64_t millisecondsSince(const std::chrono::steady_clock::time_point begin)
+    {
+        return static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - begin).count());
+    }
+
+    void fillQueue()
+    {
+        for (auto i = 0U; i < CAPACITY; ++i)
+        {
+            ASSERT_TRUE(m_pusher.push(allocateChunk()));
+        }
+    }
+
+    using ChunkQueueData_t = ChunkQueueData<iox::DefaultChunkQueueConfig, PolicyType>;
+
+    static constexpr uint64_t CAPACITY{4U};
+    static constexpr iox::units::Duration TIMEOUT{10_ms};
+    static constexpr iox::units::Duration LONG_TIMEOUT{10_s};
+
+    ChunkQueueData_t m_chunkData{QueueFullPolicy::BLOCK_PRODUCER,
+                                 iox::cxx::VariantQueueTypes::FiFo_MultiProducerSingleConsumer};
+    ChunkQueuePopper<ChunkQueueData_t> m_popper{&m_chunkData};
+    ChunkQueuePusher<ChunkQueueData_t> m_pusher{&m_chunkData};
+};
+template <typename PolicyType>
+constexpr uint64_t ChunkQueueBlockingProducer_test<PolicyType>::CAPACITY;
+template <typename PolicyType>
+constexpr iox::units::Duration ChunkQueueBlockingProducer_test<PolicyType>::TIMEOUT;
+template <typename PolicyType>
+constexpr iox::units::Duration ChunkQueueBlockingProducer_test<PolicyType>::LONG_TIMEOUT;
+
+TYPED_TEST(ChunkQueueBlockingProducer_test, WaitForSpaceReturnsImmediatelyWhenQueueIsNotFull)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "505ebf8a-2be8-47d5-870b-f03c05fed08c");
+    ASSERT_TRUE(this->m_pusher.push(this->allocateChunk()));
+
+    auto begin = std::chrono::steady_clock::now();
+    this->m_pusher.waitForSpace(this->LONG_TIMEOUT);
+    auto elapsed = this->millisecondsSince(begin);
+
+    EXPECT_THAT(elapsed, Lt(this->LONG_TIMEOUT.toMilliseconds()));
+}
+
+TYPED_TEST(ChunkQueueBlockingProducer_test, WaitForSpaceOnFullQueueReturnsAfterTimeout)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "92c722de-87f0-4b70-9155-4b0ce8cfaad3");
+    this->fillQueue();
+
+    auto begin = std::chrono::steady_clock::now();
+    this->m_pusher.waitForSpace(this->TIMEOUT);
+    auto elapsed = this->millisecondsSince(begin);
+
+    EXPECT_THAT(elapsed, Ge(this->TIMEOUT.toMilliseconds()));
+}
+
+TYPED_TEST(ChunkQueueBlockingProducer_test, PopToLowWatermarkWakesUpWaitingProducer)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1699f836-408b-4608-aba5-b656c224a8e8");
+    this->fillQueue();
+
+    std::atomic_bool isProducerWokenUp{false};
+    auto begin = std::chrono::steady_clock::now();
+    std::thread producer([&] {
+        this->m_pusher.waitForSpace(this->LONG_TIMEOUT);
+        isProducerWokenUp = true;
+    });
+
+    // a single free slot does not wake up the producer
+    std::this_thread::sleep_for(std::chrono::milliseconds(10U * this->TIMEOUT.toMilliseconds()));
+    EXPECT_TRUE(this->m_popper.tryPop().has_value());
+    std::this_thread::sleep_for(std::chrono::milliseconds(this->TIMEOUT.toMilliseconds()));
+    EXPECT_FALSE(isProducerWokenUp.load());
+
+    EXPECT_TRUE(this->m_popper.tryPop().has_value());
+    producer.join();
+    auto elapsed = this->millisecondsSince(begin);
+
+    EXPECT_TRUE(isProducerWokenUp.load());
+    EXPECT_THAT(elapsed, Lt(this->LONG_TIMEOUT.toMilliseconds()));
+}
+
+TYPED_TEST(ChunkQueueBlockingProducer_test, PopOfOneChunkToLowWatermarkWakesUpWaitingProducerBeforeTimeout)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0b8e3f5c-6a2d-4c17-9e41-7d5f2a9c3b60");
+    constexpr uint64_t SMALL_CAPACITY{2U};
+    this->m_popper.setCapacity(SMALL_CAPACITY);
+    for (auto i = 0U; i < SMALL_CAPACITY; ++i)
+    {
+        ASSERT_TRUE(this->m_pusher.push(this->allocateChunk()));
+    }
+
+    auto begin = std::chrono::steady_clock::now();
+    std::thread producer([&] { this->m_pusher.waitForSpace(this->LONG_TIMEOUT); });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(this->TIMEOUT.toMilliseconds()));
+    EXPECT_TRUE(this->m_popper.tryPop().has_value());
+    producer.join();
+    auto elapsed = this->millisecondsSince(begin);
+
+    EXPECT_THAT(elapsed, Lt(this->LONG_TIMEOUT.toMilliseconds()));
+}
+
+TYPED_TEST(ChunkQueueBlockingProducer_test, PopsBelowLowWatermarkWakeUpWaitingProducerOnlyOnce)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e4a1c9d7-2b5f-4e83-a6c0-91d3f8b2e5a4");
+    this->fillQueue();
+
+    std::thread producer([&] { this->m_pusher.waitForSpace(this->LONG_TIMEOUT); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(this->TIMEOUT.toMilliseconds()));
+    for (auto i = 0U; i < this->CAPACITY - 1U; ++i)
+    {
+        EXPECT_TRUE(this->m_popper.tryPop().has_value());
+    }
+    producer.join();
+
+    // a left over post would wake up the next waiting producer although the queue is full
+    for (auto i = 1U; i < this->CAPACITY; ++i)
+    {
+        ASSERT_TRUE(this->m_pusher.push(this->allocateChunk()));
+    }
+    auto begin = std::chrono::steady_clock::now();
+    this->m_pusher.waitForSpace(this->TIMEOUT);
+    auto elapsed = this->millisecondsSince(begin);
+
+    EXPECT_THAT(elapsed, Ge(this->TIMEOUT.toMilliseconds()));
+}
+
 /// @note this could be changed to a parameterized ChunkQueueOverflowingFIFO_test when there are more FIFOs available
 using ChunkQueueSoFiSubjects = Types<ThreadSafePolicy, SingleThreadedPolicy>;
 
@@ -416,4 +618,40 @@ TYPED_TEST(ChunkQueueSoFi_test, LostChunkInfoIsResetAfterRead)
     EXPECT_FALSE(this->m_popper.hasLostChunks());
 }
 
+TYPED_TEST(ChunkQueueSoFi_test, LostChunkIsReportedOnlyOnceToConcurrentConsumers)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c623d8d9-e2e5-472a-a0b1-2d645c622b25");
+    constexpr uint64_t NUMBER_OF_ROUNDS{100U};
+    constexpr uint64_t NUMBER_OF_CONSUMERS{4U};
+
+    for (uint64_t round = 0U; round < NUMBER_OF_ROUNDS; ++round)
+    {
+        this->m_pusher.lostAChunk();
+
+        std::atomic_bool isStarted{false};
+        std::atomic<uint64_t> numberOfReportedLosses{0U};
+        std::vector<std::thread> consumers;
+        for (uint64_t i = 0U; i < NUMBER_OF_CONSUMERS; ++i)
+        {
+            consumers.emplace_back([&] {
+                while (!isStarted.load())
+                {
+                    std::this_thread::yield();
+                }
+                if (this->m_popper.hasLostChunks())
+                {
+                    ++numberOfReportedLosses;
+                }
+            });
+        }
+        isStarted = true;
+        for (auto& consumer : consumers)
+        {
+            consumer.join();
+        }
+
+        EXPECT_THAT(numberOfReportedLosses.load(), Eq(1U));
+    }
+}
+
 } // namespace
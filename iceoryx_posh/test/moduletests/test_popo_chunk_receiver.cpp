@@ -184,6 +184,55 @@ TEST_F(ChunkReceiver_test, getTooMuchWithoutRelease)
     EXPECT_THAT(maybeChunkHeader.get_error(), Eq(iox::popo::ChunkReceiveResult::TOO_MANY_CHUNKS_HELD_IN_PARALLEL));
 }
 
+TEST_F(ChunkReceiver_test, ReceivedChunksAreCounted)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "19d2ed3c-0465-462e-adcc-2974ad94e2fe");
+    constexpr uint64_t NUMBER_OF_CHUNKS{3U};
+    for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        m_chunkQueuePusher.push(getChunkFromMemoryManager());
+        auto maybeChunkHeader = m_chunkReceiver.tryGet();
+        ASSERT_FALSE(maybeChunkHeader.has_error());
+        m_chunkReceiver.release(*maybeChunkHeader);
+    }
+
+    EXPECT_TRUE(m_chunkReceiver.tryGet().has_error());
+    EXPECT_THAT(m_chunkReceiverData.m_receivedChunks.load(), Eq(NUMBER_OF_CHUNKS));
+}
+
+TEST_F(ChunkReceiver_test, LatencyHistogramIsOnlyPresentWhenRequested)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3aa95c5b-60e2-4aaf-ad35-a9b1e746f3b1");
+    iox::popo::LatencyHistogram latencyHistogram;
+    ChunkReceiverData_t chunkReceiverDataWithHistogram{iox::cxx::VariantQueueTypes::SoFi_SingleProducerSingleConsumer,
+                                                       iox::popo::QueueFullPolicy::DISCARD_OLDEST_DATA,
+                                                       iox::mepoo::MemoryInfo(),
+                                                       &latencyHistogram};
+
+    EXPECT_FALSE(m_chunkReceiverData.m_latencyHistogram);
+    EXPECT_THAT(chunkReceiverDataWithHistogram.m_latencyHistogram.get(), Eq(&latencyHistogram));
+}
+
+TEST_F(ChunkReceiver_test, ChunksWithoutSendTimestampAreNotRecordedInTheLatencyHistogram)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "602c4cdd-8a4f-4106-87e4-13f8780c0329");
+    iox::popo::LatencyHistogram latencyHistogram;
+    ChunkReceiverData_t chunkReceiverDataWithHistogram{iox::cxx::VariantQueueTypes::SoFi_SingleProducerSingleConsumer,
+                                                       iox::popo::QueueFullPolicy::DISCARD_OLDEST_DATA,
+                                                       iox::mepoo::MemoryInfo(),
+                                                       &latencyHistogram};
+    iox::popo::ChunkReceiver<ChunkReceiverData_t> chunkReceiver{&chunkReceiverDataWithHistogram};
+    iox::popo::ChunkQueuePusher<ChunkReceiverData_t> chunkQueuePusher{&chunkReceiverDataWithHistogram};
+
+    chunkQueuePusher.push(getChunkFromMemoryManager());
+    auto maybeChunkHeader = chunkReceiver.tryGet();
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+    EXPECT_THAT((*maybeChunkHeader)->sendTimestamp(), Eq(0U));
+    chunkReceiver.release(*maybeChunkHeader);
+
+    EXPECT_THAT(latencyHistogram.count(), Eq(0U));
+}
+
 TEST_F(ChunkReceiver_test, releaseInvalidChunk)
 {
     ::testing::Test::RecordProperty("TEST_ID", "2a47fd0e-a217-4565-98af-05779c938340");
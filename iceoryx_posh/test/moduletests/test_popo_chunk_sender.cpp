@@ -35,6 +35,7 @@
 #include "test.hpp"
 
 #include <memory>
+#include <thread>
 
 namespace
 {
@@ -110,9 +111,25 @@ class ChunkSender_test : public Test
         &m_memoryManager, iox::popo::ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA, 0}; // must be 0 for test
     ChunkSenderData_t m_chunkSenderDataWithHistory{
         &m_memoryManager, iox::popo::ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA, HISTORY_CAPACITY};
+    static constexpr uint32_t RECYCLED_CHUNK_CAPACITY = 2;
+    ChunkSenderData_t m_chunkSenderDataWithRecycling{&m_memoryManager,
+                                                     iox::popo::ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA,
+                                                     0,
+                                                     iox::mepoo::MemoryInfo(),
+                                                     false,
+                                                     RECYCLED_CHUNK_CAPACITY};
 
     iox::popo::ChunkSender<ChunkSenderData_t> m_chunkSender{&m_chunkSenderData};
     iox::popo::ChunkSender<ChunkSenderData_t> m_chunkSenderWithHistory{&m_chunkSenderDataWithHistory};
+    iox::popo::ChunkSender<ChunkSenderData_t> m_chunkSenderWithRecycling{&m_chunkSenderDataWithRecycling};
+
+    void allocateAndSend(iox::popo::ChunkSender<ChunkSenderData_t>& sender, const uint32_t userPayloadSize)
+    {
+        auto maybeChunkHeader = sender.tryAllocate(
+            UniquePortId(), userPayloadSize, USER_PAYLOAD_ALIGNMENT, USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+        ASSERT_FALSE(maybeChunkHeader.has_error());
+        sender.send(*maybeChunkHeader);
+    }
 };
 
 TEST_F(ChunkSender_test, allocate_OneChunkWithoutUserHeaderAndSmallUserPayloadAlignmentResultsInSmallChunk)
@@ -447,6 +464,129 @@ TEST_F(ChunkSender_test, sendInvalidChunk)
     EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(1U));
 }
 
+TEST_F(ChunkSender_test, sendBatchWithReceiverDeliversChunksInOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2582b285-e625-412a-b984-04ee95f40e84");
+    constexpr uint64_t BATCH_SIZE{4U};
+    ASSERT_FALSE(m_chunkSender.tryAddQueue(&m_chunkQueueData).has_error());
+
+    iox::mepoo::ChunkHeader* chunkHeaders[BATCH_SIZE];
+    for (uint64_t i = 0U; i < BATCH_SIZE; ++i)
+    {
+        auto maybeChunkHeader = m_chunkSender.tryAllocate(
+            UniquePortId(), sizeof(DummySample), alignof(DummySample), USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+        ASSERT_FALSE(maybeChunkHeader.has_error());
+        new ((*maybeChunkHeader)->userPayload()) DummySample{i};
+        chunkHeaders[i] = *maybeChunkHeader;
+    }
+
+    EXPECT_THAT(m_chunkSender.sendBatch(chunkHeaders, BATCH_SIZE), Eq(1U));
+
+    iox::popo::ChunkQueuePopper<ChunkQueueData_t> myQueue(&m_chunkQueueData);
+    for (uint64_t i = 0U; i < BATCH_SIZE; ++i)
+    {
+        auto popRet = myQueue.tryPop();
+        ASSERT_TRUE(popRet.has_value());
+        EXPECT_THAT(static_cast<DummySample*>(popRet->getUserPayload())->dummy, Eq(i));
+        EXPECT_THAT(popRet->getChunkHeader()->sequenceNumber(), Eq(i));
+    }
+    EXPECT_TRUE(myQueue.empty());
+
+    auto maybePreviousChunk = m_chunkSender.tryGetPreviousChunk();
+    ASSERT_TRUE(maybePreviousChunk.has_value());
+    EXPECT_THAT(*maybePreviousChunk, Eq(chunkHeaders[BATCH_SIZE - 1U]));
+}
+
+TEST_F(ChunkSender_test, sendBatchAddsAllChunksToHistoryInOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "859eb56b-5e9e-49d3-b6b0-b017a4790cfe");
+    constexpr uint64_t BATCH_SIZE{HISTORY_CAPACITY - 1U};
+
+    iox::mepoo::ChunkHeader* chunkHeaders[BATCH_SIZE];
+    for (uint64_t i = 0U; i < BATCH_SIZE; ++i)
+    {
+        auto maybeChunkHeader = m_chunkSenderWithHistory.tryAllocate(
+            UniquePortId(), sizeof(DummySample), alignof(DummySample), USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+        ASSERT_FALSE(maybeChunkHeader.has_error());
+        new ((*maybeChunkHeader)->userPayload()) DummySample{i};
+        chunkHeaders[i] = *maybeChunkHeader;
+    }
+
+    EXPECT_THAT(m_chunkSenderWithHistory.sendBatch(chunkHeaders, BATCH_SIZE), Eq(0U));
+    EXPECT_THAT(m_chunkSenderWithHistory.getHistorySize(), Eq(BATCH_SIZE));
+
+    ASSERT_FALSE(m_chunkSenderWithHistory.tryAddQueue(&m_chunkQueueData, HISTORY_CAPACITY).has_error());
+    iox::popo::ChunkQueuePopper<ChunkQueueData_t> myQueue(&m_chunkQueueData);
+    for (uint64_t i = 0U; i < BATCH_SIZE; ++i)
+    {
+        auto popRet = myQueue.tryPop();
+        ASSERT_TRUE(popRet.has_value());
+        EXPECT_THAT(static_cast<DummySample*>(popRet->getUserPayload())->dummy, Eq(i));
+    }
+    EXPECT_TRUE(myQueue.empty());
+}
+
+TEST_F(ChunkSender_test, sendBatchWithInvalidChunkTriggersTheErrorHandlerAndSendsTheValidChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "79e396f0-826e-4997-984d-fdd2334e930f");
+    ASSERT_FALSE(m_chunkSender.tryAddQueue(&m_chunkQueueData).has_error());
+    auto maybeChunkHeader = m_chunkSender.tryAllocate(
+        UniquePortId(), sizeof(DummySample), alignof(DummySample), USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+
+    auto errorHandlerCalled{false};
+    auto errorHandlerGuard = iox::ErrorHandlerMock::setTemporaryErrorHandler<iox::PoshError>(
+        [&errorHandlerCalled](const iox::PoshError, const iox::ErrorLevel) { errorHandlerCalled = true; });
+
+    ChunkMock<bool> myCrazyChunk;
+    iox::mepoo::ChunkHeader* chunkHeaders[]{myCrazyChunk.chunkHeader(), *maybeChunkHeader};
+    EXPECT_THAT(m_chunkSender.sendBatch(chunkHeaders, 2U), Eq(1U));
+
+    EXPECT_TRUE(errorHandlerCalled);
+    iox::popo::ChunkQueuePopper<ChunkQueueData_t> myQueue(&m_chunkQueueData);
+    EXPECT_THAT(myQueue.size(), Eq(1U));
+}
+
+TEST_F(ChunkSender_test, sendBatchCountsOnlyTheReceiversWhichGotAllChunksWhenReceiversChange)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b7d2e0a4-1c3f-4f6e-8a95-2d4c6e8f0a13");
+    constexpr uint64_t BATCH_SIZE{3U};
+    ChunkSenderData_t senderData{&m_memoryManager, iox::popo::ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER, 0};
+    iox::popo::ChunkSender<ChunkSenderData_t> sut{&senderData};
+
+    // the blocking receiver takes only the first chunk and unsubscribes while the batch waits for it
+    ChunkQueueData_t blockingQueueData{iox::popo::QueueFullPolicy::BLOCK_PRODUCER,
+                                       iox::cxx::VariantQueueTypes::FiFo_MultiProducerSingleConsumer};
+    iox::popo::ChunkQueuePopper<ChunkQueueData_t> blockingQueue(&blockingQueueData);
+    blockingQueue.setCapacity(1U);
+    ASSERT_FALSE(sut.tryAddQueue(&blockingQueueData).has_error());
+    ASSERT_FALSE(sut.tryAddQueue(&m_chunkQueueData).has_error());
+
+    iox::mepoo::ChunkHeader* chunkHeaders[BATCH_SIZE];
+    for (uint64_t i = 0U; i < BATCH_SIZE; ++i)
+    {
+        auto maybeChunkHeader = sut.tryAllocate(
+            UniquePortId(), sizeof(DummySample), alignof(DummySample), USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+        ASSERT_FALSE(maybeChunkHeader.has_error());
+        chunkHeaders[i] = *maybeChunkHeader;
+    }
+
+    uint64_t numberOfReceivers{BATCH_SIZE};
+    std::thread sender([&] { numberOfReceivers = sut.sendBatch(chunkHeaders, BATCH_SIZE); });
+    while (blockingQueue.empty())
+    {
+        std::this_thread::yield();
+    }
+    EXPECT_FALSE(sut.tryRemoveQueue(&blockingQueueData).has_error());
+    sender.join();
+
+    EXPECT_THAT(numberOfReceivers, Eq(1U));
+    iox::popo::ChunkQueuePopper<ChunkQueueData_t> myQueue(&m_chunkQueueData);
+    EXPECT_THAT(myQueue.size(), Eq(BATCH_SIZE));
+    EXPECT_THAT(blockingQueue.size(), Eq(1U));
+    blockingQueue.clear();
+}
+
 TEST_F(ChunkSender_test, sendToQueueWithoutReceiverReturnsFalse)
 {
     ::testing::Test::RecordProperty("TEST_ID", "7139bfdc-3df9-4def-a292-407f8e650b34");
@@ -696,6 +836,137 @@ TEST_F(ChunkSender_test, ReuseOfLastIfBiggerButFitsInChunk)
     EXPECT_TRUE((*chunkBigger)->userPayload() == (*maybeLastChunk)->userPayload());
 }
 
+TEST_F(ChunkSender_test, RecycledChunksAreReusedWhenAlternatingBetweenPayloadSizes)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "25bd6d0b-15b6-4f6e-b8e3-00348593cc70");
+    constexpr uint64_t NUMBER_OF_ROUNDS{10U};
+    for (uint64_t i = 0U; i < NUMBER_OF_ROUNDS; ++i)
+    {
+        allocateAndSend(m_chunkSenderWithRecycling, SMALL_CHUNK);
+        allocateAndSend(m_chunkSenderWithRecycling, BIG_CHUNK);
+    }
+
+    // the big chunk is the last chunk and the small chunk was recycled
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(1U));
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(1).m_usedChunks, Eq(1U));
+    EXPECT_THAT(m_chunkSenderDataWithRecycling.m_recycledChunkMisses.load(), Eq(2U));
+    EXPECT_THAT(m_chunkSenderDataWithRecycling.m_recycledChunkHits.load(), Eq(2U * NUMBER_OF_ROUNDS - 2U));
+}
+
+TEST_F(ChunkSender_test, WithoutRecycledChunksOnlyTheLastChunkIsReused)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "04ae4d8d-9d40-470a-8a55-8a84565b062d");
+    allocateAndSend(m_chunkSender, SMALL_CHUNK);
+    allocateAndSend(m_chunkSender, BIG_CHUNK);
+
+    // the small chunk is released when the big chunk becomes the last chunk
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(1).m_usedChunks, Eq(1U));
+}
+
+TEST_F(ChunkSender_test, WithoutRecycledChunksNoHitsAndMissesAreCounted)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5f9c2a7e-3d81-4b6a-9e0c-7a4d2b8f1c65");
+    // the last chunk is reused for the second small chunk, the other allocations require a new chunk
+    allocateAndSend(m_chunkSender, SMALL_CHUNK);
+    allocateAndSend(m_chunkSender, SMALL_CHUNK);
+    allocateAndSend(m_chunkSender, BIG_CHUNK);
+
+    EXPECT_THAT(m_chunkSenderData.m_recycledChunkMisses.load(), Eq(0U));
+    EXPECT_THAT(m_chunkSenderData.m_recycledChunkHits.load(), Eq(0U));
+}
+
+TEST_F(ChunkSender_test, RecycledChunkIsNotReusedWhileASubscriberHoldsIt)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4f07e16e-6ddf-414a-84cf-eaba7ad189de");
+    ASSERT_FALSE(m_chunkSenderWithRecycling.tryAddQueue(&m_chunkQueueData).has_error());
+
+    allocateAndSend(m_chunkSenderWithRecycling, SMALL_CHUNK);
+    allocateAndSend(m_chunkSenderWithRecycling, SMALL_CHUNK);
+    allocateAndSend(m_chunkSenderWithRecycling, SMALL_CHUNK);
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(3U));
+    EXPECT_THAT(m_chunkSenderDataWithRecycling.m_recycledChunkHits.load(), Eq(0U));
+
+    {
+        iox::popo::ChunkQueuePopper<ChunkQueueData_t> myQueue(&m_chunkQueueData);
+        while (myQueue.tryPop().has_value())
+        {
+        }
+    }
+
+    allocateAndSend(m_chunkSenderWithRecycling, SMALL_CHUNK);
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(3U));
+    EXPECT_THAT(m_chunkSenderDataWithRecycling.m_recycledChunkHits.load(), Eq(1U));
+}
+
+TEST_F(ChunkSender_test, RecycledChunkCapacityIsLimitedToTheMaximum)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5b02376d-7358-43a8-9b08-bc8bc782bf72");
+    ChunkSenderData_t sut{&m_memoryManager,
+                          iox::popo::ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA,
+                          0,
+                          iox::mepoo::MemoryInfo(),
+                          false,
+                          ChunkSenderData_t::MAX_RECYCLED_CHUNKS + 1U};
+
+    EXPECT_THAT(sut.m_recycledChunkCapacity, Eq(ChunkSenderData_t::MAX_RECYCLED_CHUNKS));
+}
+
+TEST_F(ChunkSender_test, SendUpdatesTheStatisticsOfTheSentChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "30b062de-d150-4f35-9429-125795dd5d1e");
+    constexpr uint32_t FIRST_USER_PAYLOAD_SIZE{16U};
+    constexpr uint32_t SECOND_USER_PAYLOAD_SIZE{64U};
+    constexpr std::chrono::milliseconds SEND_INTERVAL{5};
+
+    allocateAndSend(m_chunkSender, FIRST_USER_PAYLOAD_SIZE);
+    EXPECT_THAT(m_chunkSenderData.m_lastSendIntervalInNanoseconds.load(), Eq(0U));
+    std::this_thread::sleep_for(SEND_INTERVAL);
+    allocateAndSend(m_chunkSender, SECOND_USER_PAYLOAD_SIZE);
+
+    EXPECT_THAT(m_chunkSenderData.m_sentChunks.load(), Eq(2U));
+    EXPECT_THAT(m_chunkSenderData.m_sentUserPayloadBytes.load(),
+                Eq(FIRST_USER_PAYLOAD_SIZE + SECOND_USER_PAYLOAD_SIZE));
+    EXPECT_THAT(m_chunkSenderData.m_lastUserPayloadSize.load(), Eq(SECOND_USER_PAYLOAD_SIZE));
+    EXPECT_THAT(m_chunkSenderData.m_lastChunkSize.load(), Ge(SECOND_USER_PAYLOAD_SIZE));
+    EXPECT_THAT(m_chunkSenderData.m_lastSendIntervalInNanoseconds.load(),
+                Ge(static_cast<uint64_t>(std::chrono::nanoseconds(SEND_INTERVAL).count())));
+    EXPECT_THAT(m_chunkSenderData.m_lastSendTimestamp.load() - m_chunkSenderData.m_firstSendTimestamp.load(),
+                Eq(m_chunkSenderData.m_lastSendIntervalInNanoseconds.load()));
+}
+
+TEST_F(ChunkSender_test, SendStampsTheSendTimestampIntoTheChunkHeader)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2e9b1e17-6ec6-462a-97e2-bd8c34ca0545");
+    ASSERT_FALSE(m_chunkSender.tryAddQueue(&m_chunkQueueData).has_error());
+
+    allocateAndSend(m_chunkSender, sizeof(DummySample));
+
+    iox::popo::ChunkQueuePopper<ChunkQueueData_t> myQueue(&m_chunkQueueData);
+    auto popRet = myQueue.tryPop();
+    ASSERT_TRUE(popRet.has_value());
+    EXPECT_THAT(popRet->getChunkHeader()->sendTimestamp(), Ne(0U));
+    EXPECT_THAT(popRet->getChunkHeader()->sendTimestamp(), Eq(m_chunkSenderData.m_lastSendTimestamp.load()));
+}
+
+TEST_F(ChunkSender_test, ChunksWhichAreDroppedByAFullQueueAreCountedAsLost)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "20f11915-7f53-417e-abd3-455c137bb85b");
+    constexpr uint64_t QUEUE_CAPACITY{1U};
+    constexpr uint64_t NUMBER_OF_CHUNKS{3U};
+    ASSERT_FALSE(m_chunkSender.tryAddQueue(&m_chunkQueueData).has_error());
+    iox::popo::ChunkQueuePopper<ChunkQueueData_t> queue(&m_chunkQueueData);
+    queue.setCapacity(QUEUE_CAPACITY);
+
+    for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        allocateAndSend(m_chunkSender, sizeof(DummySample));
+    }
+
+    EXPECT_THAT(m_chunkSenderData.m_lostChunks.load(), Eq(NUMBER_OF_CHUNKS - QUEUE_CAPACITY));
+    EXPECT_THAT(m_chunkQueueData.m_lostChunks.load(), Eq(NUMBER_OF_CHUNKS - QUEUE_CAPACITY));
+}
+
 TEST_F(ChunkSender_test, Cleanup)
 {
     ::testing::Test::RecordProperty("TEST_ID", "5e5ab921-24bf-45a9-9572-68e444120baa");
@@ -725,6 +996,23 @@ TEST_F(ChunkSender_test, Cleanup)
     EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
 }
 
+TEST_F(ChunkSender_test, CleanupReleasesRecycledChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ca4feda2-92e1-4fb5-91f1-daf3224daea6");
+    ASSERT_FALSE(m_chunkSenderWithRecycling.tryAddQueue(&m_chunkQueueData).has_error());
+
+    for (uint32_t i = 0U; i < RECYCLED_CHUNK_CAPACITY + 1U; ++i)
+    {
+        allocateAndSend(m_chunkSenderWithRecycling, SMALL_CHUNK);
+    }
+    iox::popo::ChunkQueuePopper<ChunkQueueData_t>(&m_chunkQueueData).clear();
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(RECYCLED_CHUNK_CAPACITY + 1U));
+
+    m_chunkSenderWithRecycling.releaseAll();
+
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
+}
+
 TEST_F(ChunkSender_test, asStringLiteralConvertsAllocationErrorValuesToStrings)
 {
     ::testing::Test::RecordProperty("TEST_ID", "fdb713e1-0e2c-411e-a3ee-02c216d510d0");
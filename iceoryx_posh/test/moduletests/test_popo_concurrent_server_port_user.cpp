@@ -0,0 +1,126 @@
+// Copyright (c) 2026 by agent <agent@local>. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/popo/ports/concurrent_server_port_user.hpp"
+#include "test_popo_server_port_common.hpp"
+
+#include <atomic>
+#include <functional>
+#include <thread>
+#include <vector>
+
+namespace iox_test_popo_server_port
+{
+class ConcurrentServerPortUser_test : public ServerPort_test
+{
+  public:
+    void pushRequestsInBackground(const uint64_t numberOfRequests)
+    {
+        m_producer = std::thread([this, numberOfRequests] {
+            for (uint64_t i = 0U; i < numberOfRequests; ++i)
+            {
+                auto sharedChunk = getChunkWithInitializedRequestHeaderAndData(i);
+                // the request queue has the BLOCK_PRODUCER policy and rejects the request when it is full
+                while (!serverPort.requestQueuePusher.push(sharedChunk))
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    /// @brief starts MAX_REQUESTS_PROCESSED_SIMULTANEOUSLY consumers which call the function for every request they
+    /// get until all requests are taken
+    void processRequestsConcurrently(const uint64_t numberOfRequests,
+                                     const std::function<void(const RequestHeader* const)>& processRequest)
+    {
+        std::atomic<uint64_t> numberOfTakenRequests{0U};
+        std::vector<std::thread> consumers;
+        for (uint64_t i = 0U; i < iox::MAX_REQUESTS_PROCESSED_SIMULTANEOUSLY; ++i)
+        {
+            consumers.emplace_back([&] {
+                while (numberOfTakenRequests.load() < numberOfRequests)
+                {
+                    auto requestResult = sut.getRequest();
+                    if (requestResult.has_error())
+                    {
+                        EXPECT_THAT(requestResult.get_error(), Eq(ServerRequestResult::NO_PENDING_REQUESTS));
+                        std::this_thread::yield();
+                        continue;
+                    }
+                    ++numberOfTakenRequests;
+                    processRequest(requestResult.value());
+                    sut.releaseRequest(requestResult.value());
+                }
+            });
+        }
+
+        for (auto& consumer : consumers)
+        {
+            consumer.join();
+        }
+        m_producer.join();
+    }
+
+    static constexpr uint64_t NUMBER_OF_REQUESTS{1000U};
+
+    decltype(serverOptionsWithBlockProducerRequestQueueFullPolicy)& serverPort{
+        serverOptionsWithBlockProducerRequestQueueFullPolicy};
+    ConcurrentServerPortUser sut{serverPort.portData};
+
+  private:
+    std::thread m_producer;
+};
+constexpr uint64_t ConcurrentServerPortUser_test::NUMBER_OF_REQUESTS;
+
+TEST_F(ConcurrentServerPortUser_test, EveryRequestIsTakenExactlyOnceByConcurrentConsumers)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "49106aeb-52dd-48b9-9426-fc8f626c388a");
+    std::vector<std::atomic<uint64_t>> numberOfTakes(NUMBER_OF_REQUESTS);
+
+    pushRequestsInBackground(NUMBER_OF_REQUESTS);
+    processRequestsConcurrently(NUMBER_OF_REQUESTS, [&](const RequestHeader* const requestHeader) {
+        const auto requestData = getRequestData(requestHeader);
+        ASSERT_THAT(requestData, Lt(NUMBER_OF_REQUESTS));
+        ++numberOfTakes[requestData];
+    });
+
+    for (uint64_t i = 0U; i < NUMBER_OF_REQUESTS; ++i)
+    {
+        EXPECT_THAT(numberOfTakes[i].load(), Eq(1U)) << "request " << i;
+    }
+    EXPECT_THAT(getNumberOfUsedChunks(), Eq(0U));
+}
+
+TEST_F(ConcurrentServerPortUser_test, ConcurrentConsumersCanAllocateAndSendResponses)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ac222878-7d9f-4d25-ba66-0da5fbe8d4c1");
+    addClientQueue(serverPort);
+
+    pushRequestsInBackground(NUMBER_OF_REQUESTS);
+    processRequestsConcurrently(NUMBER_OF_REQUESTS, [&](const RequestHeader* const requestHeader) {
+        sut.allocateResponse(requestHeader, USER_PAYLOAD_SIZE, USER_PAYLOAD_ALIGNMENT)
+            .and_then([&](auto& responseHeader) { EXPECT_FALSE(sut.sendResponse(responseHeader).has_error()); })
+            .or_else([&](const auto& error) { GTEST_FAIL() << "Expected ResponseHeader but got error: " << error; });
+    });
+
+    EXPECT_FALSE(clientResponseQueue.empty());
+    clientResponseQueue.clear();
+    // the chunk sender keeps the last sent response for reuse
+    EXPECT_THAT(getNumberOfUsedChunks(), Eq(1U));
+}
+
+} // namespace iox_test_popo_server_port
@@ -135,9 +135,9 @@ TEST_F(ConditionVariable_test, AllNotificationsAreFalseAfterConstruction)
 {
     ::testing::Test::RecordProperty("TEST_ID", "4e5f6dbc-84cc-468a-9d64-f5ed88012ebc");
     ConditionVariableData sut;
-    for (auto& notification : sut.m_activeNotifications)
+    for (uint64_t i = 0U; i < iox::MAX_NUMBER_OF_NOTIFIERS; ++i)
     {
-        EXPECT_THAT(notification, Eq(false));
+        EXPECT_THAT(sut.isNotificationActive(i), Eq(false));
     }
 }
 
@@ -150,9 +150,9 @@ TEST_F(ConditionVariable_test, CorrectRuntimeNameAfterConstructionWithRuntimeNam
 TEST_F(ConditionVariable_test, AllNotificationsAreFalseAfterConstructionWithRuntimeName)
 {
     ::testing::Test::RecordProperty("TEST_ID", "4825e152-08e3-414e-a34f-d93d048f84b8");
-    for (auto& notification : m_condVarData.m_activeNotifications)
+    for (uint64_t i = 0U; i < iox::MAX_NUMBER_OF_NOTIFIERS; ++i)
     {
-        EXPECT_THAT(notification, Eq(false));
+        EXPECT_THAT(m_condVarData.isNotificationActive(i), Eq(false));
     }
 }
 
@@ -166,11 +166,11 @@ TEST_F(ConditionVariable_test, NotifyActivatesCorrectIndex)
     {
         if (i == EVENT_INDEX)
         {
-            EXPECT_THAT(m_condVarData.m_activeNotifications[i], Eq(true));
+            EXPECT_THAT(m_condVarData.isNotificationActive(i), Eq(true));
         }
         else
         {
-            EXPECT_THAT(m_condVarData.m_activeNotifications[i], Eq(false));
+            EXPECT_THAT(m_condVarData.isNotificationActive(i), Eq(false));
         }
     }
 }
@@ -233,6 +233,56 @@ TEST_F(ConditionVariable_test, TimedWaitReturnsAllNotifiedIndices)
     }
 }
 
+TEST_F(ConditionVariable_test, TimedWaitReturnsNotifiedIndicesOfDifferentNotificationWordsSorted)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4cdc51fc-5fa2-4bb5-b98c-e9a5eaae3006");
+    constexpr uint64_t LAST_INDEX{iox::MAX_NUMBER_OF_NOTIFIERS - 1U};
+    ConditionListener sut(m_condVarData);
+    ConditionNotifier(m_condVarData, LAST_INDEX).notify();
+    ConditionNotifier(m_condVarData, 64U).notify();
+    ConditionNotifier(m_condVarData, 63U).notify();
+    ConditionNotifier(m_condVarData, 0U).notify();
+
+    auto indices = sut.timedWait(iox::units::Duration::fromMilliseconds(100));
+
+    ASSERT_THAT(indices.size(), Eq(4U));
+    EXPECT_THAT(indices[0U], Eq(0U));
+    EXPECT_THAT(indices[1U], Eq(63U));
+    EXPECT_THAT(indices[2U], Eq(64U));
+    EXPECT_THAT(indices[3U], Eq(LAST_INDEX));
+    EXPECT_THAT(sut.timedWait(iox::units::Duration::fromMilliseconds(0)).size(), Eq(0U));
+}
+
+TEST_F(ConditionVariable_test, NotifyWithoutWaitingListenerDoesNotPostSemaphore)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "63849173-c716-4d3c-babd-462086454997");
+    ConditionNotifier(m_condVarData, 0U).notify();
+
+    EXPECT_THAT(m_condVarData.m_semaphore->tryWait().value(), Eq(false));
+    EXPECT_THAT(m_condVarData.isNotificationActive(0U), Eq(true));
+    EXPECT_THAT(m_condVarData.m_wasNotified.load(), Eq(true));
+}
+
+TEST_F(ConditionVariable_test, NotifyWithWaitingListenerPostsSemaphore)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9b4eed11-f5b5-4ebd-8450-f9706b44a7d8");
+    m_condVarData.m_hasWaitingListener.store(true);
+    ConditionNotifier(m_condVarData, 0U).notify();
+
+    EXPECT_THAT(m_condVarData.m_semaphore->tryWait().value(), Eq(true));
+}
+
+TEST_F(ConditionVariable_test, WaitingListenerIsResetAfterWait)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c540fb56-82eb-468d-8658-3d9a93f11a3a");
+    ConditionListener sut(m_condVarData);
+    ConditionNotifier(m_condVarData, 0U).notify();
+
+    ASSERT_THAT(sut.wait().size(), Eq(1U));
+
+    EXPECT_THAT(m_condVarData.m_hasWaitingListener.load(), Eq(false));
+}
+
 TIMING_TEST_F(ConditionVariable_test, TimedWaitBlocksUntilTimeout, Repeat(5), [&] {
     ::testing::Test::RecordProperty("TEST_ID", "c755aec9-43c3-4bf4-bec4-5672c76561ef");
     ConditionListener listener(m_condVarData);
@@ -420,9 +470,9 @@ TIMING_TEST_F(ConditionVariable_test, SecondWaitBlocksUntilNewNotification, Repe
         hasWaited.store(true, std::memory_order_relaxed);
         ASSERT_THAT(activeNotifications.size(), Eq(1U));
         EXPECT_THAT(activeNotifications[0], Eq(FIRST_EVENT_INDEX));
-        for (const auto& notification : m_condVarData.m_activeNotifications)
+        for (uint64_t i = 0U; i < iox::MAX_NUMBER_OF_NOTIFIERS; ++i)
         {
-            EXPECT_THAT(notification, Eq(false));
+            EXPECT_THAT(m_condVarData.isNotificationActive(i), Eq(false));
         }
     });
 
@@ -0,0 +1,159 @@
+// Copyright (c) 2026 by agent <agent@local>. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/testing/timing_test.hpp"
+#include "iceoryx_hoofs/testing/watch_dog.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/discovery_notifier.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/discovery_trigger.hpp"
+#include "test.hpp"
+
+#include <atomic>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::popo;
+using namespace iox::units::duration_literals;
+
+class DiscoveryTrigger_test : public Test
+{
+  public:
+    using Entry_t = std::pair<DiscoveryEntryKind, uint64_t>;
+
+    void SetUp() override
+    {
+        m_watchdog.watchAndActOnFailure([&] { std::terminate(); });
+    }
+
+    std::vector<Entry_t> collectDirtyEntries()
+    {
+        std::vector<Entry_t> entries;
+        sut.collectDirtyEntries(
+            [&](const DiscoveryEntryKind kind, const uint64_t position) { entries.emplace_back(kind, position); });
+        return entries;
+    }
+
+    const iox::units::Duration m_timeToWait = 2_s;
+    const iox::units::Duration m_timingTestTime = 100_ms;
+    Watchdog m_watchdog{m_timeToWait};
+
+    DiscoveryTrigger sut;
+};
+
+TEST_F(DiscoveryTrigger_test, NoDirtyEntriesAreCollectedWithoutNotification)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "acc6e4c9-928a-4568-8ea2-64d9d7e1f13d");
+    EXPECT_TRUE(collectDirtyEntries().empty());
+}
+
+TEST_F(DiscoveryTrigger_test, EntryIndicesOfAllKindsAreConsecutiveAndUnique)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "84252a80-a518-45fb-9eb7-83b88a53b4c2");
+    EXPECT_THAT(DiscoveryTrigger::toEntryIndex(DiscoveryEntryKind::PUBLISHER_PORT, 0U), Eq(0U));
+    EXPECT_THAT(DiscoveryTrigger::toEntryIndex(DiscoveryEntryKind::SUBSCRIBER_PORT, 0U), Eq(iox::MAX_PUBLISHERS));
+    EXPECT_THAT(DiscoveryTrigger::toEntryIndex(DiscoveryEntryKind::CONDITION_VARIABLE,
+                                               iox::MAX_NUMBER_OF_CONDITION_VARIABLES - 1U),
+                Eq(DiscoveryTrigger::NUMBER_OF_ENTRIES - 1U));
+}
+
+TEST_F(DiscoveryTrigger_test, NotifiedEntriesAreCollectedInOrderWithKindAndPosition)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "004db342-de74-45e8-8f8f-ba570dd37d8a");
+    const std::vector<Entry_t> expectedEntries{{DiscoveryEntryKind::PUBLISHER_PORT, 0U},
+                                               {DiscoveryEntryKind::PUBLISHER_PORT, iox::MAX_PUBLISHERS - 1U},
+                                               {DiscoveryEntryKind::SUBSCRIBER_PORT, 0U},
+                                               {DiscoveryEntryKind::SERVER_PORT, 3U},
+                                               {DiscoveryEntryKind::CLIENT_PORT, iox::MAX_CLIENTS - 1U},
+                                               {DiscoveryEntryKind::INTERFACE_PORT, 1U},
+                                               {DiscoveryEntryKind::NODE, 0U},
+                                               {DiscoveryEntryKind::CONDITION_VARIABLE,
+                                                iox::MAX_NUMBER_OF_CONDITION_VARIABLES - 1U}};
+
+    // notify in reverse order to verify that the order of the notifications does not matter
+    for (auto entry = expectedEntries.rbegin(); entry != expectedEntries.rend(); ++entry)
+    {
+        sut.notify(DiscoveryTrigger::toEntryIndex(entry->first, entry->second));
+    }
+
+    EXPECT_THAT(collectDirtyEntries(), Eq(expectedEntries));
+}
+
+TEST_F(DiscoveryTrigger_test, EntryWhichIsNotifiedMultipleTimesIsCollectedOnce)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2f705873-3e4d-4f2e-956d-ac291f0ff990");
+    const auto entryIndex = DiscoveryTrigger::toEntryIndex(DiscoveryEntryKind::SERVER_PORT, 7U);
+    sut.notify(entryIndex);
+    sut.notify(entryIndex);
+    sut.notify(entryIndex);
+
+    const std::vector<Entry_t> expectedEntries{{DiscoveryEntryKind::SERVER_PORT, 7U}};
+    EXPECT_THAT(collectDirtyEntries(), Eq(expectedEntries));
+}
+
+TEST_F(DiscoveryTrigger_test, CollectingResetsTheDirtyEntries)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "67c1f79c-4b53-49c0-94b8-d16c34c20b21");
+    sut.notify(DiscoveryTrigger::toEntryIndex(DiscoveryEntryKind::NODE, 2U));
+    ASSERT_THAT(collectDirtyEntries().size(), Eq(1U));
+
+    EXPECT_TRUE(collectDirtyEntries().empty());
+}
+
+TEST_F(DiscoveryTrigger_test, AttachedDiscoveryNotifierMarksItsEntryAsDirty)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3bbf84f1-2d04-4e33-932d-5ba67edeea7b");
+    DiscoveryNotifier defaultNotifier;
+    defaultNotifier.notify();
+
+    DiscoveryNotifier attachedNotifier(sut, DiscoveryTrigger::toEntryIndex(DiscoveryEntryKind::CLIENT_PORT, 5U));
+    attachedNotifier.notify();
+
+    const std::vector<Entry_t> expectedEntries{{DiscoveryEntryKind::CLIENT_PORT, 5U}};
+    EXPECT_THAT(collectDirtyEntries(), Eq(expectedEntries));
+}
+
+TEST_F(DiscoveryTrigger_test, TimedWaitReturnsImmediatelyAfterNotificationOrWakeUp)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "29b5a78b-9950-4cdf-87b4-0490c71533ee");
+    // the watchdog terminates the test if the wait blocks until the timeout
+    sut.notify(DiscoveryTrigger::toEntryIndex(DiscoveryEntryKind::PUBLISHER_PORT, 0U));
+    sut.timedWait(2 * m_timeToWait);
+
+    sut.wakeUp();
+    sut.timedWait(2 * m_timeToWait);
+}
+
+TIMING_TEST_F(DiscoveryTrigger_test, TimedWaitBlocksUntilNotification, Repeat(5), [&] {
+    ::testing::Test::RecordProperty("TEST_ID", "0a1d43ef-cc8a-46f2-a61d-2cb7866e387f");
+    std::atomic_bool hasWaited{false};
+
+    std::thread waiter([&] {
+        sut.timedWait(m_timeToWait);
+        hasWaited.store(true, std::memory_order_relaxed);
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(m_timingTestTime.toMilliseconds()));
+    EXPECT_THAT(hasWaited, Eq(false));
+    sut.notify(DiscoveryTrigger::toEntryIndex(DiscoveryEntryKind::SUBSCRIBER_PORT, 1U));
+    std::this_thread::sleep_for(std::chrono::milliseconds(m_timingTestTime.toMilliseconds()));
+    EXPECT_THAT(hasWaited, Eq(true));
+    waiter.join();
+})
+
+} // namespace
@@ -0,0 +1,121 @@
+// Copyright (c) 2026 by agent <agent@local>. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/popo/building_blocks/latency_histogram.hpp"
+#include "test.hpp"
+
+#include <limits>
+
+namespace
+{
+using namespace ::testing;
+using iox::popo::LatencyHistogram;
+
+TEST(LatencyHistogram_test, EmptyHistogramHasNoSamplesAndReportsZero)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "be2377f5-56e9-4305-8773-c2a63f37e9d3");
+    LatencyHistogram sut;
+
+    EXPECT_THAT(sut.count(), Eq(0U));
+    EXPECT_THAT(sut.valueAtPercentile(50.0), Eq(0U));
+    EXPECT_THAT(sut.valueAtPercentile(99.9), Eq(0U));
+}
+
+TEST(LatencyHistogram_test, SmallValuesHaveABucketOfTheirOwn)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9a1cac97-57a8-4da7-a006-6b8337917b76");
+    for (uint64_t value = 0U; value < LatencyHistogram::SUB_BUCKETS_PER_OCTAVE; ++value)
+    {
+        EXPECT_THAT(LatencyHistogram::bucketIndex(value), Eq(value));
+        EXPECT_THAT(LatencyHistogram::bucketUpperBound(value), Eq(value));
+    }
+}
+
+TEST(LatencyHistogram_test, BucketsAreContiguousAndContainTheirValues)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3df74969-dd65-4532-9406-40a33d66aac7");
+    for (uint64_t index = 1U; index < LatencyHistogram::NUMBER_OF_BUCKETS; ++index)
+    {
+        const auto lowerBound = LatencyHistogram::bucketUpperBound(index - 1U) + 1U;
+        const auto upperBound = LatencyHistogram::bucketUpperBound(index);
+        ASSERT_THAT(upperBound, Ge(lowerBound));
+        EXPECT_THAT(LatencyHistogram::bucketIndex(lowerBound), Eq(index));
+        EXPECT_THAT(LatencyHistogram::bucketIndex(upperBound), Eq(index));
+    }
+}
+
+TEST(LatencyHistogram_test, RelativeErrorOfTheBucketUpperBoundIsBelowOneQuarter)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3b472a77-d550-439a-8d4c-7d61f320b1a7");
+    for (uint64_t value : {5U, 100U, 1234U, 99999U, 12345678U, 1000000000U})
+    {
+        const auto upperBound = LatencyHistogram::bucketUpperBound(LatencyHistogram::bucketIndex(value));
+        EXPECT_THAT(upperBound, Ge(value));
+        EXPECT_THAT(upperBound - value, Lt(value / 4U + 1U));
+    }
+}
+
+TEST(LatencyHistogram_test, ValuesBeyondTheRangeAreCountedInTheLastBucket)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "01d57c21-f560-42af-8067-02a9c3154a01");
+    LatencyHistogram sut;
+    sut.record(std::numeric_limits<uint64_t>::max());
+
+    EXPECT_THAT(LatencyHistogram::bucketIndex(std::numeric_limits<uint64_t>::max()),
+                Eq(LatencyHistogram::NUMBER_OF_BUCKETS - 1U));
+    EXPECT_THAT(sut.count(), Eq(1U));
+    EXPECT_THAT(sut.valueAtPercentile(100.0),
+                Eq(LatencyHistogram::bucketUpperBound(LatencyHistogram::NUMBER_OF_BUCKETS - 1U)));
+}
+
+TEST(LatencyHistogram_test, PercentilesAreReportedWithTheUpperBoundOfTheirBucket)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4dcbc8d5-6c81-480f-bee5-d92995278889");
+    constexpr uint64_t FAST_LATENCY{1000U};
+    constexpr uint64_t SLOW_LATENCY{1000000U};
+    LatencyHistogram sut;
+    for (uint64_t i = 0U; i < 990U; ++i)
+    {
+        sut.record(FAST_LATENCY);
+    }
+    for (uint64_t i = 0U; i < 10U; ++i)
+    {
+        sut.record(SLOW_LATENCY);
+    }
+
+    EXPECT_THAT(sut.count(), Eq(1000U));
+    EXPECT_THAT(sut.valueAtPercentile(50.0),
+                Eq(LatencyHistogram::bucketUpperBound(LatencyHistogram::bucketIndex(FAST_LATENCY))));
+    EXPECT_THAT(sut.valueAtPercentile(99.0),
+                Eq(LatencyHistogram::bucketUpperBound(LatencyHistogram::bucketIndex(FAST_LATENCY))));
+    EXPECT_THAT(sut.valueAtPercentile(99.9),
+                Eq(LatencyHistogram::bucketUpperBound(LatencyHistogram::bucketIndex(SLOW_LATENCY))));
+}
+
+TEST(LatencyHistogram_test, PercentilesOutOfRangeAreClamped)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b68a7d9c-e914-4e3c-929a-5fb6cb639e4c");
+    LatencyHistogram sut;
+    sut.record(10U);
+    sut.record(1000U);
+
+    EXPECT_THAT(sut.valueAtPercentile(-5.0), Eq(sut.valueAtPercentile(0.0)));
+    EXPECT_THAT(sut.valueAtPercentile(0.0), Eq(LatencyHistogram::bucketUpperBound(LatencyHistogram::bucketIndex(10U))));
+    EXPECT_THAT(sut.valueAtPercentile(150.0),
+                Eq(LatencyHistogram::bucketUpperBound(LatencyHistogram::bucketIndex(1000U))));
+}
+
+} // namespace
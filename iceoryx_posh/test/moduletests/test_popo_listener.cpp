@@ -140,6 +140,15 @@ class TestListener : public Listener
     }
 };
 
+class TestMultiThreadedListener : public MultiThreadedListener
+{
+  public:
+    TestMultiThreadedListener(ConditionVariableData& data, const uint64_t numberOfWorkerThreads) noexcept
+        : MultiThreadedListener(data, numberOfWorkerThreads)
+    {
+    }
+};
+
 struct EventAndSutPair_t
 {
     SimpleEventClass* object;
@@ -1238,4 +1247,124 @@ TIMING_TEST_F(Listener_test, AttachingInCallbackWorks, Repeat(5), [&] {
 // END
 //////////////////////////////////
 
+//////////////////////////////////
+// BEGIN MultiThreadedListener
+//////////////////////////////////
+namespace
+{
+std::atomic<uint64_t> g_blockingCallbackCount{0U};
+std::atomic<uint64_t> g_countingCallbackCount{0U};
+std::atomic<uint64_t> g_concurrentCallbacks{0U};
+std::atomic<uint64_t> g_maxConcurrentCallbacks{0U};
+iox::optional<iox::posix::UnnamedSemaphore> g_workerBlocker;
+
+class MultiThreadedListener_test : public Test
+{
+  public:
+    static void blockingCallback(SimpleEventClass* const) noexcept
+    {
+        ++g_blockingCallbackCount;
+        IOX_DISCARD_RESULT(g_workerBlocker->wait());
+    }
+
+    static void countingCallback(SimpleEventClass* const) noexcept
+    {
+        ++g_countingCallbackCount;
+    }
+
+    static void concurrencyTrackingCallback(SimpleEventClass* const) noexcept
+    {
+        auto concurrentCallbacks = ++g_concurrentCallbacks;
+        auto maxConcurrentCallbacks = g_maxConcurrentCallbacks.load();
+        while (concurrentCallbacks > maxConcurrentCallbacks
+               && !g_maxConcurrentCallbacks.compare_exchange_weak(maxConcurrentCallbacks, concurrentCallbacks))
+        {
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1U));
+        ++g_countingCallbackCount;
+        --g_concurrentCallbacks;
+    }
+
+    void SetUp() override
+    {
+        g_blockingCallbackCount = 0U;
+        g_countingCallbackCount = 0U;
+        g_concurrentCallbacks = 0U;
+        g_maxConcurrentCallbacks = 0U;
+        iox::posix::UnnamedSemaphoreBuilder()
+            .initialValue(0U)
+            .isInterProcessCapable(false)
+            .create(g_workerBlocker)
+            .expect("Unable to create worker blocker semaphore");
+    }
+
+    ConditionVariableData m_condVarData{"Sternenstaub"};
+    iox::optional<TestMultiThreadedListener> m_sut;
+
+    const iox::units::Duration m_fatalTimeout = 2_s;
+    Watchdog m_watchdog{m_fatalTimeout};
+    static constexpr uint64_t NUMBER_OF_WORKER_THREADS = 4U;
+    static constexpr uint64_t CALLBACK_WAIT_IN_MS = 100U;
+};
+
+constexpr uint64_t MultiThreadedListener_test::NUMBER_OF_WORKER_THREADS;
+constexpr uint64_t MultiThreadedListener_test::CALLBACK_WAIT_IN_MS;
+} // namespace
+
+TEST_F(MultiThreadedListener_test, ListenerHasNoWorkerThreads)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8f7b2177-8639-4ee8-9783-4a2f96d99778");
+    TestListener sut(m_condVarData);
+    EXPECT_THAT(sut.numberOfWorkerThreads(), Eq(0U));
+}
+
+TEST_F(MultiThreadedListener_test, NumberOfWorkerThreadsIsLimitedToMaximum)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ae28c33e-d045-4c53-87e9-72f7f477cae8");
+    m_sut.emplace(m_condVarData, iox::MAX_NUMBER_OF_WORKER_THREADS_PER_LISTENER + 1U);
+    EXPECT_THAT(m_sut->numberOfWorkerThreads(), Eq(iox::MAX_NUMBER_OF_WORKER_THREADS_PER_LISTENER));
+}
+
+TIMING_TEST_F(MultiThreadedListener_test, BlockedCallbackDoesNotDelayCallbackOfOtherEvent, Repeat(5), [&] {
+    ::testing::Test::RecordProperty("TEST_ID", "51352c76-9255-4a27-b615-fd94bbdc607a");
+    m_sut.emplace(m_condVarData, NUMBER_OF_WORKER_THREADS);
+    SimpleEventClass slowEvent;
+    SimpleEventClass fastEvent;
+    ASSERT_FALSE(m_sut->attachEvent(slowEvent, createNotificationCallback(blockingCallback)).has_error());
+    ASSERT_FALSE(m_sut->attachEvent(fastEvent, createNotificationCallback(countingCallback)).has_error());
+
+    m_watchdog.watchAndActOnFailure([] { std::terminate(); });
+    slowEvent.triggerNoEventType();
+    std::this_thread::sleep_for(std::chrono::milliseconds(CALLBACK_WAIT_IN_MS));
+    fastEvent.triggerNoEventType();
+    std::this_thread::sleep_for(std::chrono::milliseconds(CALLBACK_WAIT_IN_MS));
+
+    TIMING_TEST_EXPECT_TRUE(g_blockingCallbackCount == 1U);
+    TIMING_TEST_EXPECT_TRUE(g_countingCallbackCount == 1U);
+
+    IOX_DISCARD_RESULT(g_workerBlocker->post());
+    m_sut.reset();
+})
+
+TIMING_TEST_F(MultiThreadedListener_test, CallbacksOfOneEventAreNotExecutedConcurrently, Repeat(5), [&] {
+    ::testing::Test::RecordProperty("TEST_ID", "aebc3185-e69b-45c9-9e47-b0043d063f63");
+    m_sut.emplace(m_condVarData, NUMBER_OF_WORKER_THREADS);
+    SimpleEventClass event;
+    ASSERT_FALSE(m_sut->attachEvent(event, createNotificationCallback(concurrencyTrackingCallback)).has_error());
+
+    constexpr uint64_t NUMBER_OF_TRIGGERS = 50U;
+    for (uint64_t i = 0U; i < NUMBER_OF_TRIGGERS; ++i)
+    {
+        event.triggerNoEventType();
+        std::this_thread::sleep_for(std::chrono::microseconds(500U));
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(CALLBACK_WAIT_IN_MS));
+
+    TIMING_TEST_EXPECT_TRUE(g_countingCallbackCount >= 1U);
+    TIMING_TEST_EXPECT_TRUE(g_maxConcurrentCallbacks == 1U);
+})
+//////////////////////////////////
+// END
+//////////////////////////////////
+
 } // namespace
@@ -107,6 +107,30 @@ TEST_F(PublisherTest, LoanWithArgumentsCallsCustomCtor)
     // ===== Cleanup ===== //
 }
 
+TEST_F(PublisherTest, PublishBatchSendsAllSamplesWithOnePortCall)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c1c543f0-ff5d-449f-bb64-a2f7ecf714d9");
+    ChunkMock<DummyData> anotherChunkMock;
+    EXPECT_CALL(portMock, tryAllocateChunk(sizeof(DummyData), _, _, _))
+        .WillOnce(Return(ByMove(iox::success<iox::mepoo::ChunkHeader*>(chunkMock.chunkHeader()))))
+        .WillOnce(Return(ByMove(iox::success<iox::mepoo::ChunkHeader*>(anotherChunkMock.chunkHeader()))));
+    auto firstSample = sut.loan();
+    auto secondSample = sut.loan();
+    ASSERT_FALSE(firstSample.has_error());
+    ASSERT_FALSE(secondSample.has_error());
+    EXPECT_CALL(portMock, sendChunks(_, 2U))
+        .WillOnce(Invoke([&](iox::mepoo::ChunkHeader* const* const chunkHeaders, const uint64_t) {
+            EXPECT_THAT(chunkHeaders[0], Eq(chunkMock.chunkHeader()));
+            EXPECT_THAT(chunkHeaders[1], Eq(anotherChunkMock.chunkHeader()));
+        }));
+    EXPECT_CALL(portMock, releaseChunk(_)).Times(0);
+    // ===== Test ===== //
+    iox::popo::Sample<DummyData> samples[]{std::move(firstSample.value()), std::move(secondSample.value())};
+    sut.publishBatch(samples, 2U);
+    // ===== Verify ===== //
+    // ===== Cleanup ===== //
+}
+
 TEST_F(PublisherTest, CanLoanSamplesAndPublishTheResultOfALambdaWithAdditionalArguments)
 {
     ::testing::Test::RecordProperty("TEST_ID", "6e341963-5917-440b-b01a-2fc8fff64def");
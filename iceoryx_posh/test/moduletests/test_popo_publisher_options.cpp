@@ -32,6 +32,8 @@ TEST(PublisherOptions_test, SerializationRoundTripIsSuccessful)
     testOptions.nodeName = "hypnotoad";
     testOptions.offerOnCreate = false;
     testOptions.subscriberTooSlowPolicy = iox::popo::ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER;
+    testOptions.batchSubscriberNotifications = true;
+    testOptions.recycledChunkCapacity = 3U;
 
     iox::popo::PublisherOptions::deserialize(testOptions.serialize())
         .and_then([&](auto& roundTripOptions) {
@@ -46,6 +48,13 @@ TEST(PublisherOptions_test, SerializationRoundTripIsSuccessful)
 
             EXPECT_THAT(roundTripOptions.subscriberTooSlowPolicy, Ne(defaultOptions.subscriberTooSlowPolicy));
             EXPECT_THAT(roundTripOptions.subscriberTooSlowPolicy, Eq(testOptions.subscriberTooSlowPolicy));
+
+            EXPECT_THAT(roundTripOptions.batchSubscriberNotifications,
+                        Ne(defaultOptions.batchSubscriberNotifications));
+            EXPECT_THAT(roundTripOptions.batchSubscriberNotifications, Eq(testOptions.batchSubscriberNotifications));
+
+            EXPECT_THAT(roundTripOptions.recycledChunkCapacity, Ne(defaultOptions.recycledChunkCapacity));
+            EXPECT_THAT(roundTripOptions.recycledChunkCapacity, Eq(testOptions.recycledChunkCapacity));
         })
         .or_else([&](auto&) { GTEST_FAIL() << "Serialization/Deserialization of PublisherOptions failed!"; });
 }
@@ -66,9 +75,15 @@ TEST(PublisherOptions_test, DeserializingInvalidSubscriberTooSlowPolicyFails)
     const iox::NodeName_t NODE_NAME{"harr-harr"};
     constexpr bool OFFER_ON_CREATE{true};
     constexpr std::underlying_type_t<iox::popo::ConsumerTooSlowPolicy> SUBSCRIBER_TOO_SLOW_POLICY{111};
+    constexpr bool BATCH_SUBSCRIBER_NOTIFICATIONS{false};
+    constexpr uint32_t RECYCLED_CHUNK_CAPACITY{0U};
 
-    const auto serialized =
-        iox::cxx::Serialization::create(HISTORY_CAPACITY, NODE_NAME, OFFER_ON_CREATE, SUBSCRIBER_TOO_SLOW_POLICY);
+    const auto serialized = iox::cxx::Serialization::create(HISTORY_CAPACITY,
+                                                            NODE_NAME,
+                                                            OFFER_ON_CREATE,
+                                                            SUBSCRIBER_TOO_SLOW_POLICY,
+                                                            BATCH_SUBSCRIBER_NOTIFICATIONS,
+                                                            RECYCLED_CHUNK_CAPACITY);
     iox::popo::PublisherOptions::deserialize(serialized)
         .and_then([&](auto&) { GTEST_FAIL() << "Deserialization is expected to fail!"; })
         .or_else([&](auto&) { GTEST_SUCCEED(); });
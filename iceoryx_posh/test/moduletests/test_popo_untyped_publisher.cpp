@@ -138,6 +138,23 @@ TEST_F(UntypedPublisherTest, PublishesUserPayloadViaUnderlyingPort)
     // ===== Cleanup ===== //
 }
 
+TEST_F(UntypedPublisherTest, PublishBatchSendsAllUserPayloadsWithOnePortCall)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d5ed13e5-2b86-420c-998a-18e9d03b8247");
+    // ===== Setup ===== //
+    ChunkMock<uint64_t> anotherChunkMock;
+    void* userPayloads[]{chunkMock.chunkHeader()->userPayload(), anotherChunkMock.chunkHeader()->userPayload()};
+    EXPECT_CALL(portMock, sendChunks(_, 2U))
+        .WillOnce(Invoke([&](iox::mepoo::ChunkHeader* const* const chunkHeaders, const uint64_t) {
+            EXPECT_THAT(chunkHeaders[0], Eq(chunkMock.chunkHeader()));
+            EXPECT_THAT(chunkHeaders[1], Eq(anotherChunkMock.chunkHeader()));
+        }));
+    // ===== Test ===== //
+    sut.publishBatch(userPayloads, 2U);
+    // ===== Verify ===== //
+    // ===== Cleanup ===== //
+}
+
 // test whether the BasePublisher methods are called
 
 TEST_F(UntypedPublisherTest, OfferDoesOfferServiceOnUnderlyingPort)
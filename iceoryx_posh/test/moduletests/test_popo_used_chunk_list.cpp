@@ -22,6 +22,8 @@
 
 #include "test.hpp"
 
+#include <deque>
+
 namespace
 {
 using namespace ::testing;
@@ -233,6 +235,38 @@ TEST_F(UsedChunkList_test, UsedChunkListCanBeFilledToCapacityAndFullyEmptied)
     checkIfEmpty();
 }
 
+TEST_F(UsedChunkList_test, FullUsedChunkListCanBeRotatedByRemovingTheOldestAndInsertingANewChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9a1b942d-739f-4c09-9894-421a01e1631c");
+    constexpr uint32_t NUMBER_OF_ROTATIONS{5U * USED_CHUNK_LIST_CAPACITY};
+    std::deque<ChunkHeader*> chunkHeaderInUse;
+    createMultipleChunks(USED_CHUNK_LIST_CAPACITY, [&](SharedChunk&& chunk) {
+        chunkHeaderInUse.push_back(chunk.getChunkHeader());
+        EXPECT_TRUE(sut.insert(chunk));
+    });
+
+    for (uint32_t i = 0U; i < NUMBER_OF_ROTATIONS; ++i)
+    {
+        SharedChunk removedChunk;
+        ASSERT_TRUE(sut.remove(chunkHeaderInUse.front(), removedChunk));
+        EXPECT_THAT(removedChunk.getChunkHeader(), Eq(chunkHeaderInUse.front()));
+        chunkHeaderInUse.pop_front();
+
+        auto chunk = getChunkFromMemoryManager();
+        chunkHeaderInUse.push_back(chunk.getChunkHeader());
+        ASSERT_TRUE(sut.insert(chunk));
+    }
+
+    EXPECT_THAT(memoryManager.getMemPoolInfo(0U).m_usedChunks, Eq(USED_CHUNK_LIST_CAPACITY));
+    for (auto chunkHeader : chunkHeaderInUse)
+    {
+        SharedChunk removedChunk;
+        EXPECT_TRUE(sut.remove(chunkHeader, removedChunk));
+    }
+
+    checkIfEmpty();
+}
+
 TEST_F(UsedChunkList_test, RemoveChunkFromEmptyListIsHandledGracefully)
 {
     ::testing::Test::RecordProperty("TEST_ID", "2c4a64d1-07cc-4334-89bf-dd58ad291af5");
@@ -30,6 +30,7 @@
 #include "iceoryx_posh/testing/roudi_environment/roudi_environment.hpp"
 #include "test.hpp"
 
+#include <tuple>
 #include <type_traits>
 
 namespace
@@ -379,9 +380,13 @@ TEST_F(PoshRuntime_test, GetMiddlewarePublisherWithForbiddenServiceDescriptionsF
     iox::vector<iox::capro::ServiceDescription, iox::NUMBER_OF_INTERNAL_PUBLISHERS> internalServices;
     const iox::capro::ServiceDescription serviceRegistry{
         iox::SERVICE_DISCOVERY_SERVICE_NAME, iox::SERVICE_DISCOVERY_INSTANCE_NAME, iox::SERVICE_DISCOVERY_EVENT_NAME};
+    const iox::capro::ServiceDescription serviceRegistryChangeLog{iox::SERVICE_DISCOVERY_SERVICE_NAME,
+                                                                  iox::SERVICE_DISCOVERY_INSTANCE_NAME,
+                                                                  iox::SERVICE_DISCOVERY_CHANGE_LOG_EVENT_NAME};
 
     // Added by PortManager
     internalServices.push_back(serviceRegistry);
+    internalServices.push_back(serviceRegistryChangeLog);
     internalServices.push_back(iox::roudi::IntrospectionPortService);
     internalServices.push_back(iox::roudi::IntrospectionPortThroughputService);
     internalServices.push_back(iox::roudi::IntrospectionSubscriberPortChangingDataService);
@@ -1116,6 +1121,82 @@ TEST_F(PoshRuntime_test, ShutdownUnblocksBlockingServer)
     EXPECT_THAT(wasResponseSent.load(), Eq(true));
 }
 
+enum class PortKind
+{
+    PUBLISHER,
+    SUBSCRIBER,
+    CLIENT,
+    SERVER
+};
+
+class PoshRuntimeInvalidNodeName_test : public TestWithParam<std::tuple<IpcProtocol, PortKind>>
+{
+  public:
+    RouDiEnvironment m_roudiEnv{
+        iox::RouDiConfig_t().setDefaults(), iox::roudi::MonitoringMode::OFF, 0U, std::get<0>(GetParam())};
+    PoshRuntime* m_runtime{&iox::runtime::PoshRuntime::initRuntime("invalidNodeName")};
+    const iox::NodeName_t m_invalidNodeName{"invalidNode,"};
+};
+
+// the binary protocol could transfer the node name but it is rejected like with the text protocol
+INSTANTIATE_TEST_SUITE_P(PoshRuntime_test,
+                         PoshRuntimeInvalidNodeName_test,
+                         Combine(Values(IpcProtocol::TEXT, IpcProtocol::BINARY),
+                                 Values(PortKind::PUBLISHER, PortKind::SUBSCRIBER, PortKind::CLIENT, PortKind::SERVER)));
+
+TEST_P(PoshRuntimeInvalidNodeName_test, GetMiddlewarePortWithInvalidNodeNameLeadsToErrorHandlerCall)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3a0d6c52-8f1e-4b7a-9c24-6e5f0b1d2a87");
+    const iox::capro::ServiceDescription sd{"shine", "on", "diamond"};
+
+    iox::optional<iox::PoshError> detectedError;
+    auto errorHandlerGuard = iox::ErrorHandlerMock::setTemporaryErrorHandler<iox::PoshError>(
+        [&detectedError](const iox::PoshError error, const iox::ErrorLevel errorLevel) {
+            detectedError.emplace(error);
+            EXPECT_THAT(errorLevel, Eq(iox::ErrorLevel::SEVERE));
+        });
+
+    iox::PoshError expectedError{iox::PoshError::NO_ERROR};
+    switch (std::get<1>(GetParam()))
+    {
+    case PortKind::PUBLISHER:
+    {
+        iox::popo::PublisherOptions publisherOptions;
+        publisherOptions.nodeName = m_invalidNodeName;
+        m_runtime->getMiddlewarePublisher(sd, publisherOptions);
+        expectedError = iox::PoshError::POSH__RUNTIME_ROUDI_REQUEST_PUBLISHER_INVALID_RESPONSE;
+        break;
+    }
+    case PortKind::SUBSCRIBER:
+    {
+        iox::popo::SubscriberOptions subscriberOptions;
+        subscriberOptions.nodeName = m_invalidNodeName;
+        m_runtime->getMiddlewareSubscriber(sd, subscriberOptions);
+        expectedError = iox::PoshError::POSH__RUNTIME_ROUDI_REQUEST_SUBSCRIBER_INVALID_RESPONSE;
+        break;
+    }
+    case PortKind::CLIENT:
+    {
+        iox::popo::ClientOptions clientOptions;
+        clientOptions.nodeName = m_invalidNodeName;
+        m_runtime->getMiddlewareClient(sd, clientOptions);
+        expectedError = iox::PoshError::POSH__RUNTIME_ROUDI_REQUEST_CLIENT_INVALID_RESPONSE;
+        break;
+    }
+    case PortKind::SERVER:
+    {
+        iox::popo::ServerOptions serverOptions;
+        serverOptions.nodeName = m_invalidNodeName;
+        m_runtime->getMiddlewareServer(sd, serverOptions);
+        expectedError = iox::PoshError::POSH__RUNTIME_ROUDI_REQUEST_SERVER_INVALID_RESPONSE;
+        break;
+    }
+    }
+
+    ASSERT_THAT(detectedError.has_value(), Eq(true));
+    EXPECT_THAT(detectedError.value(), Eq(expectedError));
+}
+
 TEST(PoshRuntimeFactory_test, SetValidRuntimeFactorySucceeds)
 {
     ::testing::Test::RecordProperty("TEST_ID", "59c4e1e6-36f6-4f6d-b4c2-e84fa891f014");
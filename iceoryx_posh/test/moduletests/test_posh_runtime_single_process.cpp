@@ -43,6 +43,33 @@ class PoshRuntimeSingleProcess_test : public Test
     virtual void SetUp(){};
 
     virtual void TearDown(){};
+
+    void expectPortsAndConditionVariableCreatedWithProtocol(const IpcProtocol ipcProtocol)
+    {
+        iox::RouDiConfig_t defaultRouDiConfig = iox::RouDiConfig_t().setDefaults();
+        std::unique_ptr<IceOryxRouDiComponents> roudiComponents{new IceOryxRouDiComponents(defaultRouDiConfig)};
+
+        std::unique_ptr<RouDi> roudi{
+            new RouDi(roudiComponents->rouDiMemoryManager,
+                      roudiComponents->portManager,
+                      RouDi::RoudiStartupParameters{iox::roudi::MonitoringMode::OFF,
+                                                    false,
+                                                    RouDi::RuntimeMessagesThreadStart::IMMEDIATE,
+                                                    iox::version::CompatibilityCheckLevel::PATCH,
+                                                    iox::roudi::PROCESS_DEFAULT_KILL_DELAY,
+                                                    ipcProtocol})};
+
+        std::unique_ptr<PoshRuntimeSingleProcess> sut{new PoshRuntimeSingleProcess("App")};
+        const iox::capro::ServiceDescription service{"Radar", "FrontLeft", "Objects"};
+
+        iox::popo::PublisherOptions publisherOptions;
+        publisherOptions.nodeName = "Node";
+        EXPECT_THAT(sut->getMiddlewarePublisher(service, publisherOptions), Ne(nullptr));
+        EXPECT_THAT(sut->getMiddlewareSubscriber(service, iox::popo::SubscriberOptions()), Ne(nullptr));
+        EXPECT_THAT(sut->getMiddlewareClient(service, iox::popo::ClientOptions()), Ne(nullptr));
+        EXPECT_THAT(sut->getMiddlewareServer(service, iox::popo::ServerOptions()), Ne(nullptr));
+        EXPECT_THAT(sut->getMiddlewareConditionVariable(), Ne(nullptr));
+    }
 };
 
 TEST_F(PoshRuntimeSingleProcess_test, ConstructorPoshRuntimeSingleProcessIsSuccess)
@@ -81,4 +108,16 @@ TEST_F(PoshRuntimeSingleProcess_test, ConstructorPoshRuntimeSingleProcessMultipl
     EXPECT_THAT(detectedError.value(), Eq(iox::PoshError::POSH__RUNTIME_IS_CREATED_MULTIPLE_TIMES));
 }
 
+TEST_F(PoshRuntimeSingleProcess_test, PortsAndConditionVariableAreCreatedWithBinaryProtocol)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f6c19b6d-6d51-4b4a-bd5e-082345d65d8a");
+    expectPortsAndConditionVariableCreatedWithProtocol(IpcProtocol::BINARY);
+}
+
+TEST_F(PoshRuntimeSingleProcess_test, PortsAndConditionVariableAreCreatedWithTextProtocol)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9a7b2e29-2dd2-40e5-be57-a2b4d92f163b");
+    expectPortsAndConditionVariableCreatedWithProtocol(IpcProtocol::TEXT);
+}
+
 } // namespace
@@ -103,6 +103,120 @@ TEST_F(RoudiConfigTomlFileProvider_test, ParsingFileIsSuccessful)
 #endif
 }
 
+TEST_F(RoudiConfigTomlFileProvider_test, ParsingAllocationPolicyIsSuccessful)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2f443157-c0c7-4371-a5c7-cf6dabf2844a");
+    constexpr const char* CONFIG_WITH_ALLOCATION_POLICY = R"(
+        [general]
+        version = 1
+
+        [[segment]]
+
+        [[segment.mempool]]
+        size = 128
+        count = 10
+
+        [[segment]]
+        allocation-policy = "spill-to-any-larger"
+
+        [[segment.mempool]]
+        size = 128
+        count = 10
+    )";
+
+    std::istringstream stream(CONFIG_WITH_ALLOCATION_POLICY);
+    auto result = iox::config::TomlRouDiConfigFileProvider::parse(stream);
+
+    ASSERT_FALSE(result.has_error());
+    ASSERT_EQ(result.value().m_sharedMemorySegments.size(), 2U);
+    EXPECT_EQ(result.value().m_sharedMemorySegments[0].m_mempoolConfig.m_allocationPolicy,
+              iox::mepoo::MemPoolAllocationPolicy::STRICT_BEST_FIT);
+    EXPECT_EQ(result.value().m_sharedMemorySegments[1].m_mempoolConfig.m_allocationPolicy,
+              iox::mepoo::MemPoolAllocationPolicy::SPILL_TO_ANY_LARGER);
+}
+
+TEST_F(RoudiConfigTomlFileProvider_test, ParsingChunkCacheCapacityIsSuccessful)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "cf88b3f1-7ff4-4b12-9e16-6cfb6401729b");
+    constexpr const char* CONFIG_WITH_CHUNK_CACHE_CAPACITY = R"(
+        [general]
+        version = 1
+
+        [[segment]]
+
+        [[segment.mempool]]
+        size = 128
+        count = 10
+
+        [[segment]]
+        chunk-cache-capacity = 32
+
+        [[segment.mempool]]
+        size = 128
+        count = 10
+    )";
+
+    std::istringstream stream(CONFIG_WITH_CHUNK_CACHE_CAPACITY);
+    auto result = iox::config::TomlRouDiConfigFileProvider::parse(stream);
+
+    ASSERT_FALSE(result.has_error());
+    ASSERT_EQ(result.value().m_sharedMemorySegments.size(), 2U);
+    EXPECT_EQ(result.value().m_sharedMemorySegments[0].m_mempoolConfig.m_chunkCacheCapacity, 0U);
+    EXPECT_EQ(result.value().m_sharedMemorySegments[1].m_mempoolConfig.m_chunkCacheCapacity, 32U);
+}
+
+TEST_F(RoudiConfigTomlFileProvider_test, ParsingHugePageConfigAndNumaNodeIsSuccessful)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "03c8ac97-cbd3-4793-b656-c6ad54ef09e9");
+    constexpr const char* CONFIG_WITH_HUGE_PAGES = R"(
+        [general]
+        version = 1
+
+        [[segment]]
+
+        [[segment.mempool]]
+        size = 128
+        count = 10
+
+        [[segment]]
+        huge-page-mount-point = "/dev/hugepages"
+        numa-node = 1
+
+        [[segment.mempool]]
+        size = 128
+        count = 10
+
+        [[segment]]
+        huge-page-mount-point = "/mnt/huge1G"
+        huge-page-size = 1073741824
+
+        [[segment.mempool]]
+        size = 128
+        count = 10
+    )";
+
+    std::istringstream stream(CONFIG_WITH_HUGE_PAGES);
+    auto result = iox::config::TomlRouDiConfigFileProvider::parse(stream);
+
+    ASSERT_FALSE(result.has_error());
+    const auto& segments = result.value().m_sharedMemorySegments;
+    ASSERT_EQ(segments.size(), 3U);
+
+    EXPECT_FALSE(segments[0].m_hugePageConfig.has_value());
+    EXPECT_FALSE(segments[0].m_numaNode.has_value());
+
+    ASSERT_TRUE(segments[1].m_hugePageConfig.has_value());
+    EXPECT_EQ(segments[1].m_hugePageConfig->m_mountPoint, iox::Path::create("/dev/hugepages").value());
+    EXPECT_EQ(segments[1].m_hugePageConfig->m_pageSize, iox::mepoo::HugePageConfig::DEFAULT_PAGE_SIZE);
+    ASSERT_TRUE(segments[1].m_numaNode.has_value());
+    EXPECT_EQ(segments[1].m_numaNode.value(), 1U);
+
+    ASSERT_TRUE(segments[2].m_hugePageConfig.has_value());
+    EXPECT_EQ(segments[2].m_hugePageConfig->m_mountPoint, iox::Path::create("/mnt/huge1G").value());
+    EXPECT_EQ(segments[2].m_hugePageConfig->m_pageSize, 1073741824U);
+    EXPECT_FALSE(segments[2].m_numaNode.has_value());
+}
+
 constexpr const char* CONFIG_NO_GENERAL_SECTION = R"(
     [[segment]]
 
@@ -186,6 +300,43 @@ constexpr const char* CONFIG_MEMPOOL_WITHOUT_CHUNK_COUNT = R"(
     size = 128
 )";
 
+constexpr const char* CONFIG_INVALID_MEMPOOL_ALLOCATION_POLICY = R"(
+    [general]
+    version = 1
+
+    [[segment]]
+    allocation-policy = "spill-to-nowhere"
+
+    [[segment.mempool]]
+    size = 128
+    count = 10000
+)";
+
+constexpr const char* CONFIG_HUGE_PAGE_SIZE_WITHOUT_MOUNT_POINT = R"(
+    [general]
+    version = 1
+
+    [[segment]]
+    huge-page-size = 2097152
+
+    [[segment.mempool]]
+    size = 128
+    count = 10000
+)";
+
+constexpr const char* CONFIG_HUGE_PAGE_SIZE_NOT_POWER_OF_TWO = R"(
+    [general]
+    version = 1
+
+    [[segment]]
+    huge-page-mount-point = "/dev/hugepages"
+    huge-page-size = 3000000
+
+    [[segment.mempool]]
+    size = 128
+    count = 10000
+)";
+
 constexpr const char* CONFIG_EXCEPTION_IN_PARSER = R"(🐔)";
 
 INSTANTIATE_TEST_SUITE_P(
@@ -205,6 +356,12 @@ INSTANTIATE_TEST_SUITE_P(
                                  CONFIG_MEMPOOL_WITHOUT_CHUNK_SIZE},
            ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::MEMPOOL_WITHOUT_CHUNK_COUNT,
                                  CONFIG_MEMPOOL_WITHOUT_CHUNK_COUNT},
+           ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::INVALID_MEMPOOL_ALLOCATION_POLICY,
+                                 CONFIG_INVALID_MEMPOOL_ALLOCATION_POLICY},
+           ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::INVALID_HUGE_PAGE_CONFIG,
+                                 CONFIG_HUGE_PAGE_SIZE_WITHOUT_MOUNT_POINT},
+           ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::INVALID_HUGE_PAGE_CONFIG,
+                                 CONFIG_HUGE_PAGE_SIZE_NOT_POWER_OF_TWO},
            ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::EXCEPTION_IN_PARSER,
                                  CONFIG_EXCEPTION_IN_PARSER}));
 
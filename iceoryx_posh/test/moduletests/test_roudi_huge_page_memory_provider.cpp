@@ -0,0 +1,174 @@
+// Copyright (c) 2026 by agent <agent@local>. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#if !defined(_WIN32)
+#include "iceoryx_posh/roudi/memory/huge_page_memory_provider.hpp"
+
+#include "iceoryx_hoofs/internal/posix_wrapper/system_configuration.hpp"
+#include "iceoryx_platform/platform_settings.hpp"
+
+#include "mocks/roudi_memory_block_mock.hpp"
+
+#include "test.hpp"
+
+namespace
+{
+using namespace ::testing;
+
+using namespace iox::roudi;
+
+using iox::ShmName_t;
+static const ShmName_t TEST_SHM_NAME = ShmName_t("FuManchuOnHugePages");
+
+/// @note there is no hugetlbfs mount point available on every test machine; the temp directory with the regular page
+/// size exercises the same code paths
+class HugePageMemoryProvider_Test : public Test
+{
+  public:
+    void SetUp() override
+    {
+        /// @note just in the case a test left something behind we remove the shared memory if it exists
+        IOX_DISCARD_RESULT(iox::posix::SharedMemory::unlinkIfExist(TEST_SHM_NAME, hugePageConfig.m_mountPoint));
+    }
+
+    void TearDown() override
+    {
+    }
+
+    static iox::mepoo::HugePageConfig createHugePageConfig()
+    {
+        return iox::mepoo::HugePageConfig{
+            iox::Path::create(iox::platform::IOX_TEMP_DIR).expect("valid mount point"), iox::internal::pageSize()};
+    }
+
+    bool shmExistsInMountPoint()
+    {
+        return !iox::posix::SharedMemoryObjectBuilder()
+                    .name(TEST_SHM_NAME)
+                    .memorySizeInBytes(8)
+                    .accessMode(iox::posix::AccessMode::READ_ONLY)
+                    .openMode(iox::posix::OpenMode::OPEN_EXISTING)
+                    .permissions(iox::perms::owner_all)
+                    .directory(hugePageConfig.m_mountPoint)
+                    .create()
+                    .has_error();
+    }
+
+    iox::mepoo::HugePageConfig hugePageConfig{createHugePageConfig()};
+    MemoryBlockMock memoryBlock1;
+};
+
+TEST_F(HugePageMemoryProvider_Test, CreateMemoryCreatesSharedMemoryInMountPoint)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0207bce4-2653-4601-a430-ba8a5a9638df");
+    HugePageMemoryProvider sut(
+        TEST_SHM_NAME, hugePageConfig, iox::posix::AccessMode::READ_WRITE, iox::posix::OpenMode::PURGE_AND_CREATE);
+    ASSERT_FALSE(sut.addMemoryBlock(&memoryBlock1).has_error());
+    uint64_t MEMORY_SIZE{16};
+    uint64_t MEMORY_ALIGNMENT{8};
+    EXPECT_CALL(memoryBlock1, size()).WillRepeatedly(Return(MEMORY_SIZE));
+    EXPECT_CALL(memoryBlock1, alignment()).WillRepeatedly(Return(MEMORY_ALIGNMENT));
+
+    EXPECT_THAT(sut.create().has_error(), Eq(false));
+
+    EXPECT_THAT(shmExistsInMountPoint(), Eq(true));
+
+    EXPECT_CALL(memoryBlock1, destroy());
+}
+
+TEST_F(HugePageMemoryProvider_Test, CreatedMemoryIsZeroedAndWritable)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "78c5aed0-a5e5-4ce0-b615-28d477f85ddf");
+    HugePageMemoryProvider sut(
+        TEST_SHM_NAME, hugePageConfig, iox::posix::AccessMode::READ_WRITE, iox::posix::OpenMode::PURGE_AND_CREATE);
+    ASSERT_FALSE(sut.addMemoryBlock(&memoryBlock1).has_error());
+    const uint64_t MEMORY_SIZE{3U * hugePageConfig.m_pageSize + 16U};
+    uint64_t MEMORY_ALIGNMENT{8};
+    EXPECT_CALL(memoryBlock1, size()).WillRepeatedly(Return(MEMORY_SIZE));
+    EXPECT_CALL(memoryBlock1, alignment()).WillRepeatedly(Return(MEMORY_ALIGNMENT));
+
+    ASSERT_FALSE(sut.create().has_error());
+
+    auto* memory = static_cast<uint8_t*>(memoryBlock1.memory().value());
+    for (uint64_t i = 0U; i < MEMORY_SIZE; ++i)
+    {
+        ASSERT_THAT(memory[i], Eq(0U));
+        memory[i] = 42U;
+    }
+
+    EXPECT_CALL(memoryBlock1, destroy());
+}
+
+TEST_F(HugePageMemoryProvider_Test, DestroyMemoryRemovesSharedMemoryFromMountPoint)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5c499900-21bf-4cc6-b59e-cd11b366d0ab");
+    HugePageMemoryProvider sut(
+        TEST_SHM_NAME, hugePageConfig, iox::posix::AccessMode::READ_WRITE, iox::posix::OpenMode::PURGE_AND_CREATE);
+    ASSERT_FALSE(sut.addMemoryBlock(&memoryBlock1).has_error());
+    uint64_t MEMORY_SIZE{16};
+    uint64_t MEMORY_ALIGNMENT{8};
+    EXPECT_CALL(memoryBlock1, size()).WillRepeatedly(Return(MEMORY_SIZE));
+    EXPECT_CALL(memoryBlock1, alignment()).WillRepeatedly(Return(MEMORY_ALIGNMENT));
+
+    ASSERT_FALSE(sut.create().has_error());
+
+    EXPECT_CALL(memoryBlock1, destroy());
+
+    ASSERT_FALSE(sut.destroy().has_error());
+
+    EXPECT_THAT(shmExistsInMountPoint(), Eq(false));
+}
+
+TEST_F(HugePageMemoryProvider_Test, CreationFailedWithAlignmentExceedingHugePageSize)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "21cefe95-7b65-4b73-b395-d14d833407ea");
+    HugePageMemoryProvider sut(
+        TEST_SHM_NAME, hugePageConfig, iox::posix::AccessMode::READ_WRITE, iox::posix::OpenMode::PURGE_AND_CREATE);
+    ASSERT_FALSE(sut.addMemoryBlock(&memoryBlock1).has_error());
+    uint64_t MEMORY_SIZE{16};
+    uint64_t MEMORY_ALIGNMENT{hugePageConfig.m_pageSize + 8U};
+    EXPECT_CALL(memoryBlock1, size()).WillRepeatedly(Return(MEMORY_SIZE));
+    EXPECT_CALL(memoryBlock1, alignment()).WillRepeatedly(Return(MEMORY_ALIGNMENT));
+
+    auto expectFailed = sut.create();
+    ASSERT_THAT(expectFailed.has_error(), Eq(true));
+    ASSERT_THAT(expectFailed.get_error(), Eq(MemoryProviderError::MEMORY_ALIGNMENT_EXCEEDS_PAGE_SIZE));
+
+    EXPECT_THAT(shmExistsInMountPoint(), Eq(false));
+}
+
+TEST_F(HugePageMemoryProvider_Test, CreateMemoryWithFailingNumaBindingStillSucceeds)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "70cd490d-281e-4d56-9245-61ebe6126a6e");
+    constexpr uint32_t NOT_EXISTING_NUMA_NODE{1000000U};
+    HugePageMemoryProvider sut(TEST_SHM_NAME,
+                               hugePageConfig,
+                               iox::posix::AccessMode::READ_WRITE,
+                               iox::posix::OpenMode::PURGE_AND_CREATE,
+                               NOT_EXISTING_NUMA_NODE);
+    ASSERT_FALSE(sut.addMemoryBlock(&memoryBlock1).has_error());
+    uint64_t MEMORY_SIZE{16};
+    uint64_t MEMORY_ALIGNMENT{8};
+    EXPECT_CALL(memoryBlock1, size()).WillRepeatedly(Return(MEMORY_SIZE));
+    EXPECT_CALL(memoryBlock1, alignment()).WillRepeatedly(Return(MEMORY_ALIGNMENT));
+
+    EXPECT_THAT(sut.create().has_error(), Eq(false));
+
+    EXPECT_CALL(memoryBlock1, destroy());
+}
+
+} // namespace
+#endif
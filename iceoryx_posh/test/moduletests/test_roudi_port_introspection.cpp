@@ -443,6 +443,106 @@ TEST_F(PortIntrospection_test, addAndRemoveSubscriber)
 }
 
 
+TEST_F(PortIntrospection_test, ThroughputDataContainsRecycledChunkCounters)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "721efb68-0ec2-40ea-86c2-a14ec4cfd5b3");
+    using Topic = iox::roudi::PortThroughputIntrospectionFieldTopic;
+    constexpr uint64_t RECYCLED_CHUNK_HITS{13U};
+    constexpr uint64_t RECYCLED_CHUNK_MISSES{37U};
+
+    auto chunk = std::unique_ptr<ChunkMock<Topic>>(new ChunkMock<Topic>);
+
+    iox::mepoo::MemoryManager memoryManager;
+    iox::popo::PublisherPortData portData(
+        {"Ferdinand", "Spitz", "Schnuppi"}, "Hypnotoad", &memoryManager, iox::popo::PublisherOptions());
+    portData.m_chunkSenderData.m_recycledChunkHits = RECYCLED_CHUNK_HITS;
+    portData.m_chunkSenderData.m_recycledChunkMisses = RECYCLED_CHUNK_MISSES;
+    ASSERT_THAT(m_introspectionAccess.addPublisher(portData), Eq(true));
+
+    EXPECT_CALL(m_introspectionAccess.getPublisherPortThroughput().value(), tryAllocateChunk(_, _, _, _))
+        .WillRepeatedly(Return(iox::expected<iox::mepoo::ChunkHeader*, iox::popo::AllocationError>::create_value(
+            chunk.get()->chunkHeader())));
+
+    bool chunkWasSent = false;
+    EXPECT_CALL(m_introspectionAccess.getPublisherPortThroughput().value(), sendChunk(_))
+        .WillRepeatedly(Invoke([&](iox::mepoo::ChunkHeader* const) { chunkWasSent = true; }));
+
+    m_introspectionAccess.sendThroughputData();
+
+    ASSERT_THAT(chunkWasSent, Eq(true));
+    ASSERT_THAT(chunk->sample()->m_throughputList.size(), Eq(1U));
+    auto& throughputData = chunk->sample()->m_throughputList[0];
+    EXPECT_THAT(throughputData.m_publisherPortID, Eq(static_cast<uint64_t>(portData.m_uniqueId)));
+    EXPECT_THAT(throughputData.m_recycledChunkHits, Eq(RECYCLED_CHUNK_HITS));
+    EXPECT_THAT(throughputData.m_recycledChunkMisses, Eq(RECYCLED_CHUNK_MISSES));
+
+    chunk->sample()->~PortThroughputIntrospectionFieldTopic();
+}
+
+TEST_F(PortIntrospection_test, ThroughputDataContainsSendStatisticsAndRates)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "87ba8294-7a41-4570-a289-35e18e2d572e");
+    using Topic = iox::roudi::PortThroughputIntrospectionFieldTopic;
+    constexpr uint64_t SENT_CHUNKS{11U};
+    constexpr uint64_t SENT_BYTES{1100U};
+    constexpr uint64_t ADDITIONAL_SENT_CHUNKS{4U};
+    constexpr uint32_t USER_PAYLOAD_SIZE{100U};
+    constexpr uint32_t CHUNK_SIZE{192U};
+    constexpr uint64_t FIRST_SEND_TIMESTAMP{1000U};
+    constexpr uint64_t LAST_SEND_TIMESTAMP{6000U};
+    constexpr uint64_t LAST_SEND_INTERVAL{300U};
+    constexpr uint64_t LOST_CHUNKS{2U};
+
+    auto chunk = std::unique_ptr<ChunkMock<Topic>>(new ChunkMock<Topic>);
+
+    iox::mepoo::MemoryManager memoryManager;
+    iox::popo::PublisherOptions options;
+    options.historyCapacity = 1U;
+    iox::popo::PublisherPortData portData({"Ferdinand", "Spitz", "Schnuppi"}, "Hypnotoad", &memoryManager, options);
+    auto& chunkSenderData = portData.m_chunkSenderData;
+    chunkSenderData.m_sentChunks = SENT_CHUNKS;
+    chunkSenderData.m_sentUserPayloadBytes = SENT_BYTES;
+    chunkSenderData.m_lastUserPayloadSize = USER_PAYLOAD_SIZE;
+    chunkSenderData.m_lastChunkSize = CHUNK_SIZE;
+    chunkSenderData.m_firstSendTimestamp = FIRST_SEND_TIMESTAMP;
+    chunkSenderData.m_lastSendTimestamp = LAST_SEND_TIMESTAMP;
+    chunkSenderData.m_lastSendIntervalInNanoseconds = LAST_SEND_INTERVAL;
+    chunkSenderData.m_lostChunks = LOST_CHUNKS;
+    ASSERT_THAT(m_introspectionAccess.addPublisher(portData), Eq(true));
+
+    EXPECT_CALL(m_introspectionAccess.getPublisherPortThroughput().value(), tryAllocateChunk(_, _, _, _))
+        .WillRepeatedly(Return(iox::expected<iox::mepoo::ChunkHeader*, iox::popo::AllocationError>::create_value(
+            chunk.get()->chunkHeader())));
+    EXPECT_CALL(m_introspectionAccess.getPublisherPortThroughput().value(), sendChunk(_)).Times(2);
+
+    m_introspectionAccess.sendThroughputData();
+
+    ASSERT_THAT(chunk->sample()->m_throughputList.size(), Eq(1U));
+    auto& throughputData = chunk->sample()->m_throughputList[0];
+    EXPECT_THAT(throughputData.m_sentChunks, Eq(SENT_CHUNKS));
+    EXPECT_THAT(throughputData.m_sentBytes, Eq(SENT_BYTES));
+    EXPECT_THAT(throughputData.m_sampleSize, Eq(USER_PAYLOAD_SIZE));
+    EXPECT_THAT(throughputData.m_chunkSize, Eq(CHUNK_SIZE));
+    EXPECT_THAT(throughputData.m_lastSendIntervalInNanoseconds, Eq(LAST_SEND_INTERVAL));
+    EXPECT_THAT(throughputData.m_averageSendIntervalInNanoseconds,
+                Eq((LAST_SEND_TIMESTAMP - FIRST_SEND_TIMESTAMP) / (SENT_CHUNKS - 1U)));
+    EXPECT_THAT(throughputData.m_lostChunks, Eq(LOST_CHUNKS));
+    EXPECT_THAT(throughputData.m_isField, Eq(true));
+    // there is no previous sample to compute the rates from
+    EXPECT_THAT(throughputData.m_chunksPerMinute, Eq(0.0));
+    EXPECT_THAT(throughputData.m_bytesPerSecond, Eq(0.0));
+    chunk->sample()->~PortThroughputIntrospectionFieldTopic();
+
+    chunkSenderData.m_sentChunks = SENT_CHUNKS + ADDITIONAL_SENT_CHUNKS;
+    chunkSenderData.m_sentUserPayloadBytes = SENT_BYTES + ADDITIONAL_SENT_CHUNKS * USER_PAYLOAD_SIZE;
+    m_introspectionAccess.sendThroughputData();
+
+    ASSERT_THAT(chunk->sample()->m_throughputList.size(), Eq(1U));
+    EXPECT_THAT(chunk->sample()->m_throughputList[0].m_chunksPerMinute, Gt(0.0));
+    EXPECT_THAT(chunk->sample()->m_throughputList[0].m_bytesPerSecond, Gt(0.0));
+    chunk->sample()->~PortThroughputIntrospectionFieldTopic();
+}
+
 TEST_F(PortIntrospection_test, Thread)
 {
     ::testing::Test::RecordProperty("TEST_ID", "ae5b252d-0060-4bb7-a193-0c2ae0ebbb7a");
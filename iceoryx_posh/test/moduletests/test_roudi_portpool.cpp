@@ -325,6 +325,40 @@ TEST_F(PortPool_test, RemovePublisherPortIsSuccessful)
     EXPECT_EQ(publisherPortDataList.size(), 0U);
 }
 
+TEST_F(PortPool_test, GetPublisherPortDataListWithServiceDescriptionReturnsOnlyMatchingPortsInCreationOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2bcb909c-a7ad-4582-94da-be3be9b303f6");
+    ServiceDescription otherServiceDescription{"service1", "instance1", "event2"};
+    auto firstPort = sut.addPublisherPort(m_serviceDescription, &m_memoryManager, m_applicationName, m_publisherOptions);
+    ASSERT_FALSE(
+        sut.addPublisherPort(otherServiceDescription, &m_memoryManager, m_applicationName, m_publisherOptions)
+            .has_error());
+    auto secondPort =
+        sut.addPublisherPort(m_serviceDescription, &m_memoryManager, m_applicationName, m_publisherOptions);
+
+    auto publisherPortDataList = sut.getPublisherPortDataList(m_serviceDescription);
+
+    ASSERT_EQ(publisherPortDataList.size(), 2U);
+    EXPECT_EQ(publisherPortDataList[0], firstPort.value());
+    EXPECT_EQ(publisherPortDataList[1], secondPort.value());
+}
+
+TEST_F(PortPool_test, GetPublisherPortDataListWithServiceDescriptionDoesNotReturnRemovedPorts)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7cd7fbfe-b446-45b8-a92a-60c409102e3c");
+    auto firstPort = sut.addPublisherPort(m_serviceDescription, &m_memoryManager, m_applicationName, m_publisherOptions);
+    auto secondPort =
+        sut.addPublisherPort(m_serviceDescription, &m_memoryManager, m_applicationName, m_publisherOptions);
+
+    sut.removePublisherPort(firstPort.value());
+    auto publisherPortDataList = sut.getPublisherPortDataList(m_serviceDescription);
+    ASSERT_EQ(publisherPortDataList.size(), 1U);
+    EXPECT_EQ(publisherPortDataList[0], secondPort.value());
+
+    sut.removePublisherPort(secondPort.value());
+    EXPECT_EQ(sut.getPublisherPortDataList(m_serviceDescription).size(), 0U);
+}
+
 // END PublisherPort tests
 
 // BEGIN SubscriberPort tests
@@ -451,6 +485,70 @@ TEST_F(PortPool_test, RemoveSubscriberPortIsSuccessful)
     EXPECT_EQ(subscriberPortDataList.size(), 0U);
 }
 
+TEST_F(PortPool_test, AddSubscriberPortWithoutLatencyHistogramDoesNotAcquireOne)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8d2f6b1e-4a73-4c9e-b5d0-3e7a9c1f2b64");
+    auto subscriberPort = sut.addSubscriberPort(m_serviceDescription, m_applicationName, m_subscriberOptions);
+
+    ASSERT_FALSE(subscriberPort.has_error());
+    EXPECT_FALSE(subscriberPort.value()->m_chunkReceiverData.m_latencyHistogram);
+    EXPECT_EQ(m_portPoolData.m_latencyHistogramMembers.content().size(), 0U);
+}
+
+TEST_F(PortPool_test, AddSubscriberPortWithLatencyHistogramAcquiresOneFromThePool)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1c5e9a3f-7b20-4d68-8e4a-6f0b2d9c5a17");
+    m_subscriberOptions.recordLatencyHistogram = true;
+    auto subscriberPort = sut.addSubscriberPort(m_serviceDescription, m_applicationName, m_subscriberOptions);
+
+    ASSERT_FALSE(subscriberPort.has_error());
+    auto latencyHistograms = m_portPoolData.m_latencyHistogramMembers.content();
+    ASSERT_EQ(latencyHistograms.size(), 1U);
+    EXPECT_EQ(subscriberPort.value()->m_chunkReceiverData.m_latencyHistogram.get(), latencyHistograms[0]);
+}
+
+TEST_F(PortPool_test, AddSubscriberPortWithLatencyHistogramWhenHistogramsAreExhaustedSucceedsWithoutOne)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e6b3d8c2-0f49-4a15-9c7e-5a2d1b8f4e30");
+    m_subscriberOptions.recordLatencyHistogram = true;
+    for (uint32_t i = 0U; i < MAX_LATENCY_HISTOGRAMS; ++i)
+    {
+        ASSERT_FALSE(sut.addSubscriberPort(m_serviceDescription, m_applicationName, m_subscriberOptions).has_error());
+    }
+
+    auto subscriberPort = sut.addSubscriberPort(m_serviceDescription, m_applicationName, m_subscriberOptions);
+
+    ASSERT_FALSE(subscriberPort.has_error());
+    EXPECT_FALSE(subscriberPort.value()->m_chunkReceiverData.m_latencyHistogram);
+}
+
+TEST_F(PortPool_test, RemoveSubscriberPortReleasesItsLatencyHistogram)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4a9f2c7d-8e16-4b53-a0d4-9c3e6f1b7a28");
+    m_subscriberOptions.recordLatencyHistogram = true;
+    auto subscriberPort = sut.addSubscriberPort(m_serviceDescription, m_applicationName, m_subscriberOptions);
+    ASSERT_FALSE(subscriberPort.has_error());
+
+    sut.removeSubscriberPort(subscriberPort.value());
+
+    EXPECT_EQ(m_portPoolData.m_latencyHistogramMembers.content().size(), 0U);
+}
+
+TEST_F(PortPool_test, GetSubscriberPortDataListWithServiceDescriptionReturnsOnlyMatchingPorts)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f33c40da-b994-4858-aacd-8e3bb8a64d5b");
+    ServiceDescription otherServiceDescription{"service2", "instance1", "event1"};
+    auto subscriberPort = sut.addSubscriberPort(m_serviceDescription, m_applicationName, m_subscriberOptions);
+    ASSERT_FALSE(sut.addSubscriberPort(otherServiceDescription, m_applicationName, m_subscriberOptions).has_error());
+
+    auto subscriberPortDataList = sut.getSubscriberPortDataList(m_serviceDescription);
+    ASSERT_EQ(subscriberPortDataList.size(), 1U);
+    EXPECT_EQ(subscriberPortDataList[0], subscriberPort.value());
+
+    sut.removeSubscriberPort(subscriberPort.value());
+    EXPECT_EQ(sut.getSubscriberPortDataList(m_serviceDescription).size(), 0U);
+}
+
 // END SubscriberPort tests
 
 // BEGIN ClientPort tests
@@ -845,4 +943,57 @@ TEST_F(PortPool_test, RemoveConditionVariableDataIsSuccessful)
 
 // END ConditionVariable tests
 
+// BEGIN Heartbeat tests
+
+TEST_F(PortPool_test, AddHeartbeatIsSuccessful)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7202fa4d-fc0b-4e01-bee8-9cfa1fee4067");
+    auto heartbeat = sut.addHeartbeat(m_applicationName);
+
+    ASSERT_FALSE(heartbeat.has_error());
+    EXPECT_EQ(sut.getHeartbeatList().size(), 1U);
+}
+
+TEST_F(PortPool_test, AddHeartbeatWhenHeartbeatListOverflowsReturnsError)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a176dd2c-a7fa-4d16-8487-3ba418de5a93");
+    for (uint32_t i = 0U; i < MAX_PROCESS_NUMBER; ++i)
+    {
+        ASSERT_FALSE(sut.addHeartbeat(m_applicationName).has_error());
+    }
+
+    auto errorHandlerCalled{false};
+    PoshError error{PoshError::NO_ERROR};
+    auto errorHandlerGuard =
+        ErrorHandlerMock::setTemporaryErrorHandler<iox::PoshError>([&](const auto e, const ErrorLevel) {
+            error = e;
+            errorHandlerCalled = true;
+        });
+    auto heartbeat = sut.addHeartbeat(m_applicationName);
+
+    ASSERT_TRUE(heartbeat.has_error());
+    EXPECT_EQ(heartbeat.get_error(), roudi::PortPoolError::HEARTBEAT_LIST_FULL);
+    ASSERT_TRUE(errorHandlerCalled);
+    EXPECT_EQ(error, PoshError::PORT_POOL__HEARTBEAT_LIST_OVERFLOW);
+}
+
+TEST_F(PortPool_test, GetHeartbeatListWhenEmptyIsSuccessful)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1c4428ed-7986-47ad-8eca-6260b3c69fdd");
+    EXPECT_EQ(sut.getHeartbeatList().size(), 0U);
+}
+
+TEST_F(PortPool_test, RemoveHeartbeatIsSuccessful)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0d9ef04f-9c95-492f-9101-d60082dad263");
+    auto heartbeat = sut.addHeartbeat(m_applicationName);
+    ASSERT_FALSE(heartbeat.has_error());
+
+    sut.removeHeartbeat(heartbeat.value());
+
+    EXPECT_EQ(sut.getHeartbeatList().size(), 0U);
+}
+
+// END Heartbeat tests
+
 } // namespace
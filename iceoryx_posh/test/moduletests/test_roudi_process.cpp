@@ -18,6 +18,7 @@
 #include "iceoryx_platform/types.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/roudi/process.hpp"
+#include "iceoryx_posh/internal/runtime/heartbeat.hpp"
 #include "iceoryx_posh/mepoo/mepoo_config.hpp"
 #include "iceoryx_posh/roudi/memory/roudi_memory_interface.hpp"
 #include "iceoryx_posh/version/compatibility_check_level.hpp"
@@ -36,7 +37,7 @@ class IpcInterfaceUser_Mock : public iox::roudi::Process
 {
   public:
     IpcInterfaceUser_Mock()
-        : iox::roudi::Process("TestProcess", 200, PosixUser("foo"), true, 255)
+        : iox::roudi::Process("TestProcess", 200, PosixUser("foo"), nullptr, 255, IpcProtocol::TEXT)
     {
     }
     MOCK_METHOD1(sendViaIpcChannel, void(IpcMessage));
@@ -49,7 +50,7 @@ class Process_test : public Test
     const iox::RuntimeName_t processname = {"TestProcess"};
     uint32_t pid{200U};
     PosixUser user{"foo"};
-    bool isMonitored = true;
+    Heartbeat heartbeat;
     const uint64_t dataSegmentId{0x654321U};
     const uint64_t sessionId{255U};
     IpcInterfaceUser_Mock ipcInterfaceUserMock;
@@ -58,28 +59,35 @@ class Process_test : public Test
 TEST_F(Process_test, getPid)
 {
     ::testing::Test::RecordProperty("TEST_ID", "fbe9ea27-9e23-4ec7-bfe6-e2563d42c5e7");
-    Process roudiproc(processname, pid, user, isMonitored, sessionId);
+    Process roudiproc(processname, pid, user, &heartbeat, sessionId, IpcProtocol::TEXT);
     EXPECT_THAT(roudiproc.getPid(), Eq(pid));
 }
 
 TEST_F(Process_test, getName)
 {
     ::testing::Test::RecordProperty("TEST_ID", "c2f3df1d-0aa9-480e-8c2e-dd76960a7717");
-    Process roudiproc(processname, pid, user, isMonitored, sessionId);
+    Process roudiproc(processname, pid, user, &heartbeat, sessionId, IpcProtocol::TEXT);
     EXPECT_THAT(roudiproc.getName(), Eq(processname));
 }
 
-TEST_F(Process_test, isMonitored)
+TEST_F(Process_test, isMonitoredWithHeartbeat)
 {
     ::testing::Test::RecordProperty("TEST_ID", "6d926282-c8f4-4b9c-a086-acc62e102c72");
-    Process roudiproc(processname, pid, user, isMonitored, sessionId);
-    EXPECT_THAT(roudiproc.isMonitored(), Eq(isMonitored));
+    Process roudiproc(processname, pid, user, &heartbeat, sessionId, IpcProtocol::TEXT);
+    EXPECT_TRUE(roudiproc.isMonitored());
+}
+
+TEST_F(Process_test, isNotMonitoredWithoutHeartbeat)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "669b0d03-fb0b-421a-9be7-2720d512049a");
+    Process roudiproc(processname, pid, user, nullptr, sessionId, IpcProtocol::TEXT);
+    EXPECT_FALSE(roudiproc.isMonitored());
 }
 
 TEST_F(Process_test, getSessionId)
 {
     ::testing::Test::RecordProperty("TEST_ID", "6986a49c-e23b-4cd6-ab63-269b32ff8d92");
-    Process roudiproc(processname, pid, user, isMonitored, sessionId);
+    Process roudiproc(processname, pid, user, &heartbeat, sessionId, IpcProtocol::TEXT);
     EXPECT_THAT(roudiproc.getSessionId(), Eq(sessionId));
 }
 
@@ -102,7 +110,7 @@ TEST_F(Process_test, sendViaIpcChannelFail)
             EXPECT_THAT(errorLevel, Eq(iox::ErrorLevel::MODERATE));
         });
 
-    Process roudiproc(processname, pid, user, isMonitored, sessionId);
+    Process roudiproc(processname, pid, user, &heartbeat, sessionId, IpcProtocol::TEXT);
     roudiproc.sendViaIpcChannel(data);
 
     ASSERT_THAT(sendViaIpcChannelStatusFail.has_value(), Eq(true));
@@ -110,13 +118,25 @@ TEST_F(Process_test, sendViaIpcChannelFail)
                 Eq(iox::PoshError::POSH__ROUDI_PROCESS_SEND_VIA_IPC_CHANNEL_FAILED));
 }
 
-TEST_F(Process_test, TimeStamp)
+TEST_F(Process_test, getHeartbeatReturnsHeartbeatFromConstruction)
 {
     ::testing::Test::RecordProperty("TEST_ID", "5b527de2-699e-4d35-86ee-10ed28498e88");
-    auto timestmp = iox::mepoo::BaseClock_t::now();
-    Process roudiproc(processname, pid, user, isMonitored, sessionId);
-    roudiproc.setTimestamp(timestmp);
-    EXPECT_THAT(roudiproc.getTimestamp(), Eq(timestmp));
+    Process roudiproc(processname, pid, user, &heartbeat, sessionId, IpcProtocol::TEXT);
+    EXPECT_THAT(roudiproc.getHeartbeat(), Eq(&heartbeat));
+}
+
+TEST_F(Process_test, getHeartbeatOfUnmonitoredProcessReturnsNullptr)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d94300a2-b484-4972-b28d-b630b4d344d1");
+    Process roudiproc(processname, pid, user, nullptr, sessionId, IpcProtocol::TEXT);
+    EXPECT_THAT(roudiproc.getHeartbeat(), Eq(nullptr));
+}
+
+TEST_F(Process_test, getIpcProtocolReturnsProtocolFromConstruction)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b5ecbb8d-82d2-45d7-9919-37167922eca9");
+    Process roudiproc(processname, pid, user, &heartbeat, sessionId, IpcProtocol::BINARY);
+    EXPECT_THAT(roudiproc.getIpcProtocol(), Eq(IpcProtocol::BINARY));
 }
 
 } // namespace
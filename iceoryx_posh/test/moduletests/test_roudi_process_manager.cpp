@@ -59,6 +59,7 @@ class ProcessManager_test : public Test
     PosixUser m_user{iox::posix::PosixUser::getUserOfCurrentProcess().getName()};
     const bool m_isMonitored{true};
     VersionInfo m_versionInfo{42U, 42U, 42U, 42U, "Foo", "Bar"};
+    const iox::runtime::IpcProtocol m_ipcProtocol{iox::runtime::IpcProtocol::TEXT};
 
     IpcInterfaceCreator m_processIpcInterface{m_processname};
     ProcessIntrospectionType m_processIntrospection;
@@ -72,7 +73,8 @@ class ProcessManager_test : public Test
 TEST_F(ProcessManager_test, RegisterProcessWithMonitorningWorks)
 {
     ::testing::Test::RecordProperty("TEST_ID", "57311fb6-f993-4011-bbe9-e42df5e54d5e");
-    auto result = m_sut->registerProcess(m_processname, m_pid, m_user, m_isMonitored, 1U, 1U, m_versionInfo);
+    auto result = m_sut->registerProcess(m_processname, m_pid, m_user, m_isMonitored, 1U, 1U, m_versionInfo,
+                                         m_ipcProtocol);
 
     EXPECT_TRUE(result);
 }
@@ -81,7 +83,8 @@ TEST_F(ProcessManager_test, RegisterProcessWithoutMonitoringWorks)
 {
     ::testing::Test::RecordProperty("TEST_ID", "ce0fcf0e-564c-4330-86c8-13b33c2a64c8");
     constexpr bool isNotMonitored{false};
-    auto result = m_sut->registerProcess(m_processname, m_pid, m_user, isNotMonitored, 1U, 1U, m_versionInfo);
+    auto result = m_sut->registerProcess(m_processname, m_pid, m_user, isNotMonitored, 1U, 1U, m_versionInfo,
+                                         m_ipcProtocol);
 
     EXPECT_TRUE(result);
 }
@@ -89,8 +92,10 @@ TEST_F(ProcessManager_test, RegisterProcessWithoutMonitoringWorks)
 TEST_F(ProcessManager_test, RegisterSameProcessTwiceWithMonitoringWorks)
 {
     ::testing::Test::RecordProperty("TEST_ID", "d449513c-2f8f-4b77-b419-8d1b5743f02d");
-    auto result1 = m_sut->registerProcess(m_processname, m_pid, m_user, m_isMonitored, 1U, 1U, m_versionInfo);
-    auto result2 = m_sut->registerProcess(m_processname, m_pid, m_user, m_isMonitored, 1U, 1U, m_versionInfo);
+    auto result1 = m_sut->registerProcess(m_processname, m_pid, m_user, m_isMonitored, 1U, 1U, m_versionInfo,
+                                          m_ipcProtocol);
+    auto result2 = m_sut->registerProcess(m_processname, m_pid, m_user, m_isMonitored, 1U, 1U, m_versionInfo,
+                                          m_ipcProtocol);
 
     EXPECT_TRUE(result1);
     EXPECT_TRUE(result2);
@@ -100,8 +105,10 @@ TEST_F(ProcessManager_test, RegisterSameProcessTwiceWithoutMonitoringWorks)
 {
     ::testing::Test::RecordProperty("TEST_ID", "08d16887-72e5-4934-8447-a3b4760444e1");
     constexpr bool isNotMonitored{false};
-    auto result1 = m_sut->registerProcess(m_processname, m_pid, m_user, isNotMonitored, 1U, 1U, m_versionInfo);
-    auto result2 = m_sut->registerProcess(m_processname, m_pid, m_user, isNotMonitored, 1U, 1U, m_versionInfo);
+    auto result1 = m_sut->registerProcess(m_processname, m_pid, m_user, isNotMonitored, 1U, 1U, m_versionInfo,
+                                          m_ipcProtocol);
+    auto result2 = m_sut->registerProcess(m_processname, m_pid, m_user, isNotMonitored, 1U, 1U, m_versionInfo,
+                                          m_ipcProtocol);
 
     EXPECT_TRUE(result1);
     EXPECT_TRUE(result2);
@@ -118,7 +125,7 @@ TEST_F(ProcessManager_test, UnregisterNonExistentProcessLeadsToError)
 TEST_F(ProcessManager_test, RegisterAndUnregisterWorks)
 {
     ::testing::Test::RecordProperty("TEST_ID", "335f1487-38ab-4526-9a83-a4b496139c34");
-    m_sut->registerProcess(m_processname, m_pid, m_user, m_isMonitored, 1U, 1U, m_versionInfo);
+    m_sut->registerProcess(m_processname, m_pid, m_user, m_isMonitored, 1U, 1U, m_versionInfo, m_ipcProtocol);
     auto unregisterResult = m_sut->unregisterProcess(m_processname);
 
     EXPECT_TRUE(unregisterResult);
@@ -127,7 +134,7 @@ TEST_F(ProcessManager_test, RegisterAndUnregisterWorks)
 TEST_F(ProcessManager_test, HandleProcessShutdownPreparationRequestWorks)
 {
     ::testing::Test::RecordProperty("TEST_ID", "741669ec-111b-494b-b243-d28510b07782");
-    m_sut->registerProcess(m_processname, m_pid, m_user, m_isMonitored, 1U, 1U, m_versionInfo);
+    m_sut->registerProcess(m_processname, m_pid, m_user, m_isMonitored, 1U, 1U, m_versionInfo, m_ipcProtocol);
 
     auto user = iox::posix::PosixUser::getUserOfCurrentProcess();
     auto payloadDataSegmentMemoryManager = m_roudiMemoryManager->segmentManager()
@@ -23,6 +23,7 @@
 #include "test.hpp"
 
 #include <chrono>
+#include <memory>
 #include <random>
 #include <vector>
 
@@ -704,4 +705,102 @@ TYPED_TEST(ServiceRegistry_test, FindWithMixOfPublishersAndServersWorks)
     EXPECT_EQ(filtered[1].serviceDescription, service3);
 }
 
+TYPED_TEST(ServiceRegistry_test, SearchWithSingleSpecifiedStringFindsAllMatchesInFullRegistry)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "607b4923-0256-420d-8438-d4d4885ef6cc");
+    constexpr uint64_t NUMBER_OF_INSTANCES{4U};
+    for (uint64_t i = 0U; i < CAPACITY; ++i)
+    {
+        ASSERT_FALSE(this->sut
+                         .add(ServiceDescription(
+                             "Foo",
+                             iox::into<iox::lossy<IdString_t>>(iox::cxx::convert::toString(i % NUMBER_OF_INSTANCES)),
+                             iox::into<iox::lossy<IdString_t>>(iox::cxx::convert::toString(i))))
+                         .has_error());
+    }
+
+    this->find(iox::capro::Wildcard, IdString_t("1"), iox::capro::Wildcard);
+    ASSERT_THAT(this->searchResult.size(), Eq(CAPACITY / NUMBER_OF_INSTANCES));
+    for (uint64_t i = 0U; i < this->searchResult.size(); ++i)
+    {
+        // the entries are found in the order in which they were added
+        EXPECT_THAT(this->searchResult[i].serviceDescription.getEventIDString(),
+                    Eq(iox::into<iox::lossy<IdString_t>>(
+                        iox::cxx::convert::toString(i * NUMBER_OF_INSTANCES + 1U))));
+    }
+
+    this->find(IdString_t("Foo"), iox::capro::Wildcard, IdString_t("42"));
+    ASSERT_THAT(this->searchResult.size(), Eq(1U));
+    EXPECT_THAT(this->searchResult[0].serviceDescription, Eq(ServiceDescription("Foo", "2", "42")));
+}
+
+TYPED_TEST(ServiceRegistry_test, RemovedEntriesAreNotFoundAndTheirSlotsAreReused)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "37080553-8940-43c6-a17e-024b720a5b9b");
+    for (uint64_t i = 0U; i < CAPACITY; ++i)
+    {
+        ASSERT_FALSE(this->sut
+                         .add(ServiceDescription(
+                             "Foo", "Bar", iox::into<iox::lossy<IdString_t>>(iox::cxx::convert::toString(i))))
+                         .has_error());
+    }
+
+    for (uint64_t i = 0U; i < CAPACITY; i += 2U)
+    {
+        this->sut.remove(
+            ServiceDescription("Foo", "Bar", iox::into<iox::lossy<IdString_t>>(iox::cxx::convert::toString(i))));
+    }
+    EXPECT_THAT(this->countServices(), Eq(CAPACITY / 2U));
+
+    this->find(IdString_t("Foo"), IdString_t("Bar"), IdString_t("0"));
+    EXPECT_THAT(this->searchResult.size(), Eq(0U));
+    this->find(IdString_t("Foo"), IdString_t("Bar"), IdString_t("1"));
+    EXPECT_THAT(this->searchResult.size(), Eq(1U));
+
+    for (uint64_t i = 0U; i < CAPACITY / 2U; ++i)
+    {
+        ASSERT_FALSE(this->sut
+                         .add(ServiceDescription(
+                             "Baz", "Bar", iox::into<iox::lossy<IdString_t>>(iox::cxx::convert::toString(i))))
+                         .has_error());
+    }
+    EXPECT_TRUE(this->sut.add(ServiceDescription("Baz", "Bar", "full")).has_error());
+
+    this->find(iox::capro::Wildcard, IdString_t("Bar"), iox::capro::Wildcard);
+    ASSERT_THAT(this->searchResult.size(), Eq(CAPACITY));
+    // the freed slots are reused from the front, the entries alternate therefore in slot order
+    EXPECT_THAT(this->searchResult[0].serviceDescription, Eq(ServiceDescription("Baz", "Bar", "0")));
+    EXPECT_THAT(this->searchResult[1].serviceDescription, Eq(ServiceDescription("Foo", "Bar", "1")));
+    EXPECT_THAT(this->searchResult[2].serviceDescription, Eq(ServiceDescription("Baz", "Bar", "1")));
+}
+
+TYPED_TEST(ServiceRegistry_test, CopiedRegistryFindsTheSameEntriesIndependentOfTheOriginal)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "02727385-7aad-4391-93c3-35b52c0a89d9");
+    ServiceDescription service1("a", "b", "c");
+    ServiceDescription service2("a", "d", "e");
+    ASSERT_FALSE(this->sut.add(service1).has_error());
+    ASSERT_FALSE(this->sut.add(service2).has_error());
+
+    // the registry is published by copying it into a shared memory chunk and must therefore not contain pointers
+    std::unique_ptr<ServiceRegistry> copy(new ServiceRegistry(*this->sut.operator->()));
+    this->sut.remove(service1);
+    this->sut.remove(service2);
+
+    SearchResult_t searchResult;
+    copy->find(IdString_t("a"), iox::capro::Wildcard, iox::capro::Wildcard, [&](const auto& entry) {
+        searchResult.push_back(entry);
+    });
+    ASSERT_THAT(searchResult.size(), Eq(2U));
+    EXPECT_THAT(searchResult[0].serviceDescription, Eq(service1));
+    EXPECT_THAT(searchResult[1].serviceDescription, Eq(service2));
+
+    searchResult.clear();
+    copy->find(IdString_t("a"), IdString_t("d"), IdString_t("e"), [&](const auto& entry) {
+        searchResult.push_back(entry);
+    });
+    ASSERT_THAT(searchResult.size(), Eq(1U));
+    EXPECT_THAT(searchResult[0].serviceDescription, Eq(service2));
+}
+
 } // namespace
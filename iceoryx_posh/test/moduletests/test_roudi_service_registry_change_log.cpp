@@ -0,0 +1,193 @@
+// Copyright (c) 2026 by agent <agent@local>. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_dust/cxx/convert.hpp"
+#include "iceoryx_posh/internal/roudi/service_registry_change_log.hpp"
+
+#include "test.hpp"
+
+#include <memory>
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::roudi;
+using iox::capro::IdString_t;
+using iox::capro::ServiceDescription;
+using Operation = ServiceRegistryChangeLog::Operation;
+
+class ServiceRegistryChangeLog_test : public Test
+{
+  public:
+    /// @brief modifies the registry of RouDi and records the modification like the PortManager
+    void modify(const Operation operation, const ServiceDescription& service)
+    {
+        switch (operation)
+        {
+        case Operation::ADD_PUBLISHER:
+            IOX_DISCARD_RESULT(registry->addPublisher(service));
+            break;
+        case Operation::REMOVE_PUBLISHER:
+            registry->removePublisher(service);
+            break;
+        case Operation::ADD_SERVER:
+            IOX_DISCARD_RESULT(registry->addServer(service));
+            break;
+        case Operation::REMOVE_SERVER:
+            registry->removeServer(service);
+            break;
+        }
+        if (registry->generation() != sut.generation())
+        {
+            sut.record(registry->generation(), operation, service);
+        }
+    }
+
+    void addPublishers(const uint64_t number)
+    {
+        for (uint64_t i = 0U; i < number; ++i)
+        {
+            modify(Operation::ADD_PUBLISHER,
+                   ServiceDescription("Foo", "Bar", iox::into<iox::lossy<IdString_t>>(iox::cxx::convert::toString(i))));
+        }
+    }
+
+    static std::vector<ServiceRegistry::ServiceDescriptionEntry> entries(const ServiceRegistry& registry)
+    {
+        std::vector<ServiceRegistry::ServiceDescriptionEntry> entries;
+        registry.forEach([&](const auto& entry) { entries.push_back(entry); });
+        return entries;
+    }
+
+    static void expectEqual(const ServiceRegistry& lhs, const ServiceRegistry& rhs)
+    {
+        EXPECT_THAT(lhs.generation(), Eq(rhs.generation()));
+        const auto lhsEntries = entries(lhs);
+        const auto rhsEntries = entries(rhs);
+        ASSERT_THAT(lhsEntries.size(), Eq(rhsEntries.size()));
+        for (uint64_t i = 0U; i < lhsEntries.size(); ++i)
+        {
+            EXPECT_THAT(lhsEntries[i].serviceDescription, Eq(rhsEntries[i].serviceDescription));
+            EXPECT_THAT(lhsEntries[i].publisherCount, Eq(rhsEntries[i].publisherCount));
+            EXPECT_THAT(lhsEntries[i].serverCount, Eq(rhsEntries[i].serverCount));
+        }
+    }
+
+    // use dynamic memory to reduce stack usage
+    std::unique_ptr<ServiceRegistry> registry{new ServiceRegistry};
+    std::unique_ptr<ServiceRegistry> copy{new ServiceRegistry};
+    ServiceRegistryChangeLog sut;
+};
+
+TEST_F(ServiceRegistryChangeLog_test, InitialChangeLogDoesNotModifyRegistry)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "cbfa1d06-28d2-4a72-a54f-a7d8a4f1b8a7");
+    EXPECT_THAT(sut.generation(), Eq(0U));
+    EXPECT_FALSE(sut.applyTo(*copy).has_error());
+    expectEqual(*copy, *registry);
+}
+
+TEST_F(ServiceRegistryChangeLog_test, RegistryIsUpToDateAfterApplyingAllOperations)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5c10d52e-5d7a-4e8b-ae3f-5d26b7f4f3e1");
+    const ServiceDescription service1("a", "b", "c");
+    const ServiceDescription service2("d", "e", "f");
+    const ServiceDescription service3("g", "h", "i");
+
+    modify(Operation::ADD_PUBLISHER, service1);
+    modify(Operation::ADD_SERVER, service2);
+    modify(Operation::ADD_PUBLISHER, service2);
+    modify(Operation::ADD_PUBLISHER, service3);
+    modify(Operation::REMOVE_PUBLISHER, service1);
+    modify(Operation::ADD_SERVER, service1);
+    modify(Operation::REMOVE_SERVER, service2);
+    modify(Operation::REMOVE_PUBLISHER, service3);
+
+    EXPECT_THAT(sut.generation(), Eq(8U));
+    EXPECT_FALSE(sut.applyTo(*copy).has_error());
+    expectEqual(*copy, *registry);
+}
+
+TEST_F(ServiceRegistryChangeLog_test, ModificationsWithoutEffectAreNotRecorded)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6a3bc2b8-4b0b-4f5a-9b0a-0fd36b66b7a4");
+    const ServiceDescription service("a", "b", "c");
+
+    modify(Operation::REMOVE_PUBLISHER, service);
+    modify(Operation::REMOVE_SERVER, service);
+    EXPECT_THAT(sut.generation(), Eq(0U));
+
+    addPublishers(ServiceRegistry::CAPACITY);
+    modify(Operation::ADD_SERVER, service);
+    EXPECT_THAT(sut.generation(), Eq(ServiceRegistry::CAPACITY));
+}
+
+TEST_F(ServiceRegistryChangeLog_test, OnlyChangesWhichAreNewerThanTheRegistryAreApplied)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0d7b2d7e-c8a6-4b76-9a55-97c4c8f7b6c2");
+    addPublishers(3U);
+    ASSERT_FALSE(sut.applyTo(*copy).has_error());
+
+    // the already applied changes would increment the publisher count again
+    addPublishers(5U);
+    ASSERT_FALSE(sut.applyTo(*copy).has_error());
+    expectEqual(*copy, *registry);
+
+    ASSERT_FALSE(sut.applyTo(*copy).has_error());
+    expectEqual(*copy, *registry);
+}
+
+TEST_F(ServiceRegistryChangeLog_test, RegistryWhichIsOlderThanTheOldestChangeIsNotModified)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1e0bbf54-ff8e-4f7c-bd3b-2d6b3f8f0c2c");
+    addPublishers(ServiceRegistryChangeLog::CAPACITY + 1U);
+
+    auto result = sut.applyTo(*copy);
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.get_error(), Eq(ServiceRegistryChangeLog::Error::CHANGES_ARE_NO_LONGER_AVAILABLE));
+    EXPECT_THAT(copy->generation(), Eq(0U));
+    EXPECT_TRUE(entries(*copy).empty());
+}
+
+TEST_F(ServiceRegistryChangeLog_test, SnapshotCoveredByTheChangeLogIsBroughtUpToDate)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8f1f3f65-0c3c-4b02-9a31-7bcb8c2f7f3d");
+    addPublishers(ServiceRegistryChangeLog::SNAPSHOT_INTERVAL);
+    std::unique_ptr<ServiceRegistry> snapshot{new ServiceRegistry(*registry)};
+
+    addPublishers(ServiceRegistryChangeLog::CAPACITY);
+    ASSERT_TRUE(sut.applyTo(*copy).has_error());
+
+    *copy = *snapshot;
+    EXPECT_FALSE(sut.applyTo(*copy).has_error());
+    expectEqual(*copy, *registry);
+}
+
+TEST_F(ServiceRegistryChangeLog_test, RegistryWhichIsNewerThanTheChangeLogIsNotModified)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d8c4c3b5-4e0e-4a0b-8d8e-4b1c1c7f2e6a");
+    ServiceRegistryChangeLog olderChangeLog;
+    addPublishers(2U);
+    olderChangeLog = sut;
+    addPublishers(2U);
+    *copy = *registry;
+
+    EXPECT_FALSE(olderChangeLog.applyTo(*copy).has_error());
+    expectEqual(*copy, *registry);
+}
+
+} // namespace
@@ -0,0 +1,62 @@
+// Copyright (c) 2026 by agent <agent@local>. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/runtime/heartbeat.hpp"
+
+#include "test.hpp"
+
+#include <thread>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::runtime;
+using namespace iox::units::duration_literals;
+
+constexpr iox::units::Duration WAIT_TIME{10_ms};
+constexpr iox::units::Duration TOLERANCE{1_s};
+
+TEST(Heartbeat_test, DurationSinceLastBeatIsSmallAfterConstruction)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "13fc44cf-4e60-4a29-ae10-c4e19181bb7a");
+    Heartbeat sut;
+
+    EXPECT_THAT(sut.durationSinceLastBeat(), Lt(TOLERANCE));
+}
+
+TEST(Heartbeat_test, DurationSinceLastBeatGrowsWithoutBeat)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "648d153d-3989-424a-bd8b-c2fe8950d4e0");
+    Heartbeat sut;
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(WAIT_TIME.toMilliseconds()));
+
+    EXPECT_THAT(sut.durationSinceLastBeat(), Ge(WAIT_TIME));
+}
+
+TEST(Heartbeat_test, BeatResetsDurationSinceLastBeat)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6199751f-62b7-4f0e-8fd8-e28824c97a76");
+    Heartbeat sut;
+    std::this_thread::sleep_for(std::chrono::milliseconds(WAIT_TIME.toMilliseconds()));
+    const auto durationBeforeBeat = sut.durationSinceLastBeat();
+
+    sut.beat();
+
+    EXPECT_THAT(sut.durationSinceLastBeat(), Lt(durationBeforeBeat));
+}
+
+} // namespace
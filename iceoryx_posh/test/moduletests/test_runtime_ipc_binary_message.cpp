@@ -0,0 +1,331 @@
+// Copyright (c) 2026 by agent <agent@local>. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/runtime/ipc_binary_message.hpp"
+
+#include "test.hpp"
+
+namespace
+{
+using namespace ::testing;
+using namespace iox;
+using namespace iox::runtime;
+
+IpcBinaryMessage transfer(const IpcBinaryMessage& message)
+{
+    IpcBinaryMessage received;
+    EXPECT_TRUE(received.decode(message.encode()));
+    return received;
+}
+
+TEST(IpcBinaryMessage_test, DefaultConstructedMessageIsInvalid)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "fe75a2ae-9360-4426-bc33-93e2473a2b29");
+    IpcBinaryMessage sut;
+
+    EXPECT_FALSE(sut.isValid());
+    EXPECT_THAT(sut.getType(), Eq(IpcMessageType::NOTYPE));
+}
+
+TEST(IpcBinaryMessage_test, MessageConstructedWithTypeIsValidAndHasType)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7efa43ea-0706-4bce-a48e-032eb684bb89");
+    IpcBinaryMessage sut{IpcMessageType::CREATE_PUBLISHER};
+
+    EXPECT_TRUE(sut.isValid());
+    EXPECT_THAT(sut.getType(), Eq(IpcMessageType::CREATE_PUBLISHER));
+}
+
+TEST(IpcBinaryMessage_test, ArithmeticValuesAndEnumsSurviveTransfer)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1cb3170d-b9e0-4687-bc14-7274d5e4233d");
+    constexpr uint64_t OFFSET{0x1234567800ABCDEFU};
+    constexpr int32_t NEGATIVE{-42};
+    constexpr uint8_t ZERO{0U};
+    IpcBinaryMessage sut{IpcMessageType::ERROR};
+    sut << OFFSET << NEGATIVE << ZERO << IpcMessageErrorType::PUBLISHER_LIST_FULL << true << false;
+
+    auto received = transfer(sut);
+    uint64_t offset{0U};
+    int32_t negative{0};
+    uint8_t zero{1U};
+    IpcMessageErrorType error{IpcMessageErrorType::NOTYPE};
+    bool isTrue{false};
+    bool isFalse{true};
+    received >> offset >> negative >> zero >> error >> isTrue >> isFalse;
+
+    ASSERT_TRUE(received.isValid());
+    EXPECT_THAT(received.getType(), Eq(IpcMessageType::ERROR));
+    EXPECT_THAT(offset, Eq(OFFSET));
+    EXPECT_THAT(negative, Eq(NEGATIVE));
+    EXPECT_THAT(zero, Eq(ZERO));
+    EXPECT_THAT(error, Eq(IpcMessageErrorType::PUBLISHER_LIST_FULL));
+    EXPECT_TRUE(isTrue);
+    EXPECT_FALSE(isFalse);
+}
+
+TEST(IpcBinaryMessage_test, StringsSurviveTransfer)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "17e50168-0f93-4700-9138-d3da92baa573");
+    const RuntimeName_t runtimeName{"Hypnotoad,with,separators"};
+    const NodeName_t emptyName;
+    IpcBinaryMessage sut{IpcMessageType::CREATE_CONDITION_VARIABLE};
+    sut << runtimeName << emptyName;
+
+    auto received = transfer(sut);
+    RuntimeName_t receivedRuntimeName;
+    NodeName_t receivedEmptyName{"not empty"};
+    received >> receivedRuntimeName >> receivedEmptyName;
+
+    ASSERT_TRUE(received.isValid());
+    EXPECT_THAT(receivedRuntimeName, Eq(runtimeName));
+    EXPECT_TRUE(receivedEmptyName.empty());
+}
+
+TEST(IpcBinaryMessage_test, ServiceDescriptionSurvivesTransfer)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9425f7c9-7eaa-451a-8b9e-c3fc7a63dd2a");
+    capro::ServiceDescription service{"Radar", "FrontLeft", "Objects", {1U, 2U, 3U, 4U}, capro::Interfaces::DDS};
+    service.setLocal();
+    IpcBinaryMessage sut{IpcMessageType::CREATE_PUBLISHER};
+    sut << service;
+
+    auto received = transfer(sut);
+    capro::ServiceDescription receivedService;
+    received >> receivedService;
+
+    ASSERT_TRUE(received.isValid());
+    EXPECT_THAT(receivedService, Eq(service));
+    EXPECT_THAT(receivedService.getClassHash(), Eq(service.getClassHash()));
+    EXPECT_THAT(receivedService.getScope(), Eq(capro::Scope::LOCAL));
+    EXPECT_THAT(receivedService.getSourceInterface(), Eq(capro::Interfaces::DDS));
+}
+
+TEST(IpcBinaryMessage_test, PublisherOptionsAndPortConfigInfoSurviveTransfer)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a3ef93ce-dd7f-4836-828e-83ccf5d81d03");
+    popo::PublisherOptions options;
+    options.historyCapacity = 13U;
+    options.nodeName = "Node";
+    options.offerOnCreate = false;
+    options.subscriberTooSlowPolicy = popo::ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER;
+    options.batchSubscriberNotifications = true;
+    options.recycledChunkCapacity = 7U;
+    const PortConfigInfo portConfigInfo{11U, 22U, 33U};
+    IpcBinaryMessage sut{IpcMessageType::CREATE_PUBLISHER};
+    sut << options << portConfigInfo;
+
+    auto received = transfer(sut);
+    popo::PublisherOptions receivedOptions;
+    PortConfigInfo receivedPortConfigInfo;
+    received >> receivedOptions >> receivedPortConfigInfo;
+
+    ASSERT_TRUE(received.isValid());
+    EXPECT_THAT(receivedOptions.historyCapacity, Eq(options.historyCapacity));
+    EXPECT_THAT(receivedOptions.nodeName, Eq(options.nodeName));
+    EXPECT_THAT(receivedOptions.offerOnCreate, Eq(options.offerOnCreate));
+    EXPECT_THAT(receivedOptions.subscriberTooSlowPolicy, Eq(options.subscriberTooSlowPolicy));
+    EXPECT_THAT(receivedOptions.batchSubscriberNotifications, Eq(options.batchSubscriberNotifications));
+    EXPECT_THAT(receivedOptions.recycledChunkCapacity, Eq(options.recycledChunkCapacity));
+    EXPECT_THAT(receivedPortConfigInfo, Eq(portConfigInfo));
+}
+
+TEST(IpcBinaryMessage_test, SubscriberOptionsSurviveTransfer)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1e8acbc8-a564-4beb-aa9d-132299028c26");
+    popo::SubscriberOptions options;
+    options.queueCapacity = 42U;
+    options.historyRequest = 3U;
+    options.nodeName = "Node";
+    options.subscribeOnCreate = false;
+    options.queueFullPolicy = popo::QueueFullPolicy::BLOCK_PRODUCER;
+    options.requiresPublisherHistorySupport = true;
+    options.recordLatencyHistogram = true;
+    IpcBinaryMessage sut{IpcMessageType::CREATE_SUBSCRIBER};
+    sut << options;
+
+    auto received = transfer(sut);
+    popo::SubscriberOptions receivedOptions;
+    received >> receivedOptions;
+
+    ASSERT_TRUE(received.isValid());
+    EXPECT_THAT(receivedOptions.queueCapacity, Eq(options.queueCapacity));
+    EXPECT_THAT(receivedOptions.historyRequest, Eq(options.historyRequest));
+    EXPECT_THAT(receivedOptions.nodeName, Eq(options.nodeName));
+    EXPECT_THAT(receivedOptions.subscribeOnCreate, Eq(options.subscribeOnCreate));
+    EXPECT_THAT(receivedOptions.queueFullPolicy, Eq(options.queueFullPolicy));
+    EXPECT_THAT(receivedOptions.requiresPublisherHistorySupport, Eq(options.requiresPublisherHistorySupport));
+    EXPECT_THAT(receivedOptions.recordLatencyHistogram, Eq(options.recordLatencyHistogram));
+}
+
+TEST(IpcBinaryMessage_test, ClientAndServerOptionsSurviveTransfer)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "52fb3159-45bd-466d-83cf-eb56de7482d6");
+    popo::ClientOptions clientOptions;
+    clientOptions.responseQueueCapacity = 5U;
+    clientOptions.nodeName = "Client";
+    clientOptions.connectOnCreate = false;
+    clientOptions.responseQueueFullPolicy = popo::QueueFullPolicy::BLOCK_PRODUCER;
+    clientOptions.serverTooSlowPolicy = popo::ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER;
+    popo::ServerOptions serverOptions;
+    serverOptions.requestQueueCapacity = 6U;
+    serverOptions.nodeName = "Server";
+    serverOptions.offerOnCreate = false;
+    serverOptions.requestQueueFullPolicy = popo::QueueFullPolicy::BLOCK_PRODUCER;
+    serverOptions.clientTooSlowPolicy = popo::ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER;
+    IpcBinaryMessage sut{IpcMessageType::CREATE_CLIENT};
+    sut << clientOptions << serverOptions;
+
+    auto received = transfer(sut);
+    popo::ClientOptions receivedClientOptions;
+    popo::ServerOptions receivedServerOptions;
+    received >> receivedClientOptions >> receivedServerOptions;
+
+    ASSERT_TRUE(received.isValid());
+    EXPECT_THAT(receivedClientOptions, Eq(clientOptions));
+    EXPECT_THAT(receivedServerOptions, Eq(serverOptions));
+}
+
+TEST(IpcBinaryMessage_test, EncodedMessageStartsWithMarkerAndContainsNoNullCharacter)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2bc09b81-ae6d-4f3c-81e2-af8e2cee1cd2");
+    IpcBinaryMessage sut{IpcMessageType::CREATE_PUBLISHER};
+    sut << uint64_t{0U} << uint64_t{0x100U} << RuntimeName_t{""};
+
+    const auto encoded = sut.encode();
+
+    ASSERT_FALSE(encoded.empty());
+    EXPECT_THAT(encoded[0], Eq(IpcBinaryMessage::ENCODING_MARKER));
+    EXPECT_THAT(encoded.find('\0'), Eq(std::string::npos));
+    EXPECT_TRUE(IpcBinaryMessage::isBinaryEncoded(encoded));
+}
+
+TEST(IpcBinaryMessage_test, MessageLargerThanOneEncodingBlockSurvivesTransfer)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "817a344c-e20a-4b65-9dca-9e1d07df4d70");
+    IpcBinaryMessage sut{IpcMessageType::CREATE_PUBLISHER};
+    uint64_t numberOfValues{0U};
+    // alternate between blocks without null bytes and blocks with many null bytes
+    for (uint64_t i = 0U; i < 100U; ++i)
+    {
+        sut << ((i % 80U < 40U) ? 0xFFFFFFFFFFFFFFFFU : i);
+        ++numberOfValues;
+    }
+    ASSERT_TRUE(sut.isValid());
+
+    auto received = transfer(sut);
+
+    for (uint64_t i = 0U; i < numberOfValues; ++i)
+    {
+        uint64_t value{0U};
+        received >> value;
+        EXPECT_THAT(value, Eq((i % 80U < 40U) ? 0xFFFFFFFFFFFFFFFFU : i));
+    }
+    EXPECT_TRUE(received.isValid());
+    EXPECT_THAT(received.size(), Eq(sut.size()));
+}
+
+TEST(IpcBinaryMessage_test, WritingBeyondCapacityInvalidatesMessage)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e9e796f6-e001-4ae8-96ee-e89dd8ebff0c");
+    IpcBinaryMessage sut{IpcMessageType::CREATE_PUBLISHER};
+    for (uint64_t i = 0U; i < IpcBinaryMessage::CAPACITY / sizeof(uint64_t); ++i)
+    {
+        sut << i;
+    }
+
+    EXPECT_FALSE(sut.isValid());
+}
+
+TEST(IpcBinaryMessage_test, ReadingBeyondTheEndInvalidatesMessage)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "55938d86-e3b3-4136-bb46-6c23af2ecf57");
+    IpcBinaryMessage sut{IpcMessageType::CREATE_PUBLISHER};
+    sut << uint32_t{42U};
+
+    auto received = transfer(sut);
+    uint64_t value{13U};
+    received >> value;
+
+    EXPECT_FALSE(received.isValid());
+    EXPECT_THAT(value, Eq(13U));
+}
+
+TEST(IpcBinaryMessage_test, ReadingStringExceedingTheCapacityInvalidatesMessage)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "bbfb9733-4ae6-4b01-aa8d-d0fae702f113");
+    IpcBinaryMessage sut{IpcMessageType::CREATE_PUBLISHER};
+    sut << string<10>{"0123456789"};
+
+    auto received = transfer(sut);
+    string<5> value;
+    received >> value;
+
+    EXPECT_FALSE(received.isValid());
+}
+
+TEST(IpcBinaryMessage_test, ReadingOutOfRangePolicyInvalidatesMessage)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b25b9496-491a-4f7f-bd03-844abc01838e");
+    IpcBinaryMessage sut{IpcMessageType::CREATE_SUBSCRIBER};
+    sut << uint64_t{1U} << uint64_t{0U} << NodeName_t{"Node"} << true << uint8_t{42U} << false;
+
+    auto received = transfer(sut);
+    popo::SubscriberOptions options;
+    options.queueCapacity = 13U;
+    received >> options;
+
+    EXPECT_FALSE(received.isValid());
+    EXPECT_THAT(options.queueCapacity, Eq(13U));
+}
+
+TEST(IpcBinaryMessage_test, DecodingTextMessageFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "55c6d92f-3f15-487e-93a7-8f20c3c4967e");
+    IpcBinaryMessage sut;
+
+    EXPECT_FALSE(IpcBinaryMessage::isBinaryEncoded("1,Hypnotoad,"));
+    EXPECT_FALSE(sut.decode("1,Hypnotoad,"));
+    EXPECT_FALSE(sut.isValid());
+}
+
+TEST(IpcBinaryMessage_test, DecodingMessageWithOtherProtocolVersionFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a0f76d2f-1b95-4d76-a38b-43e8c668c7c3");
+    IpcBinaryMessage sut{IpcMessageType::CREATE_PUBLISHER};
+    auto encoded = sut.encode();
+    // the first byte after the marker and the code byte is the protocol version
+    encoded[2] = static_cast<char>(IpcBinaryMessage::PROTOCOL_VERSION + 1U);
+
+    IpcBinaryMessage received;
+    EXPECT_FALSE(received.decode(encoded));
+    EXPECT_FALSE(received.isValid());
+}
+
+TEST(IpcBinaryMessage_test, DecodingTruncatedMessageFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "28a76a18-b2e2-4f25-b943-63772a4a9282");
+    IpcBinaryMessage sut{IpcMessageType::CREATE_PUBLISHER};
+    sut << RuntimeName_t{"Hypnotoad"};
+    auto encoded = sut.encode();
+    encoded.resize(encoded.size() - 3U);
+
+    IpcBinaryMessage received;
+    EXPECT_FALSE(received.decode(encoded));
+    EXPECT_FALSE(received.isValid());
+}
+
+} // namespace
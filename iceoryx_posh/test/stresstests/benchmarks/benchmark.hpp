@@ -0,0 +1,63 @@
+// Copyright (c) 2026 by agent <agent@local>. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_STRESSTESTS_BENCHMARKS_BENCHMARK_HPP
+#define IOX_POSH_STRESSTESTS_BENCHMARKS_BENCHMARK_HPP
+
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+namespace iox
+{
+namespace benchmark
+{
+/// @brief Calls 'f' for 'numberOfIterations' times and returns the mean duration of a single call
+/// @param[in] f the callable to measure
+/// @param[in] numberOfIterations how often 'f' shall be called
+/// @return the mean duration of a single call of 'f' in nanoseconds
+template <typename F>
+double meanLatencyInNanoseconds(F&& f, const uint64_t numberOfIterations) noexcept
+{
+    const auto start = std::chrono::steady_clock::now();
+    for (uint64_t i = 0U; i < numberOfIterations; ++i)
+    {
+        f();
+    }
+    const auto stop = std::chrono::steady_clock::now();
+
+    return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count())
+           / static_cast<double>(numberOfIterations);
+}
+
+/// @brief Prints one row of a benchmark result table
+/// @param[in] name of the measured scenario
+/// @param[in] parameter the scenario was measured with, e.g. the number of mempools
+/// @param[in] value the measured value
+/// @param[in] unit of the measured value
+inline void printResult(const std::string& name, const uint64_t parameter, const double value, const char* unit)
+{
+    // Not using iceoryx logger due to width requirements
+    std::cout << std::setw(40) << std::left << name << std::right << std::setw(8) << parameter << " : "
+              << std::setw(14) << std::fixed << std::setprecision(1) << value << " " << unit << std::endl;
+}
+
+} // namespace benchmark
+} // namespace iox
+
+#endif // IOX_POSH_STRESSTESTS_BENCHMARKS_BENCHMARK_HPP
@@ -0,0 +1,125 @@
+// Copyright (c) 2026 by agent <agent@local>. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_distributor.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_distributor_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_popper.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_pusher.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_listener.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/locking_policy.hpp"
+#include "iceoryx_posh/mepoo/mepoo_config.hpp"
+#include "iox/bump_allocator.hpp"
+
+#include "benchmark.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace iox;
+
+constexpr uint64_t NUMBER_OF_ITERATIONS{20000U};
+constexpr uint32_t MAX_NUMBER_OF_SUBSCRIBERS{256U};
+constexpr uint32_t QUEUE_CAPACITY{4U};
+constexpr uint32_t CHUNK_PAYLOAD_SIZE{64U};
+
+struct ChunkQueueConfig
+{
+    static constexpr uint64_t MAX_QUEUE_CAPACITY{QUEUE_CAPACITY};
+};
+
+struct ChunkDistributorConfig
+{
+    static constexpr uint32_t MAX_QUEUES{MAX_NUMBER_OF_SUBSCRIBERS};
+    static constexpr uint64_t MAX_HISTORY_CAPACITY{1U};
+};
+
+using ChunkQueueData_t = popo::ChunkQueueData<ChunkQueueConfig, popo::ThreadSafePolicy>;
+using ChunkQueuePusher_t = popo::ChunkQueuePusher<ChunkQueueData_t>;
+using ChunkDistributorData_t =
+    popo::ChunkDistributorData<ChunkDistributorConfig, popo::ThreadSafePolicy, ChunkQueuePusher_t>;
+using ChunkDistributor_t = popo::ChunkDistributor<ChunkDistributorData_t>;
+
+/// @brief all subscribers are attached to the same WaitSet, i.e. the same condition variable, whose thread is woken up
+/// by the publisher; returns the mean latency of a single delivery to all subscribers
+double measureSendLatency(const uint32_t numberOfSubscribers, const bool batchConsumerNotifications)
+{
+    mepoo::MePooConfig config;
+    // the queues discard the oldest chunk on overflow, i.e. the number of chunks in use is bound by the queue capacity
+    config.addMemPool({CHUNK_PAYLOAD_SIZE, MAX_NUMBER_OF_SUBSCRIBERS * (QUEUE_CAPACITY + 1U) + 1U});
+    const uint64_t memorySize = mepoo::MemoryManager::requiredFullMemorySize(config);
+    std::unique_ptr<void, decltype(&std::free)> memory{std::malloc(memorySize), &std::free};
+    BumpAllocator allocator{memory.get(), memorySize};
+    mepoo::MemoryManager memoryManager;
+    memoryManager.configureMemoryManager(config, allocator, allocator);
+
+    popo::ConditionVariableData conditionVariableData{"fanout"};
+    ChunkDistributorData_t sutData{popo::ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA, 0U, batchConsumerNotifications};
+    ChunkDistributor_t sut{&sutData};
+
+    std::vector<std::unique_ptr<ChunkQueueData_t>> queues;
+    for (uint32_t i = 0U; i < numberOfSubscribers; ++i)
+    {
+        queues.emplace_back(std::make_unique<ChunkQueueData_t>(
+            popo::QueueFullPolicy::DISCARD_OLDEST_DATA, cxx::VariantQueueTypes::SoFi_SingleProducerSingleConsumer));
+        popo::ChunkQueuePopper<ChunkQueueData_t>(queues.back().get()).setConditionVariable(conditionVariableData, i);
+        sut.tryAddQueue(queues.back().get()).expect("queue added");
+    }
+
+    popo::ConditionListener listener{conditionVariableData};
+    std::atomic_bool keepRunning{true};
+    std::thread waitSetThread([&] {
+        while (keepRunning.load(std::memory_order_relaxed))
+        {
+            listener.wait();
+        }
+    });
+
+    const auto chunkSettings =
+        mepoo::ChunkSettings::create(CHUNK_PAYLOAD_SIZE, CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT).expect("valid settings");
+    const auto latency = benchmark::meanLatencyInNanoseconds(
+        [&] { sut.deliverToAllStoredQueues(memoryManager.getChunk(chunkSettings).expect("chunk available")); },
+        NUMBER_OF_ITERATIONS);
+
+    keepRunning.store(false, std::memory_order_relaxed);
+    listener.destroy();
+    waitSetThread.join();
+    sut.removeAllQueues();
+
+    return latency;
+}
+
+int main()
+{
+    for (const bool batchConsumerNotifications : {false, true})
+    {
+        const std::string name{batchConsumerNotifications ? "deliverToAllStoredQueues, batched wake"
+                                                           : "deliverToAllStoredQueues, wake per queue"};
+        for (uint32_t numberOfSubscribers = 1U; numberOfSubscribers <= MAX_NUMBER_OF_SUBSCRIBERS;
+             numberOfSubscribers *= 2U)
+        {
+            benchmark::printResult(
+                name, numberOfSubscribers, measureSendLatency(numberOfSubscribers, batchConsumerNotifications), "ns");
+        }
+    }
+
+    return 0;
+}
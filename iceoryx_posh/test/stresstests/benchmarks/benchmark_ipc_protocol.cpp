@@ -0,0 +1,89 @@
+// Copyright (c) 2026 by agent <agent@local>. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/roudi/roudi.hpp"
+#include "iceoryx_posh/roudi/iceoryx_roudi_components.hpp"
+#include "iceoryx_posh/runtime/posh_runtime_single_process.hpp"
+#include "iox/logging.hpp"
+
+#include "benchmark.hpp"
+
+#include <algorithm>
+#include <memory>
+
+using namespace iox;
+
+constexpr uint64_t NUMBER_OF_PUBLISHERS{1000U};
+/// @note RouDi has only MAX_PUBLISHERS ports including its own introspection publishers, therefore the publishers are
+/// created in rounds with a fresh RouDi
+constexpr uint64_t PUBLISHERS_PER_ROUND{MAX_PUBLISHERS / 2U};
+
+/// @brief measures the mean latency of a runtime to request a publisher port from RouDi, i.e. the round trip over the
+/// IPC channels including the encoding and decoding of the request and the response with the given protocol
+double measurePublisherCreationLatency(const runtime::IpcProtocol ipcProtocol)
+{
+    double accumulatedLatency{0.0};
+    uint64_t createdPublishers{0U};
+    while (createdPublishers < NUMBER_OF_PUBLISHERS)
+    {
+        const uint64_t publishersInRound = std::min(PUBLISHERS_PER_ROUND, NUMBER_OF_PUBLISHERS - createdPublishers);
+
+        RouDiConfig_t roudiConfig = RouDiConfig_t().setDefaults();
+        std::unique_ptr<roudi::IceOryxRouDiComponents> roudiComponents{
+            new roudi::IceOryxRouDiComponents(roudiConfig)};
+        std::unique_ptr<roudi::RouDi> roudi{
+            new roudi::RouDi(roudiComponents->rouDiMemoryManager,
+                             roudiComponents->portManager,
+                             roudi::RouDi::RoudiStartupParameters{roudi::MonitoringMode::OFF,
+                                                                  false,
+                                                                  roudi::RouDi::RuntimeMessagesThreadStart::IMMEDIATE,
+                                                                  version::CompatibilityCheckLevel::PATCH,
+                                                                  roudi::PROCESS_DEFAULT_KILL_DELAY,
+                                                                  ipcProtocol})};
+        std::unique_ptr<runtime::PoshRuntimeSingleProcess> runtime{
+            new runtime::PoshRuntimeSingleProcess("iox-bm-ipc-protocol")};
+
+        uint64_t index{0U};
+        const auto latency = benchmark::meanLatencyInNanoseconds(
+            [&] {
+                const capro::ServiceDescription service{
+                    "Benchmark", "IpcProtocol", capro::IdString_t(TruncateToCapacity, std::to_string(index).c_str())};
+                if (runtime->getMiddlewarePublisher(service, popo::PublisherOptions()) == nullptr)
+                {
+                    IOX_LOG(ERROR) << "Could not create publisher " << index;
+                }
+                ++index;
+            },
+            publishersInRound);
+
+        accumulatedLatency += latency * static_cast<double>(publishersInRound);
+        createdPublishers += publishersInRound;
+    }
+
+    return accumulatedLatency / static_cast<double>(NUMBER_OF_PUBLISHERS);
+}
+
+int main()
+{
+    const auto textLatency = measurePublisherCreationLatency(runtime::IpcProtocol::TEXT);
+    const auto binaryLatency = measurePublisherCreationLatency(runtime::IpcProtocol::BINARY);
+
+    benchmark::printResult("create publisher, text protocol", NUMBER_OF_PUBLISHERS, textLatency, "ns");
+    benchmark::printResult("create publisher, binary protocol", NUMBER_OF_PUBLISHERS, binaryLatency, "ns");
+
+    return 0;
+}
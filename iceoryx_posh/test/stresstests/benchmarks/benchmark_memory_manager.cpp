@@ -0,0 +1,80 @@
+// Copyright (c) 2026 by agent <agent@local>. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
+#include "iceoryx_posh/mepoo/mepoo_config.hpp"
+#include "iox/bump_allocator.hpp"
+
+#include "benchmark.hpp"
+
+#include <cstdlib>
+#include <memory>
+
+using namespace iox;
+
+constexpr uint64_t NUMBER_OF_ITERATIONS{1000000U};
+constexpr uint32_t CHUNK_COUNT{4U};
+constexpr uint32_t SMALLEST_CHUNK_PAYLOAD_SIZE{64U};
+
+/// @brief the chunk-payload sizes grow by a factor of ~1.4, which results in two mempools per size class like in a
+/// typical RouDi config
+uint32_t chunkPayloadSizeOfMemPool(const uint32_t memPoolIndex)
+{
+    uint64_t size{SMALLEST_CHUNK_PAYLOAD_SIZE};
+    for (uint32_t i = 0U; i < memPoolIndex; ++i)
+    {
+        size = size * 7U / 5U;
+    }
+    return static_cast<uint32_t>(align(size, mepoo::MemPool::CHUNK_MEMORY_ALIGNMENT));
+}
+
+/// @brief measures the loan latency of a chunk from the largest mempool which is the worst case for a linear search
+double measureLoanLatency(const uint32_t numberOfMemPools)
+{
+    mepoo::MePooConfig config;
+    for (uint32_t i = 0U; i < numberOfMemPools; ++i)
+    {
+        config.addMemPool({chunkPayloadSizeOfMemPool(i), CHUNK_COUNT});
+    }
+
+    const uint64_t memorySize = mepoo::MemoryManager::requiredFullMemorySize(config);
+    std::unique_ptr<void, decltype(&std::free)> memory{std::malloc(memorySize), &std::free};
+    BumpAllocator allocator{memory.get(), memorySize};
+    mepoo::MemoryManager sut;
+    sut.configureMemoryManager(config, allocator, allocator);
+
+    const auto chunkSettings = mepoo::ChunkSettings::create(chunkPayloadSizeOfMemPool(numberOfMemPools - 1U),
+                                                            CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT)
+                                   .expect("valid chunk settings");
+
+    return benchmark::meanLatencyInNanoseconds(
+        [&] {
+            // the SharedChunk is released immediately which returns the chunk to its mempool
+            sut.getChunk(chunkSettings).expect("chunk available");
+        },
+        NUMBER_OF_ITERATIONS);
+}
+
+int main()
+{
+    for (uint32_t numberOfMemPools = 1U; numberOfMemPools <= MAX_NUMBER_OF_MEMPOOLS; numberOfMemPools *= 2U)
+    {
+        benchmark::printResult("MemoryManager::getChunk + release", numberOfMemPools,
+                               measureLoanLatency(numberOfMemPools), "ns");
+    }
+
+    return 0;
+}
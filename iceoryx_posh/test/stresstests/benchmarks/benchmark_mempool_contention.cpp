@@ -0,0 +1,100 @@
+// Copyright (c) 2026 by agent <agent@local>. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/mepoo/mem_pool.hpp"
+#include "iox/bump_allocator.hpp"
+
+#include "benchmark.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace iox;
+
+constexpr uint64_t NUMBER_OF_ITERATIONS_PER_THREAD{200000U};
+constexpr uint32_t MAX_NUMBER_OF_THREADS{16U};
+constexpr uint32_t CHUNKS_PER_ITERATION{4U};
+constexpr uint32_t CHUNK_SIZE{128U};
+constexpr uint32_t CHUNK_COUNT{MAX_NUMBER_OF_THREADS * CHUNKS_PER_ITERATION * 4U};
+
+/// @brief every thread acquires a few chunks and releases them again, like a publisher which loans and a subscriber
+/// which releases samples; returns the overall number of getChunk and freeChunk calls per microsecond
+double measureThroughput(const uint32_t numberOfThreads, const uint32_t chunkCacheCapacity)
+{
+    const uint64_t managementMemorySize = mepoo::MemPool::requiredManagementMemorySize(CHUNK_COUNT, chunkCacheCapacity);
+    const uint64_t chunkMemorySize = static_cast<uint64_t>(CHUNK_COUNT) * CHUNK_SIZE;
+    std::unique_ptr<void, decltype(&std::free)> managementMemory{std::malloc(managementMemorySize), &std::free};
+    std::unique_ptr<void, decltype(&std::free)> chunkMemory{std::malloc(chunkMemorySize), &std::free};
+    BumpAllocator managementAllocator{managementMemory.get(), managementMemorySize};
+    BumpAllocator chunkMemoryAllocator{chunkMemory.get(), chunkMemorySize};
+    mepoo::MemPool sut{CHUNK_SIZE, CHUNK_COUNT, managementAllocator, chunkMemoryAllocator, chunkCacheCapacity};
+
+    std::atomic<bool> start{false};
+    std::vector<std::thread> threads;
+    for (uint32_t t = 0U; t < numberOfThreads; ++t)
+    {
+        threads.emplace_back([&] {
+            void* chunks[CHUNKS_PER_ITERATION];
+            while (!start.load(std::memory_order_acquire))
+            {
+                std::this_thread::yield();
+            }
+            for (uint64_t i = 0U; i < NUMBER_OF_ITERATIONS_PER_THREAD; ++i)
+            {
+                for (auto& chunk : chunks)
+                {
+                    chunk = sut.getChunk();
+                }
+                for (auto chunk : chunks)
+                {
+                    sut.freeChunk(chunk);
+                }
+            }
+        });
+    }
+
+    const auto begin = std::chrono::steady_clock::now();
+    start.store(true, std::memory_order_release);
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    const auto end = std::chrono::steady_clock::now();
+
+    const auto numberOfCalls =
+        static_cast<double>(numberOfThreads) * NUMBER_OF_ITERATIONS_PER_THREAD * CHUNKS_PER_ITERATION * 2U;
+    return numberOfCalls
+           / static_cast<double>(std::chrono::duration_cast<std::chrono::microseconds>(end - begin).count());
+}
+
+int main()
+{
+    for (const uint32_t chunkCacheCapacity : {0U, 8U, 32U})
+    {
+        const std::string name{"MemPool get/free, cache capacity " + std::to_string(chunkCacheCapacity)};
+        for (uint32_t numberOfThreads = 1U; numberOfThreads <= MAX_NUMBER_OF_THREADS; numberOfThreads *= 2U)
+        {
+            benchmark::printResult(
+                name, numberOfThreads, measureThroughput(numberOfThreads, chunkCacheCapacity), "ops/us");
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,131 @@
+// Copyright (c) 2026 by agent <agent@local>. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/popo/ports/subscriber_port_user.hpp"
+#include "iceoryx_posh/internal/roudi/roudi.hpp"
+#include "iceoryx_posh/roudi/iceoryx_roudi_components.hpp"
+#include "iceoryx_posh/runtime/posh_runtime_single_process.hpp"
+#include "iox/logging.hpp"
+
+#include "benchmark.hpp"
+
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace iox;
+
+/// @note RouDi creates some publishers for the introspection and the service registry, therefore not all
+/// MAX_PUBLISHERS are available for the benchmark
+constexpr uint64_t NUMBER_OF_PORT_PAIRS[]{64U, 128U, 256U, MAX_PUBLISHERS - 64U};
+constexpr std::chrono::seconds CONNECTION_TIMEOUT{30};
+
+enum class CreationOrder
+{
+    PUBLISHERS_FIRST,
+    SUBSCRIBERS_FIRST
+};
+
+/// @brief measures the time from the creation of the first port until every subscriber is connected to its publisher,
+/// i.e. the time RouDi needs to match the offers and subscriptions of a mass startup
+double measureTimeToFullConnection(const uint64_t numberOfPortPairs, const CreationOrder creationOrder)
+{
+    RouDiConfig_t roudiConfig = RouDiConfig_t().setDefaults();
+    std::unique_ptr<roudi::IceOryxRouDiComponents> roudiComponents{new roudi::IceOryxRouDiComponents(roudiConfig)};
+    std::unique_ptr<roudi::RouDi> roudi{
+        new roudi::RouDi(roudiComponents->rouDiMemoryManager,
+                         roudiComponents->portManager,
+                         roudi::RouDi::RoudiStartupParameters{roudi::MonitoringMode::OFF, false})};
+    std::unique_ptr<runtime::PoshRuntimeSingleProcess> runtime{
+        new runtime::PoshRuntimeSingleProcess("iox-bm-pub-sub-startup")};
+
+    auto service = [](const uint64_t index) {
+        return capro::ServiceDescription{
+            "Benchmark", "Startup", capro::IdString_t(TruncateToCapacity, std::to_string(index).c_str())};
+    };
+
+    std::vector<popo::SubscriberPortData*> subscribers;
+    subscribers.reserve(numberOfPortPairs);
+    auto createPublishers = [&] {
+        for (uint64_t i = 0U; i < numberOfPortPairs; ++i)
+        {
+            if (runtime->getMiddlewarePublisher(service(i), popo::PublisherOptions()) == nullptr)
+            {
+                IOX_LOG(ERROR) << "Could not create publisher " << i;
+            }
+        }
+    };
+    auto createSubscribers = [&] {
+        for (uint64_t i = 0U; i < numberOfPortPairs; ++i)
+        {
+            auto subscriber = runtime->getMiddlewareSubscriber(service(i), popo::SubscriberOptions());
+            if (subscriber == nullptr)
+            {
+                IOX_LOG(ERROR) << "Could not create subscriber " << i;
+                continue;
+            }
+            subscribers.push_back(subscriber);
+        }
+    };
+
+    const auto start = std::chrono::steady_clock::now();
+    if (creationOrder == CreationOrder::PUBLISHERS_FIRST)
+    {
+        createPublishers();
+        createSubscribers();
+    }
+    else
+    {
+        createSubscribers();
+        createPublishers();
+    }
+
+    for (auto subscriberPortData : subscribers)
+    {
+        popo::SubscriberPortUser subscriber(subscriberPortData);
+        while (subscriber.getSubscriptionState() != SubscribeState::SUBSCRIBED)
+        {
+            if (std::chrono::steady_clock::now() - start > CONNECTION_TIMEOUT)
+            {
+                IOX_LOG(ERROR) << "Not all subscribers are connected after " << CONNECTION_TIMEOUT.count() << "s";
+                break;
+            }
+            std::this_thread::yield();
+        }
+    }
+    const auto stop = std::chrono::steady_clock::now();
+
+    return static_cast<double>(std::chrono::duration_cast<std::chrono::microseconds>(stop - start).count()) / 1000.0;
+}
+
+int main()
+{
+    for (const auto numberOfPortPairs : NUMBER_OF_PORT_PAIRS)
+    {
+        benchmark::printResult("publishers first, time to connect",
+                               numberOfPortPairs,
+                               measureTimeToFullConnection(numberOfPortPairs, CreationOrder::PUBLISHERS_FIRST),
+                               "ms");
+        benchmark::printResult("subscribers first, time to connect",
+                               numberOfPortPairs,
+                               measureTimeToFullConnection(numberOfPortPairs, CreationOrder::SUBSCRIBERS_FIRST),
+                               "ms");
+    }
+
+    return 0;
+}
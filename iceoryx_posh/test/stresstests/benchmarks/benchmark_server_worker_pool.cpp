@@ -0,0 +1,168 @@
+// Copyright (c) 2026 by agent <agent@local>. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/roudi/roudi.hpp"
+#include "iceoryx_posh/popo/client.hpp"
+#include "iceoryx_posh/popo/server_worker_pool.hpp"
+#include "iceoryx_posh/roudi/iceoryx_roudi_components.hpp"
+#include "iceoryx_posh/runtime/posh_runtime_single_process.hpp"
+#include "iox/logging.hpp"
+
+#include "benchmark.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace iox;
+
+constexpr uint64_t NUMBER_OF_CLIENTS{4U};
+/// @brief the requests a client sends without waiting for the responses
+constexpr uint64_t REQUESTS_IN_FLIGHT_PER_CLIENT{MAX_REQUESTS_ALLOCATED_SIMULTANEOUSLY};
+/// @brief the time the request handler needs for one request; it simulates the work of a real server
+constexpr std::chrono::microseconds PROCESSING_TIME{10};
+constexpr std::chrono::seconds MEASUREMENT_DURATION{1};
+constexpr std::chrono::seconds CONNECTION_TIMEOUT{10};
+
+void busyWait(const std::chrono::microseconds duration)
+{
+    const auto start = std::chrono::steady_clock::now();
+    while (std::chrono::steady_clock::now() - start < duration)
+    {
+    }
+}
+
+/// @brief measures how many requests per second a ServerWorkerPool processes when its request queue is kept filled
+/// by multiple clients
+double measureRequestsPerSecond(const uint64_t numberOfWorkerThreads, const uint64_t inFlightRequestsPerWorker)
+{
+    const capro::ServiceDescription service{
+        "Benchmark",
+        "ServerWorkerPool",
+        capro::IdString_t(
+            TruncateToCapacity,
+            (std::to_string(numberOfWorkerThreads) + "-" + std::to_string(inFlightRequestsPerWorker)).c_str())};
+
+    popo::ServerWorkerPoolOptions options;
+    options.numberOfWorkerThreads = numberOfWorkerThreads;
+    options.inFlightRequestsPerWorker = inFlightRequestsPerWorker;
+    popo::ServerWorkerPool<uint64_t, uint64_t> serverWorkerPool{
+        service,
+        [](const uint64_t& request, uint64_t& response) {
+            busyWait(PROCESSING_TIME);
+            response = request;
+        },
+        options};
+
+    std::atomic<uint64_t> numberOfConnectedClients{0U};
+    std::atomic_bool isMeasurementRunning{true};
+    std::atomic<uint64_t> numberOfResponses{0U};
+    std::vector<std::thread> clients;
+    for (uint64_t i = 0U; i < NUMBER_OF_CLIENTS; ++i)
+    {
+        clients.emplace_back([&] {
+            popo::Client<uint64_t, uint64_t> client{service};
+            const auto start = std::chrono::steady_clock::now();
+            while (client.getConnectionState() != ConnectionState::CONNECTED)
+            {
+                if (std::chrono::steady_clock::now() - start > CONNECTION_TIMEOUT)
+                {
+                    IOX_LOG(ERROR) << "Client is not connected after " << CONNECTION_TIMEOUT.count() << "s";
+                    break;
+                }
+                std::this_thread::yield();
+            }
+            ++numberOfConnectedClients;
+            while (numberOfConnectedClients.load() < NUMBER_OF_CLIENTS)
+            {
+                std::this_thread::yield();
+            }
+
+            uint64_t requestsInFlight{0U};
+            uint64_t responses{0U};
+            while (isMeasurementRunning.load(std::memory_order_relaxed))
+            {
+                while (requestsInFlight < REQUESTS_IN_FLIGHT_PER_CLIENT)
+                {
+                    auto loanResult = client.loan();
+                    if (loanResult.has_error() || loanResult.value().send().has_error())
+                    {
+                        break;
+                    }
+                    ++requestsInFlight;
+                }
+                bool hasResponses{false};
+                while (!client.take().has_error())
+                {
+                    --requestsInFlight;
+                    ++responses;
+                    hasResponses = true;
+                }
+                // leave the CPU to the workers while the responses are pending
+                if (!hasResponses)
+                {
+                    std::this_thread::yield();
+                }
+            }
+            numberOfResponses += responses;
+        });
+    }
+
+    while (numberOfConnectedClients.load() < NUMBER_OF_CLIENTS)
+    {
+        std::this_thread::yield();
+    }
+    const auto start = std::chrono::steady_clock::now();
+    std::this_thread::sleep_for(MEASUREMENT_DURATION);
+    isMeasurementRunning = false;
+    const auto stop = std::chrono::steady_clock::now();
+
+    for (auto& client : clients)
+    {
+        client.join();
+    }
+
+    return static_cast<double>(numberOfResponses.load())
+           / std::chrono::duration_cast<std::chrono::duration<double>>(stop - start).count();
+}
+
+int main()
+{
+    RouDiConfig_t roudiConfig = RouDiConfig_t().setDefaults();
+    std::unique_ptr<roudi::IceOryxRouDiComponents> roudiComponents{new roudi::IceOryxRouDiComponents(roudiConfig)};
+    std::unique_ptr<roudi::RouDi> roudi{
+        new roudi::RouDi(roudiComponents->rouDiMemoryManager,
+                         roudiComponents->portManager,
+                         roudi::RouDi::RoudiStartupParameters{roudi::MonitoringMode::OFF, false})};
+    runtime::PoshRuntimeSingleProcess runtime("iox-bm-server-worker-pool");
+
+    for (uint64_t workers = 1U; workers <= MAX_REQUESTS_PROCESSED_SIMULTANEOUSLY; workers *= 2U)
+    {
+        benchmark::printResult(
+            "workers (1 in-flight per worker)", workers, measureRequestsPerSecond(workers, 1U), "requests/s");
+        const uint64_t maxInFlightRequestsPerWorker = MAX_REQUESTS_PROCESSED_SIMULTANEOUSLY / workers;
+        benchmark::printResult("workers (max in-flight per worker)",
+                               workers,
+                               measureRequestsPerSecond(workers, maxInFlightRequestsPerWorker),
+                               "requests/s");
+    }
+
+    return 0;
+}
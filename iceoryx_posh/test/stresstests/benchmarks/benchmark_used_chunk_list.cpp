@@ -0,0 +1,84 @@
+// Copyright (c) 2026 by agent <agent@local>. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
+#include "iceoryx_posh/internal/popo/used_chunk_list.hpp"
+#include "iceoryx_posh/mepoo/mepoo_config.hpp"
+#include "iox/bump_allocator.hpp"
+#include "iox/vector.hpp"
+
+#include "benchmark.hpp"
+
+#include <cstdlib>
+#include <memory>
+
+using namespace iox;
+
+constexpr uint64_t NUMBER_OF_ITERATIONS{1000000U};
+constexpr uint32_t USED_CHUNK_LIST_CAPACITY{MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY + 1U};
+constexpr uint32_t CHUNK_PAYLOAD_SIZE{64U};
+
+/// @brief measures the latency to release the oldest held chunk and to hold it again, like a subscriber which releases
+/// its samples in the order of reception; this is the worst case for a search from the most recently inserted chunk
+double measureReleaseLatency(const uint32_t numberOfHeldChunks)
+{
+    mepoo::MePooConfig config;
+    config.addMemPool({CHUNK_PAYLOAD_SIZE, USED_CHUNK_LIST_CAPACITY});
+
+    const uint64_t memorySize = mepoo::MemoryManager::requiredFullMemorySize(config);
+    std::unique_ptr<void, decltype(&std::free)> memory{std::malloc(memorySize), &std::free};
+    BumpAllocator allocator{memory.get(), memorySize};
+    mepoo::MemoryManager memoryManager;
+    memoryManager.configureMemoryManager(config, allocator, allocator);
+
+    const auto chunkSettings =
+        mepoo::ChunkSettings::create(CHUNK_PAYLOAD_SIZE, CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT).expect("valid settings");
+
+    popo::UsedChunkList<USED_CHUNK_LIST_CAPACITY> sut;
+    vector<mepoo::ChunkHeader*, USED_CHUNK_LIST_CAPACITY> heldChunkHeaders;
+    for (uint32_t i = 0U; i < numberOfHeldChunks; ++i)
+    {
+        auto chunk = memoryManager.getChunk(chunkSettings).expect("chunk available");
+        heldChunkHeaders.emplace_back(chunk.getChunkHeader());
+        sut.insert(chunk);
+    }
+
+    uint32_t oldest{0U};
+    mepoo::SharedChunk chunk;
+    auto latency = benchmark::meanLatencyInNanoseconds(
+        [&] {
+            sut.remove(heldChunkHeaders[oldest], chunk);
+            sut.insert(chunk);
+            oldest = (oldest + 1U) % numberOfHeldChunks;
+        },
+        NUMBER_OF_ITERATIONS);
+
+    sut.cleanup();
+    return latency;
+}
+
+int main()
+{
+    for (uint32_t numberOfHeldChunks = 1U; numberOfHeldChunks <= MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY;
+         numberOfHeldChunks *= 2U)
+    {
+        benchmark::printResult("UsedChunkList::remove + insert", numberOfHeldChunks,
+                               measureReleaseLatency(numberOfHeldChunks), "ns");
+    }
+
+    return 0;
+}
@@ -39,7 +39,8 @@ class RouDiEnvironment
   public:
     RouDiEnvironment(const RouDiConfig_t& roudiConfig = RouDiConfig_t().setDefaults(),
                      roudi::MonitoringMode monitoringMode = roudi::MonitoringMode::OFF,
-                     const uint16_t uniqueRouDiId = 0u);
+                     const uint16_t uniqueRouDiId = 0u,
+                     const runtime::IpcProtocol ipcProtocol = runtime::IpcProtocol::BINARY);
     virtual ~RouDiEnvironment();
 
     RouDiEnvironment(RouDiEnvironment&& rhs) = default;
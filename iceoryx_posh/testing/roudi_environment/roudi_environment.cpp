@@ -35,13 +35,20 @@ RouDiEnvironment::RouDiEnvironment(BaseCTor, const uint16_t uniqueRouDiId)
 
 RouDiEnvironment::RouDiEnvironment(const RouDiConfig_t& roudiConfig,
                                    const roudi::MonitoringMode monitoringMode,
-                                   const uint16_t uniqueRouDiId)
+                                   const uint16_t uniqueRouDiId,
+                                   const runtime::IpcProtocol ipcProtocol)
     : RouDiEnvironment(BaseCTor::BASE, uniqueRouDiId)
 {
     m_roudiComponents = std::unique_ptr<IceOryxRouDiComponents>(new IceOryxRouDiComponents(roudiConfig));
-    m_roudiApp = std::unique_ptr<RouDi>(new RouDi(m_roudiComponents->rouDiMemoryManager,
-                                                  m_roudiComponents->portManager,
-                                                  RouDi::RoudiStartupParameters{monitoringMode, false}));
+    m_roudiApp = std::unique_ptr<RouDi>(
+        new RouDi(m_roudiComponents->rouDiMemoryManager,
+                  m_roudiComponents->portManager,
+                  RouDi::RoudiStartupParameters{monitoringMode,
+                                                false,
+                                                RouDi::RuntimeMessagesThreadStart::IMMEDIATE,
+                                                version::CompatibilityCheckLevel::PATCH,
+                                                roudi::PROCESS_DEFAULT_KILL_DELAY,
+                                                ipcProtocol}));
 }
 
 RouDiEnvironment::~RouDiEnvironment()
@@ -277,14 +277,16 @@ void IntrospectionApp::printMemPoolInfo(const MemPoolIntrospectionInfo& introspe
     constexpr int32_t minFreechunksWidth{9};
     constexpr int32_t chunkSizeWidth{11};
     constexpr int32_t chunkPayloadSizeWidth{13};
+    constexpr int32_t spilledChunksWidth{9};
 
     wprintw(pad, "%*s |", memPoolWidth, "MemPool");
     wprintw(pad, "%*s |", usedchunksWidth, "Chunks In Use");
     wprintw(pad, "%*s |", numchunksWidth, "Total");
     wprintw(pad, "%*s |", minFreechunksWidth, "Min Free");
     wprintw(pad, "%*s |", chunkSizeWidth, "Chunk Size");
-    wprintw(pad, "%*s\n", chunkPayloadSizeWidth, "Chunk Payload Size");
-    wprintw(pad, "--------------------------------------------------------------------------------\n");
+    wprintw(pad, "%*s |", chunkPayloadSizeWidth, "Chunk Payload Size");
+    wprintw(pad, "%*s\n", spilledChunksWidth, "Spilled");
+    wprintw(pad, "-------------------------------------------------------------------------------------------\n");
 
     for (size_t i = 0u; i < introspectionInfo.m_mempoolInfo.size(); ++i)
     {
@@ -296,7 +298,8 @@ void IntrospectionApp::printMemPoolInfo(const MemPoolIntrospectionInfo& introspe
             wprintw(pad, "%*d |", numchunksWidth, info.m_numChunks);
             wprintw(pad, "%*d |", minFreechunksWidth, info.m_minFreeChunks);
             wprintw(pad, "%*d |", chunkSizeWidth, info.m_chunkSize);
-            wprintw(pad, "%*d\n", chunkPayloadSizeWidth, info.m_chunkPayloadSize);
+            wprintw(pad, "%*d |", chunkPayloadSizeWidth, info.m_chunkPayloadSize);
+            wprintw(pad, "%*d\n", spilledChunksWidth, info.m_spilledChunks);
         }
     }
     wprintw(pad, "\n");
@@ -310,14 +313,14 @@ void IntrospectionApp::printPortIntrospectionData(const std::vector<ComposedPubl
     constexpr int32_t eventWidth{21};
     constexpr int32_t runtimeNameWidth{23};
     constexpr int32_t nodeNameWidth{23};
-    // uncomment once this information is needed
-    // constexpr int32_t sampleSizeWidth{12};
-    // constexpr int32_t chunkSizeWidth{12};
-    // constexpr int32_t chunksWidth{12};
-    // constexpr int32_t intervalWidth{19};
+    constexpr int32_t sampleSizeWidth{12};
+    constexpr int32_t chunkSizeWidth{12};
+    constexpr int32_t chunksWidth{12};
+    constexpr int32_t intervalWidth{19};
     constexpr int32_t subscriptionStateWidth{14};
     // constexpr int32_t fifoWidth{17};    // uncomment once this information is needed
     constexpr int32_t scopeWidth{12};
+    constexpr int32_t latencyWidth{22};
     constexpr int32_t interfaceSourceWidth{8};
 
     prettyPrint("Publisher Ports\n", PrettyOptions::bold);
@@ -327,11 +330,10 @@ void IntrospectionApp::printPortIntrospectionData(const std::vector<ComposedPubl
     wprintw(pad, " %*s |", eventWidth, "Event");
     wprintw(pad, " %*s |", runtimeNameWidth, "Process");
     wprintw(pad, " %*s |", nodeNameWidth, "Node");
-    // uncomment once this information is needed
-    // wprintw(pad, " %*s |", sampleSizeWidth, "Sample Size");
-    // wprintw(pad, " %*s |", chunkSizeWidth, "Chunk Size");
-    // wprintw(pad, " %*s |", chunksWidth, "Chunks");
-    // wprintw(pad, " %*s |", intervalWidth, "Last Send Interval");
+    wprintw(pad, " %*s |", sampleSizeWidth, "Sample Size");
+    wprintw(pad, " %*s |", chunkSizeWidth, "Chunk Size");
+    wprintw(pad, " %*s |", chunksWidth, "Chunks");
+    wprintw(pad, " %*s |", intervalWidth, "Last Send Interval");
     wprintw(pad, " %*s\n", interfaceSourceWidth, "Src. Itf.");
 
     wprintw(pad, " %*s |", serviceWidth, "");
@@ -339,15 +341,15 @@ void IntrospectionApp::printPortIntrospectionData(const std::vector<ComposedPubl
     wprintw(pad, " %*s |", eventWidth, "");
     wprintw(pad, " %*s |", runtimeNameWidth, "");
     wprintw(pad, " %*s |", nodeNameWidth, "");
-    // uncomment once this information is needed
-    // wprintw(pad, " %*s |", sampleSizeWidth, "[Byte]");
-    // wprintw(pad, " %*s |", chunkSizeWidth, "[Byte]");
-    // wprintw(pad, " %*s |", chunksWidth, "[/Minute]");
-    // wprintw(pad, " %*s |", intervalWidth, "[Milliseconds]");
+    wprintw(pad, " %*s |", sampleSizeWidth, "[Byte]");
+    wprintw(pad, " %*s |", chunkSizeWidth, "[Byte]");
+    wprintw(pad, " %*s |", chunksWidth, "[/Minute]");
+    wprintw(pad, " %*s |", intervalWidth, "[Milliseconds]");
     wprintw(pad, " %*s\n", interfaceSourceWidth, "");
 
     wprintw(pad, "---------------------------------------------------------------------------------------------------");
-    wprintw(pad, "--------------------------------\n");
+    wprintw(pad, "-------------------------------------------------------------------------------------------------");
+    wprintw(pad, "--\n");
 
     bool needsLineBreak{false};
     uint32_t currentLine{0U};
@@ -384,11 +386,13 @@ void IntrospectionApp::printPortIntrospectionData(const std::vector<ComposedPubl
 
     for (auto& publisherPort : publisherPortData)
     {
-        // uncomment once this information is needed
-        // std::string m_sampleSize{"n/a"};
-        // std::string m_chunkSize{"n/a"};
-        // std::string m_chunksPerMinute{"n/a"};
-        // std::string sendInterval{"n/a"};
+        constexpr uint64_t NANOSECONDS_PER_MILLISECOND{1000000U};
+        const auto& throughput = *publisherPort.throughputData;
+        const std::string sampleSize{std::to_string(throughput.m_sampleSize)};
+        const std::string chunkSize{std::to_string(throughput.m_chunkSize)};
+        const std::string chunksPerMinute{std::to_string(static_cast<uint64_t>(throughput.m_chunksPerMinute))};
+        const std::string sendInterval{
+            std::to_string(throughput.m_lastSendIntervalInNanoseconds / NANOSECONDS_PER_MILLISECOND)};
 
         currentLine = 0;
         do
@@ -411,11 +415,10 @@ void IntrospectionApp::printPortIntrospectionData(const std::vector<ComposedPubl
             wprintw(pad,
                     " %s |",
                     printEntry(nodeNameWidth, iox::into<std::string>(publisherPort.portData->m_node)).c_str());
-            // uncomment once this information is needed
-            // wprintw(pad, " %s |", printEntry(sampleSizeWidth, m_sampleSize).c_str());
-            // wprintw(pad, " %s |", printEntry(chunkSizeWidth, m_chunkSize).c_str());
-            // wprintw(pad, " %s |", printEntry(chunksWidth, m_chunksPerMinute).c_str());
-            // wprintw(pad, " %s |", printEntry(intervalWidth, sendInterval).c_str());
+            wprintw(pad, " %s |", printEntry(sampleSizeWidth, sampleSize).c_str());
+            wprintw(pad, " %s |", printEntry(chunkSizeWidth, chunkSize).c_str());
+            wprintw(pad, " %s |", printEntry(chunksWidth, chunksPerMinute).c_str());
+            wprintw(pad, " %s |", printEntry(intervalWidth, sendInterval).c_str());
             wprintw(
                 pad,
                 " %s\n",
@@ -439,6 +442,7 @@ void IntrospectionApp::printPortIntrospectionData(const std::vector<ComposedPubl
     wprintw(pad, " %*s |", nodeNameWidth, "Node");
     wprintw(pad, " %*s |", subscriptionStateWidth, "Subscription");
     // wprintw(pad, " %*s |", fifoWidth, "FiFo"); // uncomment once this information is needed
+    wprintw(pad, " %*s |", latencyWidth, "Latency [Microseconds]");
     wprintw(pad, " %*s\n", scopeWidth, "Propagation");
 
     wprintw(pad, " %*s |", serviceWidth, "");
@@ -448,10 +452,11 @@ void IntrospectionApp::printPortIntrospectionData(const std::vector<ComposedPubl
     wprintw(pad, " %*s |", nodeNameWidth, "");
     wprintw(pad, " %*s |", subscriptionStateWidth, "State");
     // wprintw(pad, " %*s |", fifoWidth, "size / capacity"); // uncomment once this information is needed
+    wprintw(pad, " %*s |", latencyWidth, "p50 / p99 / p99.9");
     wprintw(pad, " %*s\n", scopeWidth, "scope");
 
     wprintw(pad, "---------------------------------------------------------------------------------------------------");
-    wprintw(pad, "---------------------------------------------------\n");
+    wprintw(pad, "----------------------------------------------------------------------------\n");
 
     auto subscriptionStateToString = [](iox::SubscribeState subState) -> std::string {
         switch (subState)
@@ -473,6 +478,15 @@ void IntrospectionApp::printPortIntrospectionData(const std::vector<ComposedPubl
 
     for (auto& subscriber : subscriberPortData)
     {
+        constexpr uint64_t NANOSECONDS_PER_MICROSECOND{1000U};
+        const auto& changingData = *subscriber.subscriberPortChangingData;
+        const std::string latency{
+            (changingData.latencySamples == 0U)
+                ? std::string("n/a")
+                : std::to_string(changingData.latencyP50InNanoseconds / NANOSECONDS_PER_MICROSECOND) + " / "
+                      + std::to_string(changingData.latencyP99InNanoseconds / NANOSECONDS_PER_MICROSECOND) + " / "
+                      + std::to_string(changingData.latencyP999InNanoseconds / NANOSECONDS_PER_MICROSECOND)};
+
         currentLine = 0;
         do
         {
@@ -510,6 +524,7 @@ void IntrospectionApp::printPortIntrospectionData(const std::vector<ComposedPubl
             //{
             // wprintw(pad, " %*s |", fifoWidth, "");
             //}
+            wprintw(pad, " %s |", printEntry(latencyWidth, latency).c_str());
             wprintw(pad,
                     " %s\n",
                     printEntry(scopeWidth,
@@ -527,6 +542,7 @@ void IntrospectionApp::printPortIntrospectionData(const std::vector<ComposedPubl
         wprintw(pad, " %*s |", nodeNameWidth, "");
         wprintw(pad, " %*s |", subscriptionStateWidth, "");
         // wprintw(pad, " %*s |", fifoWidth, ""); // uncomment once this information is needed
+        wprintw(pad, " %*s |", latencyWidth, "");
         wprintw(pad, " %*s", scopeWidth, "");
         wprintw(pad, "\n");
     }